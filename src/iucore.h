@@ -26,6 +26,9 @@
 
 #include "iudefs.h"
 #include "iucontainers.h"
+#include "iucore/executor.h"
+#include "iucore/cpudispatch.h"
+#include "iucore/trace.h"
 
 namespace iu {
 
@@ -278,7 +281,9 @@ IUCORE_DLLAPI void setValue(const float& value, LinearDeviceMemory_32f_C1* srcds
  * \ingroup Set2D
  * \param value The pixel value to be set.
  * \param image Pointer to the image.
- * \param roi Region of interest which should be set.
+ * \param roi Region of interest which should be set: the pixels [roi.x, roi.x+roi.width) x
+ *            [roi.y, roi.y+roi.height), clipped to the image. Host and device agree on this
+ *            (the host version used to treat roi.width/roi.height as end coordinates).
  */
 // host:
 IUCORE_DLLAPI void setValue(const unsigned char& value, ImageCpu_8u_C1* srcdst, const IuRect& roi);
@@ -316,7 +321,8 @@ IUCORE_DLLAPI void setValue(const float4& value, ImageGpu_32f_C4* srcdst, const
  * \ingroup Set3D
  * \param value The pixel value to be set.
  * \param image Pointer to the image.
- * \param roi Region of interest which should be set.
+ * \param roi Region of interest which should be set: the voxels [roi.x, roi.x+roi.width) x
+ *            [roi.y, roi.y+roi.height) x [roi.z, roi.z+roi.depth), clipped to the volume.
  */
 // host:
 IUCORE_DLLAPI void setValue(const unsigned char& value, VolumeCpu_8u_C1* srcdst, const IuCube& roi);
@@ -375,6 +381,26 @@ IUCORE_DLLAPI void convert(const ImageGpu_32f_C3* src, const IuRect& src_roi, Im
  */
 IUCORE_DLLAPI void convert(const ImageGpu_32f_C4* src, const IuRect& src_roi, ImageGpu_32f_C3* dst, const IuRect& dst_roi);
 
+/** Converts an interleaved 32-bit image to a planar image (one plane per channel).
+ * Converting a 4-channel image to a 3-channel planar image drops the alpha channel.
+ * \param src Interleaved source image [host].
+ * \param dst Planar destination image [host]. Must have the same size as \a src
+ *            (otherwise an IuException is thrown).
+ */
+IUCORE_DLLAPI void convert(const ImageCpu_32f_C3* src, ImagePlanarCpu_32f_C3* dst);
+IUCORE_DLLAPI void convert(const ImageCpu_32f_C4* src, ImagePlanarCpu_32f_C3* dst);
+IUCORE_DLLAPI void convert(const ImageCpu_32f_C4* src, ImagePlanarCpu_32f_C4* dst);
+
+/** Converts a planar 32-bit image back to an interleaved image.
+ * Converting a 3-channel planar image to a 4-channel image sets alpha to 1.0.
+ * \param src Planar source image [host].
+ * \param dst Interleaved destination image [host]. Must have the same size as \a src
+ *            (otherwise an IuException is thrown).
+ */
+IUCORE_DLLAPI void convert(const ImagePlanarCpu_32f_C3* src, ImageCpu_32f_C3* dst);
+IUCORE_DLLAPI void convert(const ImagePlanarCpu_32f_C3* src, ImageCpu_32f_C4* dst);
+IUCORE_DLLAPI void convert(const ImagePlanarCpu_32f_C4* src, ImageCpu_32f_C4* dst);
+
 /** Converts an 32-bit single-channel image to a 8-bit single-channel image.
  * \params src 1-channel source image [host].
  * \params dst 1-channel destination image [host].
@@ -421,6 +447,26 @@ IUCORE_DLLAPI void convert_8u32f_C1(const iu::ImageGpu_8u_C1* src, const IuRect&
 IUCORE_DLLAPI void convert_16u32f_C1(const iu::ImageCpu_16u_C1* src, iu::ImageCpu_32f_C1 *dst,
                                  float mul_constant, float add_constant);
 
+/** Copies a column-major matrix (e.g. MATLAB data; element (x,y) at src[y + x*height])
+ * into the upper left width x height pixels of a host image, converting the element
+ * type. The transposition is cache blocked and runs on all threads.
+ * \params src Column-major source buffer of width*height elements.
+ * \params width Number of columns of the source (image width).
+ * \params height Number of rows of the source (image height).
+ * \params dst Destination image [host]; at least width x height pixels.
+ */
+IUCORE_DLLAPI void copyFromColumnMajor(const double* src, unsigned int width, unsigned int height, iu::ImageCpu_32f_C1* dst);
+IUCORE_DLLAPI void copyFromColumnMajor(const float* src, unsigned int width, unsigned int height, iu::ImageCpu_32f_C1* dst);
+IUCORE_DLLAPI void copyFromColumnMajor(const int* src, unsigned int width, unsigned int height, iu::ImageCpu_32s_C1* dst);
+
+/** Copies the upper left width x height pixels of a host image into a column-major
+ * matrix (inverse of copyFromColumnMajor).
+ */
+IUCORE_DLLAPI void copyToColumnMajor(const iu::ImageCpu_32f_C1* src, double* dst, unsigned int width, unsigned int height);
+IUCORE_DLLAPI void copyToColumnMajor(const iu::ImageCpu_32f_C1* src, float* dst, unsigned int width, unsigned int height);
+IUCORE_DLLAPI void copyToColumnMajor(const iu::ImageCpu_32s_C1* src, int* dst, unsigned int width, unsigned int height);
+IUCORE_DLLAPI void copyToColumnMajor(const iu::ImageCpu_8u_C1* src, unsigned char* dst, unsigned int width, unsigned int height);
+
 
 /** Converts an RGB image to a HSV image.
  * \params src 4-channel source image [device].
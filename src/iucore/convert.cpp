@@ -22,7 +22,9 @@
  */
 
 #include <cstring>
+#include <algorithm>
 #include "convert.h"
+#include "cpukernels.h"
 
 
 namespace iuprivate {
@@ -53,34 +55,353 @@ extern IuStatus cuConvert_hsv_to_rgb(const iu::ImageGpu_32f_C4* src, iu::ImageGp
  *  FUNCTION IMPLEMENTATIONS
  * ***************************************************************************/
 
+//-----------------------------------------------------------------------------
+// [host] row body for the bit depth conversions; dst = mul_constant*src + add_constant
+template<typename SrcType, typename DstType>
+struct ConvertScaleRows
+{
+  typedef void (*RowKernel)(const SrcType*, DstType*, int, float, float);
+
+  const SrcType* src;
+  size_t src_stride;
+  DstType* dst;
+  size_t dst_stride;
+  int width;
+  float mul_constant;
+  float add_constant;
+  RowKernel row;
+
+  void operator()(int begin, int end) const
+  {
+    for(int y=begin; y<end; ++y)
+      row(src + y*src_stride, dst + y*dst_stride, width, mul_constant, add_constant);
+  }
+};
+
+template<typename SrcType, typename DstType>
+static void convertScale(const SrcType* src, size_t src_stride, DstType* dst, size_t dst_stride,
+                         const IuSize& size, float mul_constant, float add_constant,
+                         typename ConvertScaleRows<SrcType, DstType>::RowKernel row)
+{
+  ConvertScaleRows<SrcType, DstType> body;
+  body.src = src;
+  body.src_stride = src_stride;
+  body.dst = dst;
+  body.dst_stride = dst_stride;
+  body.width = size.width;
+  body.mul_constant = mul_constant;
+  body.add_constant = add_constant;
+  body.row = row;
+  iu::parallelFor(0, size.height, body, iu::Executor::rowGrain(size.width));
+}
+
 //-----------------------------------------------------------------------------
 // [host] 2D bit depth conversion; 32f_C1 -> 8u_C1;
 void convert_32f8u_C1(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_8u_C1 *dst,
                       float mul_constant, float add_constant)
 {
-  for (unsigned int x=0; x<dst->width(); x++)
+  convertScale(src->data(), src->stride(), dst->data(), dst->stride(), dst->size(),
+               mul_constant, add_constant, cpuKernels().convertRow_32f8u);
+}
+
+//-----------------------------------------------------------------------------
+// [host] 2D bit depth conversion; 16u_C1 -> 32f_C1;
+void convert_16u32f_C1(const iu::ImageCpu_16u_C1* src, iu::ImageCpu_32f_C1 *dst,
+                       float mul_constant, float add_constant)
+{
+  convertScale(src->data(), src->stride(), dst->data(), dst->stride(), dst->size(),
+               mul_constant, add_constant, cpuKernels().convertRow_16u32f);
+}
+
+//-----------------------------------------------------------------------------
+/* [host] blocked transposition. Every task owns a band of TRANSPOSE_TILE destination
+ * rows (source columns) and walks it in square tiles, so that the writes stay
+ * contiguous and the strided source lines of a tile are still cached when the next
+ * destination row reads them. The block kernels handle all planes of an element at
+ * once, so interleaved pixels are written in one pass.
+ */
+enum { TRANSPOSE_TILE = 256 };
+
+template<typename SrcType, typename DstType>
+struct TransposeBands
+{
+  typedef void (*BlockKernel)(const SrcType*, size_t, int, size_t, DstType*, size_t, int, size_t,
+                              int, int, int);
+
+  const SrcType* src;
+  size_t src_stride;
+  int src_step;
+  DstType* dst;
+  size_t dst_stride;
+  int dst_step;
+  int rows;
+  int cols;
+  int planes;
+  size_t src_plane_step;
+  size_t dst_plane_step;
+  int tile;
+  BlockKernel block;
+
+  void operator()(int begin, int end) const
   {
-    for (unsigned int y=0; y<dst->height(); y++)
+    for(int band=begin; band<end; ++band)
     {
-      float val = *src->data(x,y);
-      *dst->data(x,y) = mul_constant*val + add_constant;
+      const int c = band*tile;
+      const int n_c = std::min(tile, cols - c);
+      for(int r=0; r<rows; r+=tile)
+        block(src + r*src_stride + (size_t)c*src_step, src_stride, src_step, src_plane_step,
+              dst + c*dst_stride + (size_t)r*dst_step, dst_stride, dst_step, dst_plane_step,
+              planes, std::min(tile, rows - r), n_c);
     }
   }
+};
+
+template<typename SrcType, typename DstType>
+static void transposeBands(const SrcType* src, size_t src_stride, int src_step,
+                           DstType* dst, size_t dst_stride, int dst_step, int rows, int cols,
+                           int planes, size_t src_plane_step, size_t dst_plane_step,
+                           typename TransposeBands<SrcType, DstType>::BlockKernel block)
+{
+  if(rows <= 0 || cols <= 0 || planes <= 0)
+    return;
+  TransposeBands<SrcType, DstType> body;
+  body.src = src;
+  body.src_stride = src_stride;
+  body.src_step = src_step;
+  body.dst = dst;
+  body.dst_stride = dst_stride;
+  body.dst_step = dst_step;
+  body.rows = rows;
+  body.cols = cols;
+  body.planes = planes;
+  body.src_plane_step = src_plane_step;
+  body.dst_plane_step = dst_plane_step;
+  // smaller tiles when several planes are read per element
+  body.tile = (planes > 1) ? TRANSPOSE_TILE/2 : TRANSPOSE_TILE;
+  body.block = block;
+  const int bands = (cols + body.tile-1) / body.tile;
+  iu::parallelFor(0, bands, body, iu::Executor::rowGrain(body.tile*(unsigned int)(rows*planes)));
+}
+
+void transposeConvert(const double* src, size_t src_stride, int src_step,
+                      float* dst, size_t dst_stride, int dst_step, int rows, int cols,
+                      int planes, size_t src_plane_step, size_t dst_plane_step)
+{
+  transposeBands(src, src_stride, src_step, dst, dst_stride, dst_step, rows, cols,
+                 planes, src_plane_step, dst_plane_step,
+                 cpuKernels().transposeBlock_64f32f);
+}
+
+void transposeConvert(const float* src, size_t src_stride, int src_step,
+                      float* dst, size_t dst_stride, int dst_step, int rows, int cols,
+                      int planes, size_t src_plane_step, size_t dst_plane_step)
+{
+  transposeBands(src, src_stride, src_step, dst, dst_stride, dst_step, rows, cols,
+                 planes, src_plane_step, dst_plane_step,
+                 cpuKernels().transposeBlock_32f32f);
+}
+
+void transposeConvert(const int* src, size_t src_stride, int src_step,
+                      int* dst, size_t dst_stride, int dst_step, int rows, int cols,
+                      int planes, size_t src_plane_step, size_t dst_plane_step)
+{
+  transposeBands(src, src_stride, src_step, dst, dst_stride, dst_step, rows, cols,
+                 planes, src_plane_step, dst_plane_step,
+                 cpuKernels().transposeBlock_32s32s);
+}
+
+void transposeConvert(const float* src, size_t src_stride, int src_step,
+                      double* dst, size_t dst_stride, int dst_step, int rows, int cols,
+                      int planes, size_t src_plane_step, size_t dst_plane_step)
+{
+  transposeBands(src, src_stride, src_step, dst, dst_stride, dst_step, rows, cols,
+                 planes, src_plane_step, dst_plane_step,
+                 cpuKernels().transposeBlock_32f64f);
+}
+
+void transposeConvert(const unsigned char* src, size_t src_stride, int src_step,
+                      unsigned char* dst, size_t dst_stride, int dst_step, int rows, int cols,
+                      int planes, size_t src_plane_step, size_t dst_plane_step)
+{
+  transposeBands(src, src_stride, src_step, dst, dst_stride, dst_step, rows, cols,
+                 planes, src_plane_step, dst_plane_step,
+                 cpuKernels().transposeBlock_8u8u);
 }
 
 //-----------------------------------------------------------------------------
-// [host] 2D bit depth conversion; 16u_C1 -> 32f_C1;
-void convert_16u32f_C1(const iu::ImageCpu_16u_C1* src, iu::ImageCpu_32f_C1 *dst,
-                       float mul_constant, float add_constant)
+// [host] column-major <-> image; the source columns (x) are the rows of the transposition
+template<typename SrcType, class Image>
+static void copyFromColumnMajorImpl(const SrcType* src, unsigned int width, unsigned int height, Image* dst)
+{
+  if(src == 0 || width > dst->width() || height > dst->height())
+    throw IuException("memory dimensions mismatch", __FILE__, __FUNCTION__, __LINE__);
+  transposeConvert(src, height, 1, dst->data(), dst->stride(), 1, width, height);
+}
+
+template<class Image, typename DstType>
+static void copyToColumnMajorImpl(const Image* src, DstType* dst, unsigned int width, unsigned int height)
+{
+  if(dst == 0 || width > src->width() || height > src->height())
+    throw IuException("memory dimensions mismatch", __FILE__, __FUNCTION__, __LINE__);
+  transposeConvert(src->data(), src->stride(), 1, dst, height, 1, height, width);
+}
+
+void copyFromColumnMajor(const double* src, unsigned int width, unsigned int height, iu::ImageCpu_32f_C1* dst)
+{
+  copyFromColumnMajorImpl(src, width, height, dst);
+}
+
+void copyFromColumnMajor(const float* src, unsigned int width, unsigned int height, iu::ImageCpu_32f_C1* dst)
 {
-  for (unsigned int x=0; x<dst->width(); x++)
+  copyFromColumnMajorImpl(src, width, height, dst);
+}
+
+void copyFromColumnMajor(const int* src, unsigned int width, unsigned int height, iu::ImageCpu_32s_C1* dst)
+{
+  copyFromColumnMajorImpl(src, width, height, dst);
+}
+
+void copyToColumnMajor(const iu::ImageCpu_32f_C1* src, double* dst, unsigned int width, unsigned int height)
+{
+  copyToColumnMajorImpl(src, dst, width, height);
+}
+
+void copyToColumnMajor(const iu::ImageCpu_32f_C1* src, float* dst, unsigned int width, unsigned int height)
+{
+  copyToColumnMajorImpl(src, dst, width, height);
+}
+
+void copyToColumnMajor(const iu::ImageCpu_32s_C1* src, int* dst, unsigned int width, unsigned int height)
+{
+  copyToColumnMajorImpl(src, dst, width, height);
+}
+
+void copyToColumnMajor(const iu::ImageCpu_8u_C1* src, unsigned char* dst, unsigned int width, unsigned int height)
+{
+  copyToColumnMajorImpl(src, dst, width, height);
+}
+
+//-----------------------------------------------------------------------------
+/* [host] interleaved -> planar. The first \a Planes of \a SrcChannels interleaved
+ * floats are split into the planes (a C4 source can be reduced to three planes).
+ * The channel counts are compile time constants so the compiler can turn the
+ * inner loop into shuffles.
+ */
+template<int SrcChannels, unsigned int Planes, IuPixelType PlanarType>
+struct ConvertToPlanarRows
+{
+  const float* src;
+  size_t src_stride;
+  iu::ImagePlanarCpu<Planes, PlanarType>* dst;
+
+  void operator()(int begin, int end) const
+  {
+    const int width = dst->width();
+    for(int y=begin; y<end; ++y)
+    {
+      const float* s = src + y*src_stride;
+      float* p[Planes];
+      for(unsigned int c=0; c<Planes; ++c)
+        p[c] = dst->plane(c, 0, y);
+      for(int x=0; x<width; ++x)
+        for(unsigned int c=0; c<Planes; ++c)
+          p[c][x] = s[x*SrcChannels + c];
+    }
+  }
+};
+
+template<int SrcChannels, unsigned int Planes, IuPixelType PlanarType>
+static void convertToPlanar(const float* src, size_t src_stride, const IuSize& src_size,
+                            iu::ImagePlanarCpu<Planes, PlanarType>* dst)
+{
+  if(src_size != dst->size())
+    throw IuException("memory dimensions mismatch", __FILE__, __FUNCTION__, __LINE__);
+  ConvertToPlanarRows<SrcChannels, Planes, PlanarType> body;
+  body.src = src;
+  body.src_stride = src_stride;
+  body.dst = dst;
+  iu::parallelFor(0, dst->height(), body, iu::Executor::rowGrain(Planes*dst->width()));
+}
+
+//-----------------------------------------------------------------------------
+/* [host] planar -> interleaved. Channels of the destination that have no plane
+ * (alpha of a C4 image written from three planes) are set to 1.
+ */
+template<int DstChannels, unsigned int Planes, IuPixelType PlanarType>
+struct ConvertFromPlanarRows
+{
+  const iu::ImagePlanarCpu<Planes, PlanarType>* src;
+  float* dst;
+  size_t dst_stride;
+
+  void operator()(int begin, int end) const
   {
-    for (unsigned int y=0; y<dst->height(); y++)
+    const int width = src->width();
+    for(int y=begin; y<end; ++y)
     {
-      unsigned short val = *src->data(x,y); //((*src->data(x,y) & 0x00ffU) << 8) | ((*src->data(x,y) & 0xff00U) >> 8);
-      *dst->data(x,y) = mul_constant*(float)val + add_constant;
+      float* d = dst + y*dst_stride;
+      const float* p[Planes];
+      for(unsigned int c=0; c<Planes; ++c)
+        p[c] = src->plane(c, 0, y);
+      for(int x=0; x<width; ++x)
+      {
+        for(unsigned int c=0; c<Planes; ++c)
+          d[x*DstChannels + c] = p[c][x];
+        for(int c=Planes; c<DstChannels; ++c)
+          d[x*DstChannels + c] = 1.0f;
+      }
     }
   }
+};
+
+template<int DstChannels, unsigned int Planes, IuPixelType PlanarType>
+static void convertFromPlanar(const iu::ImagePlanarCpu<Planes, PlanarType>* src,
+                              float* dst, size_t dst_stride, const IuSize& dst_size)
+{
+  if(src->size() != dst_size)
+    throw IuException("memory dimensions mismatch", __FILE__, __FUNCTION__, __LINE__);
+  ConvertFromPlanarRows<DstChannels, Planes, PlanarType> body;
+  body.src = src;
+  body.dst = dst;
+  body.dst_stride = dst_stride;
+  iu::parallelFor(0, src->height(), body, iu::Executor::rowGrain(DstChannels*src->width()));
+}
+
+//-----------------------------------------------------------------------------
+// [host] layout conversion 32f_C3 -> planar 32f_C3
+void convert(const iu::ImageCpu_32f_C3* src, iu::ImagePlanarCpu_32f_C3* dst)
+{
+  convertToPlanar<3>(reinterpret_cast<const float*>(src->data()), 3*src->stride(), src->size(), dst);
+}
+
+// [host] layout conversion 32f_C4 -> planar 32f_C3 (alpha is dropped)
+void convert(const iu::ImageCpu_32f_C4* src, iu::ImagePlanarCpu_32f_C3* dst)
+{
+  convertToPlanar<4>(reinterpret_cast<const float*>(src->data()), 4*src->stride(), src->size(), dst);
+}
+
+// [host] layout conversion 32f_C4 -> planar 32f_C4
+void convert(const iu::ImageCpu_32f_C4* src, iu::ImagePlanarCpu_32f_C4* dst)
+{
+  convertToPlanar<4>(reinterpret_cast<const float*>(src->data()), 4*src->stride(), src->size(), dst);
+}
+
+// [host] layout conversion planar 32f_C3 -> 32f_C3
+void convert(const iu::ImagePlanarCpu_32f_C3* src, iu::ImageCpu_32f_C3* dst)
+{
+  convertFromPlanar<3>(src, reinterpret_cast<float*>(dst->data()), 3*dst->stride(), dst->size());
+}
+
+// [host] layout conversion planar 32f_C3 -> 32f_C4 (alpha is set to 1)
+void convert(const iu::ImagePlanarCpu_32f_C3* src, iu::ImageCpu_32f_C4* dst)
+{
+  convertFromPlanar<4>(src, reinterpret_cast<float*>(dst->data()), 4*dst->stride(), dst->size());
+}
+
+// [host] layout conversion planar 32f_C4 -> 32f_C4
+void convert(const iu::ImagePlanarCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst)
+{
+  convertFromPlanar<4>(src, reinterpret_cast<float*>(dst->data()), 4*dst->stride(), dst->size());
 }
 
 //-----------------------------------------------------------------------------
@@ -47,6 +47,37 @@ void convert_32f8u_C1(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_8u_C1 *dst,
 void convert_16u32f_C1(const iu::ImageCpu_16u_C1* src, iu::ImageCpu_32f_C1 *dst,
                        float mul_constant, float add_constant);
 
+// [host] cache blocked transposition with type conversion of rows x cols source elements:
+// dst[c*dst_stride + r*dst_step] = src[r*src_stride + c*src_step] (in elements; a step
+// other than 1 addresses one channel of interleaved pixels). With \a planes > 1 the planes
+// k at src + k*src_plane_step are transposed to dst + k*dst_plane_step tile by tile
+// (planar <-> interleaved in one pass).
+void transposeConvert(const double* src, size_t src_stride, int src_step,
+                      float* dst, size_t dst_stride, int dst_step, int rows, int cols,
+                      int planes=1, size_t src_plane_step=0, size_t dst_plane_step=0);
+void transposeConvert(const float* src, size_t src_stride, int src_step,
+                      float* dst, size_t dst_stride, int dst_step, int rows, int cols,
+                      int planes=1, size_t src_plane_step=0, size_t dst_plane_step=0);
+void transposeConvert(const int* src, size_t src_stride, int src_step,
+                      int* dst, size_t dst_stride, int dst_step, int rows, int cols,
+                      int planes=1, size_t src_plane_step=0, size_t dst_plane_step=0);
+void transposeConvert(const float* src, size_t src_stride, int src_step,
+                      double* dst, size_t dst_stride, int dst_step, int rows, int cols,
+                      int planes=1, size_t src_plane_step=0, size_t dst_plane_step=0);
+void transposeConvert(const unsigned char* src, size_t src_stride, int src_step,
+                      unsigned char* dst, size_t dst_stride, int dst_step, int rows, int cols,
+                      int planes=1, size_t src_plane_step=0, size_t dst_plane_step=0);
+
+// [host] column-major width x height matrix (element (x,y) at src[y + x*height]) -> upper
+// left corner of a host image and back
+void copyFromColumnMajor(const double* src, unsigned int width, unsigned int height, iu::ImageCpu_32f_C1* dst);
+void copyFromColumnMajor(const float* src, unsigned int width, unsigned int height, iu::ImageCpu_32f_C1* dst);
+void copyFromColumnMajor(const int* src, unsigned int width, unsigned int height, iu::ImageCpu_32s_C1* dst);
+void copyToColumnMajor(const iu::ImageCpu_32f_C1* src, double* dst, unsigned int width, unsigned int height);
+void copyToColumnMajor(const iu::ImageCpu_32f_C1* src, float* dst, unsigned int width, unsigned int height);
+void copyToColumnMajor(const iu::ImageCpu_32s_C1* src, int* dst, unsigned int width, unsigned int height);
+void copyToColumnMajor(const iu::ImageCpu_8u_C1* src, unsigned char* dst, unsigned int width, unsigned int height);
+
  // [device] 2D bit depth conversion; 32f_C1 -> 8u_C1;
 void convert_32f8u_C1(const iu::ImageGpu_32f_C1* src, const IuRect& src_roi, iu::ImageGpu_8u_C1 *dst, const IuRect& dst_roi,
                       float mul_constant=255.0f, unsigned char add_constant=0);
@@ -66,6 +97,16 @@ void convert(const iu::ImageGpu_32f_C3* src, const IuRect& src_roi, iu::ImageGpu
 // 2D conversion; device; 32-bit 4-channel -> 32-bit 3-channel
 void convert(const iu::ImageGpu_32f_C4* src, const IuRect& src_roi, iu::ImageGpu_32f_C3* dst, const IuRect& dst_roi);
 
+// 2D layout conversion; host; interleaved (AoS) -> planar (SoA)
+void convert(const iu::ImageCpu_32f_C3* src, iu::ImagePlanarCpu_32f_C3* dst);
+void convert(const iu::ImageCpu_32f_C4* src, iu::ImagePlanarCpu_32f_C3* dst);
+void convert(const iu::ImageCpu_32f_C4* src, iu::ImagePlanarCpu_32f_C4* dst);
+
+// 2D layout conversion; host; planar (SoA) -> interleaved (AoS)
+void convert(const iu::ImagePlanarCpu_32f_C3* src, iu::ImageCpu_32f_C3* dst);
+void convert(const iu::ImagePlanarCpu_32f_C3* src, iu::ImageCpu_32f_C4* dst);
+void convert(const iu::ImagePlanarCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst);
+
 // [device] 2D Color conversion from RGB to HSV (32-bit 4-channel)
 void convertRgbHsv(const iu::ImageGpu_32f_C4* src, iu::ImageGpu_32f_C4* dst, bool normalize);
 
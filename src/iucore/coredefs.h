@@ -30,6 +30,13 @@
 #include <sstream>
 #include "globaldefs.h"
 
+/** Move constructors/assignments of the host containers are only compiled for
+ * C++11 compilers (the headers are also seen by nvcc).
+ */
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1600)
+  #define IU_HAS_MOVE_SEMANTICS
+#endif
+
  /** Basic assert macro
  * This macro should be used to enforce any kind of pre or post conditions.
  * Unlike the C assertion this assert also prints an error/warning as output in release mode.
@@ -127,7 +134,8 @@ typedef enum
   IU_32F_C1,
   IU_32F_C2,
   IU_32F_C3,
-  IU_32F_C4
+  IU_32F_C4,
+  IU_64F_C1
 } IuPixelType;
 
 typedef enum
@@ -152,7 +160,8 @@ typedef enum
 {
   COO = 0, // uncompressed sparse format
   CSR = 1, // compressed rows
-  CSC = 2  // compressed columns
+  CSC = 2, // compressed columns
+  SELL = 3 // sliced ELLPACK (SELL-C-sigma), host only
 } IuSparseFormat;
 
 /** Interpolation types. */
@@ -164,6 +173,40 @@ typedef enum
   IU_INTERPOLATE_CUBIC_SPLINE /**< cubic spline interpolation. */
 } IuInterpolationType;
 
+/** Morphological operations (rectangular structuring elements). */
+typedef enum
+{
+  IU_MORPHOLOGY_ERODE, /**< minimum over the structuring element. */
+  IU_MORPHOLOGY_DILATE, /**< maximum over the structuring element. */
+  IU_MORPHOLOGY_OPEN, /**< erosion followed by dilation. */
+  IU_MORPHOLOGY_CLOSE, /**< dilation followed by erosion. */
+  IU_MORPHOLOGY_GRADIENT /**< dilation minus erosion. */
+} IuMorphologyType;
+
+/** Border handling of the host filters (for a line abcd). */
+typedef enum
+{
+  IU_BORDER_REPLICATE, /**< aaa|abcd|ddd */
+  IU_BORDER_REFLECT, /**< cba|abcd|dcb */
+  IU_BORDER_CONSTANT, /**< vvv|abcd|vvv with a given value v */
+  IU_BORDER_WRAP /**< bcd|abcd|abc */
+} IuBorderType;
+
+/** Algorithm of the host convolutions/correlations. */
+typedef enum
+{
+  IU_CONVOLUTION_AUTO, /**< chosen by the estimated cost. */
+  IU_CONVOLUTION_DIRECT, /**< direct summation. */
+  IU_CONVOLUTION_FFT /**< FFT of overlapping tiles (overlap-save). */
+} IuConvolutionMethod;
+
+/** Matching cost of the host stereo cost volumes. */
+typedef enum
+{
+  IU_STEREO_CENSUS, /**< Hamming distance of census transforms. */
+  IU_STEREO_SAD /**< sum of absolute differences. */
+} IuStereoCost;
+
 /** 2D Size
  * This struct contains width, height and some helper functions to define a 2D size.
  */
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Core
+ * Class       : CpuDispatch
+ * Language    : C++
+ * Description : Implementation of the runtime instruction set selection for the host kernels
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#ifdef IU_CPU_DISPATCH
+  #ifdef _MSC_VER
+    #include <intrin.h>
+  #else
+    #include <cpuid.h>
+  #endif
+#endif
+#include "cpukernels.h"
+
+namespace iuprivate {
+
+// row kernels of every compiled level (cpukernels_<level>.cpp)
+namespace cpu_generic { void getCpuKernels(CpuKernels& kernels); }
+#ifdef IU_CPU_DISPATCH
+namespace cpu_sse4 { void getCpuKernels(CpuKernels& kernels); }
+namespace cpu_avx2 { void getCpuKernels(CpuKernels& kernels); }
+namespace cpu_avx512 { void getCpuKernels(CpuKernels& kernels); }
+#endif
+
+namespace {
+
+#ifdef IU_CPU_DISPATCH
+//-----------------------------------------------------------------------------
+void cpuid(int leaf, int subleaf, unsigned int regs[4])
+{
+#ifdef _MSC_VER
+  int r[4];
+  __cpuidex(r, leaf, subleaf);
+  for(int i=0; i<4; ++i)
+    regs[i] = (unsigned int)r[i];
+#else
+  __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// register state enabled by the OS (XCR0)
+unsigned long long xgetbv0()
+{
+#ifdef _MSC_VER
+  return _xgetbv(0);
+#else
+  unsigned int eax, edx;
+  __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+#endif
+
+//-----------------------------------------------------------------------------
+IuCpuLevel detectLevel()
+{
+#ifdef IU_CPU_DISPATCH
+  unsigned int regs[4];
+  cpuid(0, 0, regs);
+  const unsigned int max_leaf = regs[0];
+  if(max_leaf < 1)
+    return IU_CPU_GENERIC;
+
+  cpuid(1, 0, regs);
+  const unsigned int ecx1 = regs[2];
+  const bool sse41 = (ecx1 & (1u << 19)) != 0;
+  const bool fma = (ecx1 & (1u << 12)) != 0;
+  const bool osxsave = (ecx1 & (1u << 27)) != 0;
+  const bool avx = (ecx1 & (1u << 28)) != 0;
+  if(!sse41)
+    return IU_CPU_GENERIC;
+
+  unsigned int ebx7 = 0;
+  if(max_leaf >= 7)
+  {
+    cpuid(7, 0, regs);
+    ebx7 = regs[1];
+  }
+  const bool avx2 = (ebx7 & (1u << 5)) != 0;
+  const bool avx512f = (ebx7 & (1u << 16)) != 0;
+
+  // the OS has to save the ymm (and zmm/opmask) state
+  const unsigned long long xcr0 = osxsave ? xgetbv0() : 0;
+  const bool ymm_state = (xcr0 & 0x6) == 0x6;
+  const bool zmm_state = (xcr0 & 0xe6) == 0xe6;
+
+  if(avx && avx2 && fma && ymm_state)
+  {
+    if(avx512f && zmm_state)
+      return IU_CPU_AVX512;
+    return IU_CPU_AVX2;
+  }
+  return IU_CPU_SSE4;
+#else
+  return IU_CPU_GENERIC;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+struct CpuDispatchState
+{
+  IuCpuLevel supported;
+  IuCpuLevel level;
+  CpuKernels kernels;
+
+  CpuDispatchState() :
+    supported(detectLevel()), level(IU_CPU_GENERIC)
+  {
+    IuCpuLevel requested = supported;
+    const char* env = getenv("IU_CPU_LEVEL");
+    if(env != 0)
+    {
+      for(int l = IU_CPU_GENERIC; l <= IU_CPU_AVX512; ++l)
+        if(strcmp(env, iu::CpuDispatch::levelName((IuCpuLevel)l)) == 0)
+          requested = (IuCpuLevel)l;
+    }
+    select(requested);
+  }
+
+  void select(IuCpuLevel requested)
+  {
+    level = (requested < supported) ? requested : supported;
+    switch(level)
+    {
+#ifdef IU_CPU_DISPATCH
+    case IU_CPU_AVX512:
+      cpu_avx512::getCpuKernels(kernels);
+      break;
+    case IU_CPU_AVX2:
+      cpu_avx2::getCpuKernels(kernels);
+      break;
+    case IU_CPU_SSE4:
+      cpu_sse4::getCpuKernels(kernels);
+      break;
+#endif
+    default:
+      level = IU_CPU_GENERIC;
+      cpu_generic::getCpuKernels(kernels);
+      break;
+    }
+  }
+};
+
+CpuDispatchState& dispatchState()
+{
+  static CpuDispatchState state;
+  return state;
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+const CpuKernels& cpuKernels()
+{
+  return dispatchState().kernels;
+}
+
+} // namespace iuprivate
+
+namespace iu {
+
+//-----------------------------------------------------------------------------
+IuCpuLevel CpuDispatch::supportedLevel()
+{
+  return iuprivate::dispatchState().supported;
+}
+
+//-----------------------------------------------------------------------------
+IuCpuLevel CpuDispatch::level()
+{
+  return iuprivate::dispatchState().level;
+}
+
+//-----------------------------------------------------------------------------
+IuCpuLevel CpuDispatch::setLevel(IuCpuLevel level)
+{
+  iuprivate::dispatchState().select(level);
+  return iuprivate::dispatchState().level;
+}
+
+//-----------------------------------------------------------------------------
+const char* CpuDispatch::levelName(IuCpuLevel level)
+{
+  switch(level)
+  {
+  case IU_CPU_SSE4: return "sse4";
+  case IU_CPU_AVX2: return "avx2";
+  case IU_CPU_AVX512: return "avx512";
+  default: return "generic";
+  }
+}
+
+} // namespace iu
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Core
+ * Class       : CpuDispatch
+ * Language    : C++
+ * Description : Definition of the runtime instruction set selection for the host kernels
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IUCORE_CPUDISPATCH_H
+#define IUCORE_CPUDISPATCH_H
+
+#include "globaldefs.h"
+
+/** Instruction set levels the hot host kernels are compiled for. */
+typedef enum
+{
+  IU_CPU_GENERIC = 0, /**< baseline of the compiler target (e.g. SSE2 on x86-64) */
+  IU_CPU_SSE4 = 1,    /**< SSE4.1 */
+  IU_CPU_AVX2 = 2,    /**< AVX2 + FMA */
+  IU_CPU_AVX512 = 3   /**< AVX-512F */
+} IuCpuLevel;
+
+namespace iu {
+
+/** \brief Runtime selection of the host kernel variants.
+ *
+ * The inner row loops of the host kernels (conversions, arithmetic, gauss and
+ * resampling filters, pyramid reduction, remap) are compiled once per IuCpuLevel.
+ * At the first call the best level supported by the CPU (cpuid) and the OS is
+ * selected. The environment variable IU_CPU_LEVEL
+ * (generic, sse4, avx2, avx512) lowers the selection, e.g. for testing; levels
+ * that are not supported are never selected. All levels compute bitwise
+ * identical results.
+ */
+class IUCORE_DLLAPI CpuDispatch
+{
+public:
+  /** Returns the highest level supported by this CPU and compiled into the library. */
+  static IuCpuLevel supportedLevel();
+
+  /** Returns the level currently used by the host kernels. */
+  static IuCpuLevel level();
+
+  /** Selects \a level (clamped to supportedLevel()) and returns the level in use.
+   * Must not be called while host kernels are running.
+   */
+  static IuCpuLevel setLevel(IuCpuLevel level);
+
+  /** Returns the name of \a level as used by IU_CPU_LEVEL. */
+  static const char* levelName(IuCpuLevel level);
+};
+
+} // namespace iu
+
+#endif // IUCORE_CPUDISPATCH_H
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Core
+ * Class       : none
+ * Language    : C++
+ * Description : Table of the instruction set specific row kernels
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IUPRIVATE_CPUKERNELS_H
+#define IUPRIVATE_CPUKERNELS_H
+
+#include "cpudispatch.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// DISCLAIMER: the following declarations are internal and may change in any
+// version without notice, or even be removed.
+//////////////////////////////////////////////////////////////////////////////
+
+namespace iuprivate {
+
+/** Row kernels of one instruction set level. All loops run over \a n elements.
+ * The core table holds the conversions and transpositions and the generic row
+ * arithmetic (affine, scale, axpy, saturation) used by several modules;
+ * kernels of a single module live in the table of that module (FilterKernels,
+ * TransformKernels, StereoKernels, SparseKernels), compiled the same way.
+ */
+struct CpuKernels
+{
+  /** d = mul*s + add (float -> 8-bit as the scalar conversion) */
+  void (*convertRow_32f8u)(const float* s, unsigned char* d, int n, float mul, float add);
+  /** d = mul*s + add */
+  void (*convertRow_8u32f)(const unsigned char* s, float* d, int n, float mul, float add);
+  /** d = mul*s + add */
+  void (*convertRow_16u32f)(const unsigned short* s, float* d, int n, float mul, float add);
+  /** transposition with type conversion of a block of rows x cols source elements:
+   * d[c*d_stride + r*d_step] = s[r*s_stride + c*s_step] (strides and steps in elements),
+   * repeated for the planes k at s + k*s_plane and d + k*d_plane */
+  void (*transposeBlock_64f32f)(const double* s, size_t s_stride, int s_step, size_t s_plane,
+                                float* d, size_t d_stride, int d_step, size_t d_plane,
+                                int planes, int rows, int cols);
+  void (*transposeBlock_32f32f)(const float* s, size_t s_stride, int s_step, size_t s_plane,
+                                float* d, size_t d_stride, int d_step, size_t d_plane,
+                                int planes, int rows, int cols);
+  void (*transposeBlock_32s32s)(const int* s, size_t s_stride, int s_step, size_t s_plane,
+                                int* d, size_t d_stride, int d_step, size_t d_plane,
+                                int planes, int rows, int cols);
+  void (*transposeBlock_32f64f)(const float* s, size_t s_stride, int s_step, size_t s_plane,
+                                double* d, size_t d_stride, int d_step, size_t d_plane,
+                                int planes, int rows, int cols);
+  void (*transposeBlock_8u8u)(const unsigned char* s, size_t s_stride, int s_step, size_t s_plane,
+                              unsigned char* d, size_t d_stride, int d_step, size_t d_plane,
+                              int planes, int rows, int cols);
+  /** d = a*s1 + b*s2 + c; s2 may be 0 (then d = a*s1 + c) */
+  void (*affineRow)(const float* s1, float a, const float* s2, float b, float c, float* d, int n);
+  /** d = g*s */
+  void (*scaleRow)(const float* s, float g, float* d, int n);
+  /** d += g*s */
+  void (*axpyRow)(const float* s, float g, float* d, int n);
+  /** d = s rounded and saturated to [0,255] */
+  void (*saturateRow_32f8u)(const float* s, unsigned char* d, int n);
+};
+
+/** Returns the row kernels of the selected level (see iu::CpuDispatch). */
+const CpuKernels& cpuKernels();
+
+} // namespace iuprivate
+
+#endif // IUPRIVATE_CPUKERNELS_H
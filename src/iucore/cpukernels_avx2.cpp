@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Core
+ * Class       : none
+ * Language    : C++
+ * Description : Row kernels for the instruction set level: AVX2 + FMA
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#define IU_CPU_KERNELS_NAMESPACE cpu_avx2
+#include "cpukernels_impl.h"
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Core
+ * Class       : none
+ * Language    : C++
+ * Description : Row kernels; compiled once per instruction set level
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+// No include guard: this file is included by the cpukernels_<level>.cpp files,
+// each defining IU_CPU_KERNELS_NAMESPACE and compiled with its own target flags.
+// The loops are plain C++ written for the auto-vectorizer; the build disables
+// floating point contraction for them so all levels give identical results.
+
+#ifndef IU_CPU_KERNELS_NAMESPACE
+  #error "IU_CPU_KERNELS_NAMESPACE has to be defined"
+#endif
+
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include "cpukernels.h"
+#include "cpukernelsdefs.h"
+
+namespace iuprivate {
+namespace IU_CPU_KERNELS_NAMESPACE {
+
+//-----------------------------------------------------------------------------
+static void convertRow_32f8u(const float* IU_CPU_RESTRICT s, unsigned char* IU_CPU_RESTRICT d,
+                             int n, float mul, float add)
+{
+  for(int x=0; x<n; ++x)
+    d[x] = (unsigned char)(int)(mul*s[x] + add);
+}
+
+//-----------------------------------------------------------------------------
+static void convertRow_8u32f(const unsigned char* IU_CPU_RESTRICT s, float* IU_CPU_RESTRICT d,
+                             int n, float mul, float add)
+{
+  for(int x=0; x<n; ++x)
+    d[x] = mul*(float)s[x] + add;
+}
+
+//-----------------------------------------------------------------------------
+static void convertRow_16u32f(const unsigned short* IU_CPU_RESTRICT s, float* IU_CPU_RESTRICT d,
+                              int n, float mul, float add)
+{
+  for(int x=0; x<n; ++x)
+    d[x] = mul*(float)s[x] + add;
+}
+
+//-----------------------------------------------------------------------------
+// Walks the destination rows so that the writes are contiguous; the caller keeps the
+// block small enough for the strided source lines to stay in the L1 cache. Up to four
+// planes are handled per element, so interleaved pixels are written in one go.
+template<int Planes, typename SrcType, typename DstType>
+static void transposePlanes(const SrcType* IU_CPU_RESTRICT s, size_t s_stride, int s_step, size_t s_plane,
+                            DstType* IU_CPU_RESTRICT d, size_t d_stride, int d_step, size_t d_plane,
+                            int rows, int cols)
+{
+  for(int c=0; c<cols; ++c)
+  {
+    DstType* IU_CPU_RESTRICT dc = d + c*d_stride;
+    const SrcType* IU_CPU_RESTRICT sc = s + (size_t)c*s_step;
+    for(int r=0; r<rows; ++r)
+      for(int k=0; k<Planes; ++k)
+        dc[(size_t)r*d_step + k*d_plane] = (DstType)sc[r*s_stride + k*s_plane];
+  }
+}
+
+template<typename SrcType, typename DstType>
+static void transposeBlock(const SrcType* IU_CPU_RESTRICT s, size_t s_stride, int s_step, size_t s_plane,
+                           DstType* IU_CPU_RESTRICT d, size_t d_stride, int d_step, size_t d_plane,
+                           int planes, int rows, int cols)
+{
+  if(planes == 1 && s_step == 1 && d_step == 1)
+  {
+    for(int c=0; c<cols; ++c)
+    {
+      DstType* IU_CPU_RESTRICT dc = d + c*d_stride;
+      for(int r=0; r<rows; ++r)
+        dc[r] = (DstType)s[r*s_stride + c];
+    }
+    return;
+  }
+  for(; planes >= 4; planes -= 4, s += 4*s_plane, d += 4*d_plane)
+    transposePlanes<4>(s, s_stride, s_step, s_plane, d, d_stride, d_step, d_plane, rows, cols);
+  if(planes == 3)
+    transposePlanes<3>(s, s_stride, s_step, s_plane, d, d_stride, d_step, d_plane, rows, cols);
+  else if(planes == 2)
+    transposePlanes<2>(s, s_stride, s_step, s_plane, d, d_stride, d_step, d_plane, rows, cols);
+  else if(planes == 1)
+    transposePlanes<1>(s, s_stride, s_step, s_plane, d, d_stride, d_step, d_plane, rows, cols);
+}
+
+static void transposeBlock_64f32f(const double* s, size_t s_stride, int s_step, size_t s_plane,
+                                  float* d, size_t d_stride, int d_step, size_t d_plane,
+                                  int planes, int rows, int cols)
+{
+  transposeBlock(s, s_stride, s_step, s_plane, d, d_stride, d_step, d_plane, planes, rows, cols);
+}
+
+static void transposeBlock_32f32f(const float* s, size_t s_stride, int s_step, size_t s_plane,
+                                  float* d, size_t d_stride, int d_step, size_t d_plane,
+                                  int planes, int rows, int cols)
+{
+  transposeBlock(s, s_stride, s_step, s_plane, d, d_stride, d_step, d_plane, planes, rows, cols);
+}
+
+static void transposeBlock_32s32s(const int* s, size_t s_stride, int s_step, size_t s_plane,
+                                  int* d, size_t d_stride, int d_step, size_t d_plane,
+                                  int planes, int rows, int cols)
+{
+  transposeBlock(s, s_stride, s_step, s_plane, d, d_stride, d_step, d_plane, planes, rows, cols);
+}
+
+static void transposeBlock_32f64f(const float* s, size_t s_stride, int s_step, size_t s_plane,
+                                  double* d, size_t d_stride, int d_step, size_t d_plane,
+                                  int planes, int rows, int cols)
+{
+  transposeBlock(s, s_stride, s_step, s_plane, d, d_stride, d_step, d_plane, planes, rows, cols);
+}
+
+static void transposeBlock_8u8u(const unsigned char* s, size_t s_stride, int s_step, size_t s_plane,
+                                unsigned char* d, size_t d_stride, int d_step, size_t d_plane,
+                                int planes, int rows, int cols)
+{
+  transposeBlock(s, s_stride, s_step, s_plane, d, d_stride, d_step, d_plane, planes, rows, cols);
+}
+
+//-----------------------------------------------------------------------------
+// (dst may alias the sources for in-place arithmetic; no restrict)
+static void affineRow(const float* s1, float a, const float* s2, float b, float c,
+                      float* d, int n)
+{
+  if(s2 != 0)
+  {
+    for(int x=0; x<n; ++x)
+      d[x] = a*s1[x] + b*s2[x] + c;
+  }
+  else
+  {
+    for(int x=0; x<n; ++x)
+      d[x] = a*s1[x] + c;
+  }
+}
+
+//-----------------------------------------------------------------------------
+static void scaleRow(const float* IU_CPU_RESTRICT s, float g, float* IU_CPU_RESTRICT d, int n)
+{
+  for(int x=0; x<n; ++x)
+    d[x] = g*s[x];
+}
+
+//-----------------------------------------------------------------------------
+static void axpyRow(const float* IU_CPU_RESTRICT s, float g, float* IU_CPU_RESTRICT d, int n)
+{
+  for(int x=0; x<n; ++x)
+    d[x] += g*s[x];
+}
+
+//-----------------------------------------------------------------------------
+static void saturateRow_32f8u(const float* IU_CPU_RESTRICT s, unsigned char* IU_CPU_RESTRICT d, int n)
+{
+  for(int x=0; x<n; ++x)
+  {
+    float v = s[x] + 0.5f;
+    v = (v < 255.0f) ? v : 255.0f;
+    v = (v > 0.0f) ? v : 0.0f;
+    d[x] = (unsigned char)(int)v;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void getCpuKernels(CpuKernels& kernels)
+{
+  kernels.convertRow_32f8u = convertRow_32f8u;
+  kernels.convertRow_8u32f = convertRow_8u32f;
+  kernels.convertRow_16u32f = convertRow_16u32f;
+  kernels.transposeBlock_64f32f = transposeBlock_64f32f;
+  kernels.transposeBlock_32f32f = transposeBlock_32f32f;
+  kernels.transposeBlock_32s32s = transposeBlock_32s32s;
+  kernels.transposeBlock_32f64f = transposeBlock_32f64f;
+  kernels.transposeBlock_8u8u = transposeBlock_8u8u;
+  kernels.affineRow = affineRow;
+  kernels.scaleRow = scaleRow;
+  kernels.axpyRow = axpyRow;
+  kernels.saturateRow_32f8u = saturateRow_32f8u;
+}
+
+} // namespace IU_CPU_KERNELS_NAMESPACE
+} // namespace iuprivate
+
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Core
+ * Class       : none
+ * Language    : C++
+ * Description : Compiler hints of the row kernels compiled per instruction set level
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IUPRIVATE_CPUKERNELSDEFS_H
+#define IUPRIVATE_CPUKERNELSDEFS_H
+
+#if defined(__GNUC__) || defined(_MSC_VER)
+  #define IU_CPU_RESTRICT __restrict
+#else
+  #define IU_CPU_RESTRICT
+#endif
+
+// the next loop has no dependencies between its iterations (for stores through
+// several offsets of one pointer, which restrict cannot express)
+#if defined(__clang__)
+  #define IU_CPU_IVDEP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+  #define IU_CPU_IVDEP _Pragma("GCC ivdep")
+#elif defined(_MSC_VER)
+  #define IU_CPU_IVDEP __pragma(loop(ivdep))
+#else
+  #define IU_CPU_IVDEP
+#endif
+
+#endif // IUPRIVATE_CPUKERNELSDEFS_H
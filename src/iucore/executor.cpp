@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Core
+ * Class       : Executor
+ * Language    : C++
+ * Description : Implementation of the host executor
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
+#include "executor.h"
+
+namespace iu {
+
+// number of chunks per thread if the grain size is chosen automatically
+static const int EXECUTOR_CHUNKS_PER_THREAD = 4;
+
+// global thread count (0: hardware default)
+static int executor_num_threads = 0;
+
+//-----------------------------------------------------------------------------
+void Executor::setNumThreads(int num_threads)
+{
+  executor_num_threads = (num_threads > 0) ? num_threads : 0;
+}
+
+//-----------------------------------------------------------------------------
+int Executor::numThreads()
+{
+  if(executor_num_threads > 0)
+    return executor_num_threads;
+#ifdef _OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+bool Executor::inParallel()
+{
+#ifdef _OPENMP
+  return omp_in_parallel() != 0;
+#else
+  return false;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void Executor::run(const RangeTask& task, int begin, int end, int grain, int num_threads)
+{
+  if(end <= begin)
+    return;
+
+  const int length = end - begin;
+  int threads = (num_threads > 0) ? num_threads : numThreads();
+
+  // nested calls and trivial ranges run on the calling thread
+  if(threads <= 1 || length == 1 || inParallel())
+  {
+    task(begin, end);
+    return;
+  }
+
+  if(grain <= 0)
+    grain = (length + threads*EXECUTOR_CHUNKS_PER_THREAD - 1) / (threads*EXECUTOR_CHUNKS_PER_THREAD);
+  const int chunks = (length + grain - 1) / grain;
+  if(chunks < threads)
+    threads = chunks;
+  if(threads <= 1)
+  {
+    task(begin, end);
+    return;
+  }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(threads)
+  for(int c=0; c<chunks; ++c)
+  {
+    const int chunk_begin = begin + c*grain;
+    const int chunk_end = (end - chunk_begin > grain) ? chunk_begin + grain : end;
+    task(chunk_begin, chunk_end);
+  }
+#else
+  task(begin, end);
+#endif
+}
+
+} // namespace iu
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Core
+ * Class       : Executor
+ * Language    : C++
+ * Description : Definition of the host executor (parallelFor over ranges and image tiles)
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IUCORE_EXECUTOR_H
+#define IUCORE_EXECUTOR_H
+
+#include "globaldefs.h"
+#include "coredefs.h"
+
+namespace iu {
+
+/** \brief Host executor used by all CPU kernels of the library.
+ *
+ * Work is split into chunks of \a grain iterations which the worker threads claim
+ * dynamically, so unevenly expensive chunks are balanced between the threads.
+ * Calls from inside a running parallel region (nested parallelism) are executed
+ * serially by the calling thread. Without OpenMP support everything runs serially.
+ * The bodies must not throw; exceptions cannot leave a worker thread.
+ *
+ * The bodies are plain functors (no C++11 needed), e.g.
+ * \code
+ * struct Scale
+ * {
+ *   float* data; float factor;
+ *   void operator()(int begin, int end) const
+ *   { for(int i=begin; i<end; ++i) data[i] *= factor; }
+ * };
+ * iu::parallelFor(0, length, scale);
+ * \endcode
+ */
+class IUCORE_DLLAPI Executor
+{
+public:
+  /** Interface of the range bodies handed to run(). */
+  class RangeTask
+  {
+  public:
+    virtual ~RangeTask() {}
+    virtual void operator()(int begin, int end) const = 0;
+  };
+
+  /** Sets the number of threads used by all host kernels (0: hardware default). */
+  static void setNumThreads(int num_threads);
+
+  /** Returns the number of threads used by the host kernels. */
+  static int numThreads();
+
+  /** Returns true if called from inside a parallel region. */
+  static bool inParallel();
+
+  /** Executes \a task on [begin, end) in chunks of \a grain iterations.
+   * \param grain Number of iterations per chunk (0: chosen automatically).
+   * \param num_threads Number of threads for this call only (0: global setting).
+   */
+  static void run(const RangeTask& task, int begin, int end, int grain = 0, int num_threads = 0);
+
+  /** Minimal number of elements per chunk for rowGrain(). */
+  enum { MIN_CHUNK_ELEMENTS = 16384 };
+
+  /** Grain size (in rows) for row loops so that a chunk covers at least
+   * MIN_CHUNK_ELEMENTS elements; small images are then processed serially.
+   */
+  static int rowGrain(unsigned int row_length)
+  {
+    if(row_length == 0 || row_length >= (unsigned int)MIN_CHUNK_ELEMENTS)
+      return 1;
+    return (MIN_CHUNK_ELEMENTS + row_length - 1) / row_length;
+  }
+};
+
+//-----------------------------------------------------------------------------
+namespace detail {
+
+template<class Body>
+class RangeTaskAdapter : public Executor::RangeTask
+{
+public:
+  RangeTaskAdapter(const Body& body) : body_(body) {}
+  virtual void operator()(int begin, int end) const { body_(begin, end); }
+private:
+  const Body& body_;
+};
+
+template<class Body>
+class TileTaskAdapter : public Executor::RangeTask
+{
+public:
+  TileTaskAdapter(const Body& body, const IuRect& roi,
+                  unsigned int tile_width, unsigned int tile_height, int tiles_x) :
+    body_(body), roi_(roi), tile_width_(tile_width), tile_height_(tile_height), tiles_x_(tiles_x)
+  {
+  }
+
+  virtual void operator()(int begin, int end) const
+  {
+    for(int t=begin; t<end; ++t)
+    {
+      const unsigned int ox = (t % tiles_x_) * tile_width_;
+      const unsigned int oy = (t / tiles_x_) * tile_height_;
+      const unsigned int w = (roi_.width-ox < tile_width_) ? roi_.width-ox : tile_width_;
+      const unsigned int h = (roi_.height-oy < tile_height_) ? roi_.height-oy : tile_height_;
+      body_(IuRect(roi_.x+ox, roi_.y+oy, w, h));
+    }
+  }
+
+private:
+  const Body& body_;
+  IuRect roi_;
+  unsigned int tile_width_;
+  unsigned int tile_height_;
+  int tiles_x_;
+};
+
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+/** Calls body(chunk_begin, chunk_end) in parallel for disjoint chunks covering [begin, end).
+ * \param grain Number of iterations per chunk (0: chosen automatically).
+ * \param num_threads Number of threads for this call only (0: global setting).
+ */
+template<class Body>
+inline void parallelFor(int begin, int end, const Body& body, int grain = 0, int num_threads = 0)
+{
+  detail::RangeTaskAdapter<Body> task(body);
+  Executor::run(task, begin, end, grain, num_threads);
+}
+
+/** Calls body(tile) in parallel for disjoint tiles (IuRect) covering \a roi.
+ * \param tile_width Width of the tiles (0: full roi width, i.e. row strips).
+ * \param tile_height Height of the tiles (0: 8 rows).
+ * \param num_threads Number of threads for this call only (0: global setting).
+ */
+template<class Body>
+inline void parallelForTiles(const IuRect& roi, const Body& body,
+                             unsigned int tile_width = 0, unsigned int tile_height = 0,
+                             int num_threads = 0)
+{
+  if(roi.width == 0 || roi.height == 0)
+    return;
+  if(tile_width == 0 || tile_width > roi.width)
+    tile_width = roi.width;
+  if(tile_height == 0)
+    tile_height = 8;
+  if(tile_height > roi.height)
+    tile_height = roi.height;
+
+  const int tiles_x = (roi.width + tile_width - 1) / tile_width;
+  const int tiles_y = (roi.height + tile_height - 1) / tile_height;
+  detail::TileTaskAdapter<Body> task(body, roi, tile_width, tile_height, tiles_x);
+  Executor::run(task, 0, tiles_x*tiles_y, 1, num_threads);
+}
+
+} // namespace iu
+
+#endif // IUCORE_EXECUTOR_H
@@ -27,9 +27,28 @@
 #include <cstring>
 #include <math.h>
 #include "coredefs.h"
+#include "executor.h"
 
 namespace iuprivate {
 
+//--------------------------------------------------------------------------
+// row copy body for the executor
+template <typename PixelType>
+struct ImageCopyRowsCpu
+{
+  const PixelType* src;
+  size_t src_stride;
+  PixelType* dst;
+  size_t dst_stride;
+  unsigned int width;
+
+  void operator()(int begin, int end) const
+  {
+    for(int y=begin; y<end; ++y)
+      memcpy(dst + y*dst_stride, src + y*src_stride, width*sizeof(PixelType));
+  }
+};
+
 //--------------------------------------------------------------------------
 template <typename PixelType>
 class ImageAllocatorCpu
@@ -65,16 +84,13 @@ public:
   static void copy(const PixelType *src, size_t src_pitch,
                    PixelType *dst, size_t dst_pitch, IuSize size)
   {
-    size_t src_stride = src_pitch/sizeof(PixelType);
-    size_t dst_stride = dst_pitch/sizeof(PixelType);
-
-    for(unsigned int y=0; y< size.height; ++y)
-    {
-      for(unsigned int x=0; x<size.width; ++x)
-      {
-        dst[y*dst_stride+x] = src[y*src_stride+x];
-      }
-    }
+    ImageCopyRowsCpu<PixelType> body;
+    body.src = src;
+    body.src_stride = src_pitch/sizeof(PixelType);
+    body.dst = dst;
+    body.dst_stride = dst_pitch/sizeof(PixelType);
+    body.width = size.width;
+    iu::parallelFor(0, size.height, body, iu::Executor::rowGrain(size.width));
   }
 };
 
@@ -26,6 +26,7 @@
 
 #include "image.h"
 #include "image_allocator_cpu.h"
+#include "image_view_cpu.h"
 
 namespace iu {
 
@@ -41,13 +42,7 @@ public:
 
   virtual ~ImageCpu()
   {
-    if(!ext_data_pointer_)
-    {
-      // do not delete externally handeled data pointers.
-      Allocator::free(data_);
-      data_ = 0;
-    }
-    pitch_ = 0;
+    this->release();
   }
 
   ImageCpu(unsigned int _width, unsigned int _height) :
@@ -90,13 +85,88 @@ public:
     }
   }
 
+  /** Wraps the pixels of \a view without copying (the image does not own the
+   * data). This way every host kernel taking an ImageCpu works on views.
+   */
+  explicit ImageCpu(const ImageViewCpu<PixelType>& view) :
+    Image(_pixel_type, view.width(), view.height()), data_(view.data()), pitch_(view.pitch()),
+    ext_data_pointer_(true)
+  {
+  }
+
+  /** Deep copy. If both images have the same size the pixels are copied into the
+   * existing buffer (this also writes through wrapped views), otherwise the
+   * buffer is reallocated. The roi is taken over from \a from.
+   */
+  ImageCpu& operator= (const ImageCpu<PixelType, Allocator, _pixel_type>& from)
+  {
+    if(this == &from)
+      return *this;
+    if(this->size() != from.size() || data_ == 0)
+    {
+      this->release();
+      if(from.data_ != 0)
+        data_ = Allocator::alloc(from.width(), from.height(), &pitch_);
+    }
+    Image::operator=(from);
+    if(data_ != 0)
+      Allocator::copy(from.data(), from.pitch(), data_, pitch_, this->size());
+    return *this;
+  }
+
+#ifdef IU_HAS_MOVE_SEMANTICS
+  /** Takes over the buffer of \a from, which is left empty. */
+  ImageCpu(ImageCpu<PixelType, Allocator, _pixel_type>&& from) :
+    Image(from), data_(from.data_), pitch_(from.pitch_),
+    ext_data_pointer_(from.ext_data_pointer_)
+  {
+    from.reset();
+  }
+
+  ImageCpu& operator= (ImageCpu<PixelType, Allocator, _pixel_type>&& from)
+  {
+    if(this == &from)
+      return *this;
+    this->release();
+    Image::operator=(from);
+    data_ = from.data_;
+    pitch_ = from.pitch_;
+    ext_data_pointer_ = from.ext_data_pointer_;
+    from.reset();
+    return *this;
+  }
+#endif
+
   PixelType getPixel(unsigned int x, unsigned int y)
   {
     return *data(x, y);
   }
 
-  // :TODO:
-  //ImageCpu& operator= (const ImageCpu<PixelType, Allocator>& from);
+  /** Returns a view onto the whole image. */
+  ImageViewCpu<PixelType> view()
+  {
+    return ImageViewCpu<PixelType>(data_, this->size(), pitch_);
+  }
+  ImageViewCpu<const PixelType> view() const
+  {
+    return ImageViewCpu<const PixelType>(data_, this->size(), pitch_);
+  }
+
+  /** Returns a view onto the region \a rect of the image (e.g. roi() or a tile). */
+  ImageViewCpu<PixelType> view(const IuRect& rect)
+  {
+    return this->view().view(rect);
+  }
+  ImageViewCpu<const PixelType> view(const IuRect& rect) const
+  {
+    return this->view().view(rect);
+  }
+
+  /** Returns flag if the pixels are owned by someone else (external pointer or view). */
+  bool isView() const
+  {
+    return ext_data_pointer_;
+  }
 
   /** Returns the total amount of bytes saved in the data buffer. */
   virtual size_t bytes() const
@@ -148,6 +218,28 @@ protected:
   PixelType* data_;
   size_t pitch_;
   bool ext_data_pointer_; /**< Flag if data pointer is handled outside the image class. */
+
+private:
+  void release()
+  {
+    if(!ext_data_pointer_ && data_ != 0)
+    {
+      // do not delete externally handeled data pointers.
+      Allocator::free(data_);
+    }
+    data_ = 0;
+    pitch_ = 0;
+    ext_data_pointer_ = false;
+  }
+
+  /** Leaves an empty image (used after the buffer was moved away). */
+  void reset()
+  {
+    Image::operator=(Image(_pixel_type));
+    data_ = 0;
+    pitch_ = 0;
+    ext_data_pointer_ = false;
+  }
 };
 
 } // namespace iuprivate
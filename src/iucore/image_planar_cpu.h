@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Core
+ * Class       : ImagePlanarCpu
+ * Language    : C++
+ * Description : Definition of planar (one plane per channel) host images
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IMAGE_PLANAR_CPU_H
+#define IMAGE_PLANAR_CPU_H
+
+#include "image.h"
+#include "image_allocator_cpu.h"
+
+namespace iu {
+
+/** Host image storing every channel in a separate float plane (SoA layout).
+ * All planes live in one allocation and share the same pitch; plane c starts
+ * height()*stride() floats after plane c-1. In contrast to the interleaved
+ * ImageCpu_32f_C4 no bandwidth is spent on an unused alpha channel and every
+ * plane can be processed with plain single channel (SIMD) loops.
+ */
+template<unsigned int _channels, IuPixelType _pixel_type>
+class ImagePlanarCpu : public Image
+{
+public:
+  ImagePlanarCpu() :
+    Image(_pixel_type),
+    data_(0), pitch_(0)
+  {
+  }
+
+  virtual ~ImagePlanarCpu()
+  {
+    iuprivate::ImageAllocatorCpu<float>::free(data_);
+    data_ = 0;
+    pitch_ = 0;
+  }
+
+  ImagePlanarCpu(unsigned int _width, unsigned int _height) :
+    Image(_pixel_type, _width, _height), data_(0), pitch_(0)
+  {
+    data_ = iuprivate::ImageAllocatorCpu<float>::alloc(_width, _channels*_height, &pitch_);
+  }
+
+  ImagePlanarCpu(const IuSize& size) :
+    Image(_pixel_type, size.width, size.height), data_(0), pitch_(0)
+  {
+    data_ = iuprivate::ImageAllocatorCpu<float>::alloc(size.width, _channels*size.height, &pitch_);
+  }
+
+  ImagePlanarCpu(const ImagePlanarCpu<_channels, _pixel_type>& from) :
+    Image(from), data_(0), pitch_(0)
+  {
+    data_ = iuprivate::ImageAllocatorCpu<float>::alloc(width(), _channels*height(), &pitch_);
+    iuprivate::ImageAllocatorCpu<float>::copy(from.data_, from.pitch_, data_, pitch_,
+                                               IuSize(width(), _channels*height()));
+  }
+
+  /** Returns the number of channels (planes). */
+  unsigned int channels() const
+  {
+    return _channels;
+  }
+
+  /** Returns the total amount of bytes saved in the data buffer (all planes). */
+  virtual size_t bytes() const
+  {
+    return _channels*height()*pitch_;
+  }
+
+  /** Returns the distance in bytes between starts of consecutive rows of one plane. */
+  virtual size_t pitch() const
+  {
+    return pitch_;
+  }
+
+  /** Returns the distnace in pixels between starts of consecutive rows of one plane. */
+  virtual size_t stride() const
+  {
+    return pitch_/sizeof(float);
+  }
+
+  /** Returns the distance in pixels between starts of consecutive planes. */
+  size_t planeStride() const
+  {
+    return height()*stride();
+  }
+
+  /** Returns the bit depth of one channel. */
+  virtual unsigned int bitDepth() const
+  {
+    return 8*sizeof(float);
+  }
+
+  /** Returns flag if the image data resides on the device/GPU (TRUE) or host/GPU (FALSE) */
+  virtual bool onDevice() const
+  {
+    return false;
+  }
+
+  /** Returns a pointer to the data of plane \a c.
+   * The pointer can be offset to position \a (ox/oy).
+   * @param[in] c Channel (plane) index.
+   * @param[in] ox Horizontal offset of the pointer array.
+   * @param[in] oy Vertical offset of the pointer array.
+   * @return Pointer to the plane.
+   */
+  float* plane(unsigned int c, int ox = 0, int oy = 0)
+  {
+    return &data_[c*planeStride() + oy*stride() + ox];
+  }
+  const float* plane(unsigned int c, int ox = 0, int oy = 0) const
+  {
+    return &data_[c*planeStride() + oy*stride() + ox];
+  }
+
+protected:
+  float* data_;
+  size_t pitch_;
+
+private:
+  // no assignment (yet)
+  ImagePlanarCpu& operator= (const ImagePlanarCpu&);
+};
+
+} // namespace iu
+
+
+#endif // IMAGE_PLANAR_CPU_H
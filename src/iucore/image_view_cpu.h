@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Core
+ * Class       : ImageViewCpu
+ * Language    : C++
+ * Description : Definition of a non-owning view onto host image data
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IUCORE_IMAGE_VIEW_CPU_H
+#define IUCORE_IMAGE_VIEW_CPU_H
+
+#include "coredefs.h"
+
+namespace iu {
+
+/** \brief Non-owning view onto pitched host image data (pointer, pitch, size).
+ *
+ * Views are cheap to copy and can be sliced into sub-views (crops, tiles, row
+ * bands) without touching the pixels. The viewed memory has to outlive the view.
+ * A view of \c const pixels is read-only; every view converts implicitly to
+ * its read-only counterpart.
+ *
+ * Host kernels taking an ImageCpu can be called on a view by wrapping it into a
+ * non-owning image, e.g.
+ * \code
+ * iu::ImageViewCpu<float> tile = image.view(IuRect(64, 64, 128, 128));
+ * iu::ImageCpu_32f_C1 tile_image(tile);  // no allocation, no copy
+ * iu::setValue(0.0f, &tile_image, tile_image.roi());
+ * \endcode
+ */
+template<typename PixelType>
+class ImageViewCpu
+{
+public:
+  ImageViewCpu() :
+    data_(0), stride_(0), size_(0, 0)
+  {
+  }
+
+  /** Creates a view onto \a data with \a size pixels and \a pitch bytes per row. */
+  ImageViewCpu(PixelType* data, const IuSize& size, size_t pitch) :
+    data_(data), stride_(pitch/sizeof(PixelType)), size_(size)
+  {
+    if (pitch % sizeof(PixelType) != 0)
+      throw IuException("pitch is not a multiple of the pixel size", __FILE__, __FUNCTION__, __LINE__);
+    if (data == 0 && size.width*size.height > 0)
+      throw IuException("input data not valid", __FILE__, __FUNCTION__, __LINE__);
+  }
+
+  /** Conversion to a read-only view (only compiles for \a OtherPixelType -> const \a OtherPixelType). */
+  template<typename OtherPixelType>
+  ImageViewCpu(const ImageViewCpu<OtherPixelType>& from) :
+    data_(from.data()), stride_(from.stride()), size_(from.size())
+  {
+  }
+
+  /** Returns the sub-view \a rect (in coordinates of this view). */
+  ImageViewCpu view(const IuRect& rect) const
+  {
+    if (rect.x < 0 || rect.y < 0 ||
+        rect.x + rect.width > size_.width || rect.y + rect.height > size_.height)
+      throw IuException("view not in range", __FILE__, __FUNCTION__, __LINE__);
+    ImageViewCpu sub;
+    sub.data_ = data(rect.x, rect.y);
+    sub.stride_ = stride_;
+    sub.size_ = IuSize(rect.width, rect.height);
+    return sub;
+  }
+
+  /** Returns the band of \a num_rows rows starting at row \a y. */
+  ImageViewCpu rows(int y, int num_rows) const
+  {
+    return view(IuRect(0, y, size_.width, num_rows));
+  }
+
+  /** Returns the pixel pointer at position \a (ox/oy). */
+  PixelType* data(int ox = 0, int oy = 0) const
+  {
+    return data_ + oy*stride_ + ox;
+  }
+
+  IuSize size() const
+  {
+    return size_;
+  }
+
+  unsigned int width() const
+  {
+    return size_.width;
+  }
+
+  unsigned int height() const
+  {
+    return size_.height;
+  }
+
+  /** Returns the number of pixels in the view. */
+  size_t numel() const
+  {
+    return (size_t)size_.width*size_.height;
+  }
+
+  /** Returns true if the view covers no pixels. */
+  bool empty() const
+  {
+    return numel() == 0;
+  }
+
+  /** Returns the distance in bytes between starts of consecutive rows. */
+  size_t pitch() const
+  {
+    return stride_*sizeof(PixelType);
+  }
+
+  /** Returns the distance in pixels between starts of consecutive rows. */
+  size_t stride() const
+  {
+    return stride_;
+  }
+
+  /** Returns true if the rows follow each other without padding. */
+  bool isContinuous() const
+  {
+    return size_.height <= 1 || stride_ == (size_t)size_.width;
+  }
+
+private:
+  PixelType* data_;
+  size_t stride_;
+  IuSize size_;
+};
+
+} // namespace iu
+
+#endif // IUCORE_IMAGE_VIEW_CPU_H
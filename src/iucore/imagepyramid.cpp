@@ -26,6 +26,7 @@
 #include "memorydefs.h"
 #include "iutransform/reduce.h"
 #include "copy.h"
+#include "trace.h"
 #include "imagepyramid.h"
 
 namespace iu {
@@ -66,14 +67,16 @@ unsigned int ImagePyramid::init(unsigned int max_num_levels, const IuSize& size,
 
   max_num_levels_ = IUMAX(1u, max_num_levels);
   num_levels_ = max_num_levels_;
+  scale_factor_ = scale_factor;
   size_bound_ = IUMAX(1u, size_bound);
 
   // calculate the maximum number of levels
   unsigned int shorter_side = (size.width<size.height) ? size.width : size.height;
   float ratio = static_cast<float>(shorter_side)/static_cast<float>(size_bound_);
-  // +1 because the original size is level 0
-  unsigned int possible_num_levels = static_cast<int>(
-        -logf(ratio)/logf(scale_factor)) + 1;
+  // +1 because the original size is level 0, which always exists (also for images
+  // that are already smaller than the size bound)
+  const int coarser_levels = static_cast<int>(-logf(ratio)/logf(scale_factor));
+  unsigned int possible_num_levels = static_cast<unsigned int>(IUMAX(0, coarser_levels)) + 1;
   if(num_levels_ > possible_num_levels)
     num_levels_ = possible_num_levels;
 
@@ -114,18 +117,16 @@ void ImagePyramid::reset()
 unsigned int ImagePyramid::setImage(iu::Image* image,
                                     IuInterpolationType interp_type)
 {
+  IU_TRACE_FUNCTION();
   if (image == 0)
   {
     throw IuException("Input image is NULL.", __FILE__, __FUNCTION__, __LINE__);
   }
-  if (!image->onDevice())
-  {
-    throw IuException("Currently only device images supported.", __FILE__, __FUNCTION__, __LINE__);
-  }
 
   if ((images_ != 0) && (
         (images_[0]->size() != image->size()) ||
-        (images_[0]->pixelType() != image->pixelType()) ))
+        (images_[0]->pixelType() != image->pixelType()) ||
+        (images_[0]->onDevice() != image->onDevice()) ))
   {
     this->reset();
     this->init(max_num_levels_, image->size(), scale_factor_, size_bound_);
@@ -136,6 +137,11 @@ unsigned int ImagePyramid::setImage(iu::Image* image,
   {
   case IU_32F_C1:
   {
+    if (!image->onDevice())
+    {
+      this->setImageCpu(reinterpret_cast<iu::ImageCpu_32f_C1*>(image), interp_type);
+      break;
+    }
     // *** needed so that always the same mem is used (if already existent)
     iu::ImageGpu_32f_C1*** cur_images = reinterpret_cast<iu::ImageGpu_32f_C1***>(&images_);
     if (images_ == 0)
@@ -151,7 +157,10 @@ unsigned int ImagePyramid::setImage(iu::Image* image,
     iuprivate::copy(reinterpret_cast<iu::ImageGpu_32f_C1*>(image), (*cur_images)[0]);
     for (unsigned int i=1; i<num_levels_; i++)
     {
+      IU_TRACE_ZONE("ImagePyramid::setImage level");
       iuprivate::reduce((*cur_images)[i-1], (*cur_images)[i], interp_type, 1, 0);
+      IU_TRACE_COUNT((*cur_images)[i-1]->bytes() + (*cur_images)[i]->bytes(),
+                     (*cur_images)[i]->numel());
     }
     break;
   }
@@ -162,5 +171,29 @@ unsigned int ImagePyramid::setImage(iu::Image* image,
   return num_levels_;
 }
 
+//---------------------------------------------------------------------------
+void ImagePyramid::setImageCpu(iu::ImageCpu_32f_C1* image, IuInterpolationType interp_type)
+{
+  iu::ImageCpu_32f_C1*** cur_images = reinterpret_cast<iu::ImageCpu_32f_C1***>(&images_);
+  if (images_ == 0)
+  {
+    (*cur_images) = new iu::ImageCpu_32f_C1*[num_levels_];
+    for (unsigned int i=0; i<num_levels_; i++)
+    {
+      IuSize sz(static_cast<int>(floor(0.5+static_cast<double>(image->width())*static_cast<double>(scale_factors_[i]))),
+                static_cast<int>(floor(0.5+static_cast<double>(image->height())*static_cast<double>(scale_factors_[i]))));
+      (*cur_images)[i] = new iu::ImageCpu_32f_C1(sz);
+    }
+  }
+  iuprivate::copy(image, (*cur_images)[0]);
+  for (unsigned int i=1; i<num_levels_; i++)
+  {
+    IU_TRACE_ZONE("ImagePyramid::setImage level");
+    iuprivate::reduce((*cur_images)[i-1], (*cur_images)[i], interp_type, 1, 0);
+    IU_TRACE_COUNT((*cur_images)[i-1]->bytes() + (*cur_images)[i]->bytes(),
+                   (*cur_images)[i]->numel());
+  }
+}
+
 } // namespace iu
 
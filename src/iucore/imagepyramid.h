@@ -56,7 +56,7 @@ public:
    * @param size The size for the finest level (=0).
    * @param rate Multiplicative scale factor.
    * @param size_bound Smaller size of coarsest level.
-   * @returns Number of available levels.
+   * @returns Number of available levels (at least 1: the finest level always exists).
    * @throw IuException
    */
   unsigned int init(unsigned int max_num_levels, const IuSize& size, const float& scale_factor,
@@ -67,7 +67,9 @@ public:
   void reset();
 
   /** Sets the image data of the pyramid.
-   * @params[in] image Input image representing the finest scale.
+   * @params[in] image Input image representing the finest scale. Device images and host
+   *                   images (32-bit, 1-channel) are supported; the levels reside on the
+   *                   same side as the input.
    * @returns the number of initialized pyramid levels.
    * @throw IuException
    */
@@ -96,9 +98,14 @@ public:
   // ATTENTION: Whenever a wrong function is called you get a 0-pointer!
   inline iu::ImageGpu_32f_C1* imageGpu_32f_C1(unsigned int i)
   { return reinterpret_cast<iu::ImageGpu_32f_C1*>(images_[i]); }
+  inline iu::ImageCpu_32f_C1* imageCpu_32f_C1(unsigned int i)
+  { return reinterpret_cast<iu::ImageCpu_32f_C1*>(images_[i]); }
 
 
 private:
+  /** Host version of setImage (32-bit, 1-channel). */
+  void setImageCpu(iu::ImageCpu_32f_C1* image, IuInterpolationType interp_type);
+
   iu::Image** images_;      /**< Pointer to array of (level+1) layer images (pointers - dynamically allocated). */
   IuPixelType pixel_type_;  /**< The images pixel type. */
   float* scale_factors_;    /**< Pointer to the array of (level+1) ratios of i-th levels to the zero level (rate-i). */
@@ -27,50 +27,74 @@
 #include <stdio.h>
 #include <assert.h>
 #include <cstdlib>
+#include <cstring>
+#include <new>
+#ifdef WIN32
+  #include <malloc.h>
+#else
+  #include <sys/mman.h>
+#endif
 #include "linearmemory.h"
 
 namespace iu {
 
+/** \brief Linear host buffer.
+ * The buffer is aligned to LinearHostMemory::ALIGNMENT bytes (a cache line / full
+ * AVX-512 register) so that fills and copies run on whole vector registers.
+ * Besides owning buffers there are
+ *  - page-locked buffers (mlock'ed, e.g. for staging transfers), and
+ *  - views onto a sub-range of another buffer, which never own their data.
+ */
 template<typename PixelType>
 class LinearHostMemory : public LinearMemory
 {
 public:
+  enum { ALIGNMENT = 64 };
+
   LinearHostMemory() :
     LinearMemory(),
-    data_(0), ext_data_pointer_(false)
+    data_(0), ext_data_pointer_(false), page_locked_(false)
   {
   }
 
   virtual ~LinearHostMemory()
   {
-    if((!ext_data_pointer_) && (data_!=NULL))
-    {
-      free(data_);
-      data_ = 0;
-    }
+    this->release();
   }
 
   LinearHostMemory(const unsigned int& length) :
     LinearMemory(length),
-    data_(0), ext_data_pointer_(false)
+    data_(0), ext_data_pointer_(false), page_locked_(false)
   {
-    data_ = (PixelType*)malloc(this->length()*sizeof(PixelType));
-    if (data_ == 0) throw std::bad_alloc();
+    data_ = allocate(this->length());
+  }
+
+  /** Allocates a buffer that is locked into physical memory if \a page_locked is set.
+   * Locking can fail (e.g. due to RLIMIT_MEMLOCK); the buffer is then still valid but
+   * pageable, which can be queried with pageLocked().
+   */
+  LinearHostMemory(const unsigned int& length, bool page_locked) :
+    LinearMemory(length),
+    data_(0), ext_data_pointer_(false), page_locked_(false)
+  {
+    data_ = allocate(this->length());
+    if(page_locked)
+      page_locked_ = lock(data_, this->bytes());
   }
 
   LinearHostMemory(const LinearHostMemory<PixelType>& from) :
     LinearMemory(from),
-    data_(0), ext_data_pointer_(false)
+    data_(0), ext_data_pointer_(false), page_locked_(false)
   {
-    if (from.data_==0) throw IuException("input data not valid", __FILE__, __FUNCTION__, __LINE__);
-    data_ = (PixelType*)malloc(this->length()*sizeof(PixelType));
-    if (data_ == 0) throw std::bad_alloc();
-    memcpy(data_, from.data_, this->length() * sizeof(PixelType));
+    if (from.data_==0 && from.length()>0) throw IuException("input data not valid", __FILE__, __FUNCTION__, __LINE__);
+    data_ = allocate(this->length());
+    if (data_ != 0)
+      memcpy(data_, from.data_, this->bytes());
   }
 
   LinearHostMemory(PixelType* host_data, const unsigned int& length, bool ext_data_pointer = false) :
     LinearMemory(length),
-    data_(0), ext_data_pointer_(ext_data_pointer)
+    data_(0), ext_data_pointer_(ext_data_pointer), page_locked_(false)
   {
     if (host_data==0) throw IuException("input data not valid", __FILE__, __FUNCTION__, __LINE__);
     if(ext_data_pointer_)
@@ -81,13 +105,72 @@ public:
     else
     {
       // allocates an internal data pointer and copies the external data onto it.
-      data_ = (PixelType*)malloc(this->length()*sizeof(PixelType));
-      if (data_ == 0) throw std::bad_alloc();
-      memcpy(data_, host_data, this->length() * sizeof(PixelType));
+      data_ = allocate(this->length());
+      memcpy(data_, host_data, this->bytes());
+    }
+  }
+
+  /** Creates a view onto the elements [offset, offset+length) of \a parent.
+   * The view does not own the data; \a parent has to outlive it.
+   */
+  LinearHostMemory(LinearHostMemory<PixelType>& parent, unsigned int offset, unsigned int length) :
+    LinearMemory(length),
+    data_(0), ext_data_pointer_(true), page_locked_(false)
+  {
+    if ((size_t)offset + length > parent.length())
+      throw IuException("view not in range", __FILE__, __FUNCTION__, __LINE__);
+    data_ = parent.data_ + offset;
+  }
+
+  /** Deep copy. If both buffers have the same length the data is copied into the
+   * existing buffer (this also writes through views), otherwise the buffer is
+   * reallocated. A page-locked buffer stays page-locked when it is reallocated
+   * (as far as the system limits allow, see pageLocked()). A view or a buffer on
+   * external memory cannot be reallocated; assigning a buffer of a different length
+   * to it throws an IuException.
+   */
+  LinearHostMemory& operator= (const LinearHostMemory<PixelType>& from)
+  {
+    if(this == &from)
+      return *this;
+    if(this->length() != from.length() || data_ == 0)
+    {
+      if(ext_data_pointer_)
+        throw IuException("length mismatch: cannot reallocate a view or external buffer", __FILE__, __FUNCTION__, __LINE__);
+      const bool page_locked = page_locked_;
+      this->release();
+      this->setLength(from.length());
+      data_ = allocate(this->length());
+      if(page_locked)
+        page_locked_ = lock(data_, this->bytes());
     }
+    if(this->length() > 0)
+      memcpy(data_, from.data_, this->bytes());
+    return *this;
   }
 
-  // :TODO: operator=
+#ifdef IU_HAS_MOVE_SEMANTICS
+  /** Takes over the buffer of \a from, which is left empty. */
+  LinearHostMemory(LinearHostMemory<PixelType>&& from) :
+    LinearMemory(from),
+    data_(from.data_), ext_data_pointer_(from.ext_data_pointer_), page_locked_(from.page_locked_)
+  {
+    from.reset();
+  }
+
+  LinearHostMemory& operator= (LinearHostMemory<PixelType>&& from)
+  {
+    if(this == &from)
+      return *this;
+    this->release();
+    this->setLength(from.length());
+    data_ = from.data_;
+    ext_data_pointer_ = from.ext_data_pointer_;
+    page_locked_ = from.page_locked_;
+    from.reset();
+    return *this;
+  }
+#endif
 
   /** Returns a pointer to the device buffer.
    * The pointer can be offset to position \a offset.
@@ -130,12 +213,73 @@ public:
     return false;
   }
 
+  /** Returns flag if the buffer is locked into physical memory. */
+  bool pageLocked() const
+  {
+    return page_locked_;
+  }
+
+  /** Returns flag if the buffer is owned by someone else (external pointer or view). */
+  bool isView() const
+  {
+    return ext_data_pointer_;
+  }
+
 protected:
 
 
 private:
+  static PixelType* allocate(size_t length)
+  {
+    if (length == 0)
+      return 0;
+    void* buffer = 0;
+    const size_t bytes = length*sizeof(PixelType);
+#ifdef WIN32
+    buffer = _aligned_malloc(bytes, ALIGNMENT);
+#else
+    if (posix_memalign(&buffer, ALIGNMENT, bytes) != 0)
+      buffer = 0;
+#endif
+    if (buffer == 0) throw std::bad_alloc();
+    return static_cast<PixelType*>(buffer);
+  }
+
+  static bool lock(void* buffer, size_t bytes)
+  {
+#ifdef WIN32
+    return false;
+#else
+    return (buffer != 0) && (mlock(buffer, bytes) == 0);
+#endif
+  }
+
+  void release()
+  {
+    if((!ext_data_pointer_) && (data_!=NULL))
+    {
+#ifdef WIN32
+      _aligned_free(data_);
+#else
+      if (page_locked_)
+        munlock(data_, this->bytes());
+      free(data_);
+#endif
+    }
+    this->reset();
+  }
+
+  void reset()
+  {
+    data_ = 0;
+    ext_data_pointer_ = false;
+    page_locked_ = false;
+    this->setLength(0);
+  }
+
   PixelType* data_; /**< Pointer to device buffer. */
   bool ext_data_pointer_; /**< Flag if data pointer is handled outside the image class. */
+  bool page_locked_; /**< Flag if the buffer is locked into physical memory. */
 
 };
 
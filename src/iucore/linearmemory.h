@@ -66,6 +66,13 @@ public:
   /** Returns flag if the image data resides on the device/GPU (TRUE) or host/GPU (FALSE) */
   virtual bool onDevice() const {return false;}
 
+protected:
+  /** Sets the number of elements (used when buffers are moved or reassigned). */
+  void setLength(unsigned int length)
+  {
+    length_ = length;
+  }
+
 private:
   unsigned int length_;
 
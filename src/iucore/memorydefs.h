@@ -30,6 +30,7 @@
 #include "lineardevicememory.h"
 #include "image_allocator_cpu.h"
 #include "image_cpu.h"
+#include "image_planar_cpu.h"
 #include "image_allocator_gpu.h"
 #include "image_gpu.h"
 #include "volume_allocator_cpu.h"
@@ -127,6 +128,13 @@ typedef ImageCpu<float2, iuprivate::ImageAllocatorCpu<float2>, IU_32F_C2> ImageC
 typedef ImageCpu<float3, iuprivate::ImageAllocatorCpu<float3>, IU_32F_C3> ImageCpu_32f_C3;
 typedef ImageCpu<float4, iuprivate::ImageAllocatorCpu<float4>, IU_32F_C4> ImageCpu_32f_C4;
 
+// Cpu Images; 64f (accumulation images, e.g. integral images)
+typedef ImageCpu<double, iuprivate::ImageAllocatorCpu<double>, IU_64F_C1> ImageCpu_64f_C1;
+
+// Cpu Images; 32f; planar
+typedef ImagePlanarCpu<3, IU_32F_C3> ImagePlanarCpu_32f_C3;
+typedef ImagePlanarCpu<4, IU_32F_C4> ImagePlanarCpu_32f_C4;
+
 /*
   Device
 */
@@ -167,6 +175,9 @@ typedef VolumeCpu<unsigned char, iuprivate::VolumeAllocatorCpu<unsigned char>, I
 typedef VolumeCpu<uchar2, iuprivate::VolumeAllocatorCpu<uchar2>, IU_8U_C2> VolumeCpu_8u_C2;
 typedef VolumeCpu<uchar4, iuprivate::VolumeAllocatorCpu<uchar4>, IU_8U_C4> VolumeCpu_8u_C4;
 
+// Cpu Volumes; 16u
+typedef VolumeCpu<unsigned short, iuprivate::VolumeAllocatorCpu<unsigned short>, IU_16U_C1> VolumeCpu_16u_C1;
+
 // Cpu Volumes; 32f
 typedef VolumeCpu<float, iuprivate::VolumeAllocatorCpu<float>, IU_32F_C1> VolumeCpu_32f_C1;
 typedef VolumeCpu<float2, iuprivate::VolumeAllocatorCpu<float2>, IU_32F_C2> VolumeCpu_32f_C2;
@@ -26,24 +26,58 @@
 
 namespace iuprivate {
 
+//-----------------------------------------------------------------------------
+/* [1D; host] fill helper. The value is copied into a local first: filling through
+ * the reference would force the compiler to reload it after every store (the
+ * buffer could alias it) and prevents vectorization.
+ */
+template<typename PixelType>
+static void fillLinear(const PixelType& value, iu::LinearHostMemory<PixelType>* srcdst)
+{
+  const PixelType val = value;
+  PixelType* buffer = srcdst->data();
+  const int length = srcdst->length();
+  for(int i=0; i<length; ++i)
+    buffer[i] = val;
+}
+
 //-----------------------------------------------------------------------------
 // [1D; host] set values; 8-bit
 void setValue(const unsigned char& value, iu::LinearHostMemory_8u_C1* srcdst)
 {
   memset((void*)srcdst->data(), value, srcdst->bytes());
 }
+void setValue(const uchar2& value, iu::LinearHostMemory_8u_C2* srcdst)
+{
+  fillLinear(value, srcdst);
+}
+void setValue(const uchar3& value, iu::LinearHostMemory_8u_C3* srcdst)
+{
+  fillLinear(value, srcdst);
+}
+void setValue(const uchar4& value, iu::LinearHostMemory_8u_C4* srcdst)
+{
+  fillLinear(value, srcdst);
+}
 
 //-----------------------------------------------------------------------------
 // [1D; host] set values; 32-bit
 void setValue(const int& value, iu::LinearHostMemory_32s_C1* srcdst)
 {
-  // we are using for loops because memset is only safe on integer type arrays
-
-  int* buffer = srcdst->data();
-  for(unsigned int i=0; i<srcdst->length(); ++i)
-  {
-    buffer[i] = value;
-  }
+  // memset is only safe for bytes
+  fillLinear(value, srcdst);
+}
+void setValue(const int2& value, iu::LinearHostMemory_32s_C2* srcdst)
+{
+  fillLinear(value, srcdst);
+}
+void setValue(const int3& value, iu::LinearHostMemory_32s_C3* srcdst)
+{
+  fillLinear(value, srcdst);
+}
+void setValue(const int4& value, iu::LinearHostMemory_32s_C4* srcdst)
+{
+  fillLinear(value, srcdst);
 }
 
 
@@ -51,13 +85,19 @@ void setValue(const int& value, iu::LinearHostMemory_32s_C1* srcdst)
 // [1D; host] set values; 32-bit
 void setValue(const float& value, iu::LinearHostMemory_32f_C1* srcdst)
 {
-  // we are using for loops because memset is only safe on integer type arrays
-
-  float* buffer = srcdst->data();
-  for(unsigned int i=0; i<srcdst->length(); ++i)
-  {
-    buffer[i] = value;
-  }
+  fillLinear(value, srcdst);
+}
+void setValue(const float2& value, iu::LinearHostMemory_32f_C2* srcdst)
+{
+  fillLinear(value, srcdst);
+}
+void setValue(const float3& value, iu::LinearHostMemory_32f_C3* srcdst)
+{
+  fillLinear(value, srcdst);
+}
+void setValue(const float4& value, iu::LinearHostMemory_32f_C4* srcdst)
+{
+  fillLinear(value, srcdst);
 }
 
 //-----------------------------------------------------------------------------
@@ -101,18 +101,44 @@ void setValue(const float3& value, iu::LinearDeviceMemory_32f_C3* srcdst);
 void setValue(const float4& value, iu::LinearDeviceMemory_32f_C4* srcdst);
 
 // 2D set pixel value; host;
-template<typename PixelType, class Allocator, IuPixelType _pixel_type>
-inline void setValue(const PixelType &value,
-                     iu::ImageCpu<PixelType, Allocator, _pixel_type> *srcdst,
-                     const IuRect& roi)
+// The roi is an offset plus an extent on every axis (as on the device), clipped to the
+// image; the baseline host loops ran from roi.x to roi.width and from roi.y to roi.height.
+template<typename PixelType>
+struct SetValueRowsCpu
 {
-  for(unsigned int y=roi.y; y<roi.height; ++y)
+  PixelType value;
+  PixelType* data;
+  size_t stride;
+  int x_begin;
+  int x_end;
+
+  void operator()(int begin, int end) const
   {
-    for(unsigned int x=roi.x; x<roi.width; ++x)
+    const PixelType val = value;
+    for(int y=begin; y<end; ++y)
     {
-      *srcdst->data(x,y) = value;
+      PixelType* row = data + y*stride;
+      for(int x=x_begin; x<x_end; ++x)
+        row[x] = val;
     }
   }
+};
+
+template<typename PixelType, class Allocator, IuPixelType _pixel_type>
+inline void setValue(const PixelType &value,
+                     iu::ImageCpu<PixelType, Allocator, _pixel_type> *srcdst,
+                     const IuRect& roi)
+{
+  SetValueRowsCpu<PixelType> body;
+  body.value = value;
+  body.data = srcdst->data();
+  body.stride = srcdst->stride();
+  body.x_begin = roi.x > 0 ? roi.x : 0;
+  body.x_end = roi.x+roi.width < srcdst->width() ? roi.x+roi.width : srcdst->width();
+  const int y_begin = roi.y > 0 ? roi.y : 0;
+  const int y_end = roi.y+roi.height < srcdst->height() ? roi.y+roi.height : srcdst->height();
+  if(body.x_begin < body.x_end)
+    iu::parallelFor(y_begin, y_end, body, iu::Executor::rowGrain(body.x_end-body.x_begin));
 }
 
 // 3D set pixel value; host;
@@ -121,15 +147,22 @@ inline void setValue(const PixelType &value,
                      iu::VolumeCpu<PixelType, Allocator, _pixel_type> *srcdst,
                      const IuCube& roi)
 {
-  for(unsigned int z=roi.z; z<roi.depth; ++z)
+  const int z_begin = roi.z > 0 ? roi.z : 0;
+  const int z_end = roi.z+roi.depth < srcdst->depth() ? roi.z+roi.depth : srcdst->depth();
+  const int y_begin = roi.y > 0 ? roi.y : 0;
+  const int y_end = roi.y+roi.height < srcdst->height() ? roi.y+roi.height : srcdst->height();
+
+  SetValueRowsCpu<PixelType> body;
+  body.value = value;
+  body.stride = srcdst->stride();
+  body.x_begin = roi.x > 0 ? roi.x : 0;
+  body.x_end = roi.x+roi.width < srcdst->width() ? roi.x+roi.width : srcdst->width();
+  if(body.x_begin >= body.x_end)
+    return;
+  for(int z=z_begin; z<z_end; ++z)
   {
-    for(unsigned int y=roi.y; y<roi.height; ++y)
-    {
-      for(unsigned int x=roi.x; x<roi.width; ++x)
-      {
-        *srcdst->data(x,y,z) = value;
-      }
-    }
+    body.data = srcdst->data(0,0,z);
+    iu::parallelFor(y_begin, y_end, body, iu::Executor::rowGrain(body.x_end-body.x_begin));
   }
 }
 
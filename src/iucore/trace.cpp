@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Core
+ * Class       : Trace, TraceZone
+ * Language    : C++
+ * Description : Implementation of the built-in instrumentation
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifdef WIN32
+  #include <windows.h>
+  #define IU_TRACE_TLS __declspec(thread)
+#else
+  #include <pthread.h>
+  #include <time.h>
+  #define IU_TRACE_TLS __thread
+#endif
+#include <fstream>
+#include <ostream>
+#include <vector>
+#include "trace.h"
+
+namespace iu {
+
+/* ***************************************************************************
+ *  internal state
+ * ***************************************************************************/
+
+namespace {
+
+// events per chunk of a thread buffer (chunks are never reallocated)
+const int TRACE_CHUNK_EVENTS = 4096;
+
+enum TraceEventType
+{
+  TRACE_EVENT_ZONE,
+  TRACE_EVENT_COUNTER
+};
+
+struct TraceEvent
+{
+  const char* name;
+  long long ts;       // [ns] since the clock origin
+  long long dur;      // [ns]
+  double bytes;
+  double pixels;
+  TraceEventType type;
+};
+
+struct TraceChunk
+{
+  TraceEvent events[TRACE_CHUNK_EVENTS];
+};
+
+/** Event buffer of one thread. Only the owning thread appends, so no locking is
+ * needed for recording. Buffers are kept until process exit such that events
+ * of terminated threads are still exported.
+ */
+struct TraceThreadBuffer
+{
+  int tid;
+  const char* name;
+  std::vector<TraceChunk*> chunks;
+  int num_events;
+  TraceZone* zone;    // innermost open zone
+
+  TraceThreadBuffer(int _tid) : tid(_tid), name(0), num_events(0), zone(0) {}
+
+  TraceEvent* append()
+  {
+    const int chunk = num_events / TRACE_CHUNK_EVENTS;
+    if(chunk == (int)chunks.size())
+      chunks.push_back(new TraceChunk);
+    TraceEvent* event = &chunks[chunk]->events[num_events % TRACE_CHUNK_EVENTS];
+    ++num_events;
+    return event;
+  }
+
+  const TraceEvent& event(int i) const
+  {
+    return chunks[i / TRACE_CHUNK_EVENTS]->events[i % TRACE_CHUNK_EVENTS];
+  }
+};
+
+//-----------------------------------------------------------------------------
+// Registry of all thread buffers; the lock is only taken when a thread records
+// its first event and for exporting/clearing.
+class TraceRegistry
+{
+public:
+  TraceRegistry()
+  {
+#ifdef WIN32
+    InitializeCriticalSection(&lock_);
+#else
+    pthread_mutex_init(&lock_, 0);
+#endif
+  }
+
+  void lock()
+  {
+#ifdef WIN32
+    EnterCriticalSection(&lock_);
+#else
+    pthread_mutex_lock(&lock_);
+#endif
+  }
+
+  void unlock()
+  {
+#ifdef WIN32
+    LeaveCriticalSection(&lock_);
+#else
+    pthread_mutex_unlock(&lock_);
+#endif
+  }
+
+  TraceThreadBuffer* add()
+  {
+    lock();
+    TraceThreadBuffer* buffer = new TraceThreadBuffer((int)buffers.size()+1);
+    buffers.push_back(buffer);
+    unlock();
+    return buffer;
+  }
+
+  std::vector<TraceThreadBuffer*> buffers;
+
+private:
+#ifdef WIN32
+  CRITICAL_SECTION lock_;
+#else
+  pthread_mutex_t lock_;
+#endif
+};
+
+TraceRegistry& traceRegistry()
+{
+  // intentionally leaked: zones may still end during static destruction
+  static TraceRegistry* registry = new TraceRegistry;
+  return *registry;
+}
+
+IU_TRACE_TLS TraceThreadBuffer* trace_thread_buffer = 0;
+volatile bool trace_recording = false;
+long long trace_origin = 0;
+
+//-----------------------------------------------------------------------------
+TraceThreadBuffer* threadBuffer()
+{
+  if(trace_thread_buffer == 0)
+    trace_thread_buffer = traceRegistry().add();
+  return trace_thread_buffer;
+}
+
+//-----------------------------------------------------------------------------
+// monotonic clock [ns]
+long long traceNow()
+{
+#ifdef WIN32
+  static LARGE_INTEGER frequency = {0};
+  if(frequency.QuadPart == 0)
+    QueryPerformanceFrequency(&frequency);
+  LARGE_INTEGER counter;
+  QueryPerformanceCounter(&counter);
+  return (long long)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+  timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (long long)t.tv_sec*1000000000LL + t.tv_nsec;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void writeJsonString(std::ostream& out, const char* str)
+{
+  static const char hex[] = "0123456789abcdef";
+  out << '"';
+  for(const char* c = str; c != 0 && *c != '\0'; ++c)
+  {
+    const unsigned char ch = (unsigned char)*c;
+    if(ch == '"' || ch == '\\')
+      out << '\\' << (char)ch;
+    else if(ch < 0x20)
+      out << "\\u00" << hex[ch >> 4] << hex[ch & 0xf];
+    else
+      out << (char)ch;
+  }
+  out << '"';
+}
+
+//-----------------------------------------------------------------------------
+// timestamps are exported in microseconds relative to the trace origin
+void writeMicroseconds(std::ostream& out, long long ns)
+{
+  if(ns < 0)
+  {
+    out << '-';
+    ns = -ns;
+  }
+  const long long frac = ns % 1000;
+  out << ns/1000 << '.' << (char)('0' + frac/100) << (char)('0' + (frac/10)%10)
+      << (char)('0' + frac%10);
+}
+
+} // namespace
+
+/* ***************************************************************************
+ *  Trace
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+void Trace::start()
+{
+  if(trace_origin == 0)
+    trace_origin = traceNow();
+  trace_recording = true;
+}
+
+//-----------------------------------------------------------------------------
+void Trace::stop()
+{
+  trace_recording = false;
+}
+
+//-----------------------------------------------------------------------------
+bool Trace::isRecording()
+{
+  return trace_recording;
+}
+
+//-----------------------------------------------------------------------------
+void Trace::clear()
+{
+  TraceRegistry& registry = traceRegistry();
+  registry.lock();
+  for(size_t i = 0; i < registry.buffers.size(); ++i)
+    registry.buffers[i]->num_events = 0; // chunks are reused
+  trace_origin = trace_recording ? traceNow() : 0;
+  registry.unlock();
+}
+
+//-----------------------------------------------------------------------------
+size_t Trace::numEvents()
+{
+  TraceRegistry& registry = traceRegistry();
+  registry.lock();
+  size_t num = 0;
+  for(size_t i = 0; i < registry.buffers.size(); ++i)
+    num += registry.buffers[i]->num_events;
+  registry.unlock();
+  return num;
+}
+
+//-----------------------------------------------------------------------------
+void Trace::setThreadName(const char* name)
+{
+  threadBuffer()->name = name;
+}
+
+//-----------------------------------------------------------------------------
+void Trace::count(double bytes, double pixels)
+{
+  TraceThreadBuffer* buffer = trace_thread_buffer;
+  if(buffer == 0 || buffer->zone == 0)
+    return;
+  buffer->zone->bytes_ += bytes;
+  buffer->zone->pixels_ += pixels;
+}
+
+//-----------------------------------------------------------------------------
+void Trace::counter(const char* name, double value)
+{
+  if(!trace_recording)
+    return;
+  TraceEvent* event = threadBuffer()->append();
+  event->name = name;
+  event->ts = traceNow();
+  event->dur = 0;
+  event->bytes = value;
+  event->pixels = 0.0;
+  event->type = TRACE_EVENT_COUNTER;
+}
+
+//-----------------------------------------------------------------------------
+bool Trace::writeChromeTrace(const std::string& filename)
+{
+  std::ofstream file(filename.c_str());
+  if(!file.is_open())
+    return false;
+  writeChromeTrace(file);
+  file.close();
+  return !file.fail();
+}
+
+//-----------------------------------------------------------------------------
+void Trace::writeChromeTrace(std::ostream& out)
+{
+  TraceRegistry& registry = traceRegistry();
+  registry.lock();
+
+  out << "{\"traceEvents\":[";
+  bool first = true;
+  for(size_t b = 0; b < registry.buffers.size(); ++b)
+  {
+    const TraceThreadBuffer* buffer = registry.buffers[b];
+    if(buffer->name != 0)
+    {
+      out << (first ? "\n" : ",\n");
+      first = false;
+      out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid
+          << ",\"args\":{\"name\":";
+      writeJsonString(out, buffer->name);
+      out << "}}";
+    }
+
+    for(int i = 0; i < buffer->num_events; ++i)
+    {
+      const TraceEvent& event = buffer->event(i);
+      out << (first ? "\n" : ",\n");
+      first = false;
+      out << "{\"name\":";
+      writeJsonString(out, event.name);
+      out << ",\"cat\":\"iu\",\"pid\":1,\"tid\":" << buffer->tid << ",\"ts\":";
+      writeMicroseconds(out, event.ts - trace_origin);
+      if(event.type == TRACE_EVENT_ZONE)
+      {
+        out << ",\"ph\":\"X\",\"dur\":";
+        writeMicroseconds(out, event.dur);
+        if(event.bytes > 0.0 || event.pixels > 0.0)
+          out << ",\"args\":{\"bytes\":" << event.bytes << ",\"pixels\":" << event.pixels << "}";
+      }
+      else
+      {
+        out << ",\"ph\":\"C\",\"args\":{\"value\":" << event.bytes << "}";
+      }
+      out << "}";
+    }
+  }
+  out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+  registry.unlock();
+}
+
+/* ***************************************************************************
+ *  TraceZone
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+TraceZone::TraceZone(const char* name) :
+  name_(name), begin_(-1), bytes_(0.0), pixels_(0.0), parent_(0)
+{
+  if(!trace_recording)
+    return;
+  TraceThreadBuffer* buffer = threadBuffer();
+  parent_ = buffer->zone;
+  buffer->zone = this;
+  begin_ = traceNow();
+}
+
+//-----------------------------------------------------------------------------
+TraceZone::~TraceZone()
+{
+  if(begin_ < 0)
+    return;
+  const long long end = traceNow();
+  TraceThreadBuffer* buffer = trace_thread_buffer;
+  buffer->zone = parent_;
+  // zones that end after stop() are still recorded to keep the nesting intact
+  TraceEvent* event = buffer->append();
+  event->name = name_;
+  event->ts = begin_;
+  event->dur = end - begin_;
+  event->bytes = bytes_;
+  event->pixels = pixels_;
+  event->type = TRACE_EVENT_ZONE;
+}
+
+} // namespace iu
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Core
+ * Class       : Trace, TraceZone
+ * Language    : C++
+ * Description : Definition of the built-in instrumentation (scoped zones, counters, Chrome trace export)
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IUCORE_TRACE_H
+#define IUCORE_TRACE_H
+
+#include <iosfwd>
+#include <string>
+#include "globaldefs.h"
+
+namespace iu {
+
+/** \brief Built-in instrumentation of the library.
+ *
+ * The library entry points are wrapped into scoped zones (IU_TRACE_FUNCTION).
+ * While recording, every zone that ends is appended as one event to a buffer
+ * owned by the calling thread, so recording needs no locks. The events can be
+ * exported in the Chrome trace_event JSON format (chrome://tracing, Perfetto).
+ *
+ * The zones are only compiled into the library if IU_ENABLE_TRACE is defined
+ * (CMake option VMLIBRARIES_IU_USE_TRACE); otherwise all IU_TRACE_* macros
+ * expand to nothing and the Trace interface simply records no events.
+ * If compiled in but not recording, a zone costs one flag check.
+ *
+ * \code
+ * iu::Trace::start();
+ * ... // library calls
+ * iu::Trace::stop();
+ * iu::Trace::writeChromeTrace("trace.json");
+ * \endcode
+ *
+ * \note GPU entry points are timed on the host, i.e. asynchronous kernel launches
+ *       only show the launch overhead.
+ */
+class IUCORE_DLLAPI Trace
+{
+public:
+  /** Starts recording events (previously recorded events are kept). */
+  static void start();
+
+  /** Stops recording events. */
+  static void stop();
+
+  /** Returns true while events are recorded. */
+  static bool isRecording();
+
+  /** Discards all recorded events. Must not be called while other threads are
+   * inside a zone.
+   */
+  static void clear();
+
+  /** Returns the number of recorded events (all threads). */
+  static size_t numEvents();
+
+  /** Writes the recorded events as Chrome trace_event JSON. Should be called
+   * after stop(), when no other thread records events any more.
+   * \return false if the file could not be written.
+   */
+  static bool writeChromeTrace(const std::string& filename);
+  static void writeChromeTrace(std::ostream& out);
+
+  /** Names the calling thread in the exported trace (\a name must outlive the trace). */
+  static void setThreadName(const char* name);
+
+  /** Adds processed bytes and pixels to the innermost zone of the calling thread. */
+  static void count(double bytes, double pixels);
+
+  /** Records the value of a counter track (\a name must be a string literal). */
+  static void counter(const char* name, double value);
+};
+
+/** Scoped zone: records one event from construction to destruction.
+ * \a name must be a string literal (only the pointer is stored).
+ */
+class IUCORE_DLLAPI TraceZone
+{
+public:
+  explicit TraceZone(const char* name);
+  ~TraceZone();
+
+private:
+  friend class Trace;
+
+  const char* name_;
+  long long begin_;    // [ns]; < 0 if the zone is not recorded
+  double bytes_;
+  double pixels_;
+  TraceZone* parent_;
+
+  // no copies
+  TraceZone(const TraceZone&);
+  TraceZone& operator= (const TraceZone&);
+};
+
+} // namespace iu
+
+//-----------------------------------------------------------------------------
+#if defined(_MSC_VER)
+  #define IU_TRACE_FUNCTION_NAME __FUNCSIG__
+#elif defined(__GNUC__)
+  #define IU_TRACE_FUNCTION_NAME __PRETTY_FUNCTION__
+#else
+  #define IU_TRACE_FUNCTION_NAME __FUNCTION__
+#endif
+
+#ifdef IU_ENABLE_TRACE
+  #define IU_TRACE_CONCAT_(a, b) a##b
+  #define IU_TRACE_CONCAT(a, b) IU_TRACE_CONCAT_(a, b)
+  /** Scoped zone named \a name (string literal) up to the end of the enclosing block. */
+  #define IU_TRACE_ZONE(name) iu::TraceZone IU_TRACE_CONCAT(iu_trace_zone_, __LINE__)(name)
+  /** Scoped zone named after the enclosing function (including its signature). */
+  #define IU_TRACE_FUNCTION() IU_TRACE_ZONE(IU_TRACE_FUNCTION_NAME)
+  /** Adds processed bytes/pixels to the innermost zone. */
+  #define IU_TRACE_COUNT(bytes, pixels) iu::Trace::count((double)(bytes), (double)(pixels))
+  /** Records a counter value. */
+  #define IU_TRACE_COUNTER(name, value) iu::Trace::counter(name, (double)(value))
+#else
+  #define IU_TRACE_ZONE(name) ((void)0)
+  #define IU_TRACE_FUNCTION() ((void)0)
+  #define IU_TRACE_COUNT(bytes, pixels) ((void)0)
+  #define IU_TRACE_COUNTER(name, value) ((void)0)
+#endif
+
+#endif // IUCORE_TRACE_H
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Core
+ * Class       : none
+ * Language    : C++
+ * Description : Interpolation weights of the host warps
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IUPRIVATE_WARPWEIGHTS_H
+#define IUPRIVATE_WARPWEIGHTS_H
+
+#include <cmath>
+#include <algorithm>
+
+// Shared by the warp row kernels and the clamped border pixels of iutransform/warp_cpu.cpp.
+// The functions are static: they are compiled with the flags of every instruction set
+// level and must not be merged across the levels by the linker.
+
+namespace iuprivate {
+
+// weights of one direction (same bspline basis as the remap)
+template<int Taps>
+static inline int warpWeights(float pos, float* w)
+{
+  if(Taps == 1)
+  {
+    w[0] = 1.0f;
+    return (int)std::floor(pos + 0.5f);
+  }
+  const float index = std::floor(pos);
+  const float f = pos - index;
+  if(Taps == 2)
+  {
+    w[0] = 1.0f - f;
+    w[1] = f;
+    return (int)index;
+  }
+  const float g = 1.0f - f;
+  w[0] = 1.0f/6.0f*g*g*g;
+  w[1] = 2.0f/3.0f - 0.5f*f*f*(2.0f-f);
+  w[2] = 2.0f/3.0f - 0.5f*g*g*(2.0f-g);
+  w[3] = 1.0f/6.0f*f*f*f;
+  return (int)index - 1;
+}
+
+static inline void warpStore(float v, float* d) { *d = v; }
+static inline void warpStore(float v, unsigned char* d)
+{
+  *d = (unsigned char)std::min(std::max(v + 0.5f, 0.0f), 255.0f);
+}
+
+} // namespace iuprivate
+
+#endif // IUPRIVATE_WARPWEIGHTS_H
@@ -24,6 +24,7 @@
 
 #include "iufilter.h"
 #include "iufilter/filter.h"
+#include "iucore/trace.h"
 
 namespace iu {
 
@@ -33,20 +34,55 @@ namespace iu {
 
 // 2D device; 32-bit; 1-channel
 void filterMedian3x3(const ImageGpu_32f_C1* src, ImageGpu_32f_C1* dst, const IuRect& roi)
-{iuprivate::filterMedian3x3(src, dst, roi);}
+{ IU_TRACE_FUNCTION(); iuprivate::filterMedian3x3(src, dst, roi);}
 
 // device; 32-bit; 1-channel
 void filterGauss(const ImageGpu_32f_C1* src, ImageGpu_32f_C1* dst, const IuRect& roi,
                  float sigma, int kernel_size)
-{iuprivate::filterGauss(src, dst, roi, sigma, kernel_size);}
+{ IU_TRACE_FUNCTION(); iuprivate::filterGauss(src, dst, roi, sigma, kernel_size);}
 // device; volume; 32-bit; 1-channel
 void filterGauss(const VolumeGpu_32f_C1* src, VolumeGpu_32f_C1* dst,
                  float sigma, int kernel_size)
-{iuprivate::filterGauss(src, dst, sigma, kernel_size);}
+{ IU_TRACE_FUNCTION(); iuprivate::filterGauss(src, dst, sigma, kernel_size);}
 // device; 32-bit; 4-channel
 void filterGauss(const ImageGpu_32f_C4* src, ImageGpu_32f_C4* dst, const IuRect& roi,
                  float sigma, int kernel_size)
-{iuprivate::filterGauss(src, dst, roi, sigma, kernel_size);}
+{ IU_TRACE_FUNCTION(); iuprivate::filterGauss(src, dst, roi, sigma, kernel_size);}
+// host; 32-bit; 1-channel
+void filterGauss(const ImageCpu_32f_C1* src, ImageCpu_32f_C1* dst, const IuRect& roi,
+                 float sigma, int kernel_size)
+{ IU_TRACE_FUNCTION(); iuprivate::filterGauss(src, dst, roi, sigma, kernel_size);}
+// host; 32-bit; planar 3-channel
+void filterGauss(const ImagePlanarCpu_32f_C3* src, ImagePlanarCpu_32f_C3* dst, const IuRect& roi,
+                 float sigma, int kernel_size)
+{ IU_TRACE_FUNCTION(); iuprivate::filterGauss(src, dst, roi, sigma, kernel_size);}
+// host; 32-bit; planar 4-channel
+void filterGauss(const ImagePlanarCpu_32f_C4* src, ImagePlanarCpu_32f_C4* dst, const IuRect& roi,
+                 float sigma, int kernel_size)
+{ IU_TRACE_FUNCTION(); iuprivate::filterGauss(src, dst, roi, sigma, kernel_size);}
+
+// host; 32-bit; 1-channel
+unsigned int denoiseTV(const ImageCpu_32f_C1* src, ImageCpu_32f_C1* dst, float lambda,
+                       unsigned int num_iterations, const ImageCpu_32f_C1* weights,
+                       float tolerance, unsigned int check_interval)
+{ IU_TRACE_FUNCTION(); return iuprivate::denoiseTV(src, dst, lambda, num_iterations, weights, tolerance, check_interval);}
+// host; 32-bit; 4-channel
+unsigned int denoiseTV(const ImageCpu_32f_C4* src, ImageCpu_32f_C4* dst, float lambda,
+                       unsigned int num_iterations, const ImageCpu_32f_C1* weights,
+                       float tolerance, unsigned int check_interval)
+{ IU_TRACE_FUNCTION(); return iuprivate::denoiseTV(src, dst, lambda, num_iterations, weights, tolerance, check_interval);}
+// host; 32-bit; 1-channel
+unsigned int denoiseTGV2(const ImageCpu_32f_C1* src, ImageCpu_32f_C1* dst, float lambda,
+                         float alpha1, float alpha0, unsigned int num_iterations,
+                         const ImageCpu_32f_C1* weights, float tolerance, unsigned int check_interval)
+{ IU_TRACE_FUNCTION(); return iuprivate::denoiseTGV2(src, dst, lambda, alpha1, alpha0, num_iterations,
+                                                     weights, tolerance, check_interval);}
+// host; 32-bit; 4-channel
+unsigned int denoiseTGV2(const ImageCpu_32f_C4* src, ImageCpu_32f_C4* dst, float lambda,
+                         float alpha1, float alpha0, unsigned int num_iterations,
+                         const ImageCpu_32f_C1* weights, float tolerance, unsigned int check_interval)
+{ IU_TRACE_FUNCTION(); return iuprivate::denoiseTGV2(src, dst, lambda, alpha1, alpha0, num_iterations,
+                                                     weights, tolerance, check_interval);}
 
 
 /* ***************************************************************************
@@ -55,44 +91,174 @@ void filterGauss(const ImageGpu_32f_C4* src, ImageGpu_32f_C4* dst, const IuRect&
 
 // edge filter; device; 32-bit; 1-channel
 void filterEdge(const iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C2* dst, const IuRect& roi)
-{ iuprivate::filterEdge(src, dst, roi); }
+{ IU_TRACE_FUNCTION(); iuprivate::filterEdge(src, dst, roi); }
 
 // edge filter + evaluation; device; 32-bit; 1-channel
 void filterEdge(const iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C1* dst, const IuRect& roi,
                 float alpha, float beta, float minval)
-{ iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
+{ IU_TRACE_FUNCTION(); iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
 
 // edge filter + evaluation (4n); device; 32-bit; 1-channel
 void filterEdge(const iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C2* dst, const IuRect& roi,
                 float alpha, float beta, float minval)
-{ iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
+{ IU_TRACE_FUNCTION(); iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
 
 // edge filter + evaluation (8n); device; 32-bit; 1-channel
 void filterEdge(const iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C4* dst, const IuRect& roi,
                 float alpha, float beta, float minval)
-{ iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
+{ IU_TRACE_FUNCTION(); iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
 
 // edge filter + evaluation; device; 32-bit; 4-channel (RGB)
 void filterEdge(const iu::ImageGpu_32f_C4* src, iu::ImageGpu_32f_C1* dst, const IuRect& roi,
                 float alpha, float beta, float minval)
-{ iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
+{ IU_TRACE_FUNCTION(); iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
 
 // edge filter + evaluation; device; 32-bit; 4-channel (RGB)
 void filterEdge(const iu::ImageGpu_32f_C4* src, iu::ImageGpu_32f_C2* dst, const IuRect& roi,
                 float alpha, float beta, float minval)
-{ iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
+{ IU_TRACE_FUNCTION(); iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
 
 // edge filter + evaluation; device; 32-bit; 4-channel (RGB)
 void filterEdge(const iu::ImageGpu_32f_C4* src, iu::ImageGpu_32f_C4* dst, const IuRect& roi,
                 float alpha, float beta, float minval)
-{ iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
+{ IU_TRACE_FUNCTION(); iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
+
+// edge filter; host; 32-bit; 1-channel
+void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C2* dst, const IuRect& roi)
+{ IU_TRACE_FUNCTION(); iuprivate::filterEdge(src, dst, roi); }
+
+// edge filter + evaluation; host; 32-bit; 1-channel
+void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, const IuRect& roi,
+                float alpha, float beta, float minval)
+{ IU_TRACE_FUNCTION(); iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
+
+// edge filter + evaluation (4n); host; 32-bit; 1-channel
+void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C2* dst, const IuRect& roi,
+                float alpha, float beta, float minval)
+{ IU_TRACE_FUNCTION(); iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
+
+// edge filter + evaluation (8n); host; 32-bit; 1-channel
+void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C4* dst, const IuRect& roi,
+                float alpha, float beta, float minval)
+{ IU_TRACE_FUNCTION(); iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
+
+// edge filter + evaluation; host; 32-bit; 4-channel (RGB)
+void filterEdge(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C1* dst, const IuRect& roi,
+                float alpha, float beta, float minval)
+{ IU_TRACE_FUNCTION(); iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
+
+// edge filter + evaluation; host; 32-bit; 4-channel (RGB)
+void filterEdge(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C2* dst, const IuRect& roi,
+                float alpha, float beta, float minval)
+{ IU_TRACE_FUNCTION(); iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
+
+// edge filter + evaluation; host; 32-bit; 4-channel (RGB)
+void filterEdge(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst, const IuRect& roi,
+                float alpha, float beta, float minval)
+{ IU_TRACE_FUNCTION(); iuprivate::filterEdge(src, dst, roi, alpha, beta, minval); }
+
+
+
+/* ***************************************************************************
+     edge preserving filters
+ * ***************************************************************************/
+void filterGuided(const iu::ImageCpu_32f_C1* src, const iu::ImageCpu_32f_C1* guide,
+                  iu::ImageCpu_32f_C1* dst, int radius, float eps)
+{ IU_TRACE_FUNCTION(); iuprivate::filterGuided(src, guide, dst, radius, eps); }
+void filterGuided(const iu::ImageCpu_32f_C4* src, const iu::ImageCpu_32f_C1* guide,
+                  iu::ImageCpu_32f_C4* dst, int radius, float eps)
+{ IU_TRACE_FUNCTION(); iuprivate::filterGuided(src, guide, dst, radius, eps); }
+
+void filterBilateral(const iu::ImageCpu_32f_C1* src, const iu::ImageCpu_32f_C1* guide,
+                     iu::ImageCpu_32f_C1* dst, float sigma_spatial, float sigma_range)
+{ IU_TRACE_FUNCTION(); iuprivate::filterBilateral(src, guide, dst, sigma_spatial, sigma_range); }
+void filterBilateral(const iu::ImageCpu_32f_C4* src, const iu::ImageCpu_32f_C1* guide,
+                     iu::ImageCpu_32f_C4* dst, float sigma_spatial, float sigma_range)
+{ IU_TRACE_FUNCTION(); iuprivate::filterBilateral(src, guide, dst, sigma_spatial, sigma_range); }
+
+
+/* ***************************************************************************
+     convolution
+ * ***************************************************************************/
+void filterSeparable(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                     const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                     IuBorderType border, float border_value)
+{ IU_TRACE_FUNCTION(); iuprivate::filterSeparable(src, dst, kernel_x, size_x, kernel_y, size_y, border, border_value); }
+void filterSeparable(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                     const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                     IuBorderType border, float border_value)
+{ IU_TRACE_FUNCTION(); iuprivate::filterSeparable(src, dst, kernel_x, size_x, kernel_y, size_y, border, border_value); }
+void filterSeparable(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                     const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                     IuBorderType border, float border_value)
+{ IU_TRACE_FUNCTION(); iuprivate::filterSeparable(src, dst, kernel_x, size_x, kernel_y, size_y, border, border_value); }
+void filterSeparable(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                     const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                     IuBorderType border, float border_value)
+{ IU_TRACE_FUNCTION(); iuprivate::filterSeparable(src, dst, kernel_x, size_x, kernel_y, size_y, border, border_value); }
+void filterConvolve(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                    const float* kernel, const IuSize& kernel_size,
+                    IuBorderType border, float border_value)
+{ IU_TRACE_FUNCTION(); iuprivate::filterConvolve(src, dst, kernel, kernel_size, border, border_value); }
+void filterConvolve(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                    const float* kernel, const IuSize& kernel_size,
+                    IuBorderType border, float border_value)
+{ IU_TRACE_FUNCTION(); iuprivate::filterConvolve(src, dst, kernel, kernel_size, border, border_value); }
+void filterConvolve(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                    const float* kernel, const IuSize& kernel_size,
+                    IuBorderType border, float border_value)
+{ IU_TRACE_FUNCTION(); iuprivate::filterConvolve(src, dst, kernel, kernel_size, border, border_value); }
+void filterConvolve(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                    const float* kernel, const IuSize& kernel_size,
+                    IuBorderType border, float border_value)
+{ IU_TRACE_FUNCTION(); iuprivate::filterConvolve(src, dst, kernel, kernel_size, border, border_value); }
+void filterCorrelate(const iu::ImageCpu_32f_C1* src, const iu::ImageCpu_32f_C1* templ,
+                     iu::ImageCpu_32f_C1* dst, IuConvolutionMethod method)
+{ IU_TRACE_FUNCTION(); iuprivate::filterCorrelate(src, templ, dst, method); }
+
+
+/* ***************************************************************************
+     morphology
+ * ***************************************************************************/
+void filterMorphology(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                      IuMorphologyType type, const IuSize& kernel_size)
+{ IU_TRACE_FUNCTION(); iuprivate::filterMorphology(src, dst, type, kernel_size); }
+void filterMorphology(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                      IuMorphologyType type, const IuSize& kernel_size)
+{ IU_TRACE_FUNCTION(); iuprivate::filterMorphology(src, dst, type, kernel_size); }
 
+void filterErode(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst, const IuSize& kernel_size)
+{ IU_TRACE_FUNCTION(); iuprivate::filterMorphology(src, dst, IU_MORPHOLOGY_ERODE, kernel_size); }
+void filterErode(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, const IuSize& kernel_size)
+{ IU_TRACE_FUNCTION(); iuprivate::filterMorphology(src, dst, IU_MORPHOLOGY_ERODE, kernel_size); }
+void filterDilate(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst, const IuSize& kernel_size)
+{ IU_TRACE_FUNCTION(); iuprivate::filterMorphology(src, dst, IU_MORPHOLOGY_DILATE, kernel_size); }
+void filterDilate(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, const IuSize& kernel_size)
+{ IU_TRACE_FUNCTION(); iuprivate::filterMorphology(src, dst, IU_MORPHOLOGY_DILATE, kernel_size); }
+void filterOpen(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst, const IuSize& kernel_size)
+{ IU_TRACE_FUNCTION(); iuprivate::filterMorphology(src, dst, IU_MORPHOLOGY_OPEN, kernel_size); }
+void filterOpen(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, const IuSize& kernel_size)
+{ IU_TRACE_FUNCTION(); iuprivate::filterMorphology(src, dst, IU_MORPHOLOGY_OPEN, kernel_size); }
+void filterClose(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst, const IuSize& kernel_size)
+{ IU_TRACE_FUNCTION(); iuprivate::filterMorphology(src, dst, IU_MORPHOLOGY_CLOSE, kernel_size); }
+void filterClose(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, const IuSize& kernel_size)
+{ IU_TRACE_FUNCTION(); iuprivate::filterMorphology(src, dst, IU_MORPHOLOGY_CLOSE, kernel_size); }
+void filterMorphGradient(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst, const IuSize& kernel_size)
+{ IU_TRACE_FUNCTION(); iuprivate::filterMorphology(src, dst, IU_MORPHOLOGY_GRADIENT, kernel_size); }
+void filterMorphGradient(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, const IuSize& kernel_size)
+{ IU_TRACE_FUNCTION(); iuprivate::filterMorphology(src, dst, IU_MORPHOLOGY_GRADIENT, kernel_size); }
 
 
 /* ***************************************************************************
      other filters
  * ***************************************************************************/
 void cubicBSplinePrefilter(iu::ImageGpu_32f_C1* srcdst)
-{ iuprivate::cubicBSplinePrefilter(srcdst); }
+{ IU_TRACE_FUNCTION(); iuprivate::cubicBSplinePrefilter(srcdst); }
+void cubicBSplinePrefilter(iu::ImageCpu_32f_C1* srcdst)
+{ IU_TRACE_FUNCTION(); iuprivate::cubicBSplinePrefilter(srcdst); }
+void cubicBSplinePrefilter(iu::ImageCpu_32f_C4* srcdst)
+{ IU_TRACE_FUNCTION(); iuprivate::cubicBSplinePrefilter(srcdst); }
+void cubicBSplinePrefilter(iu::VolumeCpu_32f_C1* srcdst)
+{ IU_TRACE_FUNCTION(); iuprivate::cubicBSplinePrefilter(srcdst); }
 
 } // namespace iu
@@ -71,6 +71,53 @@ IUCORE_DLLAPI void filterGauss(const VolumeGpu_32f_C1* src, VolumeGpu_32f_C1* ds
 IUCORE_DLLAPI void filterGauss(const ImageGpu_32f_C4* src, ImageGpu_32f_C4* dst, const IuRect& roi,
                                float sigma, int kernel_size=0);
 
+/** Host versions of the Gaussian filter (clamped borders).
+ * Color images are filtered in the planar layout (see iu::convert) so every
+ * channel is processed as a contiguous float plane.
+ */
+IUCORE_DLLAPI void filterGauss(const ImageCpu_32f_C1* src, ImageCpu_32f_C1* dst, const IuRect& roi,
+                               float sigma, int kernel_size=0);
+IUCORE_DLLAPI void filterGauss(const ImagePlanarCpu_32f_C3* src, ImagePlanarCpu_32f_C3* dst, const IuRect& roi,
+                               float sigma, int kernel_size=0);
+IUCORE_DLLAPI void filterGauss(const ImagePlanarCpu_32f_C4* src, ImagePlanarCpu_32f_C4* dst, const IuRect& roi,
+                               float sigma, int kernel_size=0);
+
+/** TV (ROF) Denoising
+ * \brief Minimizes sum w*|grad u| + lambda/2*|u - f|^2 with the accelerated primal-dual
+ * algorithm of Chambolle and Pock. Every iteration is a single pass over the image.
+ * Color images are denoised per channel (all four channels).
+ * \param src Noisy image f [host].
+ * \param dst Denoised image u [host]; has to differ from \a src.
+ * \param lambda Weight of the data term (smaller values smooth more).
+ * \param num_iterations Maximal number of iterations.
+ * \param weights Optional edge weights w of the pixels, e.g. from iu::filterEdge [host]. If 0, w = 1.
+ * \param tolerance The iterations stop when sum |u - u_old| <= tolerance*sum |u| (0: no check).
+ * \param check_interval Number of iterations between two convergence checks.
+ * \return Number of iterations done.
+ */
+IUCORE_DLLAPI unsigned int denoiseTV(const ImageCpu_32f_C1* src, ImageCpu_32f_C1* dst, float lambda,
+                                     unsigned int num_iterations=100, const ImageCpu_32f_C1* weights=0,
+                                     float tolerance=0.0f, unsigned int check_interval=10);
+IUCORE_DLLAPI unsigned int denoiseTV(const ImageCpu_32f_C4* src, ImageCpu_32f_C4* dst, float lambda,
+                                     unsigned int num_iterations=100, const ImageCpu_32f_C1* weights=0,
+                                     float tolerance=0.0f, unsigned int check_interval=10);
+
+/** TGV Denoising
+ * \brief Minimizes sum alpha1*w*|grad u - v| + alpha0*|grad v| + lambda/2*|u - f|^2 (second order
+ * total generalized variation; piecewise affine instead of piecewise constant results) with the
+ * primal-dual algorithm of Chambolle and Pock. Parameters as for iu::denoiseTV.
+ * \param alpha1 Weight of the first order term.
+ * \param alpha0 Weight of the second order term.
+ */
+IUCORE_DLLAPI unsigned int denoiseTGV2(const ImageCpu_32f_C1* src, ImageCpu_32f_C1* dst, float lambda,
+                                       float alpha1=1.0f, float alpha0=2.0f, unsigned int num_iterations=100,
+                                       const ImageCpu_32f_C1* weights=0,
+                                       float tolerance=0.0f, unsigned int check_interval=10);
+IUCORE_DLLAPI unsigned int denoiseTGV2(const ImageCpu_32f_C4* src, ImageCpu_32f_C4* dst, float lambda,
+                                       float alpha1=1.0f, float alpha0=2.0f, unsigned int num_iterations=100,
+                                       const ImageCpu_32f_C1* weights=0,
+                                       float tolerance=0.0f, unsigned int check_interval=10);
+
 /** @} */ // end of Denoising
 
 
@@ -79,6 +126,19 @@ IUCORE_DLLAPI void filterGauss(const ImageGpu_32f_C4* src, ImageGpu_32f_C4* dst,
  * ***************************************************************************/
 
 
+/** Edge Filter
+ * \brief Computes edge weights max(minval, exp(-alpha*|grad|^beta)) with forward differences.
+ * The version without evaluation parameters returns the plain gradient. The 2-channel outputs hold
+ * the weights in x and y direction, the 4-channel outputs additionally the two diagonal directions.
+ * 4-channel inputs are treated as RGB images (the 4th channel is ignored).
+ * \param src Source image [device or host].
+ * \param dst Destination image [device or host]
+ * \param roi Region of interest in the dsetination image.
+ * \param alpha, beta, minval Parameters of the weighting function.
+ *
+ * \note The host versions evaluate exp/pow with fast approximations; the relative error of a
+ *       weight is below 3e-7 + (4e-7 + 1.5e-7*beta*max(1,|log2|grad||))*alpha*|grad|^beta.
+ */
 IUCORE_DLLAPI void filterEdge(const iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C2* dst, const IuRect& roi);
 
 IUCORE_DLLAPI void filterEdge(const iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C1* dst, const IuRect& roi,
@@ -99,6 +159,160 @@ IUCORE_DLLAPI void filterEdge(const iu::ImageGpu_32f_C4* src, iu::ImageGpu_32f_C
 IUCORE_DLLAPI void filterEdge(const iu::ImageGpu_32f_C4* src, iu::ImageGpu_32f_C4* dst, const IuRect& roi,
                               float alpha, float beta, float minval);
 
+IUCORE_DLLAPI void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C2* dst, const IuRect& roi);
+
+IUCORE_DLLAPI void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, const IuRect& roi,
+                              float alpha, float beta, float minval);
+
+IUCORE_DLLAPI void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C2* dst, const IuRect& roi,
+                              float alpha, float beta, float minval);
+
+IUCORE_DLLAPI void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C4* dst, const IuRect& roi,
+                              float alpha, float beta, float minval);
+
+IUCORE_DLLAPI void filterEdge(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C1* dst, const IuRect& roi,
+                              float alpha, float beta, float minval);
+
+IUCORE_DLLAPI void filterEdge(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C2* dst, const IuRect& roi,
+                              float alpha, float beta, float minval);
+
+IUCORE_DLLAPI void filterEdge(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst, const IuRect& roi,
+                              float alpha, float beta, float minval);
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+/* ***************************************************************************
+     edge preserving filters
+ * ***************************************************************************/
+
+/** Guided Filter
+ * \brief Edge preserving smoothing of \a src with the local linear model of the guided filter
+ * (He et al.). The box means use running sums, so the cost per pixel does not depend on \a radius.
+ * \param src Source image [host].
+ * \param guide Guide image [host]. If 0, \a src itself (1-channel) or the mean of its RGB channels (4-channel) is used.
+ * \param dst Destination image [host]. Can be the source image (in-place).
+ * \param radius Radius of the (2*radius+1)^2 box windows (clipped at the image border).
+ * \param eps Regularization; edges with a local variance of the guide well above eps are preserved.
+ */
+IUCORE_DLLAPI void filterGuided(const iu::ImageCpu_32f_C1* src, const iu::ImageCpu_32f_C1* guide,
+                                iu::ImageCpu_32f_C1* dst, int radius, float eps);
+IUCORE_DLLAPI void filterGuided(const iu::ImageCpu_32f_C4* src, const iu::ImageCpu_32f_C1* guide,
+                                iu::ImageCpu_32f_C4* dst, int radius, float eps);
+
+/** Bilateral Filter
+ * \brief (Joint) bilateral filter approximated on a bilateral grid (Chen et al.).
+ * The grid has one cell per sigma_spatial pixels and per sigma_range guide values (at most 256 cells
+ * in range direction), so the cost per pixel is constant and the memory is bounded by the grid size.
+ * \param src Source image [host].
+ * \param guide Guide (edge) image [host]. If 0, \a src itself (1-channel) or the mean of its RGB channels (4-channel) is used.
+ * \param dst Destination image [host]. Can be the source image (in-place).
+ * \param sigma_spatial Spatial standard deviation in pixels (>= 1).
+ * \param sigma_range Standard deviation of the guide values.
+ */
+IUCORE_DLLAPI void filterBilateral(const iu::ImageCpu_32f_C1* src, const iu::ImageCpu_32f_C1* guide,
+                                   iu::ImageCpu_32f_C1* dst, float sigma_spatial, float sigma_range);
+IUCORE_DLLAPI void filterBilateral(const iu::ImageCpu_32f_C4* src, const iu::ImageCpu_32f_C1* guide,
+                                   iu::ImageCpu_32f_C4* dst, float sigma_spatial, float sigma_range);
+
+
+//////////////////////////////////////////////////////////////////////////////
+/* ***************************************************************************
+     convolution
+ * ***************************************************************************/
+
+/** Separable Convolution
+ * \brief Filters a host image with the row kernel \a kernel_x followed by the column kernel
+ * \a kernel_y. The kernels are applied as correlation (not mirrored) and anchored at
+ * (size_x-1)/2 and (size_y-1)/2. Kernels with 3, 5, 7 or 9 taps run unrolled. 8-bit results
+ * are rounded and saturated; 4-channel images are filtered per channel.
+ * \param src Source image [host].
+ * \param dst Destination image [host]. Can be the source image (in-place).
+ * \param kernel_x, size_x Row kernel and its number of taps.
+ * \param kernel_y, size_y Column kernel and its number of taps.
+ * \param border Border handling (see IuBorderType).
+ * \param border_value Value outside the image for IU_BORDER_CONSTANT.
+ */
+IUCORE_DLLAPI void filterSeparable(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                                   const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                                   IuBorderType border=IU_BORDER_REPLICATE, float border_value=0.0f);
+IUCORE_DLLAPI void filterSeparable(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                                   const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                                   IuBorderType border=IU_BORDER_REPLICATE, float border_value=0.0f);
+IUCORE_DLLAPI void filterSeparable(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                                   const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                                   IuBorderType border=IU_BORDER_REPLICATE, float border_value=0.0f);
+IUCORE_DLLAPI void filterSeparable(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                                   const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                                   IuBorderType border=IU_BORDER_REPLICATE, float border_value=0.0f);
+
+/** 2D Convolution
+ * \brief Filters a host image with a non-separable kernel (row-major, kernel_size.width taps
+ * per row), applied and anchored as in filterSeparable. Separable kernels are considerably
+ * faster with filterSeparable. For large kernels the 32-bit 1-channel version switches to
+ * the FFT of overlapping tiles when this is cheaper by the estimated cost.
+ * \param src Source image [host].
+ * \param dst Destination image [host]. Can be the source image (in-place).
+ * \param kernel, kernel_size Kernel coefficients and size.
+ * \param border Border handling (see IuBorderType).
+ * \param border_value Value outside the image for IU_BORDER_CONSTANT.
+ */
+IUCORE_DLLAPI void filterConvolve(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                                  const float* kernel, const IuSize& kernel_size,
+                                  IuBorderType border=IU_BORDER_REPLICATE, float border_value=0.0f);
+IUCORE_DLLAPI void filterConvolve(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                                  const float* kernel, const IuSize& kernel_size,
+                                  IuBorderType border=IU_BORDER_REPLICATE, float border_value=0.0f);
+IUCORE_DLLAPI void filterConvolve(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                                  const float* kernel, const IuSize& kernel_size,
+                                  IuBorderType border=IU_BORDER_REPLICATE, float border_value=0.0f);
+IUCORE_DLLAPI void filterConvolve(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                                  const float* kernel, const IuSize& kernel_size,
+                                  IuBorderType border=IU_BORDER_REPLICATE, float border_value=0.0f);
+
+/** Correlation with a template
+ * \brief dst(x,y) = sum_ij templ(i,j)*src(x+i,y+j) for all positions where the template lies
+ * within the source image (no border handling).
+ * \param src Source image [host].
+ * \param templ Template [host]; at most as large as the source.
+ * \param dst Destination image [host] of size (source size - template size + 1).
+ * \param method Direct summation, FFT of overlapping tiles or chosen by the estimated cost.
+ */
+IUCORE_DLLAPI void filterCorrelate(const iu::ImageCpu_32f_C1* src, const iu::ImageCpu_32f_C1* templ,
+                                   iu::ImageCpu_32f_C1* dst, IuConvolutionMethod method=IU_CONVOLUTION_AUTO);
+
+
+//////////////////////////////////////////////////////////////////////////////
+/* ***************************************************************************
+     morphology
+ * ***************************************************************************/
+
+/** Morphological Filter
+ * \brief Erosion, dilation, opening, closing or morphological gradient with a rectangular
+ * structuring element anchored at ((width-1)/2, (height-1)/2). The element is clipped at the
+ * image border. The van Herk/Gil-Werman algorithm needs about three comparisons per pixel
+ * and direction, independent of the size of the structuring element.
+ * \param src Source image [host].
+ * \param dst Destination image [host]. Can be the source image (in-place).
+ * \param type Operation (see IuMorphologyType).
+ * \param kernel_size Size of the structuring element.
+ */
+IUCORE_DLLAPI void filterMorphology(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                                    IuMorphologyType type, const IuSize& kernel_size);
+IUCORE_DLLAPI void filterMorphology(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                                    IuMorphologyType type, const IuSize& kernel_size);
+
+/** Shortcuts for filterMorphology with the respective IuMorphologyType. */
+IUCORE_DLLAPI void filterErode(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst, const IuSize& kernel_size);
+IUCORE_DLLAPI void filterErode(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, const IuSize& kernel_size);
+IUCORE_DLLAPI void filterDilate(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst, const IuSize& kernel_size);
+IUCORE_DLLAPI void filterDilate(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, const IuSize& kernel_size);
+IUCORE_DLLAPI void filterOpen(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst, const IuSize& kernel_size);
+IUCORE_DLLAPI void filterOpen(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, const IuSize& kernel_size);
+IUCORE_DLLAPI void filterClose(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst, const IuSize& kernel_size);
+IUCORE_DLLAPI void filterClose(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, const IuSize& kernel_size);
+IUCORE_DLLAPI void filterMorphGradient(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst, const IuSize& kernel_size);
+IUCORE_DLLAPI void filterMorphGradient(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, const IuSize& kernel_size);
 
 
 //////////////////////////////////////////////////////////////////////////////
@@ -106,7 +320,15 @@ IUCORE_DLLAPI void filterEdge(const iu::ImageGpu_32f_C4* src, iu::ImageGpu_32f_C
      other filters
  * ***************************************************************************/
 
+/** Cubic B-Spline prefilter
+ * \brief Converts the samples of \a srcdst (in-place) into cubic bspline coefficients.
+ * The coefficients are needed for exact cubic spline interpolation (e.g. IU_INTERPOLATE_CUBIC_SPLINE).
+ * \param srcdst Image/Volume that is converted [device or host].
+ */
 IUCORE_DLLAPI void cubicBSplinePrefilter(iu::ImageGpu_32f_C1* srcdst);
+IUCORE_DLLAPI void cubicBSplinePrefilter(iu::ImageCpu_32f_C1* srcdst);
+IUCORE_DLLAPI void cubicBSplinePrefilter(iu::ImageCpu_32f_C4* srcdst);
+IUCORE_DLLAPI void cubicBSplinePrefilter(iu::VolumeCpu_32f_C1* srcdst);
 
 
 /** @} */ // end of Filter Module
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Filter Module
+ * Class       : FftPlan, FftReal2d
+ * Language    : C++
+ * Description : Implementation of the host FFT (mixed radix 2/3/4/5, split complex)
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifdef WIN32
+  #include <windows.h>
+#else
+  #include <pthread.h>
+#endif
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <map>
+#include <iucutil.h>
+#include "filterkernels.h"
+#include "fft_cpu.h"
+
+namespace iuprivate {
+
+/* ***************************************************************************
+ *  FftPlan
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+FftPlan::FftPlan(int n) :
+  n_(n)
+{
+  if(!isFastSize(n))
+    throw IuException("FFT length has to be a product of 2, 3 and 5", __FILE__, __FUNCTION__, __LINE__);
+
+  // radix 4 first (fewest passes), the odd radices last
+  const double pi = 3.14159265358979323846;
+  int length = n;
+  while(length > 1)
+  {
+    Stage stage;
+    stage.radix = (length%4 == 0) ? 4 : (length%2 == 0) ? 2 : (length%3 == 0) ? 3 : 5;
+    stage.m = length/stage.radix;
+    stage.offset = (int)twiddle_re_.size();
+    for(int p=0; p<stage.m; ++p)
+    {
+      for(int j=1; j<stage.radix; ++j)
+      {
+        const double angle = -2.0*pi*(double)(p*j)/(double)length;
+        twiddle_re_.push_back((float)cos(angle));
+        twiddle_im_.push_back((float)sin(angle));
+      }
+    }
+    stages_.push_back(stage);
+    length = stage.m;
+  }
+  // the kernels read the twiddles of a stage even if it has none
+  twiddle_re_.push_back(0.0f);
+  twiddle_im_.push_back(0.0f);
+}
+
+//-----------------------------------------------------------------------------
+void FftPlan::transform(float* re, float* im, float* work_re, float* work_im,
+                        int batch, bool inverse) const
+{
+  const FilterKernels& kernels = filterKernels();
+  float* x_re = re;
+  float* x_im = im;
+  float* y_re = work_re;
+  float* y_im = work_im;
+  int stride = batch;
+  for(size_t s=0; s<stages_.size(); ++s)
+  {
+    const Stage& stage = stages_[s];
+    kernels.fftPass(stage.radix, stage.m, stride,
+                    &twiddle_re_[stage.offset], &twiddle_im_[stage.offset],
+                    x_re, x_im, y_re, y_im, inverse ? 1 : 0);
+    std::swap(x_re, y_re);
+    std::swap(x_im, y_im);
+    stride *= stage.radix;
+  }
+  if(x_re != re)
+  {
+    memcpy(re, x_re, (size_t)n_*batch*sizeof(float));
+    memcpy(im, x_im, (size_t)n_*batch*sizeof(float));
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool FftPlan::isFastSize(int n)
+{
+  if(n < 1)
+    return false;
+  while(n%2 == 0) n /= 2;
+  while(n%3 == 0) n /= 3;
+  while(n%5 == 0) n /= 5;
+  return n == 1;
+}
+
+//-----------------------------------------------------------------------------
+int FftPlan::fastSize(int n)
+{
+  n = IUMAX(n, 2);
+  n += n%2;
+  while(!isFastSize(n))
+    n += 2;
+  return n;
+}
+
+//-----------------------------------------------------------------------------
+namespace {
+
+// Plans are created on first use and never released; the lock is only held
+// for the lookup.
+class FftPlanCache
+{
+public:
+  FftPlanCache()
+  {
+#ifdef WIN32
+    InitializeCriticalSection(&lock_);
+#else
+    pthread_mutex_init(&lock_, 0);
+#endif
+  }
+
+  const FftPlan& plan(int n)
+  {
+    lock();
+    std::map<int, FftPlan*>::iterator it = plans_.find(n);
+    FftPlan* plan = 0;
+    if(it != plans_.end())
+      plan = it->second;
+    else
+    {
+      try
+      {
+        plan = new FftPlan(n);
+      }
+      catch(...)
+      {
+        unlock();
+        throw;
+      }
+      plans_[n] = plan;
+    }
+    unlock();
+    return *plan;
+  }
+
+private:
+  void lock()
+  {
+#ifdef WIN32
+    EnterCriticalSection(&lock_);
+#else
+    pthread_mutex_lock(&lock_);
+#endif
+  }
+
+  void unlock()
+  {
+#ifdef WIN32
+    LeaveCriticalSection(&lock_);
+#else
+    pthread_mutex_unlock(&lock_);
+#endif
+  }
+
+  std::map<int, FftPlan*> plans_;
+#ifdef WIN32
+  CRITICAL_SECTION lock_;
+#else
+  pthread_mutex_t lock_;
+#endif
+};
+
+} // namespace
+
+const FftPlan& fftPlan(int n)
+{
+  static FftPlanCache* cache = new FftPlanCache;
+  return cache->plan(n);
+}
+
+/* ***************************************************************************
+ *  FftReal2d
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+FftReal2d::FftReal2d(int rows, int columns) :
+  rows_(rows),
+  columns_(columns)
+{
+  if(rows%2 != 0 || columns%2 != 0)
+    throw IuException("2D real FFT needs an even size", __FILE__, __FUNCTION__, __LINE__);
+  plan_rows_ = &fftPlan(rows);
+  plan_columns_ = &fftPlan(columns);
+  const size_t pairs = (size_t)rows*(columns/2);
+  pairs_re_.resize(pairs);
+  pairs_im_.resize(pairs);
+  const size_t work = IUMAX(pairs, (size_t)spectrumSize());
+  work_re_.resize(work);
+  work_im_.resize(work);
+}
+
+//-----------------------------------------------------------------------------
+/* Z = FFT(x_2b + i*x_2b+1) along the rows gives both real spectra as
+ *   X_2b[k] = (Z[k] + conj(Z[R-k]))/2,  X_2b+1[k] = -i*(Z[k] - conj(Z[R-k]))/2,
+ * of which only k <= R/2 is kept (the rest is conjugate symmetric).
+ */
+void FftReal2d::forwardPairs(float* spec_re, float* spec_im)
+{
+  const int half = columns_/2;
+  const int k_num = rows_/2+1;
+  plan_rows_->transform(&pairs_re_[0], &pairs_im_[0], &work_re_[0], &work_im_[0], half, false);
+
+  for(int k=0; k<k_num; ++k)
+  {
+    const float* z_re = &pairs_re_[(size_t)k*half];
+    const float* z_im = &pairs_im_[(size_t)k*half];
+    const float* n_re = &pairs_re_[(size_t)((rows_-k)%rows_)*half];
+    const float* n_im = &pairs_im_[(size_t)((rows_-k)%rows_)*half];
+    for(int b=0; b<half; ++b)
+    {
+      const size_t even = (size_t)(2*b)*k_num + k;
+      spec_re[even] = 0.5f*(z_re[b] + n_re[b]);
+      spec_im[even] = 0.5f*(z_im[b] - n_im[b]);
+      spec_re[even + k_num] = 0.5f*(z_im[b] + n_im[b]);
+      spec_im[even + k_num] = 0.5f*(n_re[b] - z_re[b]);
+    }
+  }
+
+  plan_columns_->transform(spec_re, spec_im, &work_re_[0], &work_im_[0], k_num, false);
+}
+
+//-----------------------------------------------------------------------------
+void FftReal2d::inversePairs(float* spec_re, float* spec_im)
+{
+  const int half = columns_/2;
+  const int k_num = rows_/2+1;
+  plan_columns_->transform(spec_re, spec_im, &work_re_[0], &work_im_[0], k_num, true);
+
+  // Z = X_2b + i*X_2b+1 with X[R-k] = conj(X[k])
+  for(int k=0; k<rows_; ++k)
+  {
+    const int kk = (k < k_num) ? k : rows_-k;
+    const float sign = (k < k_num) ? 1.0f : -1.0f;
+    float* z_re = &pairs_re_[(size_t)k*half];
+    float* z_im = &pairs_im_[(size_t)k*half];
+    for(int b=0; b<half; ++b)
+    {
+      const size_t even = (size_t)(2*b)*k_num + kk;
+      z_re[b] = spec_re[even] - sign*spec_im[even + k_num];
+      z_im[b] = sign*spec_im[even] + spec_re[even + k_num];
+    }
+  }
+
+  plan_rows_->transform(&pairs_re_[0], &pairs_im_[0], &work_re_[0], &work_im_[0], half, true);
+}
+
+//-----------------------------------------------------------------------------
+void FftReal2d::forward(const float* src, size_t stride, float* spec_re, float* spec_im)
+{
+  const int half = columns_/2;
+  for(int y=0; y<rows_; ++y)
+  {
+    const float* s = src + y*stride;
+    float* p_re = &pairs_re_[(size_t)y*half];
+    float* p_im = &pairs_im_[(size_t)y*half];
+    for(int b=0; b<half; ++b)
+    {
+      p_re[b] = s[2*b];
+      p_im[b] = s[2*b+1];
+    }
+  }
+  forwardPairs(spec_re, spec_im);
+}
+
+//-----------------------------------------------------------------------------
+void FftReal2d::inverse(float* spec_re, float* spec_im, float* dst, size_t stride)
+{
+  inversePairs(spec_re, spec_im);
+  const int half = columns_/2;
+  for(int y=0; y<rows_; ++y)
+  {
+    float* d = dst + y*stride;
+    const float* p_re = &pairs_re_[(size_t)y*half];
+    const float* p_im = &pairs_im_[(size_t)y*half];
+    for(int b=0; b<half; ++b)
+    {
+      d[2*b] = p_re[b];
+      d[2*b+1] = p_im[b];
+    }
+  }
+}
+
+} // namespace iuprivate
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Filter Module
+ * Class       : FftPlan, FftReal2d
+ * Language    : C++
+ * Description : Definition of the host FFT (mixed radix 2/3/4/5, split complex)
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IUPRIVATE_FFT_CPU_H
+#define IUPRIVATE_FFT_CPU_H
+
+#include <cstddef>
+#include <vector>
+
+namespace iuprivate {
+
+/** Complex FFT of a length with the prime factors 2, 3 and 5 (Stockham, i.e.
+ * without bit reversal). Real and imaginary parts are kept in separate arrays.
+ * A transform runs over a batch of interleaved sequences: element n of sequence b
+ * is stored at n*batch + b, so every stage is a loop over contiguous vectors.
+ */
+class FftPlan
+{
+public:
+  explicit FftPlan(int n);
+
+  int size() const { return n_; }
+
+  /** In-place transform of \a batch sequences; the work arrays hold size()*batch
+   * values each. The inverse is not scaled.
+   */
+  void transform(float* re, float* im, float* work_re, float* work_im,
+                 int batch, bool inverse) const;
+
+  /** Returns true if \a n only has the prime factors 2, 3 and 5. */
+  static bool isFastSize(int n);
+
+  /** Returns the smallest even fast size >= \a n. */
+  static int fastSize(int n);
+
+private:
+  struct Stage
+  {
+    int radix;
+    int m;        // length after this stage
+    int offset;   // into the twiddles
+  };
+
+  int n_;
+  std::vector<Stage> stages_;
+  std::vector<float> twiddle_re_;
+  std::vector<float> twiddle_im_;
+};
+
+/** Returns the cached plan for length \a n (plans are created once and shared
+ * by all threads).
+ */
+const FftPlan& fftPlan(int n);
+
+/** 2D FFT of real images with an even number of rows and columns. Two columns
+ * are transformed as one complex sequence and the spectrum is stored transposed,
+ * i.e. as columns() x (rows()/2+1) complex values; only spectra of the same size
+ * are combined, so the layout does not matter to the users.
+ */
+class FftReal2d
+{
+public:
+  FftReal2d(int rows, int columns);
+
+  int rows() const { return rows_; }
+  int columns() const { return columns_; }
+  /** number of complex values of a spectrum */
+  int spectrumSize() const { return columns_*(rows_/2+1); }
+
+  /** Transforms rows() x columns() real values (row stride \a stride) into the
+   * spectrum \a spec_re, \a spec_im.
+   */
+  void forward(const float* src, size_t stride, float* spec_re, float* spec_im);
+
+  /** Transforms the spectrum back to real values (scaled by rows()*columns()).
+   * The spectrum is overwritten.
+   */
+  void inverse(float* spec_re, float* spec_im, float* dst, size_t stride);
+
+  /** Input/output of the column pairs: rows() x columns()/2 values, column 2b
+   * of row n is pairsRe()[n*columns()/2 + b], column 2b+1 the same in pairsIm().
+   * Filling them directly saves the copy of a dense tile.
+   */
+  float* pairsRe() { return &pairs_re_[0]; }
+  float* pairsIm() { return &pairs_im_[0]; }
+
+  /** forward() after the pairs are filled (column 2b in re, 2b+1 in im). */
+  void forwardPairs(float* spec_re, float* spec_im);
+
+  /** inverse() leaving the result in the pairs. */
+  void inversePairs(float* spec_re, float* spec_im);
+
+private:
+  int rows_;
+  int columns_;
+  const FftPlan* plan_rows_;
+  const FftPlan* plan_columns_;
+  std::vector<float> pairs_re_;
+  std::vector<float> pairs_im_;
+  std::vector<float> work_re_;
+  std::vector<float> work_im_;
+};
+
+} // namespace iuprivate
+
+#endif // IUPRIVATE_FFT_CPU_H
@@ -63,9 +63,36 @@ void filterGauss(const iu::VolumeGpu_32f_C1* src, iu::VolumeGpu_32f_C1* dst,
 void filterGauss(const iu::ImageGpu_32f_C4* src, iu::ImageGpu_32f_C4* dst,
                  const IuRect& roi, float sigma, int kernel_size);
 
+// host (filtergauss_cpu.cpp); 32-bit; 1-channel and planar 3-/4-channel
+void filterGauss(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                 const IuRect& roi, float sigma, int kernel_size);
+void filterGauss(const iu::ImagePlanarCpu_32f_C3* src, iu::ImagePlanarCpu_32f_C3* dst,
+                 const IuRect& roi, float sigma, int kernel_size);
+void filterGauss(const iu::ImagePlanarCpu_32f_C4* src, iu::ImagePlanarCpu_32f_C4* dst,
+                 const IuRect& roi, float sigma, int kernel_size);
+
+// TV and TGV denoising; host (filterdenoise_cpu.cpp); 32-bit; 1- and 4-channel
+unsigned int denoiseTV(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, float lambda,
+                       unsigned int num_iterations, const iu::ImageCpu_32f_C1* weights,
+                       float tolerance, unsigned int check_interval);
+unsigned int denoiseTV(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst, float lambda,
+                       unsigned int num_iterations, const iu::ImageCpu_32f_C1* weights,
+                       float tolerance, unsigned int check_interval);
+unsigned int denoiseTGV2(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, float lambda,
+                         float alpha1, float alpha0, unsigned int num_iterations,
+                         const iu::ImageCpu_32f_C1* weights, float tolerance, unsigned int check_interval);
+unsigned int denoiseTGV2(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst, float lambda,
+                         float alpha1, float alpha0, unsigned int num_iterations,
+                         const iu::ImageCpu_32f_C1* weights, float tolerance, unsigned int check_interval);
+
 
 // Cubic B-Spline coefficients prefilter
 void cubicBSplinePrefilter(iu::ImageGpu_32f_C1* srcdst);
+// host (filterbspline_cpu.cpp)
+void cubicBSplinePrefilter(iu::ImageCpu_32f_C1* srcdst);
+void cubicBSplinePrefilter(iu::ImageCpu_32f_C2* srcdst);
+void cubicBSplinePrefilter(iu::ImageCpu_32f_C4* srcdst);
+void cubicBSplinePrefilter(iu::VolumeCpu_32f_C1* srcdst);
 
 // Edge Filters
 void filterEdge(const iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C2* dst, const IuRect& roi);
@@ -82,6 +109,72 @@ void filterEdge(const iu::ImageGpu_32f_C4* src, iu::ImageGpu_32f_C2* dst, const
 void filterEdge(const iu::ImageGpu_32f_C4* src, iu::ImageGpu_32f_C4* dst, const IuRect& roi,
                     float alpha, float beta, float minval);
 
+// Edge Filters; host (filteredge_cpu.cpp)
+void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C2* dst, const IuRect& roi);
+void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, const IuRect& roi,
+                float alpha, float beta, float minval);
+void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C2* dst, const IuRect& roi,
+                float alpha, float beta, float minval);
+void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C4* dst, const IuRect& roi,
+                float alpha, float beta, float minval);
+void filterEdge(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C1* dst, const IuRect& roi,
+                float alpha, float beta, float minval);
+void filterEdge(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C2* dst, const IuRect& roi,
+                float alpha, float beta, float minval);
+void filterEdge(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst, const IuRect& roi,
+                float alpha, float beta, float minval);
+
+// Edge preserving filters; host (filteredgepreserving_cpu.cpp)
+// (guide == 0: the source itself, or the mean of RGB for 4-channel images)
+void filterGuided(const iu::ImageCpu_32f_C1* src, const iu::ImageCpu_32f_C1* guide,
+                  iu::ImageCpu_32f_C1* dst, int radius, float eps);
+void filterGuided(const iu::ImageCpu_32f_C4* src, const iu::ImageCpu_32f_C1* guide,
+                  iu::ImageCpu_32f_C4* dst, int radius, float eps);
+void filterBilateral(const iu::ImageCpu_32f_C1* src, const iu::ImageCpu_32f_C1* guide,
+                     iu::ImageCpu_32f_C1* dst, float sigma_spatial, float sigma_range);
+void filterBilateral(const iu::ImageCpu_32f_C4* src, const iu::ImageCpu_32f_C1* guide,
+                     iu::ImageCpu_32f_C4* dst, float sigma_spatial, float sigma_range);
+
+// Separable and 2D convolution; host (filterconvolve_cpu.cpp)
+void filterSeparable(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                     const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                     IuBorderType border, float border_value);
+void filterSeparable(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                     const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                     IuBorderType border, float border_value);
+void filterSeparable(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                     const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                     IuBorderType border, float border_value);
+void filterSeparable(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                     const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                     IuBorderType border, float border_value);
+void filterConvolve(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                    const float* kernel, const IuSize& kernel_size,
+                    IuBorderType border, float border_value);
+void filterConvolve(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                    const float* kernel, const IuSize& kernel_size,
+                    IuBorderType border, float border_value);
+void filterConvolve(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                    const float* kernel, const IuSize& kernel_size,
+                    IuBorderType border, float border_value);
+void filterConvolve(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                    const float* kernel, const IuSize& kernel_size,
+                    IuBorderType border, float border_value);
+
+// FFT convolution and correlation; host (filterfft_cpu.cpp)
+bool fftConvolutionPreferred(const IuSize& size, const IuSize& kernel_size);
+void filterConvolveFFT(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                       const float* kernel, const IuSize& kernel_size,
+                       IuBorderType border, float border_value);
+void filterCorrelate(const iu::ImageCpu_32f_C1* src, const iu::ImageCpu_32f_C1* templ,
+                     iu::ImageCpu_32f_C1* dst, IuConvolutionMethod method);
+
+// Morphology; host (filtermorphology_cpu.cpp)
+void filterMorphology(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                      IuMorphologyType type, const IuSize& kernel_size);
+void filterMorphology(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                      IuMorphologyType type, const IuSize& kernel_size);
+
 } // namespace iuprivate
 
 #endif // IUPRIVATE_FILTER_H
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Filter Module
+ * Class       : none
+ * Language    : C++
+ * Description : Border index mapping of the host filters
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IUPRIVATE_FILTERBORDER_H
+#define IUPRIVATE_FILTERBORDER_H
+
+#include <iucore/coredefs.h>
+
+namespace iuprivate {
+
+/** Returns the index of the sample used for position \a i of a line with \a n
+ * samples, or -1 where the border value is used (IU_BORDER_CONSTANT).
+ */
+inline int borderIndex(int i, int n, IuBorderType border)
+{
+  if(i >= 0 && i < n)
+    return i;
+  switch(border)
+  {
+  case IU_BORDER_REPLICATE:
+    return (i < 0) ? 0 : n-1;
+  case IU_BORDER_REFLECT:
+  {
+    const int period = 2*n;
+    i %= period;
+    if(i < 0)
+      i += period;
+    return (i < n) ? i : period-1-i;
+  }
+  case IU_BORDER_WRAP:
+    i %= n;
+    return (i < 0) ? i+n : i;
+  default:
+    return -1;
+  }
+}
+
+/** Throws for unknown border types. */
+inline void checkBorder(IuBorderType border)
+{
+  if(border != IU_BORDER_REPLICATE && border != IU_BORDER_REFLECT &&
+     border != IU_BORDER_CONSTANT && border != IU_BORDER_WRAP)
+    throw IuException("unknown border type", __FILE__, __FUNCTION__, __LINE__);
+}
+
+} // namespace iuprivate
+
+#endif // IUPRIVATE_FILTERBORDER_H
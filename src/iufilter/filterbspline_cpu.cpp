@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Filter Module
+ * Class       : none
+ * Language    : C++
+ * Description : Host implementation of the cubic bspline coefficient prefilter
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <math.h>
+#include <vector>
+#include <iucutil.h>
+#include <iucore/executor.h>
+#include "filter.h"
+
+namespace iuprivate {
+
+/* ***************************************************************************
+ *  Host recursive filters for creating cubic bspline coefficients
+ * ***************************************************************************/
+// Same recursion (and boundary handling) as filterbspline_kernels.cu which is
+// based on the work of Philippe Thevenaz.
+// See <http://bigwww.epfl.ch/thevenaz/interpolation/>
+//
+// Instead of filtering one line at a time, every function below filters \a lanes
+// neighbouring lines at once: sample n of lane l is stored at c[n*step + l].
+// The lanes are contiguous in memory, so the inner loops are plain SIMD loops.
+
+// number of columns (floats) filtered together by one thread in the vertical passes
+static const int BSPLINE_COLUMN_STRIP = 256;
+// number of rows transposed into one block for the horizontal pass
+static const int BSPLINE_ROW_BLOCK = 8;
+
+//-----------------------------------------------------------------------------
+static void convertToInterpolationCoefficients(float* coeffs, unsigned int length,
+                                               size_t step, int lanes)
+{
+  // a single sample is its own coefficient
+  if(length < 2)
+    return;
+
+  const float pole = sqrtf(3.0f)-2.0f;  // pole for cubic b-spline
+  // overall gain
+  const float lambda = (1.0f - pole) * (1.0f - 1.0f / pole);
+  const unsigned int horizon = IUMIN(28u, length);
+
+  // causal initialization (mirror boundaries; accelerated loop)
+  float* c0 = coeffs;
+  float zn = pole;
+  for(unsigned int n=1; n<horizon; ++n)
+  {
+    const float* cn = coeffs + n*step;
+    for(int l=0; l<lanes; ++l)
+      c0[l] += zn * cn[l];
+    zn *= pole;
+  }
+  for(int l=0; l<lanes; ++l)
+    c0[l] *= lambda;
+
+  // causal recursion
+  for(unsigned int n=1; n<length; ++n)
+  {
+    float* c = coeffs + n*step;
+    const float* prev = c - step;
+    for(int l=0; l<lanes; ++l)
+      c[l] = lambda * c[l] + pole * prev[l];
+  }
+
+  // anticausal initialization (mirror boundaries)
+  float* last = coeffs + (length-1)*step;
+  const float* before_last = last - step;
+  const float anticausal_gain = pole / (pole * pole - 1.0f);
+  for(int l=0; l<lanes; ++l)
+    last[l] = anticausal_gain * (pole * before_last[l] + last[l]);
+
+  // anticausal recursion
+  for(int n=(int)length-2; n>=0; --n)
+  {
+    float* c = coeffs + n*step;
+    const float* next = c + step;
+    for(int l=0; l<lanes; ++l)
+      c[l] = pole * (next[l] - c[l]);
+  }
+}
+
+//-----------------------------------------------------------------------------
+/* Filters along x. Blocks of rows are transposed into a buffer so that the
+ * recursion runs over all rows (and channels) of the block simultaneously.
+ */
+struct SamplesToCoefficientsBlocksX
+{
+  float* image;
+  unsigned int width;
+  unsigned int height;
+  size_t stride;
+  int channels;
+
+  void operator()(int begin, int end) const
+  {
+    std::vector<float> block(width*BSPLINE_ROW_BLOCK*channels);
+
+    for(int b=begin; b<end; ++b)
+    {
+      const unsigned int y0 = b*BSPLINE_ROW_BLOCK;
+      const int rows = IUMIN((int)(height-y0), BSPLINE_ROW_BLOCK);
+      const int lanes = rows*channels;
+
+      // transpose in
+      for(int r=0; r<rows; ++r)
+      {
+        const float* line = image + (y0+r)*stride;
+        for(unsigned int x=0; x<width; ++x)
+          for(int c=0; c<channels; ++c)
+            block[x*lanes + r*channels + c] = line[x*channels + c];
+      }
+
+      convertToInterpolationCoefficients(&block[0], width, lanes, lanes);
+
+      // transpose out
+      for(int r=0; r<rows; ++r)
+      {
+        float* line = image + (y0+r)*stride;
+        for(unsigned int x=0; x<width; ++x)
+          for(int c=0; c<channels; ++c)
+            line[x*channels + c] = block[x*lanes + r*channels + c];
+      }
+    }
+  }
+};
+
+static void samplesToCoefficientsX(float* image, unsigned int width, unsigned int height,
+                                   size_t stride, int channels)
+{
+  SamplesToCoefficientsBlocksX body;
+  body.image = image;
+  body.width = width;
+  body.height = height;
+  body.stride = stride;
+  body.channels = channels;
+
+  const int num_blocks = (height + BSPLINE_ROW_BLOCK - 1) / BSPLINE_ROW_BLOCK;
+  iu::parallelFor(0, num_blocks, body,
+                  iu::Executor::rowGrain(width*BSPLINE_ROW_BLOCK*channels));
+}
+
+//-----------------------------------------------------------------------------
+/* Filters along the axis with the distance \a step (in floats) between samples.
+ * Every chunk processes strips of neighbouring columns directly in place.
+ */
+struct SamplesToCoefficientsStrips
+{
+  float* image;
+  unsigned int row_length;
+  unsigned int length;
+  size_t step;
+
+  void operator()(int begin, int end) const
+  {
+    for(int s=begin; s<end; ++s)
+    {
+      const unsigned int x0 = s*BSPLINE_COLUMN_STRIP;
+      const int lanes = IUMIN((int)(row_length-x0), BSPLINE_COLUMN_STRIP);
+      convertToInterpolationCoefficients(image + x0, length, step, lanes);
+    }
+  }
+};
+
+static void samplesToCoefficientsStrided(float* image, unsigned int row_length,
+                                         unsigned int length, size_t step)
+{
+  SamplesToCoefficientsStrips body;
+  body.image = image;
+  body.row_length = row_length;
+  body.length = length;
+  body.step = step;
+
+  const int num_strips = (row_length + BSPLINE_COLUMN_STRIP - 1) / BSPLINE_COLUMN_STRIP;
+  iu::parallelFor(0, num_strips, body, iu::Executor::rowGrain(length*BSPLINE_COLUMN_STRIP));
+}
+
+//-----------------------------------------------------------------------------
+/* Filters a volume along z. Every tile of the first slice is a set of
+ * BSPLINE_COLUMN_STRIP wide strips whose lanes are filtered through all slices.
+ */
+struct SamplesToCoefficientsZ
+{
+  iu::VolumeCpu_32f_C1* volume;
+
+  void operator()(const IuRect& tile) const
+  {
+    for(int y=tile.y; y<tile.y+(int)tile.height; ++y)
+      convertToInterpolationCoefficients(volume->data(tile.x,y,0), volume->depth(),
+                                         volume->slice_stride(), tile.width);
+  }
+};
+
+//-----------------------------------------------------------------------------
+static void cubicBSplinePrefilter2D(float* image, unsigned int width, unsigned int height,
+                                    size_t stride, int channels)
+{
+  if(width == 0 || height == 0)
+    return;
+
+  samplesToCoefficientsX(image, width, height, stride, channels);
+  samplesToCoefficientsStrided(image, width*channels, height, stride);
+}
+
+/* ***************************************************************************
+ *  FUNCTION IMPLEMENTATIONS
+ * ***************************************************************************/
+
+// host; 32-bit; 1-channel
+void cubicBSplinePrefilter(iu::ImageCpu_32f_C1* srcdst)
+{
+  cubicBSplinePrefilter2D(srcdst->data(), srcdst->width(), srcdst->height(),
+                          srcdst->stride(), 1);
+}
+
+// host; 32-bit; 2-channel
+void cubicBSplinePrefilter(iu::ImageCpu_32f_C2* srcdst)
+{
+  cubicBSplinePrefilter2D(reinterpret_cast<float*>(srcdst->data()), srcdst->width(), srcdst->height(),
+                          2*srcdst->stride(), 2);
+}
+
+// host; 32-bit; 4-channel
+void cubicBSplinePrefilter(iu::ImageCpu_32f_C4* srcdst)
+{
+  cubicBSplinePrefilter2D(reinterpret_cast<float*>(srcdst->data()), srcdst->width(), srcdst->height(),
+                          4*srcdst->stride(), 4);
+}
+
+// host; volume; 32-bit; 1-channel
+void cubicBSplinePrefilter(iu::VolumeCpu_32f_C1* srcdst)
+{
+  const unsigned int width = srcdst->width();
+  const unsigned int height = srcdst->height();
+  const unsigned int depth = srcdst->depth();
+  if(width == 0 || height == 0 || depth == 0)
+    return;
+
+  // x and y direction slice by slice
+  for(unsigned int z=0; z<depth; ++z)
+    cubicBSplinePrefilter2D(srcdst->data(0,0,z), width, height, srcdst->stride(), 1);
+
+  // z direction: rows of the first slice are the lanes
+  SamplesToCoefficientsZ body;
+  body.volume = srcdst;
+  const unsigned int strip_width = IUMIN(width, (unsigned int)BSPLINE_COLUMN_STRIP);
+  iu::parallelForTiles(IuRect(0, 0, width, height), body, strip_width,
+                       iu::Executor::rowGrain(strip_width*depth));
+}
+
+} // namespace iuprivate
@@ -0,0 +1,446 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Filter Module
+ * Class       : none
+ * Language    : C++
+ * Description : Host implementation of the separable and 2D convolution with border modes
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <string.h>
+#include <vector>
+#include <iucutil.h>
+#include <iucore/executor.h>
+#include <iucore/cpukernels.h>
+#include "filterkernels.h"
+#include "filter.h"
+#include "filterborder.h"
+
+namespace iuprivate {
+
+//-----------------------------------------------------------------------------
+/* A line buffer holds width pixels of interleaved channels at pixel offset left
+ * and is followed by right pixels. Only these pad pixels are filled from the
+ * line itself, the image is never copied into a padded buffer.
+ */
+static inline void fillPixel(float* interior, int p, int width, int channels,
+                             IuBorderType border, float value)
+{
+  const int i = borderIndex(p, width, border);
+  for(int c=0; c<channels; ++c)
+    interior[p*channels + c] = (i < 0) ? value : interior[i*channels + c];
+}
+
+static void fillBorder(float* line, int width, int channels, int left, int right,
+                       IuBorderType border, float value)
+{
+  float* interior = line + left*channels;
+  for(int p=-left; p<0; ++p)
+    fillPixel(interior, p, width, channels, border, value);
+  for(int p=width; p<width+right; ++p)
+    fillPixel(interior, p, width, channels, border, value);
+}
+
+//-----------------------------------------------------------------------------
+/* Source rows as float; 8-bit rows are converted once per chunk and cached.
+ * The slot is given by the unmapped row index i, the rows of a window thus
+ * never share a slot (also not when the border maps two of them to one row).
+ */
+template<typename T>
+struct SourceRows
+{
+  const T* src;
+  size_t stride;
+  int n;
+  std::vector<float> buffer;
+  std::vector<int> tags;
+  const CpuKernels* kernels;
+
+  SourceRows(const T* _src, size_t _stride, int _n, int slots, const CpuKernels* _kernels) :
+    src(_src), stride(_stride), n(_n), buffer((size_t)slots*_n), tags(slots, -1), kernels(_kernels)
+  {
+  }
+
+  const float* row(int i, int y)
+  {
+    const int slot = i % (int)tags.size();
+    float* r = &buffer[(size_t)slot*n];
+    if(tags[slot] != y)
+    {
+      kernels->convertRow_8u32f(src + y*stride, r, n, 1.0f, 0.0f);
+      tags[slot] = y;
+    }
+    return r;
+  }
+};
+
+template<>
+struct SourceRows<float>
+{
+  const float* src;
+  size_t stride;
+
+  SourceRows(const float* _src, size_t _stride, int, int, const CpuKernels*) :
+    src(_src), stride(_stride)
+  {
+  }
+
+  const float* row(int, int y) { return src + y*stride; }
+};
+
+//-----------------------------------------------------------------------------
+// float result row -> destination
+static inline void storeRow(const CpuKernels&, const float* s, float* d, int n)
+{
+  if(s != d)
+    memcpy(d, s, n*sizeof(float));
+}
+
+static inline void storeRow(const CpuKernels& kernels, const float* s, unsigned char* d, int n)
+{
+  kernels.saturateRow_32f8u(s, d, n);
+}
+
+//-----------------------------------------------------------------------------
+// image planes of interleaved channels in units of the channel type
+template<typename T>
+struct ConvolvePlanes
+{
+  const T* src;
+  size_t src_stride;
+  T* dst;
+  size_t dst_stride;
+  int width;
+  int height;
+  int channels;
+  IuBorderType border;
+  float border_value;
+};
+
+//-----------------------------------------------------------------------------
+/* Separable convolution. Per output row the vertical pass combines the border
+ * mapped source rows into the interior of a line buffer (one pass over the row
+ * for the common kernel lengths), the horizontal pass runs over the line after
+ * its few pad pixels are filled.
+ */
+template<typename T>
+struct SeparableRows
+{
+  ConvolvePlanes<T> p;
+  const float* kx;
+  int size_x;
+  const float* ky;
+  int size_y;
+  float pad_value;  // constant border after the vertical pass
+  const CpuKernels* kernels;
+  const FilterKernels* filter_kernels;
+
+  void operator()(int begin, int end) const
+  {
+    const int n = p.width*p.channels;
+    const int left = (size_x-1)/2;
+    const int right = size_x-1-left;
+    const int top = (size_y-1)/2;
+
+    SourceRows<T> rows(p.src, p.src_stride, n, size_y, kernels);
+    std::vector<float> constant_row(n, p.border_value);
+    std::vector<const float*> taps(size_y);
+    std::vector<float> line((size_t)(p.width+size_x-1)*p.channels);
+    std::vector<float> out(sizeof(T) == sizeof(float) ? 0 : n);
+
+    for(int y=begin; y<end; ++y)
+    {
+      for(int k=0; k<size_y; ++k)
+      {
+        const int i = y-top+k;
+        const int r = borderIndex(i, p.height, p.border);
+        taps[k] = (r < 0) ? &constant_row[0] : rows.row(i+top, r);
+      }
+      float* interior = &line[left*p.channels];
+      filter_kernels->convolveColumns(&taps[0], ky, size_y, interior, n);
+      fillBorder(&line[0], p.width, p.channels, left, right, p.border, pad_value);
+
+      float* o = out.empty() ? (float*)(p.dst + y*p.dst_stride) : &out[0];
+      filter_kernels->convolveRow(&line[0], kx, size_x, p.channels, o, n);
+      storeRow(*kernels, o, p.dst + y*p.dst_stride, n);
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+/* 2D convolution as a sum of 1D convolutions of the kernel rows. The padded
+ * lines of the source rows are cached per chunk, i.e. every row is converted
+ * and padded once while the chunk moves down the image.
+ */
+template<typename T>
+struct ConvolveRows
+{
+  ConvolvePlanes<T> p;
+  const float* kernel;
+  int size_x;
+  int size_y;
+  const CpuKernels* kernels;
+  const FilterKernels* filter_kernels;
+
+  void operator()(int begin, int end) const
+  {
+    const int n = p.width*p.channels;
+    const int left = (size_x-1)/2;
+    const int right = size_x-1-left;
+    const int top = (size_y-1)/2;
+    const int line_size = (p.width+size_x-1)*p.channels;
+
+    // slot size_y holds the constant line
+    std::vector<float> lines((size_t)(size_y+1)*line_size, p.border_value);
+    std::vector<int> tags(size_y, -1);
+    std::vector<float> acc(n);
+    std::vector<float> tmp(n);
+
+    for(int y=begin; y<end; ++y)
+    {
+      for(int k=0; k<size_y; ++k)
+      {
+        const int r = borderIndex(y-top+k, p.height, p.border);
+        const float* line = &lines[(size_t)size_y*line_size];
+        if(r >= 0)
+        {
+          const int slot = r % size_y;
+          float* l = &lines[(size_t)slot*line_size];
+          if(tags[slot] != r)
+          {
+            loadRow(p.src + r*p.src_stride, l + left*p.channels, n);
+            fillBorder(l, p.width, p.channels, left, right, p.border, p.border_value);
+            tags[slot] = r;
+          }
+          line = l;
+        }
+
+        const float* g = kernel + k*size_x;
+        if(k == 0)
+          filter_kernels->convolveRow(line, g, size_x, p.channels, &acc[0], n);
+        else
+        {
+          filter_kernels->convolveRow(line, g, size_x, p.channels, &tmp[0], n);
+          kernels->axpyRow(&tmp[0], 1.0f, &acc[0], n);
+        }
+      }
+      storeRow(*kernels, &acc[0], p.dst + y*p.dst_stride, n);
+    }
+  }
+
+  inline void loadRow(const float* s, float* d, int n) const
+  {
+    memcpy(d, s, n*sizeof(float));
+  }
+
+  inline void loadRow(const unsigned char* s, float* d, int n) const
+  {
+    kernels->convertRow_8u32f(s, d, n, 1.0f, 0.0f);
+  }
+};
+
+//-----------------------------------------------------------------------------
+template<typename T>
+static ConvolvePlanes<T> convolvePlanes(const T* src, size_t src_stride, T* dst, size_t dst_stride,
+                                        int width, int height, int channels,
+                                        IuBorderType border, float border_value,
+                                        std::vector<T>& copy)
+{
+  checkBorder(border);
+
+  // the rows are streamed from top to bottom and cannot be filtered in-place
+  if(src == dst)
+  {
+    const int n = width*channels;
+    copy.resize((size_t)n*height);
+    for(int y=0; y<height; ++y)
+      memcpy(&copy[(size_t)y*n], src + y*src_stride, n*sizeof(T));
+    src = &copy[0];
+    src_stride = n;
+  }
+
+  ConvolvePlanes<T> p;
+  p.src = src;
+  p.src_stride = src_stride;
+  p.dst = dst;
+  p.dst_stride = dst_stride;
+  p.width = width;
+  p.height = height;
+  p.channels = channels;
+  p.border = border;
+  p.border_value = border_value;
+  return p;
+}
+
+//-----------------------------------------------------------------------------
+template<typename T>
+static void filterSeparable(const T* src, size_t src_stride, T* dst, size_t dst_stride,
+                            int width, int height, int channels,
+                            const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                            IuBorderType border, float border_value)
+{
+  if(kernel_x == 0 || kernel_y == 0 || size_x < 1 || size_y < 1)
+    throw IuException("kernels have to have at least one tap", __FILE__, __FUNCTION__, __LINE__);
+
+  std::vector<T> copy;
+  SeparableRows<T> body;
+  body.p = convolvePlanes(src, src_stride, dst, dst_stride, width, height, channels,
+                          border, border_value, copy);
+  body.kx = kernel_x;
+  body.size_x = size_x;
+  body.ky = kernel_y;
+  body.size_y = size_y;
+  float sum_y = 0.0f;
+  for(int k=0; k<size_y; ++k)
+    sum_y += kernel_y[k];
+  body.pad_value = border_value*sum_y;
+  body.kernels = &cpuKernels();
+  body.filter_kernels = &filterKernels();
+  iu::parallelFor(0, height, body,
+                  iu::Executor::rowGrain((size_x+size_y)*width*channels));
+}
+
+//-----------------------------------------------------------------------------
+template<typename T>
+static void filterConvolve(const T* src, size_t src_stride, T* dst, size_t dst_stride,
+                           int width, int height, int channels,
+                           const float* kernel, const IuSize& kernel_size,
+                           IuBorderType border, float border_value)
+{
+  if(kernel == 0 || kernel_size.width == 0 || kernel_size.height == 0)
+    throw IuException("kernel has to have at least one tap", __FILE__, __FUNCTION__, __LINE__);
+
+  std::vector<T> copy;
+  ConvolveRows<T> body;
+  body.p = convolvePlanes(src, src_stride, dst, dst_stride, width, height, channels,
+                          border, border_value, copy);
+  body.kernel = kernel;
+  body.size_x = kernel_size.width;
+  body.size_y = kernel_size.height;
+  body.kernels = &cpuKernels();
+  body.filter_kernels = &filterKernels();
+  iu::parallelFor(0, height, body,
+                  iu::Executor::rowGrain((body.size_x+1)*body.size_y*width*channels));
+}
+
+//-----------------------------------------------------------------------------
+template<class Image>
+static void checkSizes(const Image* src, const Image* dst)
+{
+  if(src->size() != dst->size())
+    throw IuException("source and destination image have to be of the same size",
+                      __FILE__, __FUNCTION__, __LINE__);
+}
+
+/* ***************************************************************************
+ *  FUNCTION IMPLEMENTATIONS
+ * ***************************************************************************/
+
+// host; 8-bit; 1-channel
+void filterSeparable(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                     const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                     IuBorderType border, float border_value)
+{
+  checkSizes(src, dst);
+  filterSeparable(src->data(), src->stride(), dst->data(), dst->stride(),
+                  src->width(), src->height(), 1,
+                  kernel_x, size_x, kernel_y, size_y, border, border_value);
+}
+
+// host; 8-bit; 4-channel
+void filterSeparable(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                     const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                     IuBorderType border, float border_value)
+{
+  checkSizes(src, dst);
+  filterSeparable((const unsigned char*)src->data(), 4*src->stride(),
+                  (unsigned char*)dst->data(), 4*dst->stride(),
+                  src->width(), src->height(), 4,
+                  kernel_x, size_x, kernel_y, size_y, border, border_value);
+}
+
+// host; 32-bit; 1-channel
+void filterSeparable(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                     const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                     IuBorderType border, float border_value)
+{
+  checkSizes(src, dst);
+  filterSeparable(src->data(), src->stride(), dst->data(), dst->stride(),
+                  src->width(), src->height(), 1,
+                  kernel_x, size_x, kernel_y, size_y, border, border_value);
+}
+
+// host; 32-bit; 4-channel
+void filterSeparable(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                     const float* kernel_x, int size_x, const float* kernel_y, int size_y,
+                     IuBorderType border, float border_value)
+{
+  checkSizes(src, dst);
+  filterSeparable((const float*)src->data(), 4*src->stride(),
+                  (float*)dst->data(), 4*dst->stride(),
+                  src->width(), src->height(), 4,
+                  kernel_x, size_x, kernel_y, size_y, border, border_value);
+}
+
+// host; 8-bit; 1-channel
+void filterConvolve(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                    const float* kernel, const IuSize& kernel_size,
+                    IuBorderType border, float border_value)
+{
+  checkSizes(src, dst);
+  filterConvolve(src->data(), src->stride(), dst->data(), dst->stride(),
+                 src->width(), src->height(), 1, kernel, kernel_size, border, border_value);
+}
+
+// host; 8-bit; 4-channel
+void filterConvolve(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                    const float* kernel, const IuSize& kernel_size,
+                    IuBorderType border, float border_value)
+{
+  checkSizes(src, dst);
+  filterConvolve((const unsigned char*)src->data(), 4*src->stride(),
+                 (unsigned char*)dst->data(), 4*dst->stride(),
+                 src->width(), src->height(), 4, kernel, kernel_size, border, border_value);
+}
+
+// host; 32-bit; 1-channel
+void filterConvolve(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                    const float* kernel, const IuSize& kernel_size,
+                    IuBorderType border, float border_value)
+{
+  checkSizes(src, dst);
+  if(fftConvolutionPreferred(src->size(), kernel_size))
+  {
+    filterConvolveFFT(src, dst, kernel, kernel_size, border, border_value);
+    return;
+  }
+  filterConvolve(src->data(), src->stride(), dst->data(), dst->stride(),
+                 src->width(), src->height(), 1, kernel, kernel_size, border, border_value);
+}
+
+// host; 32-bit; 4-channel
+void filterConvolve(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                    const float* kernel, const IuSize& kernel_size,
+                    IuBorderType border, float border_value)
+{
+  checkSizes(src, dst);
+  filterConvolve((const float*)src->data(), 4*src->stride(),
+                 (float*)dst->data(), 4*dst->stride(),
+                 src->width(), src->height(), 4, kernel, kernel_size, border, border_value);
+}
+
+} // namespace iuprivate
@@ -0,0 +1,436 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Filter Module
+ * Class       : none
+ * Language    : C++
+ * Description : Host implementation of the TV (ROF) and TGV denoising
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <string.h>
+#include <math.h>
+#include <vector>
+#include <iucutil.h>
+#include <iucore/executor.h>
+#include "filterkernels.h"
+#include "filter.h"
+
+namespace iuprivate {
+
+/* ***************************************************************************
+ *  TV and TGV denoising
+ * ***************************************************************************/
+// Primal-dual algorithm of Chambolle and Pock for
+//   TV:   min_u   sum w*|grad u| + lambda/2*|u - f|^2
+//   TGV2: min_u,v sum alpha1*w*|grad u - v| + alpha0*|grad v| + lambda/2*|u - f|^2
+// (grad v is the full Jacobian as in dp_tgv2). TV uses the accelerated variant
+// for the uniformly convex data term.
+//
+// An iteration is a single pass over the rows: the dual step of row y (it reads
+// the rows y and y+1 of the extrapolated primal variables) is followed by the
+// primal step of row y (it reads the dual rows y-1 and y), so every array is
+// read and written once. The rows are split into bands that are updated in
+// place; the only rows a band shares with its neighbours are the primal row
+// below its last row (still needed with the old values) and the dual row above
+// its first row (needed with the new values). Both are prepared in private rows
+// of the band before the pass.
+
+// squared norms of the discrete operators (tau*sigma*L^2 <= 1)
+static const float TV_NORM2 = 8.0f;
+static const float TGV2_NORM2 = 12.0f;
+// convexity used by the acceleration of TV (Chambolle, Pock 2011)
+static const float TV_GAMMA = 0.7f;
+// rows of the fields are aligned to 16 floats, consecutive planes are shifted by 80 floats
+static const size_t FIELD_ALIGNMENT = 16;
+static const size_t FIELD_OFFSET = 80;
+
+enum { UBAR = 0, PX, PY, VBAR1, VBAR2, V1, V2, Q1, Q2, Q3, Q4, NUM_FIELDS };
+static const int TV_FIELDS = PY + 1;
+// fields of the private rows: the dual fields above and the extrapolated primal fields below a band
+static const int DUAL_FIELDS[] = {PX, PY, Q1, Q2, Q3, Q4};
+static const int NUM_DUAL_FIELDS = 6;
+static const int EXTRAPOLATED_FIELDS[] = {UBAR, VBAR1, VBAR2};
+static const int NUM_EXTRAPOLATED_FIELDS = 3;
+
+//-----------------------------------------------------------------------------
+struct DenoiseBands
+{
+  float* u;
+  size_t u_stride;
+  const float* f;
+  size_t f_stride;
+  const float* w;
+  size_t w_stride;
+  float* field[NUM_FIELDS];
+  size_t stride;
+  // private rows of band b: field i of the row above at rows[(b*NUM_FIELDS + i)*n], the row below at
+  // rows[((bands + b)*NUM_FIELDS + i)*n]; zeros[n] for the dual variables outside the image
+  float* rows;
+  const float* zeros;
+  int n;
+  int height;
+  int step;
+  int bands;
+  bool tgv;
+  float sigma;
+  float tau;
+  float theta;
+  float lambda;
+  float alpha1;
+  float alpha0;
+  // sum |u - u_old| and sum |u| per band (0: no convergence check)
+  double* change;
+  double* norm;
+  const FilterKernels* kernels;
+
+  int begin(int band) const { return (int)((long long)band*height/bands); }
+  float* row(int i, int y) const { return field[i] + y*stride; }
+  float* above(int band, int i) const { return rows + ((size_t)band*NUM_FIELDS + i)*n; }
+  float* below(int band, int i) const { return rows + ((size_t)(bands + band)*NUM_FIELDS + i)*n; }
+
+  void dual(int y, float* const* out, float* const* down) const
+  {
+    const float* wy = w ? w + y*w_stride : 0;
+    kernels->tvDualRow(row(UBAR, y), down[UBAR], tgv ? row(VBAR1, y) : 0, tgv ? row(VBAR2, y) : 0,
+                       wy, sigma, alpha1, step, out[PX], out[PY], n);
+    if(tgv)
+      kernels->tgv2DualRow(row(VBAR1, y), row(VBAR2, y), down[VBAR1], down[VBAR2], sigma, alpha0, step,
+                           out[Q1], out[Q2], out[Q3], out[Q4], n);
+  }
+};
+
+//-----------------------------------------------------------------------------
+// private rows of the bands: the updated dual row above and the old primal row below
+struct DenoiseBandEdges
+{
+  const DenoiseBands* bands;
+
+  void operator()(int begin, int end) const
+  {
+    const DenoiseBands& s = *bands;
+    const int num_fields = s.tgv ? NUM_FIELDS : TV_FIELDS;
+    for(int band=begin; band<end; ++band)
+    {
+      const int y0 = s.begin(band);
+      const int y1 = s.begin(band+1);
+      if(y0 > 0)
+      {
+        float* out[NUM_FIELDS];
+        float* down[NUM_FIELDS];
+        for(int k=0; k<NUM_DUAL_FIELDS; ++k)
+        {
+          const int i = DUAL_FIELDS[k];
+          if(i >= num_fields)
+            continue;
+          out[i] = s.above(band, i);
+          memcpy(out[i], s.row(i, y0-1), s.n*sizeof(float));
+        }
+        for(int i=0; i<num_fields; ++i)
+          down[i] = s.row(i, y0);
+        s.dual(y0-1, out, down);
+      }
+      if(y1 < s.height)
+      {
+        for(int k=0; k<NUM_EXTRAPOLATED_FIELDS; ++k)
+        {
+          const int i = EXTRAPOLATED_FIELDS[k];
+          if(i < num_fields)
+            memcpy(s.below(band, i), s.row(i, y1), s.n*sizeof(float));
+        }
+      }
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+// one iteration of the rows of a band (in place)
+struct DenoiseBandSweep
+{
+  const DenoiseBands* bands;
+
+  void operator()(int begin, int end) const
+  {
+    const DenoiseBands& s = *bands;
+    const int num_fields = s.tgv ? NUM_FIELDS : TV_FIELDS;
+    for(int band=begin; band<end; ++band)
+    {
+      const int y0 = s.begin(band);
+      const int y1 = s.begin(band+1);
+      double change = 0.0;
+      double norm = 0.0;
+      for(int y=y0; y<y1; ++y)
+      {
+        float* cur[NUM_FIELDS];
+        float* down[NUM_FIELDS];
+        const float* up[NUM_FIELDS];
+        const float* last[NUM_FIELDS];
+        for(int i=0; i<num_fields; ++i)
+        {
+          cur[i] = s.row(i, y);
+          if(y+1 == s.height)
+            down[i] = cur[i];
+          else if(y+1 == y1)
+            down[i] = s.below(band, i);
+          else
+            down[i] = s.row(i, y+1);
+          if(y == 0)
+            up[i] = s.zeros;
+          else if(y == y0)
+            up[i] = s.above(band, i);
+          else
+            up[i] = s.row(i, y-1);
+          // the divergence ignores the y components of the last row
+          last[i] = (y+1 == s.height) ? s.zeros : cur[i];
+        }
+
+        s.dual(y, cur, down);
+
+        float* u = s.u + y*s.u_stride;
+        s.kernels->tvPrimalRow(s.f + y*s.f_stride, cur[PX], last[PY], up[PY], s.tau, s.lambda, s.theta,
+                               s.step, u, cur[UBAR], s.n);
+        if(s.tgv)
+          s.kernels->tgv2PrimalRow(cur[PX], cur[PY], cur[Q1], last[Q2], up[Q2], last[Q3], up[Q3], cur[Q4],
+                                   s.tau, s.theta, s.step, cur[V1], cur[V2], cur[VBAR1], cur[VBAR2], s.n);
+
+        if(s.change)
+        {
+          // ubar - u = theta*(u - u_old)
+          const float* ubar = cur[UBAR];
+          for(int x=0; x<s.n; ++x)
+          {
+            change += fabsf(ubar[x] - u[x]);
+            norm += fabsf(u[x]);
+          }
+        }
+      }
+      if(s.change)
+      {
+        s.change[band] = change/s.theta;
+        s.norm[band] = norm;
+      }
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+struct DenoiseInitRows
+{
+  const float* f;
+  size_t f_stride;
+  float* u;
+  size_t u_stride;
+  float* ubar;
+  size_t stride;
+  // weights of the pixels expanded to the channels
+  const float* w;
+  size_t w_stride;
+  float* w_dst;
+  size_t w_dst_stride;
+  int width;
+  int channels;
+
+  void operator()(int begin, int end) const
+  {
+    const int n = width*channels;
+    for(int y=begin; y<end; ++y)
+    {
+      const float* fy = f + y*f_stride;
+      memcpy(u + y*u_stride, fy, n*sizeof(float));
+      memcpy(ubar + y*stride, fy, n*sizeof(float));
+      if(w_dst)
+      {
+        const float* s = w + y*w_stride;
+        float* d = w_dst + y*w_dst_stride;
+        for(int x=0; x<width; ++x)
+          for(int c=0; c<channels; ++c)
+            d[x*channels + c] = s[x];
+      }
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+static unsigned int denoise(const float* f, size_t f_stride, float* u, size_t u_stride,
+                            int width, int height, int channels,
+                            const iu::ImageCpu_32f_C1* weights, bool tgv,
+                            float lambda, float alpha1, float alpha0, unsigned int num_iterations,
+                            float tolerance, unsigned int check_interval)
+{
+  const int n = width*channels;
+  const IuSize size(n, height);
+  const int num_fields = tgv ? NUM_FIELDS : TV_FIELDS;
+  // one block for all fields; the planes start at different offsets within a page so
+  // that the rows read and written together do not compete for the same cache sets
+  const size_t stride = (n + FIELD_ALIGNMENT-1)/FIELD_ALIGNMENT*FIELD_ALIGNMENT;
+  const size_t plane = stride*height + FIELD_OFFSET;
+  std::vector<float> storage(num_fields*plane + FIELD_ALIGNMENT, 0.0f);
+  float* block = &storage[0];
+  block += (FIELD_ALIGNMENT - ((size_t)block/sizeof(float))%FIELD_ALIGNMENT)%FIELD_ALIGNMENT;
+  iu::ImageCpu_32f_C1* expanded = (weights && channels > 1) ? new iu::ImageCpu_32f_C1(size) : 0;
+
+  DenoiseInitRows init;
+  init.f = f;
+  init.f_stride = f_stride;
+  init.u = u;
+  init.u_stride = u_stride;
+  init.ubar = block + UBAR*plane;
+  init.stride = stride;
+  init.w = weights ? weights->data() : 0;
+  init.w_stride = weights ? weights->stride() : 0;
+  init.w_dst = expanded ? expanded->data() : 0;
+  init.w_dst_stride = expanded ? expanded->stride() : 0;
+  init.width = width;
+  init.channels = channels;
+  iu::parallelFor(0, height, init, iu::Executor::rowGrain(2*n));
+
+  DenoiseBands s;
+  s.u = u;
+  s.u_stride = u_stride;
+  s.f = f;
+  s.f_stride = f_stride;
+  s.w = expanded ? expanded->data() : init.w;
+  s.w_stride = expanded ? expanded->stride() : init.w_stride;
+  for(int i=0; i<NUM_FIELDS; ++i)
+    s.field[i] = (i < num_fields) ? block + i*plane : 0;
+  s.stride = stride;
+  s.n = n;
+  s.height = height;
+  s.step = channels;
+  s.bands = IUMAX(1, IUMIN(iu::Executor::numThreads(),
+                           height/iu::Executor::rowGrain(num_fields*n)));
+  s.tgv = tgv;
+  s.lambda = lambda;
+  s.alpha1 = alpha1;
+  s.alpha0 = alpha0;
+  s.kernels = &filterKernels();
+
+  std::vector<float> rows((2*s.bands*NUM_FIELDS + 1)*(size_t)n, 0.0f);
+  s.rows = &rows[0];
+  s.zeros = &rows[2*s.bands*NUM_FIELDS*(size_t)n];
+  std::vector<double> change(s.bands);
+  std::vector<double> norm(s.bands);
+
+  DenoiseBandEdges edges;
+  edges.bands = &s;
+  DenoiseBandSweep sweep;
+  sweep.bands = &s;
+
+  const float step = 1.0f/sqrtf(tgv ? TGV2_NORM2 : TV_NORM2);
+  float tau = step;
+  float sigma = step;
+  unsigned int it = 0;
+  while(it < num_iterations)
+  {
+    s.sigma = sigma;
+    s.tau = tau;
+    s.theta = tgv ? 1.0f : 1.0f/sqrtf(1.0f + 2.0f*TV_GAMMA*lambda*tau);
+    ++it;
+    const bool check = (tolerance > 0.0f && check_interval > 0 && it%check_interval == 0);
+    s.change = check ? &change[0] : 0;
+    s.norm = check ? &norm[0] : 0;
+
+    if(s.bands > 1)
+      iu::parallelFor(0, s.bands, edges, 1);
+    iu::parallelFor(0, s.bands, sweep, 1);
+
+    if(!tgv)
+    {
+      tau = tau*s.theta;
+      sigma = sigma/s.theta;
+    }
+    if(check)
+    {
+      double sum_change = 0.0;
+      double sum_norm = 0.0;
+      for(int band=0; band<s.bands; ++band)
+      {
+        sum_change += change[band];
+        sum_norm += norm[band];
+      }
+      if(sum_change <= tolerance*sum_norm)
+        break;
+    }
+  }
+
+  delete expanded;
+  return it;
+}
+
+//-----------------------------------------------------------------------------
+template<typename ImageType>
+static void checkDenoiseArguments(const ImageType* src, const ImageType* dst,
+                                  const iu::ImageCpu_32f_C1* weights, float lambda)
+{
+  if(src->size() != dst->size())
+    throw IuException("source and destination image have to be of the same size",
+                      __FILE__, __FUNCTION__, __LINE__);
+  if(src == dst)
+    throw IuException("the source image is needed in all iterations (no in-place denoising)",
+                      __FILE__, __FUNCTION__, __LINE__);
+  if(weights && weights->size() != src->size())
+    throw IuException("the edge weights have to be of the image size", __FILE__, __FUNCTION__, __LINE__);
+  if(lambda <= 0.0f)
+    throw IuException("lambda has to be positive", __FILE__, __FUNCTION__, __LINE__);
+}
+
+/* ***************************************************************************
+ *  FUNCTION IMPLEMENTATIONS
+ * ***************************************************************************/
+
+// host; 32-bit; 1-channel
+unsigned int denoiseTV(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, float lambda,
+                       unsigned int num_iterations, const iu::ImageCpu_32f_C1* weights,
+                       float tolerance, unsigned int check_interval)
+{
+  checkDenoiseArguments(src, dst, weights, lambda);
+  return denoise(src->data(), src->stride(), dst->data(), dst->stride(), src->width(), src->height(), 1,
+                 weights, false, lambda, 1.0f, 0.0f, num_iterations, tolerance, check_interval);
+}
+
+// host; 32-bit; 4-channel
+unsigned int denoiseTV(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst, float lambda,
+                       unsigned int num_iterations, const iu::ImageCpu_32f_C1* weights,
+                       float tolerance, unsigned int check_interval)
+{
+  checkDenoiseArguments(src, dst, weights, lambda);
+  return denoise((const float*)src->data(), 4*src->stride(), (float*)dst->data(), 4*dst->stride(),
+                 src->width(), src->height(), 4,
+                 weights, false, lambda, 1.0f, 0.0f, num_iterations, tolerance, check_interval);
+}
+
+// host; 32-bit; 1-channel
+unsigned int denoiseTGV2(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, float lambda,
+                         float alpha1, float alpha0, unsigned int num_iterations,
+                         const iu::ImageCpu_32f_C1* weights, float tolerance, unsigned int check_interval)
+{
+  checkDenoiseArguments(src, dst, weights, lambda);
+  return denoise(src->data(), src->stride(), dst->data(), dst->stride(), src->width(), src->height(), 1,
+                 weights, true, lambda, alpha1, alpha0, num_iterations, tolerance, check_interval);
+}
+
+// host; 32-bit; 4-channel
+unsigned int denoiseTGV2(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst, float lambda,
+                         float alpha1, float alpha0, unsigned int num_iterations,
+                         const iu::ImageCpu_32f_C1* weights, float tolerance, unsigned int check_interval)
+{
+  checkDenoiseArguments(src, dst, weights, lambda);
+  return denoise((const float*)src->data(), 4*src->stride(), (float*)dst->data(), 4*dst->stride(),
+                 src->width(), src->height(), 4,
+                 weights, true, lambda, alpha1, alpha0, num_iterations, tolerance, check_interval);
+}
+
+} // namespace iuprivate
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Filter Module
+ * Class       : none
+ * Language    : C++
+ * Description : Host implementation of the edge filters
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <math.h>
+#include <iucutil.h>
+#include <iumath/fastmath.h>
+#include <iucore/executor.h>
+#include "filter.h"
+
+namespace iuprivate {
+
+/* ***************************************************************************
+ *  Edge weight evaluation
+ * ***************************************************************************/
+
+/* Evaluates max(minval, exp(-alpha*val^beta)) for val >= 0 with the fast
+ * approximations of iumath/fastmath.h. The relative error of the weight is below
+ * 3e-7 + (4e-7 + 1.5e-7*beta*max(1,|log2(val)|))*alpha*val^beta: the error bounds
+ * of fastPow and fastExp documented there, the first one scaled by the exponent.
+ * Weights this far off the exact value are well below any sensible minval anyway.
+ */
+struct EdgeWeight
+{
+  float neg_alpha_log2e; // -alpha*log2(e)
+  float beta;
+  float minval;
+  float pow_zero;        // 0^beta (pow of zero is not covered by fastPow)
+
+  EdgeWeight(float alpha, float _beta, float _minval) :
+    neg_alpha_log2e(-alpha*1.44269504f), beta(_beta), minval(_minval),
+    pow_zero(powf(0.0f, _beta))
+  {
+  }
+
+  inline float operator()(float val) const
+  {
+    const float p = val > 0.0f ? fastPow(val, beta) : pow_zero;
+    const float w = fastExp2(neg_alpha_log2e*p);
+    return w > minval ? w : minval;
+  }
+};
+
+/* ***************************************************************************
+ *  Per-pixel operations
+ * ***************************************************************************/
+// Every operation gets the center pixel c and its forward neighbours
+// r=(x+1,y), d=(x,y+1), dr=(x+1,y+1) and ur=(x+1,y-1) (clamped at the border)
+// and writes one output pixel. Only the first three color channels of 4-channel
+// input images are used (RGB).
+
+//-----------------------------------------------------------------------------
+// C1 -> C2 (gradient)
+struct EdgeOpGradient
+{
+  inline void operator()(const float* c, const float* r, const float* d,
+                         const float*, const float*, float* out) const
+  {
+    out[0] = r[0] - c[0];
+    out[1] = d[0] - c[0];
+  }
+};
+
+//-----------------------------------------------------------------------------
+// C1 -> C1 (weight of the gradient magnitude)
+struct EdgeOpC1C1
+{
+  EdgeWeight weight;
+  EdgeOpC1C1(const EdgeWeight& w) : weight(w) {}
+  inline void operator()(const float* c, const float* r, const float* d,
+                         const float*, const float*, float* out) const
+  {
+    const float gx = r[0] - c[0];
+    const float gy = d[0] - c[0];
+    out[0] = weight(sqrtf(gx*gx + gy*gy));
+  }
+};
+
+//-----------------------------------------------------------------------------
+// C1 -> C2 (weights in x and y direction)
+struct EdgeOpC1C2
+{
+  EdgeWeight weight;
+  EdgeOpC1C2(const EdgeWeight& w) : weight(w) {}
+  inline void operator()(const float* c, const float* r, const float* d,
+                         const float*, const float*, float* out) const
+  {
+    out[0] = weight(fabsf(r[0] - c[0]));
+    out[1] = weight(fabsf(d[0] - c[0]));
+  }
+};
+
+//-----------------------------------------------------------------------------
+// C1 -> C4 (weights in x, y and both diagonal directions)
+struct EdgeOpC1C4
+{
+  EdgeWeight weight;
+  EdgeOpC1C4(const EdgeWeight& w) : weight(w) {}
+  inline void operator()(const float* c, const float* r, const float* d,
+                         const float* dr, const float* ur, float* out) const
+  {
+    out[0] = weight(fabsf(r[0] - c[0]));
+    out[1] = weight(fabsf(d[0] - c[0]));
+    out[2] = weight(fabsf(dr[0] - c[0]));
+    out[3] = weight(fabsf(ur[0] - c[0]));
+  }
+};
+
+//-----------------------------------------------------------------------------
+// mean absolute difference over the RGB channels
+static inline float meanAbsDiffRGB(const float* a, const float* c)
+{
+  return (fabsf(a[0]-c[0]) + fabsf(a[1]-c[1]) + fabsf(a[2]-c[2])) / 3.0f;
+}
+
+//-----------------------------------------------------------------------------
+// C4 -> C1 (weight of the mean gradient magnitude over RGB)
+struct EdgeOpC4C1
+{
+  EdgeWeight weight;
+  EdgeOpC4C1(const EdgeWeight& w) : weight(w) {}
+  inline void operator()(const float* c, const float* r, const float* d,
+                         const float*, const float*, float* out) const
+  {
+    float sum = 0.0f;
+    for(int ch=0; ch<3; ++ch)
+    {
+      const float gx = r[ch] - c[ch];
+      const float gy = d[ch] - c[ch];
+      sum += sqrtf(gx*gx + gy*gy);
+    }
+    out[0] = weight(sum/3.0f);
+  }
+};
+
+//-----------------------------------------------------------------------------
+// C4 -> C2
+struct EdgeOpC4C2
+{
+  EdgeWeight weight;
+  EdgeOpC4C2(const EdgeWeight& w) : weight(w) {}
+  inline void operator()(const float* c, const float* r, const float* d,
+                         const float*, const float*, float* out) const
+  {
+    out[0] = weight(meanAbsDiffRGB(r, c));
+    out[1] = weight(meanAbsDiffRGB(d, c));
+  }
+};
+
+//-----------------------------------------------------------------------------
+// C4 -> C4
+struct EdgeOpC4C4
+{
+  EdgeWeight weight;
+  EdgeOpC4C4(const EdgeWeight& w) : weight(w) {}
+  inline void operator()(const float* c, const float* r, const float* d,
+                         const float* dr, const float* ur, float* out) const
+  {
+    out[0] = weight(meanAbsDiffRGB(r, c));
+    out[1] = weight(meanAbsDiffRGB(d, c));
+    out[2] = weight(meanAbsDiffRGB(dr, c));
+    out[3] = weight(meanAbsDiffRGB(ur, c));
+  }
+};
+
+/* ***************************************************************************
+ *  Row loop
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+/* Gradient computation and weighting are fused: every output pixel is written
+ * once, directly from the (at most) three source rows it depends on. The border
+ * pixel is handled separately so the inner loop has no clamping.
+ */
+template<int SrcChannels, int DstChannels, class Op>
+struct FilterEdgeRows
+{
+  const float* src;
+  size_t src_stride;
+  int width;
+  int height;
+  float* dst;
+  size_t dst_stride;
+  int x_begin;
+  int x_end;
+  const Op* op;
+
+  void operator()(int begin, int end) const
+  {
+    for(int y=begin; y<end; ++y)
+    {
+      const float* row = src + y*src_stride;
+      const float* row_down = src + IUMIN(y+1, height-1)*src_stride;
+      const float* row_up = src + IUMAX(y-1, 0)*src_stride;
+      float* out = dst + y*dst_stride;
+
+      // inner pixels (x+1 < width)
+      const int x_inner = IUMIN(x_end, width-1);
+      for(int x=x_begin; x<x_inner; ++x)
+      {
+        const int o = x*SrcChannels;
+        (*op)(row+o, row+o+SrcChannels, row_down+o, row_down+o+SrcChannels,
+              row_up+o+SrcChannels, out + x*DstChannels);
+      }
+      // last column (x+1 clamped)
+      if(x_inner < x_end)
+      {
+        const int o = x_inner*SrcChannels;
+        (*op)(row+o, row+o, row_down+o, row_down+o, row_up+o, out + x_inner*DstChannels);
+      }
+    }
+  }
+};
+
+template<int SrcChannels, int DstChannels, class Op>
+static void filterEdgeCpu(const float* src, size_t src_stride, int width, int height,
+                          float* dst, size_t dst_stride, const IuRect& roi, const Op& op)
+{
+  FilterEdgeRows<SrcChannels, DstChannels, Op> body;
+  body.src = src;
+  body.src_stride = src_stride;
+  body.width = width;
+  body.height = height;
+  body.dst = dst;
+  body.dst_stride = dst_stride;
+  body.x_begin = roi.x;
+  body.x_end = IUMIN(roi.x+(int)roi.width, width);
+  body.op = &op;
+  const int y_end = IUMIN(roi.y+(int)roi.height, height);
+  if(body.x_begin >= body.x_end || roi.y >= y_end)
+    return;
+
+  iu::parallelFor(roi.y, y_end, body, iu::Executor::rowGrain(body.x_end-body.x_begin));
+}
+
+/* ***************************************************************************
+ *  FUNCTION IMPLEMENTATIONS
+ * ***************************************************************************/
+
+// edge filter; host; 32-bit; 1-channel
+void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C2* dst, const IuRect& roi)
+{
+  filterEdgeCpu<1,2>(src->data(), src->stride(), src->width(), src->height(),
+                     reinterpret_cast<float*>(dst->data()), 2*dst->stride(), roi,
+                     EdgeOpGradient());
+}
+
+// edge filter + evaluation; host; 32-bit; 1-channel
+void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, const IuRect& roi,
+                float alpha, float beta, float minval)
+{
+  filterEdgeCpu<1,1>(src->data(), src->stride(), src->width(), src->height(),
+                     dst->data(), dst->stride(), roi,
+                     EdgeOpC1C1(EdgeWeight(alpha, beta, minval)));
+}
+
+// edge filter + evaluation (4n); host; 32-bit; 1-channel
+void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C2* dst, const IuRect& roi,
+                float alpha, float beta, float minval)
+{
+  filterEdgeCpu<1,2>(src->data(), src->stride(), src->width(), src->height(),
+                     reinterpret_cast<float*>(dst->data()), 2*dst->stride(), roi,
+                     EdgeOpC1C2(EdgeWeight(alpha, beta, minval)));
+}
+
+// edge filter + evaluation (8n); host; 32-bit; 1-channel
+void filterEdge(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C4* dst, const IuRect& roi,
+                float alpha, float beta, float minval)
+{
+  filterEdgeCpu<1,4>(src->data(), src->stride(), src->width(), src->height(),
+                     reinterpret_cast<float*>(dst->data()), 4*dst->stride(), roi,
+                     EdgeOpC1C4(EdgeWeight(alpha, beta, minval)));
+}
+
+// edge filter + evaluation; host; 32-bit; 4-channel (RGB)
+void filterEdge(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C1* dst, const IuRect& roi,
+                float alpha, float beta, float minval)
+{
+  filterEdgeCpu<4,1>(reinterpret_cast<const float*>(src->data()), 4*src->stride(),
+                     src->width(), src->height(),
+                     dst->data(), dst->stride(), roi,
+                     EdgeOpC4C1(EdgeWeight(alpha, beta, minval)));
+}
+
+// edge filter + evaluation; host; 32-bit; 4-channel (RGB)
+void filterEdge(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C2* dst, const IuRect& roi,
+                float alpha, float beta, float minval)
+{
+  filterEdgeCpu<4,2>(reinterpret_cast<const float*>(src->data()), 4*src->stride(),
+                     src->width(), src->height(),
+                     reinterpret_cast<float*>(dst->data()), 2*dst->stride(), roi,
+                     EdgeOpC4C2(EdgeWeight(alpha, beta, minval)));
+}
+
+// edge filter + evaluation; host; 32-bit; 4-channel (RGB)
+void filterEdge(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst, const IuRect& roi,
+                float alpha, float beta, float minval)
+{
+  filterEdgeCpu<4,4>(reinterpret_cast<const float*>(src->data()), 4*src->stride(),
+                     src->width(), src->height(),
+                     reinterpret_cast<float*>(dst->data()), 4*dst->stride(), roi,
+                     EdgeOpC4C4(EdgeWeight(alpha, beta, minval)));
+}
+
+} // namespace iuprivate
@@ -0,0 +1,679 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Filter Module
+ * Class       : none
+ * Language    : C++
+ * Description : Host implementation of the edge preserving filters (guided filter, bilateral grid)
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <vector>
+#include <iucutil.h>
+#include <iucore/executor.h>
+#include <iucore/cpukernels.h>
+#include "filterkernels.h"
+#include "filter.h"
+
+namespace iuprivate {
+
+/* ***************************************************************************
+ *  Float planes
+ * ***************************************************************************/
+// A plane addresses one channel of an interleaved float image: element (x,y)
+// is data[y*stride + x*step]. Like this the filters work on the channels of
+// 4-channel images without converting them to the planar layout first.
+
+struct FloatPlane
+{
+  float* data;
+  size_t stride;  // in floats
+  int step;       // floats between horizontally adjacent pixels
+
+  inline float& operator()(int x, int y) const { return data[y*stride + x*step]; }
+};
+
+static inline FloatPlane floatPlane(const iu::ImageCpu_32f_C1* im)
+{
+  FloatPlane p = { const_cast<float*>(im->data()), im->stride(), 1 };
+  return p;
+}
+
+static inline FloatPlane floatPlane(const iu::ImageCpu_32f_C4* im, int channel)
+{
+  FloatPlane p = { reinterpret_cast<float*>(const_cast<float4*>(im->data())) + channel,
+                   4*im->stride(), 4 };
+  return p;
+}
+
+//-----------------------------------------------------------------------------
+// gray guide for 4-channel images without an explicit guide: mean of RGB
+struct GrayFromRGBRows
+{
+  FloatPlane r, g, b, dst;
+  int width;
+
+  void operator()(int begin, int end) const
+  {
+    for(int y=begin; y<end; ++y)
+      for(int x=0; x<width; ++x)
+        dst(x,y) = (r(x,y) + g(x,y) + b(x,y)) / 3.0f;
+  }
+};
+
+static void grayGuide(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C1* gray)
+{
+  GrayFromRGBRows body;
+  body.r = floatPlane(src, 0);
+  body.g = floatPlane(src, 1);
+  body.b = floatPlane(src, 2);
+  body.dst = floatPlane(gray);
+  body.width = src->width();
+  iu::parallelFor(0, (int)src->height(), body, iu::Executor::rowGrain(src->width()));
+}
+
+static void checkSizes(const iu::Image* src, const iu::Image* guide, const iu::Image* dst)
+{
+  if(src->size() != dst->size() || (guide != 0 && guide->size() != src->size()))
+    throw IuException("source, guide and destination image have to be of the same size",
+                      __FILE__, __FUNCTION__, __LINE__);
+}
+
+/* ***************************************************************************
+ *  Box means (running sums; O(1) per pixel for any radius)
+ * ***************************************************************************/
+
+// term of a box mean: a(x,y), or a(x,y)*b(x,y) if product is set
+struct BoxTerm
+{
+  FloatPlane a;
+  FloatPlane b;
+  bool product;
+};
+
+static inline BoxTerm boxTerm(const FloatPlane& a)
+{
+  BoxTerm t = { a, a, false };
+  return t;
+}
+
+static inline BoxTerm boxTerm(const FloatPlane& a, const FloatPlane& b)
+{
+  BoxTerm t = { a, b, true };
+  return t;
+}
+
+// what is written for the two box means m0, m1 of every pixel
+enum BoxOutput
+{
+  BOX_MEANS,                 // dst0 = m0, dst1 = m1
+  BOX_GUIDED_COEFFICIENTS,   // m0 = mean(p), m1 = mean(I*p) -> dst0 = a, dst1 = b
+  BOX_GUIDED_RESULT          // m0 = mean(a), m1 = mean(b) -> dst0 = m0*I + m1
+};
+
+/* Box means of two terms over the (2r+1)x(2r+1) window clipped to the image
+ * (i.e. normalized by the number of pixels inside the image). Every chunk keeps
+ * running column sums of its rows in double precision; the horizontal window
+ * sums are differences of a prefix sum over the column sums. The per-pixel
+ * steps of the guided filter are applied to the rows of means right away.
+ */
+struct BoxMeanRows
+{
+  BoxTerm terms[2];
+  FloatPlane dst[2];
+  BoxOutput output;
+  FloatPlane mean_I;   // BOX_GUIDED_COEFFICIENTS
+  FloatPlane mean_II;  // BOX_GUIDED_COEFFICIENTS
+  FloatPlane guide;    // BOX_GUIDED_RESULT
+  float eps;
+  int width;
+  int height;
+  int radius;
+  const FilterKernels* kernels;
+
+  // contiguous row y of the plane (channels of interleaved images are gathered)
+  const float* row(const FloatPlane& p, int y, float* buffer) const
+  {
+    const float* r = &p(0,y);
+    if(p.step == 1)
+      return r;
+    for(int x=0; x<width; ++x)
+      buffer[x] = r[x*p.step];
+    return buffer;
+  }
+
+  // c += sign*term(.,y)
+  void addRow(double* c, const BoxTerm& t, int y, double sign, float* buffer) const
+  {
+    const float* a = row(t.a, y, buffer);
+    const float* b = t.product ? row(t.b, y, buffer+width) : 0;
+    kernels->accumulateRow_64f(a, b, sign, c, width);
+  }
+
+  /* p[x] = c[0] + ... + c[x-1]. The scan runs as four independent chains over
+   * the quarters of the row (the latency of the serial additions dominates
+   * otherwise); the quarters are offset afterwards.
+   */
+  void prefixSum(const double* c, double* p) const
+  {
+    const int l = width/4;
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    p[0] = 0.0;
+    for(int i=0; i<l; ++i)
+    {
+      s0 += c[i];       p[i+1] = s0;
+      s1 += c[l+i];     p[l+i+1] = s1;
+      s2 += c[2*l+i];   p[2*l+i+1] = s2;
+      s3 += c[3*l+i];   p[3*l+i+1] = s3;
+    }
+    for(int i=4*l; i<width; ++i)
+    {
+      s3 += c[i];
+      p[i+1] = s3;
+    }
+    for(int q=1; q<4; ++q)
+    {
+      const double offset = p[q*l];
+      const int last = (q < 3) ? (q+1)*l : width;
+      for(int i=q*l+1; i<=last; ++i)
+        p[i] += offset;
+    }
+  }
+
+  // m[x] = mean of row x of the column sums c
+  void windowMeans(const double* c, double* prefix, const double* inv_cols,
+                   double inv_rows, float* m) const
+  {
+    prefixSum(c, prefix);
+    // columns whose window lies completely inside the row
+    const int x_inner_begin = IUMIN(radius, width);
+    const int x_inner_end = IUMAX(x_inner_begin, width-radius);
+    for(int x=0; x<x_inner_begin; ++x)
+      m[x] = (float)((prefix[IUMIN(x+radius+1, width)] - prefix[0]) * inv_rows*inv_cols[x]);
+    kernels->windowSumRow_64f(prefix + x_inner_begin - radius, 2*radius+1,
+                              inv_rows/(2*radius+1), m + x_inner_begin,
+                              x_inner_end-x_inner_begin);
+    for(int x=x_inner_end; x<width; ++x)
+      m[x] = (float)((prefix[width] - prefix[IUMAX(x-radius, 0)]) * inv_rows*inv_cols[x]);
+  }
+
+  void store(int y, const float* m0, const float* m1) const
+  {
+    float* d0 = &dst[0](0,y);
+    const int s0 = dst[0].step;
+    switch(output)
+    {
+    case BOX_GUIDED_COEFFICIENTS:
+    {
+      // a = cov(I,p)/(var(I)+eps), b = mean(p) - a*mean(I)
+      float* d1 = &dst[1](0,y);
+      const int s1 = dst[1].step;
+      const float* mI = &mean_I(0,y);
+      const float* mII = &mean_II(0,y);
+      const float e = eps;
+      for(int x=0; x<width; ++x)
+      {
+        const float var = mII[x] - mI[x]*mI[x];
+        const float a = (m1[x] - mI[x]*m0[x]) / (IUMAX(var, 0.0f) + e);
+        d0[x*s0] = a;
+        d1[x*s1] = m0[x] - a*mI[x];
+      }
+      break;
+    }
+    case BOX_GUIDED_RESULT:
+    {
+      const float* g = &guide(0,y);
+      const int gs = guide.step;
+      for(int x=0; x<width; ++x)
+        d0[x*s0] = m0[x]*g[x*gs] + m1[x];
+      break;
+    }
+    default:
+    {
+      float* d1 = &dst[1](0,y);
+      const int s1 = dst[1].step;
+      for(int x=0; x<width; ++x)
+      {
+        d0[x*s0] = m0[x];
+        d1[x*s1] = m1[x];
+      }
+      break;
+    }
+    }
+  }
+
+  void operator()(int begin, int end) const
+  {
+    std::vector<double> sums(4*width + 1, 0.0);
+    double* col = &sums[0];
+    double* inv_cols = col + 2*width;
+    double* prefix = inv_cols + width;
+    std::vector<float> rows(4*width);
+    float* buffer = &rows[0];
+    float* means = buffer + 2*width;
+
+    for(int x=0; x<width; ++x)
+      inv_cols[x] = 1.0/(IUMIN(x+radius, width-1) - IUMAX(x-radius, 0) + 1);
+    for(int t=0; t<2; ++t)
+      for(int y=IUMAX(begin-radius, 0); y<=IUMIN(begin+radius, height-1); ++y)
+        addRow(col + t*width, terms[t], y, 1.0, buffer);
+
+    for(int y=begin; y<end; ++y)
+    {
+      const double inv_rows = 1.0/(IUMIN(y+radius, height-1) - IUMAX(y-radius, 0) + 1);
+      for(int t=0; t<2; ++t)
+      {
+        double* c = col + t*width;
+        if(y > begin)
+        {
+          if(y+radius < height)
+            addRow(c, terms[t], y+radius, 1.0, buffer);
+          if(y-radius-1 >= 0)
+            addRow(c, terms[t], y-radius-1, -1.0, buffer);
+        }
+        windowMeans(c, prefix, inv_cols, inv_rows, means + t*width);
+      }
+      store(y, means, means+width);
+    }
+  }
+};
+
+static void boxMeans(BoxMeanRows& body, const BoxTerm& t0, const BoxTerm& t1,
+                     int width, int height, int radius)
+{
+  body.terms[0] = t0;
+  body.terms[1] = t1;
+  body.width = width;
+  body.height = height;
+  body.radius = radius;
+  body.kernels = &filterKernels();
+  // every chunk pays for setting up its column sums: keep chunks >> radius
+  const int grain = IUMAX(iu::Executor::rowGrain(2*width), 8*radius);
+  iu::parallelFor(0, height, body, grain);
+}
+
+/* ***************************************************************************
+ *  Guided filter
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+/* Guided filter (He et al.) of the given channels with a single-channel guide:
+ * three box passes per channel (the statistics of the guide are shared by all
+ * channels). Four temporary planes are needed, independent of the radius.
+ */
+static void guidedFilter(const FloatPlane& guide, const FloatPlane* src, const FloatPlane* dst,
+                         int channels, int width, int height, int radius, float eps)
+{
+  const IuSize sz(width, height);
+  iu::ImageCpu_32f_C1 mean_I(sz), mean_II(sz), coeff_a(sz), coeff_b(sz);
+
+  BoxMeanRows stats;
+  stats.output = BOX_MEANS;
+  stats.dst[0] = floatPlane(&mean_I);
+  stats.dst[1] = floatPlane(&mean_II);
+  boxMeans(stats, boxTerm(guide), boxTerm(guide, guide), width, height, radius);
+
+  for(int c=0; c<channels; ++c)
+  {
+    BoxMeanRows coeffs;
+    coeffs.output = BOX_GUIDED_COEFFICIENTS;
+    coeffs.mean_I = stats.dst[0];
+    coeffs.mean_II = stats.dst[1];
+    coeffs.eps = eps;
+    coeffs.dst[0] = floatPlane(&coeff_a);
+    coeffs.dst[1] = floatPlane(&coeff_b);
+    boxMeans(coeffs, boxTerm(src[c]), boxTerm(guide, src[c]), width, height, radius);
+
+    BoxMeanRows result;
+    result.output = BOX_GUIDED_RESULT;
+    result.guide = guide;
+    result.dst[0] = dst[c];
+    boxMeans(result, boxTerm(coeffs.dst[0]), boxTerm(coeffs.dst[1]), width, height, radius);
+  }
+}
+
+/* ***************************************************************************
+ *  Bilateral grid
+ * ***************************************************************************/
+
+// The grid is blurred with a 5-tap binomial kernel (sigma = 1 cell) along each
+// axis, so one cell spans sigma_spatial pixels and sigma_range guide values.
+// Two cells of padding keep the splatted values away from the grid borders.
+static const int GRID_PAD = 2;
+// upper bound of the range resolution (keeps the grid memory bounded)
+static const int GRID_MAX_RANGE_CELLS = 256;
+
+struct BilateralGrid
+{
+  int gw, gh, gd;       // grid cells in x, y and range direction
+  int nc;               // floats per cell: channels + homogeneous weight
+  float sigma_spatial;
+  float sigma_range;
+  float range_min;
+  std::vector<float> data;
+  std::vector<float> tmp;
+
+  inline size_t index(int gx, int gy, int gz) const
+  {
+    return (((size_t)gy*gw + gx)*gd + gz)*nc;
+  }
+};
+
+//-----------------------------------------------------------------------------
+// nearest neighbour splatting; every chunk owns whole grid rows
+template<int Channels>
+struct GridSplatRows
+{
+  BilateralGrid* grid;
+  const int* row_begin;  // first image row of every grid row (gh+1 entries)
+  FloatPlane guide;
+  const FloatPlane* src;
+  int width;
+
+  void operator()(int begin, int end) const
+  {
+    BilateralGrid& g = *grid;
+    const float inv_spatial = 1.0f/g.sigma_spatial;
+    const float inv_range = 1.0f/g.sigma_range;
+    std::vector<int> cell_x(width);
+    for(int x=0; x<width; ++x)
+      cell_x[x] = (int)(x*inv_spatial + 0.5f) + GRID_PAD;
+
+    for(int gy=begin; gy<end; ++gy)
+    {
+      float* grid_row = &g.data[g.index(0, gy, 0)];
+      for(int y=row_begin[gy]; y<row_begin[gy+1]; ++y)
+      {
+        for(int x=0; x<width; ++x)
+        {
+          const int gz = (int)((guide(x,y)-g.range_min)*inv_range + 0.5f) + GRID_PAD;
+          float* cell = grid_row + ((size_t)cell_x[x]*g.gd + gz)*(Channels+1);
+          for(int c=0; c<Channels; ++c)
+            cell[c] += src[c](x,y);
+          cell[Channels] += 1.0f;
+        }
+      }
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+/* [1 4 6 4 1]/16 along one axis (0: x, 1: y, 2: range); zero outside the grid.
+ * The cells of one (x,y) position are contiguous, so every tap is one row
+ * kernel call over gd*nc floats (or the valid part of it for the range axis).
+ */
+struct GridBlurRows
+{
+  const BilateralGrid* grid;
+  const float* src;
+  float* dst;
+  int axis;
+  const CpuKernels* kernels;
+
+  void operator()(int begin, int end) const
+  {
+    const BilateralGrid& g = *grid;
+    static const float w[5] = { 1.0f/16.0f, 4.0f/16.0f, 6.0f/16.0f, 4.0f/16.0f, 1.0f/16.0f };
+    const int n = (axis == 0) ? g.gw : g.gh;
+    const ptrdiff_t offset = (axis == 0) ? (ptrdiff_t)g.gd*g.nc : (ptrdiff_t)g.gw*g.gd*g.nc;
+    const int len = g.gd*g.nc;
+
+    for(int gy=begin; gy<end; ++gy)
+    {
+      for(int gx=0; gx<g.gw; ++gx)
+      {
+        const size_t i = g.index(gx, gy, 0);
+        kernels->scaleRow(src + i, w[2], dst + i, len);
+        for(int k=-2; k<=2; ++k)
+        {
+          if(k == 0)
+            continue;
+          if(axis == 2)
+          {
+            const int lo = IUMAX(0, -k)*g.nc;
+            const int hi = IUMIN(g.gd, g.gd-k)*g.nc;
+            if(hi > lo)
+              kernels->axpyRow(src + i + lo + k*g.nc, w[k+2], dst + i + lo, hi-lo);
+          }
+          else
+          {
+            const int pos = (axis == 0) ? gx : gy;
+            if(pos+k >= 0 && pos+k < n)
+              kernels->axpyRow(src + i + k*offset, w[k+2], dst + i, len);
+          }
+        }
+      }
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+/* Trilinear interpolation of the blurred grid, normalized by the weight. The two
+ * grid rows around an image row are interpolated into one slab first, so every
+ * pixel reads only four cells.
+ */
+template<int Channels>
+struct GridSliceRows
+{
+  const BilateralGrid* grid;
+  FloatPlane guide;
+  const FloatPlane* src;
+  const FloatPlane* dst;
+  int width;
+  const CpuKernels* kernels;
+
+  void operator()(int begin, int end) const
+  {
+    const BilateralGrid& g = *grid;
+    const int nc = Channels+1;
+    const int slab_size = g.gw*g.gd*nc;
+    const float inv_spatial = 1.0f/g.sigma_spatial;
+    const float inv_range = 1.0f/g.sigma_range;
+
+    std::vector<float> slab(slab_size);
+    std::vector<int> cell_x(width);
+    std::vector<float> weight_x(width);
+    for(int x=0; x<width; ++x)
+    {
+      const float fx = x*inv_spatial + GRID_PAD;
+      cell_x[x] = (int)fx;
+      weight_x[x] = fx - cell_x[x];
+    }
+
+    for(int y=begin; y<end; ++y)
+    {
+      const float fy = y*inv_spatial + GRID_PAD;
+      const int y0 = (int)fy;
+      const float wy = fy - y0;
+      kernels->scaleRow(&g.data[g.index(0, y0, 0)], 1.0f-wy, &slab[0], slab_size);
+      kernels->axpyRow(&g.data[g.index(0, y0+1, 0)], wy, &slab[0], slab_size);
+
+      for(int x=0; x<width; ++x)
+      {
+        const float fz = (guide(x,y)-g.range_min)*inv_range + GRID_PAD;
+        const int z0 = (int)fz;
+        const float wz = fz - z0;
+        const float wx = weight_x[x];
+        const float w00 = (1.0f-wx)*(1.0f-wz);
+        const float w01 = (1.0f-wx)*wz;
+        const float w10 = wx*(1.0f-wz);
+        const float w11 = wx*wz;
+        const float* p0 = &slab[((size_t)cell_x[x]*g.gd + z0)*nc];
+        const float* p1 = p0 + g.gd*nc;
+
+        float value[Channels+1];
+        for(int c=0; c<nc; ++c)
+          value[c] = w00*p0[c] + w01*p0[nc+c] + w10*p1[c] + w11*p1[nc+c];
+        const float weight = value[Channels];
+        for(int c=0; c<Channels; ++c)
+          dst[c](x,y) = (weight > 0.0f) ? value[c]/weight : src[c](x,y);
+      }
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+/* Bilateral filter approximated on a bilateral grid (Chen et al.): splat into a
+ * coarse (x, y, guide value) grid, blur the grid, slice it with trilinear
+ * interpolation. The grid has about width*height/sigma_spatial^2 times
+ * range/sigma_range cells, so the cost is O(1) per pixel for the usual sigmas.
+ */
+template<int Channels>
+static void bilateralGrid(const FloatPlane& guide, const FloatPlane* src, const FloatPlane* dst,
+                          int width, int height, float sigma_spatial, float sigma_range)
+{
+  if(sigma_spatial <= 0.0f || sigma_range <= 0.0f)
+    throw IuException("sigma_spatial and sigma_range have to be positive",
+                      __FILE__, __FUNCTION__, __LINE__);
+
+  BilateralGrid grid;
+  grid.sigma_spatial = IUMAX(sigma_spatial, 1.0f);
+  grid.nc = Channels+1;
+
+  float range_max = guide(0,0);
+  grid.range_min = guide(0,0);
+  for(int y=0; y<height; ++y)
+  {
+    for(int x=0; x<width; ++x)
+    {
+      grid.range_min = IUMIN(grid.range_min, guide(x,y));
+      range_max = IUMAX(range_max, guide(x,y));
+    }
+  }
+  const float range = range_max - grid.range_min;
+  grid.sigma_range = IUMAX(sigma_range, range/(GRID_MAX_RANGE_CELLS-1));
+
+  grid.gw = (int)((width-1)/grid.sigma_spatial + 0.5f) + 1 + 2*GRID_PAD;
+  grid.gh = (int)((height-1)/grid.sigma_spatial + 0.5f) + 1 + 2*GRID_PAD;
+  grid.gd = (int)(range/grid.sigma_range + 0.5f) + 1 + 2*GRID_PAD;
+  const size_t cells = (size_t)grid.gw*grid.gh*grid.gd;
+  grid.data.assign(cells*grid.nc, 0.0f);
+  grid.tmp.resize(cells*grid.nc);
+
+  // image rows splatted into each grid row
+  const float inv_spatial = 1.0f/grid.sigma_spatial;
+  std::vector<int> row_begin(grid.gh+1, height);
+  for(int y=height-1; y>=0; --y)
+    row_begin[(int)(y*inv_spatial + 0.5f) + GRID_PAD] = y;
+  for(int gy=grid.gh-1; gy>=0; --gy)
+    row_begin[gy] = IUMIN(row_begin[gy], row_begin[gy+1]);
+
+  GridSplatRows<Channels> splat;
+  splat.grid = &grid;
+  splat.row_begin = &row_begin[0];
+  splat.guide = guide;
+  splat.src = src;
+  splat.width = width;
+  iu::parallelFor(0, grid.gh, splat, 1);
+
+  const CpuKernels* kernels = &cpuKernels();
+  const int grain = iu::Executor::rowGrain(5*grid.gw*grid.gd*grid.nc);
+  for(int axis=0; axis<3; ++axis)
+  {
+    GridBlurRows blur;
+    blur.grid = &grid;
+    blur.src = &grid.data[0];
+    blur.dst = &grid.tmp[0];
+    blur.axis = axis;
+    blur.kernels = kernels;
+    iu::parallelFor(0, grid.gh, blur, grain);
+    grid.data.swap(grid.tmp);
+  }
+
+  GridSliceRows<Channels> slice;
+  slice.grid = &grid;
+  slice.guide = guide;
+  slice.src = src;
+  slice.dst = dst;
+  slice.width = width;
+  slice.kernels = kernels;
+  // every chunk interpolates one slab per row
+  iu::parallelFor(0, height, slice, iu::Executor::rowGrain(8*width + grid.gw*grid.gd*grid.nc));
+}
+
+/* ***************************************************************************
+ *  FUNCTION IMPLEMENTATIONS
+ * ***************************************************************************/
+
+// host; 32-bit; 1-channel guided filter
+void filterGuided(const iu::ImageCpu_32f_C1* src, const iu::ImageCpu_32f_C1* guide,
+                  iu::ImageCpu_32f_C1* dst, int radius, float eps)
+{
+  checkSizes(src, guide, dst);
+  const FloatPlane s = floatPlane(src);
+  const FloatPlane d = floatPlane(dst);
+  guidedFilter(guide != 0 ? floatPlane(guide) : s, &s, &d, 1,
+               src->width(), src->height(), radius, eps);
+}
+
+// host; 32-bit; 4-channel guided filter
+void filterGuided(const iu::ImageCpu_32f_C4* src, const iu::ImageCpu_32f_C1* guide,
+                  iu::ImageCpu_32f_C4* dst, int radius, float eps)
+{
+  checkSizes(src, guide, dst);
+  FloatPlane s[4], d[4];
+  for(int c=0; c<4; ++c)
+  {
+    s[c] = floatPlane(src, c);
+    d[c] = floatPlane(dst, c);
+  }
+  if(guide != 0)
+  {
+    guidedFilter(floatPlane(guide), s, d, 4, src->width(), src->height(), radius, eps);
+  }
+  else
+  {
+    iu::ImageCpu_32f_C1 gray(src->size());
+    grayGuide(src, &gray);
+    guidedFilter(floatPlane(&gray), s, d, 4, src->width(), src->height(), radius, eps);
+  }
+}
+
+// host; 32-bit; 1-channel bilateral filter
+void filterBilateral(const iu::ImageCpu_32f_C1* src, const iu::ImageCpu_32f_C1* guide,
+                     iu::ImageCpu_32f_C1* dst, float sigma_spatial, float sigma_range)
+{
+  checkSizes(src, guide, dst);
+  const FloatPlane s = floatPlane(src);
+  const FloatPlane d = floatPlane(dst);
+  bilateralGrid<1>(guide != 0 ? floatPlane(guide) : s, &s, &d,
+                src->width(), src->height(), sigma_spatial, sigma_range);
+}
+
+// host; 32-bit; 4-channel bilateral filter
+void filterBilateral(const iu::ImageCpu_32f_C4* src, const iu::ImageCpu_32f_C1* guide,
+                     iu::ImageCpu_32f_C4* dst, float sigma_spatial, float sigma_range)
+{
+  checkSizes(src, guide, dst);
+  FloatPlane s[4], d[4];
+  for(int c=0; c<4; ++c)
+  {
+    s[c] = floatPlane(src, c);
+    d[c] = floatPlane(dst, c);
+  }
+  if(guide != 0)
+  {
+    bilateralGrid<4>(floatPlane(guide), s, d, src->width(), src->height(), sigma_spatial, sigma_range);
+  }
+  else
+  {
+    iu::ImageCpu_32f_C1 gray(src->size());
+    grayGuide(src, &gray);
+    bilateralGrid<4>(floatPlane(&gray), s, d, src->width(), src->height(), sigma_spatial, sigma_range);
+  }
+}
+
+} // namespace iuprivate
@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Filter Module
+ * Class       : none
+ * Language    : C++
+ * Description : Host implementation of the FFT based (overlap-save) convolution and correlation
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <math.h>
+#include <string.h>
+#include <vector>
+#include <iucutil.h>
+#include <iucore/executor.h>
+#include <iucore/cpukernels.h>
+#include "filterkernels.h"
+#include "filter.h"
+#include "filterborder.h"
+#include "fft_cpu.h"
+
+namespace iuprivate {
+
+/* ***************************************************************************
+ *  cost model
+ * ***************************************************************************/
+// Relative costs measured with the row kernels: one multiply-add of the direct
+// convolution is 1, a forward plus inverse real 2D FFT of n samples costs
+// FFT_COST_PER_SAMPLE_LOG*n*log2(n) and loading, multiplying and storing a tile
+// FFT_COST_PER_SAMPLE*n.
+static const double FFT_COST_PER_SAMPLE_LOG = 10.0;
+static const double FFT_COST_PER_SAMPLE = 40.0;
+// largest tile (samples); larger tiles do not pay off and need too much memory
+static const int FFT_MAX_TILE_SAMPLES = 1 << 20;
+
+struct FftTiling
+{
+  int rows;      // tile size (fast sizes)
+  int columns;
+  int tiles_x;   // number of tiles covering the output
+  int tiles_y;
+  double cost;
+};
+
+//-----------------------------------------------------------------------------
+// tile size with the least estimated cost for an output of width x height
+static FftTiling fftTiling(int width, int height, int kernel_width, int kernel_height)
+{
+  FftTiling best;
+  best.cost = -1.0;
+  const int max_columns = FftPlan::fastSize(width + kernel_width-1);
+  const int max_rows = FftPlan::fastSize(height + kernel_height-1);
+
+  for(int columns=FftPlan::fastSize(kernel_width); ; columns=FftPlan::fastSize(columns+1))
+  {
+    for(int rows=FftPlan::fastSize(kernel_height); ; rows=FftPlan::fastSize(rows+1))
+    {
+      const double samples = (double)rows*columns;
+      if(samples > FFT_MAX_TILE_SAMPLES && best.cost >= 0.0)
+        break;
+      FftTiling tiling;
+      tiling.rows = rows;
+      tiling.columns = columns;
+      tiling.tiles_x = (width + columns-kernel_width)/(columns-kernel_width+1);
+      tiling.tiles_y = (height + rows-kernel_height)/(rows-kernel_height+1);
+      tiling.cost = (double)tiling.tiles_x*tiling.tiles_y *
+          (FFT_COST_PER_SAMPLE_LOG*samples*log(samples)/log(2.0) + FFT_COST_PER_SAMPLE*samples);
+      if(best.cost < 0.0 || tiling.cost < best.cost)
+        best = tiling;
+      if(rows >= max_rows)
+        break;
+    }
+    if(columns >= max_columns || (double)columns*FftPlan::fastSize(kernel_height) > FFT_MAX_TILE_SAMPLES)
+      break;
+  }
+  return best;
+}
+
+//-----------------------------------------------------------------------------
+static double directCost(int width, int height, int kernel_width, int kernel_height)
+{
+  // the direct convolution adds up the rows of the kernel (ConvolveRows)
+  return (double)width*height*(kernel_width+1)*kernel_height;
+}
+
+/* ***************************************************************************
+ *  overlap-save
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+/* Every tile of rows x columns source samples (border mapped) is transformed,
+ * multiplied with the kernel spectrum and transformed back. The circular
+ * convolution is exact for the first (rows-kernel_height+1) x (columns-kernel_width+1)
+ * outputs, which are stored.
+ */
+struct FftConvolveTiles
+{
+  const float* src;
+  size_t src_stride;
+  int src_width;
+  int src_height;
+  float* dst;
+  size_t dst_stride;
+  int dst_width;
+  int dst_height;
+  int offset_x;   // source position of dst(0,0) minus the kernel anchor
+  int offset_y;
+  IuBorderType border;
+  float border_value;
+  FftTiling tiling;
+  int out_width;  // valid outputs per tile
+  int out_height;
+  const float* kernel_re;
+  const float* kernel_im;
+
+  void operator()(int begin, int end) const
+  {
+    const FilterKernels& kernels = filterKernels();
+    FftReal2d fft(tiling.rows, tiling.columns);
+    const int size = fft.spectrumSize();
+    const int half = tiling.columns/2;
+    std::vector<float> spec_re(size);
+    std::vector<float> spec_im(size);
+    std::vector<int> column_map(tiling.columns);
+
+    for(int tile=begin; tile<end; ++tile)
+    {
+      const int x0 = (tile%tiling.tiles_x)*out_width;
+      const int y0 = (tile/tiling.tiles_x)*out_height;
+
+      // load the column pairs
+      for(int c=0; c<tiling.columns; ++c)
+        column_map[c] = borderIndex(x0+offset_x+c, src_width, border);
+      float* p_re = fft.pairsRe();
+      float* p_im = fft.pairsIm();
+      for(int n=0; n<tiling.rows; ++n)
+      {
+        const int y = borderIndex(y0+offset_y+n, src_height, border);
+        float* r_re = p_re + (size_t)n*half;
+        float* r_im = p_im + (size_t)n*half;
+        if(y < 0)
+        {
+          for(int b=0; b<half; ++b)
+            r_re[b] = r_im[b] = border_value;
+          continue;
+        }
+        const float* s = src + y*src_stride;
+        for(int b=0; b<half; ++b)
+        {
+          const int c0 = column_map[2*b];
+          const int c1 = column_map[2*b+1];
+          r_re[b] = (c0 < 0) ? border_value : s[c0];
+          r_im[b] = (c1 < 0) ? border_value : s[c1];
+        }
+      }
+
+      fft.forwardPairs(&spec_re[0], &spec_im[0]);
+      kernels.complexMulRow(kernel_re, kernel_im, &spec_re[0], &spec_im[0], size);
+      fft.inversePairs(&spec_re[0], &spec_im[0]);
+
+      // store the valid outputs
+      const int w = IUMIN(out_width, dst_width-x0);
+      const int h = IUMIN(out_height, dst_height-y0);
+      for(int n=0; n<h; ++n)
+      {
+        const float* r_re = p_re + (size_t)n*half;
+        const float* r_im = p_im + (size_t)n*half;
+        float* d = dst + (y0+n)*dst_stride + x0;
+        for(int x=0; x<w; ++x)
+          d[x] = (x%2 == 0) ? r_re[x/2] : r_im[x/2];
+      }
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+// dst(x,y) = sum_ij kernel(i,j)*src(x+offset_x+i, y+offset_y+j) with border mapping
+static void fftCorrelation(const float* src, size_t src_stride, int src_width, int src_height,
+                           float* dst, size_t dst_stride, int dst_width, int dst_height,
+                           int offset_x, int offset_y, const float* kernel, const IuSize& kernel_size,
+                           IuBorderType border, float border_value)
+{
+  const int kx = kernel_size.width;
+  const int ky = kernel_size.height;
+
+  FftConvolveTiles body;
+  body.tiling = fftTiling(dst_width, dst_height, kx, ky);
+  const int rows = body.tiling.rows;
+  const int columns = body.tiling.columns;
+
+  // kernel spectrum; the kernel is mirrored (correlation) and the scaling of
+  // the inverse transform is folded in
+  std::vector<float> h((size_t)rows*columns, 0.0f);
+  const float scale = 1.0f/((float)rows*columns);
+  for(int j=0; j<ky; ++j)
+    for(int i=0; i<kx; ++i)
+      h[(size_t)((rows-j)%rows)*columns + (columns-i)%columns] = scale*kernel[j*kx + i];
+  FftReal2d fft(rows, columns);
+  std::vector<float> kernel_re(fft.spectrumSize());
+  std::vector<float> kernel_im(fft.spectrumSize());
+  fft.forward(&h[0], columns, &kernel_re[0], &kernel_im[0]);
+
+  body.src = src;
+  body.src_stride = src_stride;
+  body.src_width = src_width;
+  body.src_height = src_height;
+  body.dst = dst;
+  body.dst_stride = dst_stride;
+  body.dst_width = dst_width;
+  body.dst_height = dst_height;
+  body.offset_x = offset_x;
+  body.offset_y = offset_y;
+  body.border = border;
+  body.border_value = border_value;
+  body.out_width = columns-kx+1;
+  body.out_height = rows-ky+1;
+  body.kernel_re = &kernel_re[0];
+  body.kernel_im = &kernel_im[0];
+  iu::parallelFor(0, body.tiling.tiles_x*body.tiling.tiles_y, body, 1);
+}
+
+/* ***************************************************************************
+ *  direct correlation (valid outputs only)
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+struct DirectCorrelationRows
+{
+  const float* src;
+  size_t src_stride;
+  float* dst;
+  size_t dst_stride;
+  int dst_width;
+  const float* templ;
+  size_t templ_stride;
+  int templ_width;
+  int templ_height;
+
+  void operator()(int begin, int end) const
+  {
+    const CpuKernels& kernels = cpuKernels();
+    const FilterKernels& filter_kernels = filterKernels();
+    std::vector<float> tmp(dst_width);
+    for(int y=begin; y<end; ++y)
+    {
+      float* d = dst + y*dst_stride;
+      filter_kernels.convolveRow(src + y*src_stride, templ, templ_width, 1, d, dst_width);
+      for(int j=1; j<templ_height; ++j)
+      {
+        filter_kernels.convolveRow(src + (y+j)*src_stride, templ + j*templ_stride, templ_width, 1,
+                                   &tmp[0], dst_width);
+        kernels.axpyRow(&tmp[0], 1.0f, d, dst_width);
+      }
+    }
+  }
+};
+
+/* ***************************************************************************
+ *  FUNCTION IMPLEMENTATIONS
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+bool fftConvolutionPreferred(const IuSize& size, const IuSize& kernel_size)
+{
+  if(kernel_size.width*kernel_size.height < 64)
+    return false;
+  const FftTiling tiling = fftTiling(size.width, size.height, kernel_size.width, kernel_size.height);
+  return tiling.cost < directCost(size.width, size.height, kernel_size.width, kernel_size.height);
+}
+
+//-----------------------------------------------------------------------------
+void filterConvolveFFT(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                       const float* kernel, const IuSize& kernel_size,
+                       IuBorderType border, float border_value)
+{
+  if(src->size() != dst->size())
+    throw IuException("source and destination image have to be of the same size",
+                      __FILE__, __FUNCTION__, __LINE__);
+  if(kernel == 0 || kernel_size.width == 0 || kernel_size.height == 0)
+    throw IuException("kernel has to have at least one tap", __FILE__, __FUNCTION__, __LINE__);
+  checkBorder(border);
+
+  // the tiles read around their outputs; in-place needs a copy
+  const float* in = src->data();
+  size_t in_stride = src->stride();
+  std::vector<float> copy;
+  if(src->data() == dst->data())
+  {
+    copy.resize((size_t)src->width()*src->height());
+    for(unsigned int y=0; y<src->height(); ++y)
+      memcpy(&copy[(size_t)y*src->width()], src->data(0, y), src->width()*sizeof(float));
+    in = &copy[0];
+    in_stride = src->width();
+  }
+  fftCorrelation(in, in_stride, src->width(), src->height(),
+                 dst->data(), dst->stride(), dst->width(), dst->height(),
+                 -(int)(kernel_size.width-1)/2, -(int)(kernel_size.height-1)/2,
+                 kernel, kernel_size, border, border_value);
+}
+
+//-----------------------------------------------------------------------------
+void filterCorrelate(const iu::ImageCpu_32f_C1* src, const iu::ImageCpu_32f_C1* templ,
+                     iu::ImageCpu_32f_C1* dst, IuConvolutionMethod method)
+{
+  if(templ->width() > src->width() || templ->height() > src->height() ||
+     dst->width() != src->width()-templ->width()+1 || dst->height() != src->height()-templ->height()+1)
+    throw IuException("destination has to be of size (source size - template size + 1)",
+                      __FILE__, __FUNCTION__, __LINE__);
+
+  if(method == IU_CONVOLUTION_AUTO)
+    method = fftConvolutionPreferred(dst->size(), templ->size()) ? IU_CONVOLUTION_FFT
+                                                                 : IU_CONVOLUTION_DIRECT;
+  if(method == IU_CONVOLUTION_FFT)
+  {
+    // dense template for the kernel spectrum
+    std::vector<float> kernel((size_t)templ->width()*templ->height());
+    for(unsigned int y=0; y<templ->height(); ++y)
+      for(unsigned int x=0; x<templ->width(); ++x)
+        kernel[y*templ->width() + x] = *templ->data(x, y);
+    // all valid outputs only read inside the source; the rest of a tile is padded with zeros
+    fftCorrelation(src->data(), src->stride(), src->width(), src->height(),
+                   dst->data(), dst->stride(), dst->width(), dst->height(),
+                   0, 0, &kernel[0], templ->size(), IU_BORDER_CONSTANT, 0.0f);
+    return;
+  }
+
+  DirectCorrelationRows body;
+  body.src = src->data();
+  body.src_stride = src->stride();
+  body.dst = dst->data();
+  body.dst_stride = dst->stride();
+  body.dst_width = dst->width();
+  body.templ = templ->data();
+  body.templ_stride = templ->stride();
+  body.templ_width = templ->width();
+  body.templ_height = templ->height();
+  iu::parallelFor(0, dst->height(), body,
+                  iu::Executor::rowGrain((templ->width()+1)*templ->height()*dst->width()));
+}
+
+} // namespace iuprivate
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Filter Module
+ * Class       : none
+ * Language    : C++
+ * Description : Host implementation of the separable gaussian filter
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <math.h>
+#include <vector>
+#include <iucutil.h>
+#include <iucore/executor.h>
+#include <iucore/cpukernels.h>
+#include "filterkernels.h"
+#include "filter.h"
+
+namespace iuprivate {
+
+//-----------------------------------------------------------------------------
+// normalized gaussian kernel (same kernel size defaults as the device filter)
+static void gaussKernel(float sigma, int kernel_size, std::vector<float>& kernel)
+{
+  if (kernel_size == 0)
+    kernel_size = IUMAX(5, (int)ceilf(sigma*3.0f)*2 + 1);
+  if (kernel_size%2 == 0)
+    ++kernel_size;
+
+  const int radius = (kernel_size-1)/2;
+  kernel.resize(kernel_size);
+  float sum = 0.0f;
+  for(int i=-radius; i<=radius; ++i)
+  {
+    kernel[i+radius] = expf(-0.5f*i*i/(sigma*sigma));
+    sum += kernel[i+radius];
+  }
+  for(int i=0; i<kernel_size; ++i)
+    kernel[i] /= sum;
+}
+
+//-----------------------------------------------------------------------------
+/* Gaussian filtering of one float plane with clamped borders. For every output
+ * row the vertical pass accumulates whole source rows into a padded line buffer
+ * (contiguous, vectorizable), the horizontal pass then reads the buffer without
+ * any index clamping.
+ */
+struct FilterGaussRows
+{
+  const float* src;
+  size_t src_stride;
+  int height;
+  float* dst;
+  size_t dst_stride;
+  int x_begin;
+  int x_end;
+  int col_begin;  // columns of the source needed for the roi
+  int col_end;
+  int radius;
+  const float* g;
+  const CpuKernels* kernels;
+  const FilterKernels* filter_kernels;
+
+  void operator()(int begin, int end) const
+  {
+    // line[i] holds column x_begin-radius+i (one buffer per chunk)
+    std::vector<float> line((x_end-x_begin) + 2*radius);
+    float* l = &line[0] - (x_begin-radius);
+
+    for(int y=begin; y<end; ++y)
+    {
+      // vertical pass
+      const int cols = col_end-col_begin;
+      const float* s0 = src + IUMIN(IUMAX(y-radius, 0), height-1)*src_stride;
+      kernels->scaleRow(s0 + col_begin, g[0], l + col_begin, cols);
+      for(int k=1; k<=2*radius; ++k)
+      {
+        const float* s = src + IUMIN(IUMAX(y-radius+k, 0), height-1)*src_stride;
+        kernels->axpyRow(s + col_begin, g[k], l + col_begin, cols);
+      }
+
+      // clamped border
+      for(int x=x_begin-radius; x<col_begin; ++x)
+        l[x] = l[col_begin];
+      for(int x=col_end; x<x_end+radius; ++x)
+        l[x] = l[col_end-1];
+
+      // horizontal pass
+      filter_kernels->convolveRow(l + x_begin - radius, g, 2*radius+1, 1,
+                                  dst + y*dst_stride + x_begin, x_end-x_begin);
+    }
+  }
+};
+
+static void filterGaussPlane(const float* src, size_t src_stride, int width, int height,
+                             float* dst, size_t dst_stride, const IuRect& roi,
+                             const std::vector<float>& kernel)
+{
+  FilterGaussRows body;
+  body.src = src;
+  body.src_stride = src_stride;
+  body.height = height;
+  body.dst = dst;
+  body.dst_stride = dst_stride;
+  body.radius = ((int)kernel.size()-1)/2;
+  body.x_begin = IUMAX(roi.x, 0);
+  body.x_end = IUMIN(roi.x+(int)roi.width, width);
+  const int y_begin = IUMAX(roi.y, 0);
+  const int y_end = IUMIN(roi.y+(int)roi.height, height);
+  if(body.x_begin >= body.x_end || y_begin >= y_end)
+    return;
+
+  body.col_begin = IUMAX(body.x_begin-body.radius, 0);
+  body.col_end = IUMIN(body.x_end+body.radius, width);
+  body.g = &kernel[0];
+  body.kernels = &cpuKernels();
+  body.filter_kernels = &filterKernels();
+
+  const int taps = (int)kernel.size();
+  iu::parallelFor(y_begin, y_end, body,
+                  iu::Executor::rowGrain(2*taps*(body.col_end-body.col_begin)));
+}
+
+/* ***************************************************************************
+ *  FUNCTION IMPLEMENTATIONS
+ * ***************************************************************************/
+
+// host; 32-bit; 1-channel
+void filterGauss(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                 const IuRect& roi, float sigma, int kernel_size)
+{
+  std::vector<float> kernel;
+  gaussKernel(sigma, kernel_size, kernel);
+  filterGaussPlane(src->data(), src->stride(), src->width(), src->height(),
+                   dst->data(), dst->stride(), roi, kernel);
+}
+
+// host; 32-bit; planar 3-channel
+void filterGauss(const iu::ImagePlanarCpu_32f_C3* src, iu::ImagePlanarCpu_32f_C3* dst,
+                 const IuRect& roi, float sigma, int kernel_size)
+{
+  std::vector<float> kernel;
+  gaussKernel(sigma, kernel_size, kernel);
+  for(unsigned int c=0; c<src->channels(); ++c)
+    filterGaussPlane(src->plane(c), src->stride(), src->width(), src->height(),
+                     dst->plane(c), dst->stride(), roi, kernel);
+}
+
+// host; 32-bit; planar 4-channel
+void filterGauss(const iu::ImagePlanarCpu_32f_C4* src, iu::ImagePlanarCpu_32f_C4* dst,
+                 const IuRect& roi, float sigma, int kernel_size)
+{
+  std::vector<float> kernel;
+  gaussKernel(sigma, kernel_size, kernel);
+  for(unsigned int c=0; c<src->channels(); ++c)
+    filterGaussPlane(src->plane(c), src->stride(), src->width(), src->height(),
+                     dst->plane(c), dst->stride(), roi, kernel);
+}
+
+} // namespace iuprivate
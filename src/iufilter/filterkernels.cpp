@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Filter
+ * Class       : none
+ * Language    : C++
+ * Description : Selection of the filters row kernels by the dispatched instruction set level
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <iucore/cpudispatch.h>
+#include "filterkernels.h"
+
+namespace iuprivate {
+
+// filters kernels of every compiled level (filterkernels_<level>.cpp)
+namespace cpu_generic { void getFilterKernels(FilterKernels& kernels); }
+#ifdef IU_CPU_DISPATCH
+namespace cpu_sse4 { void getFilterKernels(FilterKernels& kernels); }
+namespace cpu_avx2 { void getFilterKernels(FilterKernels& kernels); }
+namespace cpu_avx512 { void getFilterKernels(FilterKernels& kernels); }
+#endif
+
+namespace {
+
+//-----------------------------------------------------------------------------
+// tables of all levels; the level is looked up per call and thus follows
+// iu::CpuDispatch::setLevel
+struct FilterKernelTables
+{
+  FilterKernels kernels[IU_CPU_AVX512+1];
+
+  FilterKernelTables()
+  {
+    cpu_generic::getFilterKernels(kernels[IU_CPU_GENERIC]);
+#ifdef IU_CPU_DISPATCH
+    cpu_sse4::getFilterKernels(kernels[IU_CPU_SSE4]);
+    cpu_avx2::getFilterKernels(kernels[IU_CPU_AVX2]);
+    cpu_avx512::getFilterKernels(kernels[IU_CPU_AVX512]);
+#else
+    for(int l=IU_CPU_SSE4; l<=IU_CPU_AVX512; ++l)
+      kernels[l] = kernels[IU_CPU_GENERIC];
+#endif
+  }
+};
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+const FilterKernels& filterKernels()
+{
+  static FilterKernelTables tables;
+  return tables.kernels[iu::CpuDispatch::level()];
+}
+
+} // namespace iuprivate
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Filter
+ * Class       : none
+ * Language    : C++
+ * Description : Row kernels of the host FFT, edge preserving, morphology and denoising filters
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IUPRIVATE_FILTERKERNELS_H
+#define IUPRIVATE_FILTERKERNELS_H
+
+//////////////////////////////////////////////////////////////////////////////
+// DISCLAIMER: the following declarations are internal and may change in any
+// version without notice, or even be removed.
+//////////////////////////////////////////////////////////////////////////////
+
+namespace iuprivate {
+
+/** Row kernels of the filters for one instruction set level (compiled
+ * like the core kernels, see iucore/cpukernels.h). All loops run over \a n elements.
+ */
+struct FilterKernels
+{
+  /** d[x] = sum_k g[k]*l[x+k*step], k < taps */
+  void (*convolveRow)(const float* l, const float* g, int taps, int step, float* d, int n);
+  /** d[x] = sum_k g[k]*rows[k][x], k < taps */
+  void (*convolveColumns)(const float* const* rows, const float* g, int taps, float* d, int n);
+  /** one radix 2/3/4/5 stage of a split-complex Stockham FFT over vectors of stride elements
+   * (m = remaining length/radix; w = forward twiddles of the stage, (radix-1) per p < m) */
+  void (*fftPass)(int radix, int m, int stride, const float* wr, const float* wi,
+                  const float* xr, const float* xi, float* yr, float* yi, int inverse);
+  /** b *= a (complex; split real and imaginary parts) */
+  void (*complexMulRow)(const float* ar, const float* ai, float* br, float* bi, int n);
+  /** c += sign*s1 (double accumulation); s2 may be given for c += sign*s1*s2 */
+  void (*accumulateRow_64f)(const float* s1, const float* s2, double sign, double* c, int n);
+  /** d[x] = scale*(p[x+window] - p[x]) (window sums from a prefix sum) */
+  void (*windowSumRow_64f)(const double* p, int window, double scale, float* d, int n);
+  /** d = min(a,b) / d = max(a,b) (elementwise) */
+  void (*minRow_8u)(const unsigned char* a, const unsigned char* b, unsigned char* d, int n);
+  void (*maxRow_8u)(const unsigned char* a, const unsigned char* b, unsigned char* d, int n);
+  void (*minRow_32f)(const float* a, const float* b, float* d, int n);
+  void (*maxRow_32f)(const float* a, const float* b, float* d, int n);
+  /** TV/TGV denoising: dual step p = proj(p + sigma*(grad ubar - vbar)) onto |p| <= radius*w of one
+   * row; x neighbours are step elements apart, ubar_down is the row below (ubar for the last row),
+   * vbar1/vbar2 are 0 for TV and w is 0 without edge weights */
+  void (*tvDualRow)(const float* ubar, const float* ubar_down, const float* vbar1, const float* vbar2,
+                    const float* w, float sigma, float radius, int step, float* px, float* py, int n);
+  /** TV/TGV denoising: primal step u = (u + tau*div p + tau*lambda*f)/(1 + tau*lambda) and
+   * ubar = u + theta*(u - u_old); py_up is the dual row above (zeros for the first row),
+   * py zeros for the last row */
+  void (*tvPrimalRow)(const float* f, const float* px, const float* py, const float* py_up,
+                      float tau, float lambda, float theta, int step, float* u, float* ubar, int n);
+  /** TGV denoising: dual step q = proj(q + sigma*grad vbar) onto |q| <= alpha0 with
+   * q = (d/dx v1, d/dy v2, d/dy v1, d/dx v2); vbar*_down as ubar_down of tvDualRow */
+  void (*tgv2DualRow)(const float* vbar1, const float* vbar2, const float* vbar1_down, const float* vbar2_down,
+                      float sigma, float alpha0, int step, float* q1, float* q2, float* q3, float* q4, int n);
+  /** TGV denoising: primal step v = v + tau*(p + div q) and vbar = v + theta*(v - v_old); q*_up
+   * are the dual rows above (zeros for the first row), q2/q3 zeros for the last row */
+  void (*tgv2PrimalRow)(const float* px, const float* py, const float* q1, const float* q2, const float* q2_up,
+                        const float* q3, const float* q3_up, const float* q4, float tau, float theta, int step,
+                        float* v1, float* v2, float* vbar1, float* vbar2, int n);
+};
+
+/** Returns the filter kernels of the level selected by iu::CpuDispatch. */
+const FilterKernels& filterKernels();
+
+} // namespace iuprivate
+
+#endif // IUPRIVATE_FILTERKERNELS_H
@@ -0,0 +1,453 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Filter
+ * Class       : none
+ * Language    : C++
+ * Description : Row kernels of the filters; compiled once per instruction set level
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+// No include guard: this file is included by the filterkernels_<level>.cpp files,
+// each defining IU_CPU_KERNELS_NAMESPACE and compiled with the target flags of
+// the core kernels of that level (iucore/cpukernels_impl.h).
+
+#ifndef IU_CPU_KERNELS_NAMESPACE
+  #error "IU_CPU_KERNELS_NAMESPACE has to be defined"
+#endif
+
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include <iucore/cpukernelsdefs.h>
+#include "filterkernels.h"
+
+namespace iuprivate {
+namespace IU_CPU_KERNELS_NAMESPACE {
+
+//-----------------------------------------------------------------------------
+// vectorized over x: every output keeps the sequential summation order over k.
+// Common kernel lengths are unrolled so the sums stay in registers.
+template<int Taps>
+static void convolveRowFixed(const float* IU_CPU_RESTRICT l, const float* IU_CPU_RESTRICT g, int step,
+                             float* IU_CPU_RESTRICT d, int n)
+{
+  float g_k[Taps];
+  for(int k=0; k<Taps; ++k)
+    g_k[k] = g[k];
+  for(int x=0; x<n; ++x)
+  {
+    float sum = g_k[0]*l[x];
+    for(int k=1; k<Taps; ++k)
+      sum += g_k[k]*l[x + k*step];
+    d[x] = sum;
+  }
+}
+
+static void convolveRow(const float* IU_CPU_RESTRICT l, const float* IU_CPU_RESTRICT g, int taps, int step,
+                        float* IU_CPU_RESTRICT d, int n)
+{
+  switch(taps)
+  {
+  case 3: convolveRowFixed<3>(l, g, step, d, n); return;
+  case 5: convolveRowFixed<5>(l, g, step, d, n); return;
+  case 7: convolveRowFixed<7>(l, g, step, d, n); return;
+  case 9: convolveRowFixed<9>(l, g, step, d, n); return;
+  default: break;
+  }
+  for(int x=0; x<n; ++x)
+    d[x] = g[0]*l[x];
+  for(int k=1; k<taps; ++k)
+  {
+    const float g_k = g[k];
+    const float* l_k = l + k*step;
+    for(int x=0; x<n; ++x)
+      d[x] += g_k*l_k[x];
+  }
+}
+
+//-----------------------------------------------------------------------------
+template<int Taps>
+static void convolveColumnsFixed(const float* const* rows, const float* IU_CPU_RESTRICT g,
+                                 float* IU_CPU_RESTRICT d, int n)
+{
+  float g_k[Taps];
+  const float* r[Taps];
+  for(int k=0; k<Taps; ++k)
+  {
+    g_k[k] = g[k];
+    r[k] = rows[k];
+  }
+  for(int x=0; x<n; ++x)
+  {
+    float sum = g_k[0]*r[0][x];
+    for(int k=1; k<Taps; ++k)
+      sum += g_k[k]*r[k][x];
+    d[x] = sum;
+  }
+}
+
+static void convolveColumns(const float* const* rows, const float* IU_CPU_RESTRICT g, int taps,
+                            float* IU_CPU_RESTRICT d, int n)
+{
+  switch(taps)
+  {
+  case 3: convolveColumnsFixed<3>(rows, g, d, n); return;
+  case 5: convolveColumnsFixed<5>(rows, g, d, n); return;
+  case 7: convolveColumnsFixed<7>(rows, g, d, n); return;
+  case 9: convolveColumnsFixed<9>(rows, g, d, n); return;
+  default: break;
+  }
+  for(int x=0; x<n; ++x)
+    d[x] = g[0]*rows[0][x];
+  for(int k=1; k<taps; ++k)
+  {
+    const float g_k = g[k];
+    const float* r_k = rows[k];
+    for(int x=0; x<n; ++x)
+      d[x] += g_k*r_k[x];
+  }
+}
+
+//-----------------------------------------------------------------------------
+static void accumulateRow_64f(const float* IU_CPU_RESTRICT s1, const float* IU_CPU_RESTRICT s2,
+                              double sign, double* IU_CPU_RESTRICT c, int n)
+{
+  if(s2 != 0)
+  {
+    for(int x=0; x<n; ++x)
+      c[x] += sign*((double)s1[x]*(double)s2[x]);
+  }
+  else
+  {
+    for(int x=0; x<n; ++x)
+      c[x] += sign*(double)s1[x];
+  }
+}
+
+//-----------------------------------------------------------------------------
+static void windowSumRow_64f(const double* IU_CPU_RESTRICT p, int window, double scale,
+                             float* IU_CPU_RESTRICT d, int n)
+{
+  const double* IU_CPU_RESTRICT q = p + window;
+  for(int x=0; x<n; ++x)
+    d[x] = (float)(scale*(q[x] - p[x]));
+}
+
+//-----------------------------------------------------------------------------
+// (d may alias a or b for running minima/maxima; no restrict)
+template<typename T>
+static void minRow(const T* a, const T* b, T* d, int n)
+{
+  for(int x=0; x<n; ++x)
+    d[x] = (b[x] < a[x]) ? b[x] : a[x];
+}
+
+template<typename T>
+static void maxRow(const T* a, const T* b, T* d, int n)
+{
+  for(int x=0; x<n; ++x)
+    d[x] = (a[x] < b[x]) ? b[x] : a[x];
+}
+
+//-----------------------------------------------------------------------------
+/* One Stockham stage of a split-complex FFT over vectors of 'stride' elements
+ * (the transform index times the batch): for p < m and j < radix
+ *   y[radix*p + j] = w_p^j * sum_k x[p + k*m] * exp(-+2 pi i j k/radix).
+ * Only forward twiddles are stored; the inverse uses their conjugates.
+ */
+template<int Radix>
+static inline void fftButterfly(const float* ar, const float* ai, float* zr, float* zi, float sign)
+{
+  if(Radix == 2)
+  {
+    zr[0] = ar[0] + ar[1];             zi[0] = ai[0] + ai[1];
+    zr[1] = ar[0] - ar[1];             zi[1] = ai[0] - ai[1];
+  }
+  else if(Radix == 3)
+  {
+    const float sin3 = 0.866025403784438647f;
+    const float t_r = ar[1] + ar[2], t_i = ai[1] + ai[2];
+    const float u_r = sign*sin3*(ar[1] - ar[2]), u_i = sign*sin3*(ai[1] - ai[2]);
+    const float b_r = ar[0] - 0.5f*t_r, b_i = ai[0] - 0.5f*t_i;
+    zr[0] = ar[0] + t_r;               zi[0] = ai[0] + t_i;
+    zr[1] = b_r + u_i;                 zi[1] = b_i - u_r;
+    zr[2] = b_r - u_i;                 zi[2] = b_i + u_r;
+  }
+  else if(Radix == 4)
+  {
+    const float t0_r = ar[0] + ar[2], t0_i = ai[0] + ai[2];
+    const float t1_r = ar[0] - ar[2], t1_i = ai[0] - ai[2];
+    const float t2_r = ar[1] + ar[3], t2_i = ai[1] + ai[3];
+    const float t3_r = sign*(ai[1] - ai[3]), t3_i = -sign*(ar[1] - ar[3]);
+    zr[0] = t0_r + t2_r;               zi[0] = t0_i + t2_i;
+    zr[1] = t1_r + t3_r;               zi[1] = t1_i + t3_i;
+    zr[2] = t0_r - t2_r;               zi[2] = t0_i - t2_i;
+    zr[3] = t1_r - t3_r;               zi[3] = t1_i - t3_i;
+  }
+  else
+  {
+    const float c1 = 0.309016994374947424f, c2 = -0.809016994374947424f;
+    const float s1 = 0.951056516295153572f, s2 = 0.587785252292473129f;
+    const float t1_r = ar[1] + ar[4], t1_i = ai[1] + ai[4];
+    const float t2_r = ar[2] + ar[3], t2_i = ai[2] + ai[3];
+    const float t3_r = ar[1] - ar[4], t3_i = ai[1] - ai[4];
+    const float t4_r = ar[2] - ar[3], t4_i = ai[2] - ai[3];
+    const float b1_r = ar[0] + c1*t1_r + c2*t2_r, b1_i = ai[0] + c1*t1_i + c2*t2_i;
+    const float b2_r = ar[0] + c2*t1_r + c1*t2_r, b2_i = ai[0] + c2*t1_i + c1*t2_i;
+    const float d1_r = sign*(s1*t3_r + s2*t4_r), d1_i = sign*(s1*t3_i + s2*t4_i);
+    const float d2_r = sign*(s2*t3_r - s1*t4_r), d2_i = sign*(s2*t3_i - s1*t4_i);
+    zr[0] = ar[0] + t1_r + t2_r;       zi[0] = ai[0] + t1_i + t2_i;
+    zr[1] = b1_r + d1_i;               zi[1] = b1_i - d1_r;
+    zr[4] = b1_r - d1_i;               zi[4] = b1_i + d1_r;
+    zr[2] = b2_r + d2_i;               zi[2] = b2_i - d2_r;
+    zr[3] = b2_r - d2_i;               zi[3] = b2_i + d2_r;
+  }
+}
+
+template<int Radix, bool Inverse>
+static void fftStage(int m, int stride, const float* IU_CPU_RESTRICT wr, const float* IU_CPU_RESTRICT wi,
+                     const float* IU_CPU_RESTRICT xr, const float* IU_CPU_RESTRICT xi,
+                     float* IU_CPU_RESTRICT yr, float* IU_CPU_RESTRICT yi)
+{
+  const float sign = Inverse ? -1.0f : 1.0f;
+  const int xm = m*stride;
+  for(int p=0; p<m; ++p)
+  {
+    float tr[Radix], ti[Radix];
+    for(int j=1; j<Radix; ++j)
+    {
+      tr[j] = wr[p*(Radix-1) + j-1];
+      ti[j] = sign*wi[p*(Radix-1) + j-1];
+    }
+    const float* IU_CPU_RESTRICT pr = xr + p*stride;
+    const float* IU_CPU_RESTRICT pi = xi + p*stride;
+    float* IU_CPU_RESTRICT qr = yr + Radix*p*stride;
+    float* IU_CPU_RESTRICT qi = yi + Radix*p*stride;
+
+    IU_CPU_IVDEP
+    for(int i=0; i<stride; ++i)
+    {
+      float ar[Radix], ai[Radix], zr[Radix], zi[Radix];
+      for(int k=0; k<Radix; ++k)
+      {
+        ar[k] = pr[k*xm + i];
+        ai[k] = pi[k*xm + i];
+      }
+      fftButterfly<Radix>(ar, ai, zr, zi, sign);
+      qr[i] = zr[0];
+      qi[i] = zi[0];
+      for(int j=1; j<Radix; ++j)
+      {
+        qr[j*stride + i] = tr[j]*zr[j] - ti[j]*zi[j];
+        qi[j*stride + i] = tr[j]*zi[j] + ti[j]*zr[j];
+      }
+    }
+  }
+}
+
+template<bool Inverse>
+static void fftPass(int radix, int m, int stride, const float* wr, const float* wi,
+                    const float* xr, const float* xi, float* yr, float* yi)
+{
+  switch(radix)
+  {
+  case 2: fftStage<2, Inverse>(m, stride, wr, wi, xr, xi, yr, yi); break;
+  case 3: fftStage<3, Inverse>(m, stride, wr, wi, xr, xi, yr, yi); break;
+  case 4: fftStage<4, Inverse>(m, stride, wr, wi, xr, xi, yr, yi); break;
+  default: fftStage<5, Inverse>(m, stride, wr, wi, xr, xi, yr, yi); break;
+  }
+}
+
+static void fftPass(int radix, int m, int stride, const float* wr, const float* wi,
+                    const float* xr, const float* xi, float* yr, float* yi, int inverse)
+{
+  if(inverse)
+    fftPass<true>(radix, m, stride, wr, wi, xr, xi, yr, yi);
+  else
+    fftPass<false>(radix, m, stride, wr, wi, xr, xi, yr, yi);
+}
+
+//-----------------------------------------------------------------------------
+static void complexMulRow(const float* IU_CPU_RESTRICT ar, const float* IU_CPU_RESTRICT ai,
+                          float* IU_CPU_RESTRICT br, float* IU_CPU_RESTRICT bi, int n)
+{
+  for(int x=0; x<n; ++x)
+  {
+    const float r = ar[x]*br[x] - ai[x]*bi[x];
+    const float i = ar[x]*bi[x] + ai[x]*br[x];
+    br[x] = r;
+    bi[x] = i;
+  }
+}
+
+//-----------------------------------------------------------------------------
+/* Primal-dual (Chambolle-Pock) TV and TGV denoising. The dual variables are
+ * projected onto balls of the given radius; the gradients are forward
+ * differences (0 at the last column/row) and the divergences their negative
+ * adjoints. Interleaved channels are processed independently, i.e. the x
+ * neighbours are step elements apart.
+ */
+static inline void projectDual(float gx, float gy, float sigma, float radius, float& px, float& py)
+{
+  px = px + sigma*gx;
+  py = py + sigma*gy;
+  const float norm = std::sqrt(px*px + py*py);
+  const float s = radius/std::max(std::max(norm, radius), 1e-30f);
+  px = px*s;
+  py = py*s;
+}
+
+template<bool WEIGHTED, bool TGV>
+static void tvDualRowT(const float* IU_CPU_RESTRICT ubar, const float* IU_CPU_RESTRICT ubar_down,
+                       const float* IU_CPU_RESTRICT vbar1, const float* IU_CPU_RESTRICT vbar2,
+                       const float* IU_CPU_RESTRICT w, float sigma, float radius, int step,
+                       float* IU_CPU_RESTRICT px, float* IU_CPU_RESTRICT py, int n)
+{
+  const int last = (n > step) ? n-step : 0;
+  IU_CPU_IVDEP
+  for(int x=0; x<last; ++x)
+    projectDual(ubar[x+step]-ubar[x] - (TGV ? vbar1[x] : 0.0f), ubar_down[x]-ubar[x] - (TGV ? vbar2[x] : 0.0f),
+                sigma, WEIGHTED ? radius*w[x] : radius, px[x], py[x]);
+  for(int x=last; x<n; ++x)
+    projectDual(-(TGV ? vbar1[x] : 0.0f), ubar_down[x]-ubar[x] - (TGV ? vbar2[x] : 0.0f),
+                sigma, WEIGHTED ? radius*w[x] : radius, px[x], py[x]);
+}
+
+static void tvDualRow(const float* ubar, const float* ubar_down, const float* vbar1, const float* vbar2,
+                      const float* w, float sigma, float radius, int step, float* px, float* py, int n)
+{
+  if(w && vbar1)
+    tvDualRowT<true, true>(ubar, ubar_down, vbar1, vbar2, w, sigma, radius, step, px, py, n);
+  else if(w)
+    tvDualRowT<true, false>(ubar, ubar_down, vbar1, vbar2, w, sigma, radius, step, px, py, n);
+  else if(vbar1)
+    tvDualRowT<false, true>(ubar, ubar_down, vbar1, vbar2, w, sigma, radius, step, px, py, n);
+  else
+    tvDualRowT<false, false>(ubar, ubar_down, vbar1, vbar2, w, sigma, radius, step, px, py, n);
+}
+
+static inline void tvPrimal(float f, float div, float tau, float taul, float inv, float theta,
+                            float& u, float& ubar)
+{
+  const float u_new = (u + tau*div + taul*f)*inv;
+  ubar = u_new + theta*(u_new - u);
+  u = u_new;
+}
+
+static void tvPrimalRow(const float* IU_CPU_RESTRICT f, const float* IU_CPU_RESTRICT px,
+                        const float* IU_CPU_RESTRICT py, const float* IU_CPU_RESTRICT py_up,
+                        float tau, float lambda, float theta, int step,
+                        float* IU_CPU_RESTRICT u, float* IU_CPU_RESTRICT ubar, int n)
+{
+  const float taul = tau*lambda;
+  const float inv = 1.0f/(1.0f + taul);
+  const int left = (step < n) ? step : n;
+  const int right = (n-step > step) ? n-step : step;
+  for(int x=0; x<left; ++x)
+    tvPrimal(f[x], ((x+step < n) ? px[x] : 0.0f) + py[x]-py_up[x], tau, taul, inv, theta, u[x], ubar[x]);
+  for(int x=step; x<n-step; ++x)
+    tvPrimal(f[x], px[x]-px[x-step] + py[x]-py_up[x], tau, taul, inv, theta, u[x], ubar[x]);
+  for(int x=right; x<n; ++x)
+    tvPrimal(f[x], -px[x-step] + py[x]-py_up[x], tau, taul, inv, theta, u[x], ubar[x]);
+}
+
+static inline void projectDual(float g1, float g2, float g3, float g4, float sigma, float radius,
+                               float& q1, float& q2, float& q3, float& q4)
+{
+  q1 = q1 + sigma*g1;
+  q2 = q2 + sigma*g2;
+  q3 = q3 + sigma*g3;
+  q4 = q4 + sigma*g4;
+  const float norm = std::sqrt(q1*q1 + q2*q2 + q3*q3 + q4*q4);
+  const float s = radius/std::max(std::max(norm, radius), 1e-30f);
+  q1 = q1*s;
+  q2 = q2*s;
+  q3 = q3*s;
+  q4 = q4*s;
+}
+
+static void tgv2DualRow(const float* IU_CPU_RESTRICT vbar1, const float* IU_CPU_RESTRICT vbar2,
+                        const float* IU_CPU_RESTRICT vbar1_down, const float* IU_CPU_RESTRICT vbar2_down,
+                        float sigma, float alpha0, int step,
+                        float* IU_CPU_RESTRICT q1, float* IU_CPU_RESTRICT q2,
+                        float* IU_CPU_RESTRICT q3, float* IU_CPU_RESTRICT q4, int n)
+{
+  const int last = (n > step) ? n-step : 0;
+  for(int x=0; x<last; ++x)
+    projectDual(vbar1[x+step]-vbar1[x], vbar2_down[x]-vbar2[x], vbar1_down[x]-vbar1[x], vbar2[x+step]-vbar2[x],
+                sigma, alpha0, q1[x], q2[x], q3[x], q4[x]);
+  for(int x=last; x<n; ++x)
+    projectDual(0.0f, vbar2_down[x]-vbar2[x], vbar1_down[x]-vbar1[x], 0.0f,
+                sigma, alpha0, q1[x], q2[x], q3[x], q4[x]);
+}
+
+static inline void tgv2Primal(float p, float div, float tau, float theta, float& v, float& vbar)
+{
+  const float v_new = v + tau*(p + div);
+  vbar = v_new + theta*(v_new - v);
+  v = v_new;
+}
+
+static void tgv2PrimalRow(const float* IU_CPU_RESTRICT px, const float* IU_CPU_RESTRICT py,
+                          const float* IU_CPU_RESTRICT q1, const float* IU_CPU_RESTRICT q2,
+                          const float* IU_CPU_RESTRICT q2_up, const float* IU_CPU_RESTRICT q3,
+                          const float* IU_CPU_RESTRICT q3_up, const float* IU_CPU_RESTRICT q4,
+                          float tau, float theta, int step,
+                          float* IU_CPU_RESTRICT v1, float* IU_CPU_RESTRICT v2,
+                          float* IU_CPU_RESTRICT vbar1, float* IU_CPU_RESTRICT vbar2, int n)
+{
+  const int left = (step < n) ? step : n;
+  const int right = (n-step > step) ? n-step : step;
+  for(int x=0; x<left; ++x)
+  {
+    const bool inner = (x+step < n);
+    tgv2Primal(px[x], (inner ? q1[x] : 0.0f) + q3[x]-q3_up[x], tau, theta, v1[x], vbar1[x]);
+    tgv2Primal(py[x], (inner ? q4[x] : 0.0f) + q2[x]-q2_up[x], tau, theta, v2[x], vbar2[x]);
+  }
+  for(int x=step; x<n-step; ++x)
+  {
+    tgv2Primal(px[x], q1[x]-q1[x-step] + q3[x]-q3_up[x], tau, theta, v1[x], vbar1[x]);
+    tgv2Primal(py[x], q4[x]-q4[x-step] + q2[x]-q2_up[x], tau, theta, v2[x], vbar2[x]);
+  }
+  for(int x=right; x<n; ++x)
+  {
+    tgv2Primal(px[x], -q1[x-step] + q3[x]-q3_up[x], tau, theta, v1[x], vbar1[x]);
+    tgv2Primal(py[x], -q4[x-step] + q2[x]-q2_up[x], tau, theta, v2[x], vbar2[x]);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void getFilterKernels(FilterKernels& kernels)
+{
+  kernels.convolveRow = convolveRow;
+  kernels.convolveColumns = convolveColumns;
+  kernels.fftPass = fftPass;
+  kernels.complexMulRow = complexMulRow;
+  kernels.accumulateRow_64f = accumulateRow_64f;
+  kernels.windowSumRow_64f = windowSumRow_64f;
+  kernels.minRow_8u = minRow<unsigned char>;
+  kernels.maxRow_8u = maxRow<unsigned char>;
+  kernels.minRow_32f = minRow<float>;
+  kernels.maxRow_32f = maxRow<float>;
+  kernels.tvDualRow = tvDualRow;
+  kernels.tvPrimalRow = tvPrimalRow;
+  kernels.tgv2DualRow = tgv2DualRow;
+  kernels.tgv2PrimalRow = tgv2PrimalRow;
+}
+
+} // namespace IU_CPU_KERNELS_NAMESPACE
+} // namespace iuprivate
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Filter Module
+ * Class       : none
+ * Language    : C++
+ * Description : Host implementation of the morphological filters (van Herk/Gil-Werman)
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <string.h>
+#include <limits>
+#include <vector>
+#include <iucutil.h>
+#include <iucore/executor.h>
+#include "filterkernels.h"
+#include "filter.h"
+
+namespace iuprivate {
+
+/* ***************************************************************************
+ *  van Herk/Gil-Werman
+ * ***************************************************************************/
+// A line padded with the neutral element is split into blocks of k samples.
+// g holds the running min/max from the start of every block, h the one to its
+// end; the window [i, i+k-1] then is the min/max of h[i] and g[i+k-1]. Together
+// these are three comparisons per sample for any k. The window is anchored at
+// (k-1)/2 and clipped at the image border.
+
+template<typename T, bool Erode> struct Morph;
+
+template<bool Erode> struct Morph<unsigned char, Erode>
+{
+  typedef void (*RowFn)(const unsigned char*, const unsigned char*, unsigned char*, int);
+  static unsigned char neutral() { return Erode ? 255 : 0; }
+  static RowFn row(const FilterKernels& k) { return Erode ? k.minRow_8u : k.maxRow_8u; }
+  static unsigned char pick(unsigned char a, unsigned char b) { return Erode ? IUMIN(a,b) : IUMAX(a,b); }
+};
+
+template<bool Erode> struct Morph<float, Erode>
+{
+  typedef void (*RowFn)(const float*, const float*, float*, int);
+  static float neutral()
+  {
+    return Erode ? std::numeric_limits<float>::infinity() : -std::numeric_limits<float>::infinity();
+  }
+  static RowFn row(const FilterKernels& k) { return Erode ? k.minRow_32f : k.maxRow_32f; }
+  static float pick(float a, float b) { return Erode ? IUMIN(a,b) : IUMAX(a,b); }
+};
+
+//-----------------------------------------------------------------------------
+/* Horizontal pass; every row on its own. The scans along x are serial (the
+ * rows are not interleaved for SIMD: the transposition costs more than the
+ * scans), the final min/max of h and g is a row kernel.
+ */
+template<typename T, bool Erode>
+struct MorphRowsX
+{
+  typedef Morph<T, Erode> M;
+  const T* src;
+  size_t src_stride;
+  T* dst;
+  size_t dst_stride;
+  int width;
+  int k;
+  typename M::RowFn row_fn;
+
+  void operator()(int begin, int end) const
+  {
+    const int anchor = (k-1)/2;
+    const int n = width + k - 1;
+    std::vector<T> buffer(3*n, M::neutral());
+    T* line = &buffer[0];
+    T* g = line + n;
+    T* h = g + n;
+
+    for(int y=begin; y<end; ++y)
+    {
+      // the padding of the line stays neutral
+      memcpy(line + anchor, src + y*src_stride, width*sizeof(T));
+      for(int b=0; b<n; b+=k)
+      {
+        const int last = IUMIN(b+k, n) - 1;
+        g[b] = line[b];
+        for(int i=b+1; i<=last; ++i)
+          g[i] = M::pick(g[i-1], line[i]);
+        h[last] = line[last];
+        for(int i=last-1; i>=b; --i)
+          h[i] = M::pick(h[i+1], line[i]);
+      }
+      row_fn(h, g + k-1, dst + y*dst_stride, width);
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+/* Vertical pass on strips of columns. The blocks are streamed from top to
+ * bottom: for the output rows of block B only h of block B and g of block B+1
+ * are needed, so every strip needs two blocks of k rows of memory. All
+ * operations are row kernels over the strip width.
+ */
+template<typename T, bool Erode>
+struct MorphColumnsY
+{
+  typedef Morph<T, Erode> M;
+  const T* src;
+  size_t src_stride;
+  T* dst;
+  size_t dst_stride;
+  int width;
+  int height;
+  int k;
+  int strip_width;
+  typename M::RowFn row_fn;
+
+  void operator()(int begin, int end) const
+  {
+    const int n = height + k - 1;  // padded rows
+    const int x0 = begin*strip_width;
+    const int sw = IUMIN(end*strip_width, width) - x0;
+    std::vector<T> buffer((2*k+1)*sw, M::neutral());
+    T* h = &buffer[0];
+    T* g = h + k*sw;
+    const T* neutral_row = g + k*sw;
+
+    for(int b=0; b<height; b+=k)
+    {
+      // h of block b (backwards)
+      const int last = IUMIN(b+k, n) - 1;
+      T* h_last = h + (last-b)*sw;
+      memcpy(h_last, paddedRow(last, x0, neutral_row), sw*sizeof(T));
+      for(int i=last-1; i>=b; --i)
+        row_fn(paddedRow(i, x0, neutral_row), h + (i-b+1)*sw, h + (i-b)*sw, sw);
+
+      // g of block b+k (forwards; only the rows needed by block b)
+      const int out_end = IUMIN(b+k, height);
+      const int g_last = IUMIN(out_end-1 + k-1, n-1);
+      if(b+k <= g_last)
+      {
+        memcpy(g, paddedRow(b+k, x0, neutral_row), sw*sizeof(T));
+        for(int i=b+k+1; i<=g_last; ++i)
+          row_fn(g + (i-b-k-1)*sw, paddedRow(i, x0, neutral_row), g + (i-b-k)*sw, sw);
+      }
+
+      // output rows of block b: window [y, y+k-1] in padded rows
+      memcpy(dst + b*dst_stride + x0, h, sw*sizeof(T));
+      for(int y=b+1; y<out_end; ++y)
+        row_fn(h + (y-b)*sw, g + (y-b-1)*sw, dst + y*dst_stride + x0, sw);
+    }
+  }
+
+  inline const T* paddedRow(int i, int x0, const T* neutral_row) const
+  {
+    const int y = i - (k-1)/2;
+    return (y >= 0 && y < height) ? src + y*src_stride + x0 : neutral_row;
+  }
+};
+
+//-----------------------------------------------------------------------------
+template<typename T, bool Erode>
+static void morphology(const T* src, size_t src_stride, T* dst, size_t dst_stride,
+                       int width, int height, const IuSize& kernel_size)
+{
+  if(kernel_size.width == 0 || kernel_size.height == 0)
+    throw IuException("kernel size has to be at least 1x1", __FILE__, __FUNCTION__, __LINE__);
+
+  const FilterKernels& kernels = filterKernels();
+  const int kx = kernel_size.width;
+  const int ky = kernel_size.height;
+
+  // the vertical pass streams over the rows and cannot work in-place
+  std::vector<T> tmp;
+  if(kx == 1 && ky > 1 && src == dst)
+  {
+    tmp.resize((size_t)width*height);
+    for(int y=0; y<height; ++y)
+      memcpy(&tmp[y*width], src + y*src_stride, width*sizeof(T));
+    src = &tmp[0];
+    src_stride = width;
+  }
+
+  // horizontal pass; directly into the destination without a vertical pass
+  if(kx > 1)
+  {
+    MorphRowsX<T, Erode> pass_x;
+    pass_x.src = src;
+    pass_x.src_stride = src_stride;
+    pass_x.width = width;
+    pass_x.k = kx;
+    pass_x.row_fn = Morph<T, Erode>::row(kernels);
+    if(ky > 1)
+    {
+      tmp.resize((size_t)width*height);
+      pass_x.dst = &tmp[0];
+      pass_x.dst_stride = width;
+    }
+    else
+    {
+      pass_x.dst = dst;
+      pass_x.dst_stride = dst_stride;
+    }
+    iu::parallelFor(0, height, pass_x, iu::Executor::rowGrain(3*width));
+    if(ky == 1)
+      return;
+    src = &tmp[0];
+    src_stride = width;
+  }
+
+  if(ky > 1)
+  {
+    MorphColumnsY<T, Erode> pass_y;
+    pass_y.src = src;
+    pass_y.src_stride = src_stride;
+    pass_y.dst = dst;
+    pass_y.dst_stride = dst_stride;
+    pass_y.width = width;
+    pass_y.height = height;
+    pass_y.k = ky;
+    pass_y.row_fn = Morph<T, Erode>::row(kernels);
+    // two blocks of a strip stay in the L2 cache
+    pass_y.strip_width = IUMIN(width, IUMAX(64, (int)(128*1024/(2*ky*sizeof(T))) & ~63));
+    const int strips = (width + pass_y.strip_width-1)/pass_y.strip_width;
+    iu::parallelFor(0, strips, pass_y, 1);
+  }
+  else if(src != dst)
+  {
+    for(int y=0; y<height; ++y)
+      memcpy(dst + y*dst_stride, src + y*src_stride, width*sizeof(T));
+  }
+}
+
+//-----------------------------------------------------------------------------
+// dst -= sub (dst >= sub for the morphological gradient)
+template<typename T>
+struct SubtractRows
+{
+  T* dst;
+  size_t dst_stride;
+  const T* sub;
+  size_t sub_stride;
+  int width;
+
+  void operator()(int begin, int end) const
+  {
+    for(int y=begin; y<end; ++y)
+    {
+      T* d = dst + y*dst_stride;
+      const T* s = sub + y*sub_stride;
+      for(int x=0; x<width; ++x)
+        d[x] = (T)(d[x] - s[x]);
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+template<typename T>
+static void morphology(const T* src, size_t src_stride, T* dst, size_t dst_stride,
+                       int width, int height, IuMorphologyType type, const IuSize& kernel_size)
+{
+  std::vector<T> tmp;
+  if(type != IU_MORPHOLOGY_ERODE && type != IU_MORPHOLOGY_DILATE)
+    tmp.resize((size_t)width*height);
+
+  switch(type)
+  {
+  case IU_MORPHOLOGY_ERODE:
+    morphology<T, true>(src, src_stride, dst, dst_stride, width, height, kernel_size);
+    break;
+  case IU_MORPHOLOGY_DILATE:
+    morphology<T, false>(src, src_stride, dst, dst_stride, width, height, kernel_size);
+    break;
+  case IU_MORPHOLOGY_OPEN:
+    morphology<T, true>(src, src_stride, &tmp[0], width, width, height, kernel_size);
+    morphology<T, false>(&tmp[0], width, dst, dst_stride, width, height, kernel_size);
+    break;
+  case IU_MORPHOLOGY_CLOSE:
+    morphology<T, false>(src, src_stride, &tmp[0], width, width, height, kernel_size);
+    morphology<T, true>(&tmp[0], width, dst, dst_stride, width, height, kernel_size);
+    break;
+  case IU_MORPHOLOGY_GRADIENT:
+  {
+    morphology<T, true>(src, src_stride, &tmp[0], width, width, height, kernel_size);
+    morphology<T, false>(src, src_stride, dst, dst_stride, width, height, kernel_size);
+    SubtractRows<T> body;
+    body.dst = dst;
+    body.dst_stride = dst_stride;
+    body.sub = &tmp[0];
+    body.sub_stride = width;
+    body.width = width;
+    iu::parallelFor(0, height, body, iu::Executor::rowGrain(width));
+    break;
+  }
+  default:
+    throw IuException("unknown morphology type", __FILE__, __FUNCTION__, __LINE__);
+  }
+}
+
+/* ***************************************************************************
+ *  FUNCTION IMPLEMENTATIONS
+ * ***************************************************************************/
+
+// host; 8-bit; 1-channel
+void filterMorphology(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                      IuMorphologyType type, const IuSize& kernel_size)
+{
+  if(src->size() != dst->size())
+    throw IuException("source and destination image have to be of the same size",
+                      __FILE__, __FUNCTION__, __LINE__);
+  morphology(src->data(), src->stride(), dst->data(), dst->stride(),
+             src->width(), src->height(), type, kernel_size);
+}
+
+// host; 32-bit; 1-channel
+void filterMorphology(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                      IuMorphologyType type, const IuSize& kernel_size)
+{
+  if(src->size() != dst->size())
+    throw IuException("source and destination image have to be of the same size",
+                      __FILE__, __FUNCTION__, __LINE__);
+  morphology(src->data(), src->stride(), dst->data(), dst->stride(),
+             src->width(), src->height(), type, kernel_size);
+}
+
+} // namespace iuprivate
@@ -1,5 +1,6 @@
 #include "iuinteraction.h"
 #include <iuinteraction/draw.h>
+#include "iucore/trace.h"
 
 namespace iu {
 
@@ -7,6 +8,7 @@ namespace iu {
 void drawLine(iu::Image *image, int x_start, int y_start,
               int x_end, int y_end, int line_width, float value)
 {
+  IU_TRACE_FUNCTION();
   iuprivate::drawLine(image, x_start, y_start, x_end, y_end, line_width, value);
 }
 
@@ -22,6 +22,7 @@
  */
 
 #include <iucore/copy.h>
+#include <iucore/trace.h>
 #include "videocapture_private.h"
 #include "videocapture.h"
 #include <iostream>
@@ -66,6 +67,7 @@ bool VideoCapture::retrieve(cv::Mat &image, int channel)
 //-----------------------------------------------------------------------------
 void VideoCapture::retrieve(iu::ImageCpu_8u_C1 *image)
 {
+  IU_TRACE_FUNCTION();
   if (!this->isOpened())
     throw IuException("VideoCapture: Capture device not ready.\n",
                       __FILE__, __FUNCTION__, __LINE__);
@@ -82,11 +84,13 @@ void VideoCapture::retrieve(iu::ImageCpu_8u_C1 *image)
   cv::Mat mat_8u(image->height(), image->width(), CV_8UC1, image->data(), image->pitch());
   // convert to grayscale image
   cv::cvtColor(frame_, mat_8u, CV_BGR2GRAY);
+  IU_TRACE_COUNT(frame_.total()*frame_.elemSize() + image->bytes(), image->numel());
 }
 
 //-----------------------------------------------------------------------------
 void VideoCapture::retrieve(iu::ImageCpu_32f_C1 *image)
 {
+  IU_TRACE_FUNCTION();
   if (!this->isOpened())
     throw IuException("VideoCapture: Capture device not ready.\n",
                       __FILE__, __FUNCTION__, __LINE__);
@@ -105,11 +109,13 @@ void VideoCapture::retrieve(iu::ImageCpu_32f_C1 *image)
   cv::cvtColor(frame_, mat_8u, CV_BGR2GRAY);
   cv::Mat im_mat(image->height(), image->width(), CV_32FC1, image->data(), image->pitch());
   mat_8u.convertTo(im_mat, im_mat.type(), 1.0f/255.0f, 0);
+  IU_TRACE_COUNT(frame_.total()*frame_.elemSize() + image->bytes(), image->numel());
 }
 
 //-----------------------------------------------------------------------------
 void VideoCapture::retrieve(iu::ImageGpu_8u_C1 *image)
 {
+  IU_TRACE_FUNCTION();
   IuSize sz = this->size();
   iu::ImageCpu_8u_C1 cpu_image(sz.width, sz.height);
   this->retrieve(&cpu_image);
@@ -119,6 +125,7 @@ void VideoCapture::retrieve(iu::ImageGpu_8u_C1 *image)
 //-----------------------------------------------------------------------------
 void VideoCapture::retrieve(iu::ImageGpu_32f_C1 *image)
 {
+  IU_TRACE_FUNCTION();
   IuSize sz = this->size();
   iu::ImageCpu_32f_C1 cpu_image(sz.width, sz.height);
   this->retrieve(&cpu_image);
@@ -21,6 +21,7 @@
  *
  */
 
+#include <iucore/trace.h>
 #include "videocapturethread.h"
 
 namespace iuprivate {
@@ -66,7 +67,6 @@ VideoCaptureThread::VideoCaptureThread(int device) :
 //-----------------------------------------------------------------------------
 VideoCaptureThread::~VideoCaptureThread()
 {
-  printf("delete VideoCaptureThread");
   stop_thread_ = true;
   wait();
   cv_cap_->release();
@@ -76,6 +76,7 @@ VideoCaptureThread::~VideoCaptureThread()
 //-----------------------------------------------------------------------------
 void VideoCaptureThread::run()
 {
+  iu::Trace::setThreadName("VideoCaptureThread");
   forever
   {
     if(stop_thread_)
@@ -89,22 +90,21 @@ void VideoCaptureThread::run()
       return;
     }
 
-    printf("thread: get next frame\n");
-    (*cv_cap_) >> frame_;
+    {
+      IU_TRACE_ZONE("VideoCaptureThread::grab");
+      (*cv_cap_) >> frame_;
+    }
 
     // copy to 'external' data
-    printf("thread: cp frame to external data\n");
     if(ext_frame_ != 0)
     {
+      IU_TRACE_ZONE("VideoCaptureThread::copy");
       QMutexLocker lock(&mutex_);
-      printf("! thread: cp operation\n");
       frame_.copyTo(*ext_frame_);
-      printf("! thread: cp set flag");
       *ext_new_image_available_ = true;
-      printf("! thread: cp done\n");
+      IU_TRACE_COUNT(frame_.total()*frame_.elemSize(), frame_.total());
     }
 
-    printf("thread: sleep\n");
     this->usleep(sleep_time_usecs_);
   }
 }
@@ -22,6 +22,7 @@
  */
 
 #include "iuio/imageiopgm.h"
+#include "iucore/trace.h"
 
 namespace iu {
 
@@ -30,12 +31,12 @@ namespace iu {
  * ***************************************************************************/
 
 iu::ImageCpu_16u_C1* imread_16u_C1(const std::string& filename)
-{ return iuprivate::imread_16u_C1(filename); }
+{ IU_TRACE_FUNCTION(); return iuprivate::imread_16u_C1(filename); }
 
 iu::ImageCpu_32f_C1* imread_16u32f_C1(const std::string& filename, int max_val)
-{ return iuprivate::imread_16u32f_C1(filename, max_val); }
+{ IU_TRACE_FUNCTION(); return iuprivate::imread_16u32f_C1(filename, max_val); }
 
 iu::ImageGpu_32f_C1* imread_cu16u32f_C1(const std::string& filename, int max_val)
-{ return iuprivate::imread_cu16u32f_C1(filename, max_val); }
+{ IU_TRACE_FUNCTION(); return iuprivate::imread_cu16u32f_C1(filename, max_val); }
 
 } // namespace iu
@@ -114,6 +114,23 @@ IUCORE_DLLAPI void addC(const iu::ImageGpu_32f_C1* src, const float& val, iu::Im
 IUCORE_DLLAPI void addC(const iu::ImageGpu_32f_C2* src, const float2& val, iu::ImageGpu_32f_C2* dst, const IuRect& roi);
 IUCORE_DLLAPI void addC(const iu::ImageGpu_32f_C4* src, const float4& val, iu::ImageGpu_32f_C4* dst, const IuRect& roi);
 
+/** Host arithmetics on planar images (see iu::convert for the layout conversion).
+ * Every channel plane is processed with contiguous row loops. (can be called in-place)
+ * \param roi Region of interest in the source and destination images
+ */
+// [host] weighted add; Not-in-place; 32-bit; planar
+IUCORE_DLLAPI void addWeighted(const iu::ImagePlanarCpu_32f_C3* src1, const float& weight1,
+                               const iu::ImagePlanarCpu_32f_C3* src2, const float& weight2,
+                               iu::ImagePlanarCpu_32f_C3* dst, const IuRect& roi);
+IUCORE_DLLAPI void addWeighted(const iu::ImagePlanarCpu_32f_C4* src1, const float& weight1,
+                               const iu::ImagePlanarCpu_32f_C4* src2, const float& weight2,
+                               iu::ImagePlanarCpu_32f_C4* dst, const IuRect& roi);
+// [host] multiplication with factor / add val; Not-in-place; 32-bit; planar
+IUCORE_DLLAPI void mulC(const iu::ImagePlanarCpu_32f_C3* src, const float3& factor, iu::ImagePlanarCpu_32f_C3* dst, const IuRect& roi);
+IUCORE_DLLAPI void mulC(const iu::ImagePlanarCpu_32f_C4* src, const float4& factor, iu::ImagePlanarCpu_32f_C4* dst, const IuRect& roi);
+IUCORE_DLLAPI void addC(const iu::ImagePlanarCpu_32f_C3* src, const float3& val, iu::ImagePlanarCpu_32f_C3* dst, const IuRect& roi);
+IUCORE_DLLAPI void addC(const iu::ImagePlanarCpu_32f_C4* src, const float4& val, iu::ImagePlanarCpu_32f_C4* dst, const IuRect& roi);
+
 
 /** @} */ // end of Arithmetics
 
@@ -286,6 +303,50 @@ IUCORE_DLLAPI void colorHistogram(const iu::ImageGpu_8u_C4* binned_image, const
 
 
 
+/* ***************************************************************************
+     INTEGRAL IMAGES
+ * ***************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////////
+/** @defgroup Integral Images
+ *  @ingroup Math
+ *  Summed-area tables and constant time box queries on the host.
+ *  @{
+ */
+
+/** Computes the integral image (summed-area table) of \a src.
+ * \param src Source image.
+ * \param dst Integral image of size (width+1)x(height+1); dst(x,y) is the sum of src over [0,x)x[0,y).
+ */
+// [host] integral image; 8-bit / 32-bit
+IUCORE_DLLAPI void integral(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_64f_C1* dst);
+IUCORE_DLLAPI void integral(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_64f_C1* dst);
+
+/** Computes the integral image of the squared pixel values of \a src (same layout as iu::integral).
+ */
+// [host] integral image of squares; 8-bit / 32-bit
+IUCORE_DLLAPI void integralSquared(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_64f_C1* dst);
+IUCORE_DLLAPI void integralSquared(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_64f_C1* dst);
+
+/** Computes sum, mean and variance of a batch of boxes in O(1) per box.
+ * \param integral Integral image (iu::integral).
+ * \param integral_sq Integral image of squares (iu::integralSquared); only needed for the variances.
+ * \param boxes Boxes in source image coordinates; they are clipped to the image.
+ * \param num Number of boxes.
+ * \param sums, means, variances Output arrays with \a num elements each; each of them may be 0.
+ */
+// [host] batched box statistics
+IUCORE_DLLAPI void boxStatistics(const iu::ImageCpu_64f_C1* integral, const iu::ImageCpu_64f_C1* integral_sq,
+                                 const IuRect* boxes, int num, double* sums, double* means, double* variances);
+
+/** Returns the sum of the pixels within \a box (clipped to the image).
+ */
+IUCORE_DLLAPI double boxSum(const iu::ImageCpu_64f_C1* integral, const IuRect& box);
+
+/** @} */ // end of Integral Images
+
+
+
 /** @} */ // end of Math
 
 } // namespace iu
@@ -80,6 +80,17 @@ void addC(const iu::ImageGpu_32f_C2* src, const float2& val, iu::ImageGpu_32f_C2
 void addC(const iu::ImageGpu_32f_C4* src, const float4& val, iu::ImageGpu_32f_C4* dst, const IuRect& roi);
 
 
+// [host] planar images (arithmetic_cpu.cpp); Not-in-place; 32-bit;
+void addWeighted(const iu::ImagePlanarCpu_32f_C3* src1, const float& weight1,
+                 const iu::ImagePlanarCpu_32f_C3* src2, const float& weight2,
+                 iu::ImagePlanarCpu_32f_C3* dst, const IuRect& roi);
+void addWeighted(const iu::ImagePlanarCpu_32f_C4* src1, const float& weight1,
+                 const iu::ImagePlanarCpu_32f_C4* src2, const float& weight2,
+                 iu::ImagePlanarCpu_32f_C4* dst, const IuRect& roi);
+void mulC(const iu::ImagePlanarCpu_32f_C3* src, const float3& factor, iu::ImagePlanarCpu_32f_C3* dst, const IuRect& roi);
+void mulC(const iu::ImagePlanarCpu_32f_C4* src, const float4& factor, iu::ImagePlanarCpu_32f_C4* dst, const IuRect& roi);
+void addC(const iu::ImagePlanarCpu_32f_C3* src, const float3& val, iu::ImagePlanarCpu_32f_C3* dst, const IuRect& roi);
+void addC(const iu::ImagePlanarCpu_32f_C4* src, const float4& val, iu::ImagePlanarCpu_32f_C4* dst, const IuRect& roi);
 
 
 } // namespace iuprivate
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Math
+ * Class       : none
+ * Language    : C++
+ * Description : Host implementation of arithmetic functions on planar images
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <iucutil.h>
+#include <iucore/cpukernels.h>
+#include "arithmetic.h"
+
+namespace iuprivate {
+
+//-----------------------------------------------------------------------------
+/* dst = a*src1 + b*src2 + c on every plane within the roi (src2 may be 0).
+ * Every row of every plane is one contiguous loop with per-plane constants;
+ * the executor iterates over (plane, row) pairs.
+ */
+template<class PlanarImage>
+struct AffinePlanarRows
+{
+  const PlanarImage* src1;
+  const PlanarImage* src2;
+  PlanarImage* dst;
+  const float* a;
+  const float* b;
+  const float* c;
+  int x_begin;
+  int x_end;
+  int y_begin;
+  int rows;
+  const CpuKernels* kernels;
+
+  void operator()(int begin, int end) const
+  {
+    for(int i=begin; i<end; ++i)
+    {
+      const int p = i / rows;
+      const int y = y_begin + i % rows;
+      const float* s2 = (src2 != 0) ? src2->plane(p, x_begin, y) : 0;
+      const float b_p = (src2 != 0) ? b[p] : 0.0f;
+      kernels->affineRow(src1->plane(p, x_begin, y), a[p], s2, b_p, c[p],
+                         dst->plane(p, x_begin, y), x_end-x_begin);
+    }
+  }
+};
+
+template<class PlanarImage>
+static void affinePlanar(const PlanarImage* src1, const float* a,
+                         const PlanarImage* src2, const float* b,
+                         const float* c, PlanarImage* dst, const IuRect& roi)
+{
+  AffinePlanarRows<PlanarImage> body;
+  body.src1 = src1;
+  body.src2 = src2;
+  body.dst = dst;
+  body.a = a;
+  body.b = b;
+  body.c = c;
+  body.kernels = &cpuKernels();
+  body.x_begin = IUMAX(roi.x, 0);
+  body.y_begin = IUMAX(roi.y, 0);
+  body.x_end = IUMIN(roi.x+(int)roi.width, (int)dst->width());
+  const int y_end = IUMIN(roi.y+(int)roi.height, (int)dst->height());
+  if(body.x_begin >= body.x_end || body.y_begin >= y_end)
+    return;
+  body.rows = y_end-body.y_begin;
+
+  iu::parallelFor(0, dst->channels()*body.rows, body,
+                  iu::Executor::rowGrain(body.x_end-body.x_begin));
+}
+
+/* ***************************************************************************
+ *  FUNCTION IMPLEMENTATIONS
+ * ***************************************************************************/
+
+// [host] weighted add; Not-in-place; 32-bit; planar 3-channel
+void addWeighted(const iu::ImagePlanarCpu_32f_C3* src1, const float& weight1,
+                 const iu::ImagePlanarCpu_32f_C3* src2, const float& weight2,
+                 iu::ImagePlanarCpu_32f_C3* dst, const IuRect& roi)
+{
+  const float a[3] = {weight1, weight1, weight1};
+  const float b[3] = {weight2, weight2, weight2};
+  const float c[3] = {0.0f, 0.0f, 0.0f};
+  affinePlanar(src1, a, src2, b, c, dst, roi);
+}
+
+// [host] weighted add; Not-in-place; 32-bit; planar 4-channel
+void addWeighted(const iu::ImagePlanarCpu_32f_C4* src1, const float& weight1,
+                 const iu::ImagePlanarCpu_32f_C4* src2, const float& weight2,
+                 iu::ImagePlanarCpu_32f_C4* dst, const IuRect& roi)
+{
+  const float a[4] = {weight1, weight1, weight1, weight1};
+  const float b[4] = {weight2, weight2, weight2, weight2};
+  const float c[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  affinePlanar(src1, a, src2, b, c, dst, roi);
+}
+
+// [host] multiplication with factor; Not-in-place; 32-bit; planar 3-channel
+void mulC(const iu::ImagePlanarCpu_32f_C3* src, const float3& factor,
+          iu::ImagePlanarCpu_32f_C3* dst, const IuRect& roi)
+{
+  const float a[3] = {factor.x, factor.y, factor.z};
+  const float c[3] = {0.0f, 0.0f, 0.0f};
+  affinePlanar(src, a, (const iu::ImagePlanarCpu_32f_C3*)0, 0, c, dst, roi);
+}
+
+// [host] multiplication with factor; Not-in-place; 32-bit; planar 4-channel
+void mulC(const iu::ImagePlanarCpu_32f_C4* src, const float4& factor,
+          iu::ImagePlanarCpu_32f_C4* dst, const IuRect& roi)
+{
+  const float a[4] = {factor.x, factor.y, factor.z, factor.w};
+  const float c[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  affinePlanar(src, a, (const iu::ImagePlanarCpu_32f_C4*)0, 0, c, dst, roi);
+}
+
+// [host] add val; Not-in-place; 32-bit; planar 3-channel
+void addC(const iu::ImagePlanarCpu_32f_C3* src, const float3& val,
+          iu::ImagePlanarCpu_32f_C3* dst, const IuRect& roi)
+{
+  const float a[3] = {1.0f, 1.0f, 1.0f};
+  const float c[3] = {val.x, val.y, val.z};
+  affinePlanar(src, a, (const iu::ImagePlanarCpu_32f_C3*)0, 0, c, dst, roi);
+}
+
+// [host] add val; Not-in-place; 32-bit; planar 4-channel
+void addC(const iu::ImagePlanarCpu_32f_C4* src, const float4& val,
+          iu::ImagePlanarCpu_32f_C4* dst, const IuRect& roi)
+{
+  const float a[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+  const float c[4] = {val.x, val.y, val.z, val.w};
+  affinePlanar(src, a, (const iu::ImagePlanarCpu_32f_C4*)0, 0, c, dst, roi);
+}
+
+} // namespace iuprivate
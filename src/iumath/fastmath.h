@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Math
+ * Class       : none
+ * Language    : C++
+ * Description : Fast (vectorizable) approximations of exp/log/pow for host code
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+/* ****************************************************************************
+ *  W A R N I N G
+ *  -------------
+ *
+ *  This file is not part of the IU API.  It exists purely as an
+ *  implementation detail.  This header file may change from version to
+ *  version without notice, or even be removed.
+ *
+ *  We mean it.
+ * ****************************************************************************
+ */
+
+#ifndef IUMATH_FASTMATH_H
+#define IUMATH_FASTMATH_H
+
+#include <string.h>
+
+namespace iuprivate {
+
+/* The functions below are branch-free so that loops calling them can be
+ * vectorized by the compiler. Measured error bounds (relative to the double
+ * precision result for the same float argument):
+ *
+ *   fastExp2(x)   : relative error < 3e-7 for x in [-126,127]. Arguments outside
+ *                   are clamped, i.e. the result is never a denormal, zero or inf.
+ *   fastLog2(x)   : for normalized x > 0 absolute error < 2e-7 where |log2(x)| <= 1
+ *                   and relative error < 2e-7 beyond (the float rounding of the
+ *                   result dominates there, e.g. 6e-7 absolute at log2(x) = -9.5).
+ *   fastPow(x,y)  : relative error < 3e-7 + 1.5e-7*|y|*max(1,|log2(x)|) for x > 0.
+ *                   The second term is the error of y*fastLog2(x) passed through
+ *                   the exponential.
+ *   fastExp(x)    : relative error < 3e-7 + 1e-7*|x|.
+ */
+
+//-----------------------------------------------------------------------------
+inline float fastExp2(float x)
+{
+  x = x < -126.0f ? -126.0f : (x > 127.0f ? 127.0f : x);
+
+  // x = n + f with f in [-0.5,0.5]
+  const int n = (int)(x + (x < 0.0f ? -0.5f : 0.5f));
+  const float f = x - (float)n;
+
+  // taylor series of 2^f (ln(2)^k/k!)
+  float p = 1.5403530e-4f;
+  p = p*f + 1.3333558e-3f;
+  p = p*f + 9.6181291e-3f;
+  p = p*f + 5.5504109e-2f;
+  p = p*f + 2.4022651e-1f;
+  p = p*f + 6.9314718e-1f;
+  p = p*f + 1.0f;
+
+  // 2^n via the exponent bits
+  const int bits = (n + 127) << 23;
+  float scale;
+  memcpy(&scale, &bits, sizeof(float));
+  return p*scale;
+}
+
+//-----------------------------------------------------------------------------
+inline float fastLog2(float x)
+{
+  int bits;
+  memcpy(&bits, &x, sizeof(float));
+  int e = ((bits >> 23) & 0xff) - 127;
+
+  // mantissa m in [1,2), mapped to [sqrt(0.5), sqrt(2))
+  bits = (bits & 0x007fffff) | 0x3f800000;
+  float m;
+  memcpy(&m, &bits, sizeof(float));
+  const bool upper = m > 1.41421356f;
+  m = upper ? 0.5f*m : m;
+  e = upper ? e+1 : e;
+
+  // log2(m) = 2/ln(2) * atanh(t) with t=(m-1)/(m+1), |t| < 0.172
+  const float t = (m - 1.0f) / (m + 1.0f);
+  const float t2 = t*t;
+  float p = 0.41219858f;
+  p = p*t2 + 0.57707802f;
+  p = p*t2 + 0.96179669f;
+  p = p*t2 + 2.88539008f;
+  return (float)e + p*t;
+}
+
+//-----------------------------------------------------------------------------
+// x^y for x > 0 (the caller handles x == 0)
+inline float fastPow(float x, float y)
+{
+  return fastExp2(y*fastLog2(x));
+}
+
+//-----------------------------------------------------------------------------
+inline float fastExp(float x)
+{
+  return fastExp2(1.44269504f*x);
+}
+
+} // namespace iuprivate
+
+#endif // IUMATH_FASTMATH_H
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Math
+ * Class       : none
+ * Language    : C++
+ * Description : Definition of integral images (summed-area tables) and box queries
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IUMATH_INTEGRAL_H
+#define IUMATH_INTEGRAL_H
+
+#include <iucore/coredefs.h>
+#include <iucore/memorydefs.h>
+
+namespace iuprivate {
+
+/** Computes the integral image of \a src. \a dst has one additional row and
+ * column: dst(x,y) is the sum of src over [0,x) x [0,y); the first row and column are 0.
+ * Values are accumulated in double precision (exact for 8-bit images).
+ */
+// [host] integral image; 8-bit / 32-bit -> 64-bit
+void integral(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_64f_C1* dst);
+void integral(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_64f_C1* dst);
+
+/** Computes the integral image of the squared pixel values of \a src (layout as integral()). */
+// [host] integral image of squares; 8-bit / 32-bit -> 64-bit
+void integralSquared(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_64f_C1* dst);
+void integralSquared(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_64f_C1* dst);
+
+/** Computes the sum, mean and variance of \a num boxes from the integral images.
+ * Boxes are clipped to the image; empty boxes give 0. Each output array as well as
+ * \a integral_sq may be 0 (\a integral_sq is needed for the variances).
+ */
+// [host] batched box statistics; O(1) per box
+void boxStatistics(const iu::ImageCpu_64f_C1* integral, const iu::ImageCpu_64f_C1* integral_sq,
+                   const IuRect* boxes, int num, double* sums, double* means, double* variances);
+
+/** Returns the sum of the pixels within \a box (clipped to the image). */
+double boxSum(const iu::ImageCpu_64f_C1* integral, const IuRect& box);
+
+} // namespace iuprivate
+
+#endif // IUMATH_INTEGRAL_H
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Math
+ * Class       : none
+ * Language    : C++
+ * Description : Implementation of integral images (summed-area tables) and box queries
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <cstring>
+#include <iucutil.h>
+#include <iucore/executor.h>
+#include "integral.h"
+
+namespace iuprivate {
+
+// columns per chunk of the vertical pass (rows of a chunk stay in L1)
+static const int INTEGRAL_COLUMN_BLOCK = 512;
+
+//-----------------------------------------------------------------------------
+/* First pass: prefix sums of every source row (rows are independent). Row y of
+ * the source ends up in row y+1 of the integral image, shifted by one column.
+ */
+template<typename SrcType, bool Squared>
+struct IntegralRowsX
+{
+  const SrcType* src;
+  size_t src_stride;
+  double* dst;
+  size_t dst_stride;
+  int width;
+
+  void operator()(int begin, int end) const
+  {
+    for(int y=begin; y<end; ++y)
+    {
+      const SrcType* s = src + y*src_stride;
+      double* d = dst + (y+1)*dst_stride;
+      double sum = 0.0;
+      d[0] = 0.0;
+      for(int x=0; x<width; ++x)
+      {
+        const double v = (double)s[x];
+        sum += Squared ? v*v : v;
+        d[x+1] = sum;
+      }
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+/* Second pass: accumulation down the columns. Every chunk owns a block of
+ * columns and walks over all rows, i.e. the inner loop is contiguous.
+ */
+struct IntegralColumnsY
+{
+  double* dst;
+  size_t dst_stride;
+  int width;   // of the integral image
+  int height;  // of the integral image
+
+  void operator()(int begin, int end) const
+  {
+    const int x_begin = begin*INTEGRAL_COLUMN_BLOCK;
+    const int x_end = IUMIN(end*INTEGRAL_COLUMN_BLOCK, width);
+    for(int y=2; y<height; ++y)
+    {
+      const double* above = dst + (y-1)*dst_stride;
+      double* d = dst + y*dst_stride;
+      for(int x=x_begin; x<x_end; ++x)
+        d[x] += above[x];
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+template<bool Squared, typename SrcType>
+static void integralImage(const SrcType* src, size_t src_stride, const IuSize& size,
+                          iu::ImageCpu_64f_C1* dst)
+{
+  if(dst->width() != size.width+1 || dst->height() != size.height+1)
+    throw IuException("integral image has to be one pixel larger than the source in each direction",
+                      __FILE__, __FUNCTION__, __LINE__);
+
+  memset(dst->data(), 0, dst->width()*sizeof(double));
+
+  IntegralRowsX<SrcType, Squared> pass_x;
+  pass_x.src = src;
+  pass_x.src_stride = src_stride;
+  pass_x.dst = dst->data();
+  pass_x.dst_stride = dst->stride();
+  pass_x.width = size.width;
+  iu::parallelFor(0, size.height, pass_x, iu::Executor::rowGrain(size.width));
+
+  IntegralColumnsY pass_y;
+  pass_y.dst = dst->data();
+  pass_y.dst_stride = dst->stride();
+  pass_y.width = dst->width();
+  pass_y.height = dst->height();
+  const int blocks = (pass_y.width + INTEGRAL_COLUMN_BLOCK-1)/INTEGRAL_COLUMN_BLOCK;
+  iu::parallelFor(0, blocks, pass_y, 1);
+}
+
+/* ***************************************************************************
+ *  FUNCTION IMPLEMENTATIONS
+ * ***************************************************************************/
+
+// [host] integral image; 8-bit -> 64-bit
+void integral(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_64f_C1* dst)
+{
+  integralImage<false>(src->data(), src->stride(), src->size(), dst);
+}
+
+// [host] integral image; 32-bit -> 64-bit
+void integral(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_64f_C1* dst)
+{
+  integralImage<false>(src->data(), src->stride(), src->size(), dst);
+}
+
+// [host] integral image of squares; 8-bit -> 64-bit
+void integralSquared(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_64f_C1* dst)
+{
+  integralImage<true>(src->data(), src->stride(), src->size(), dst);
+}
+
+// [host] integral image of squares; 32-bit -> 64-bit
+void integralSquared(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_64f_C1* dst)
+{
+  integralImage<true>(src->data(), src->stride(), src->size(), dst);
+}
+
+//-----------------------------------------------------------------------------
+// box clipped to the image; returns the number of pixels
+static inline double clipBox(const IuRect& box, int width, int height,
+                             int& x0, int& y0, int& x1, int& y1)
+{
+  x0 = IUMAX(box.x, 0);
+  y0 = IUMAX(box.y, 0);
+  x1 = IUMIN(box.x + (int)box.width, width);
+  y1 = IUMIN(box.y + (int)box.height, height);
+  if(x1 <= x0 || y1 <= y0)
+    return 0.0;
+  return (double)(x1-x0)*(double)(y1-y0);
+}
+
+static inline double boxValue(const double* ii, size_t stride, int x0, int y0, int x1, int y1)
+{
+  return ii[y1*stride + x1] - ii[y0*stride + x1] - ii[y1*stride + x0] + ii[y0*stride + x0];
+}
+
+//-----------------------------------------------------------------------------
+struct BoxStatisticsBody
+{
+  const double* ii;
+  const double* ii_sq;
+  size_t stride;
+  size_t stride_sq;
+  int width;   // of the source image
+  int height;
+  const IuRect* boxes;
+  double* sums;
+  double* means;
+  double* variances;
+
+  void operator()(int begin, int end) const
+  {
+    for(int i=begin; i<end; ++i)
+    {
+      int x0, y0, x1, y1;
+      const double area = clipBox(boxes[i], width, height, x0, y0, x1, y1);
+      const double sum = (area > 0.0) ? boxValue(ii, stride, x0, y0, x1, y1) : 0.0;
+      const double mean = (area > 0.0) ? sum/area : 0.0;
+      if(sums != 0)
+        sums[i] = sum;
+      if(means != 0)
+        means[i] = mean;
+      if(variances != 0)
+      {
+        double var = 0.0;
+        if(area > 0.0)
+          var = IUMAX(boxValue(ii_sq, stride_sq, x0, y0, x1, y1)/area - mean*mean, 0.0);
+        variances[i] = var;
+      }
+    }
+  }
+};
+
+// [host] batched box statistics
+void boxStatistics(const iu::ImageCpu_64f_C1* integral, const iu::ImageCpu_64f_C1* integral_sq,
+                   const IuRect* boxes, int num, double* sums, double* means, double* variances)
+{
+  if(variances != 0 && (integral_sq == 0 || integral_sq->size() != integral->size()))
+    throw IuException("variances need an integral image of squares of the same size",
+                      __FILE__, __FUNCTION__, __LINE__);
+  if(num <= 0)
+    return;
+
+  BoxStatisticsBody body;
+  body.ii = integral->data();
+  body.stride = integral->stride();
+  body.ii_sq = (integral_sq != 0) ? integral_sq->data() : 0;
+  body.stride_sq = (integral_sq != 0) ? integral_sq->stride() : 0;
+  body.width = (int)integral->width()-1;
+  body.height = (int)integral->height()-1;
+  body.boxes = boxes;
+  body.sums = sums;
+  body.means = means;
+  body.variances = variances;
+  iu::parallelFor(0, num, body, iu::Executor::rowGrain(64));
+}
+
+// [host] single box sum
+double boxSum(const iu::ImageCpu_64f_C1* integral, const IuRect& box)
+{
+  int x0, y0, x1, y1;
+  if(clipBox(box, (int)integral->width()-1, (int)integral->height()-1, x0, y0, x1, y1) <= 0.0)
+    return 0.0;
+  return boxValue(integral->data(), integral->stride(), x0, y0, x1, y1);
+}
+
+} // namespace iuprivate
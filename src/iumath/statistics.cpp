@@ -94,7 +94,6 @@ namespace iuprivate {
 void minMax(const iu::ImageGpu_8u_C1 *src, const IuRect &roi, unsigned char& min, unsigned char& max)
 {
   IuStatus status;
-  printf("wrapper\n");
   status = cuMinMax(src, roi, min, max);
   if (status != IU_SUCCESS) throw IuException("function returned with an error", __FILE__, __FUNCTION__, __LINE__);
 }
@@ -39,354 +39,348 @@
 #include <iucutil.h>
 #include <iucore/memorydefs.h>
 #include <iucore/copy.h>
+#include <iucore/convert.h>
 #include <mex.h>
 
 namespace iuprivate {
 
-//-----------------------------------------------------------------------------
-// [host] conversion from matlab to ImageCpu memory layout
-template<typename PixelType, class Allocator, IuPixelType _pixel_type>
-IuStatus convertMatlabToCpu(double* matlab_src_buffer, unsigned int width, unsigned int height,
-                            iu::ImageCpu<PixelType, Allocator, _pixel_type> *dst)
+/* ***************************************************************************
+ *  Layout helpers
+ * ***************************************************************************/
+// Matlab stores matrices column-major (element (x,y) at buffer[y + x*height], channels
+// as consecutive planes of width*height elements). All conversions go through the
+// cache blocked transposition transposeConvert; a plane of a multi-channel image is
+// addressed with a step of the channel count.
 
+//-----------------------------------------------------------------------------
+// block [x_begin, x_end) x [y_begin, y_end) of the image that is covered by the matlab
+// buffer (the roi offset up to the smaller extent of roi and buffer)
+struct MatlabBlock
 {
-  if(width > dst->width() || height > dst->height())
-  {
-    std::cerr << "Error in convertMatlabToCpu: memory dimensions mismatch!" << std::endl;
-    return IU_MEM_COPY_ERROR;
-  }
+  unsigned int x_begin, x_end, y_begin, y_end;
 
-  // iterate over the smaller block of input and output
-  for (unsigned int y = IUMAX(0, dst->roi().y); y<IUMIN(height, dst->roi().height); ++y)
+  MatlabBlock(const IuRect& roi, unsigned int width, unsigned int height) :
+    x_begin(IUMAX(0, roi.x)), x_end(IUMIN(width, roi.width)),
+    y_begin(IUMAX(0, roi.y)), y_end(IUMIN(height, roi.height))
   {
-    for (unsigned int x = IUMAX(0, dst->roi().x); x<IUMIN(width, dst->roi().width); ++x)
-    {
-      *dst->data(x,y) = static_cast<float>(matlab_src_buffer[y + x*height]);
-    }
+    if (x_end < x_begin) x_end = x_begin;
+    if (y_end < y_begin) y_end = y_begin;
   }
 
-  return IU_NO_ERROR;
-}
+  unsigned int width() const { return x_end - x_begin; }
+  unsigned int height() const { return y_end - y_begin; }
+};
 
 //-----------------------------------------------------------------------------
-// [host] conversion from matlab to ImageCpu memory layout - float/single version
-template<typename PixelType, class Allocator, IuPixelType _pixel_type>
-IuStatus convertMatlabToCpu(float* matlab_src_buffer, unsigned int width, unsigned int height,
-                            iu::ImageCpu<PixelType, Allocator, _pixel_type> *dst)
-
+// [host] page-locked staging buffer for the device conversions. The matlab data is
+// transposed straight into it and transferred with one DMA copy, instead of going
+// through a temporary ImageCpu. Every conversion allocates its own buffer, so
+// concurrent calls do not share it and nothing is left to free when the mex file
+// is unloaded.
+class MatlabStagingBuffer
 {
-  if(width > dst->width() || height > dst->height())
+public:
+  explicit MatlabStagingBuffer(size_t bytes) : data_(0)
   {
-    std::cerr << "Error in convertMatlabToCpu: memory dimensions mismatch!" << std::endl;
-    return IU_MEM_COPY_ERROR;
+    if (bytes > 0 && cudaMallocHost(&data_, bytes) != cudaSuccess)
+      throw IuException("cudaMallocHost returned error code", __FILE__, __FUNCTION__, __LINE__);
   }
 
-  // iterate over the smaller block of input and output
-  for (unsigned int y = IUMAX(0, dst->roi().y); y<IUMIN(height, dst->roi().height); ++y)
+  ~MatlabStagingBuffer()
   {
-    for (unsigned int x = IUMAX(0, dst->roi().x); x<IUMIN(width, dst->roi().width); ++x)
-    {
-      *dst->data(x,y) = matlab_src_buffer[y + x*height];
-    }
+    if (data_ != 0)
+      cudaFreeHost(data_);
   }
 
-  return IU_NO_ERROR;
-}
+  void* data() { return data_; }
 
-//-----------------------------------------------------------------------------
-// [host] conversion from matlab to ImageCpu memory layout - int version
-template<typename PixelType, class Allocator, IuPixelType _pixel_type>
-IuStatus convertMatlabToCpu(int* matlab_src_buffer, unsigned int width, unsigned int height,
-                            iu::ImageCpu<PixelType, Allocator, _pixel_type> *dst)
+private:
+  MatlabStagingBuffer(const MatlabStagingBuffer&);
+  MatlabStagingBuffer& operator=(const MatlabStagingBuffer&);
+
+  void* data_;
+};
 
+// [host] matlab planes -> interleaved channels (channel stride in elements)
+template<typename SrcType, typename DstType>
+void matlabToInterleaved(const SrcType* matlab_src_buffer, unsigned int width, unsigned int height,
+                         const MatlabBlock& block, int planes, DstType* dst, size_t dst_stride,
+                         int channels)
 {
-  if(width > dst->width() || height > dst->height())
-  {
-    std::cerr << "Error in convertMatlabToCpu: memory dimensions mismatch!" << std::endl;
-    return IU_MEM_COPY_ERROR;
-  }
+  transposeConvert(matlab_src_buffer + block.y_begin + (size_t)block.x_begin*height, height, 1,
+                   dst, dst_stride, channels, block.width(), block.height(),
+                   planes, (size_t)width*height, 1);
+}
 
-  // iterate over the smaller block of input and output
-  for (unsigned int y = IUMAX(0, dst->roi().y); y<IUMIN(height, dst->roi().height); ++y)
-  {
-    for (unsigned int x = IUMAX(0, dst->roi().x); x<IUMIN(width, dst->roi().width); ++x)
-    {
-      *dst->data(x,y) = matlab_src_buffer[y + x*height];
-    }
-  }
+// [host] interleaved channels -> matlab planes
+template<typename SrcType, typename DstType>
+void interleavedToMatlab(const SrcType* src, size_t src_stride, int channels, int planes,
+                         DstType* matlab_dst_buffer, unsigned int width, unsigned int height,
+                         const MatlabBlock& block)
+{
+  transposeConvert(src, src_stride, channels,
+                   matlab_dst_buffer + block.y_begin + (size_t)block.x_begin*height, height, 1,
+                   block.height(), block.width(), planes, 1, (size_t)width*height);
+}
 
-  return IU_NO_ERROR;
+// [host] sets one channel of interleaved pixels
+inline void fillChannel(float* dst, size_t dst_stride, int channels, unsigned int width,
+                        unsigned int height, float value)
+{
+  for (unsigned int y = 0; y < height; ++y)
+    for (unsigned int x = 0; x < width; ++x)
+      dst[y*dst_stride + x*channels] = value;
 }
 
 //-----------------------------------------------------------------------------
-// [device] conversion from matlab to ImageGpu memory layout
-template<typename PixelType, class Allocator, IuPixelType _pixel_type>
-IuStatus convertMatlabToGpu(double* matlab_src_buffer, unsigned int width, unsigned int height,
-                            iu::ImageGpu<PixelType, Allocator, _pixel_type> *dst)
+// [device] staged transfers of a block of interleaved pixels
+inline void stagingToDevice(const void* staging, size_t staging_pitch, void* dst, size_t dst_pitch,
+                            size_t width_bytes, size_t height)
 {
-  iu::ImageCpu_32f_C1 tmp_cpu(dst->size());
-  tmp_cpu.roi() = dst->roi();
-
-  IuStatus status = convertMatlabToCpu(matlab_src_buffer, width, height, &tmp_cpu);
-  if(status != IU_SUCCESS)
-    return status;
+  if (width_bytes == 0 || height == 0)
+    return;
+  cudaError_t status = cudaMemcpy2D(dst, dst_pitch, staging, staging_pitch, width_bytes, height,
+                                    cudaMemcpyHostToDevice);
+  if (status != cudaSuccess)
+    throw IuException("cudaMemcpy2D returned error code", __FILE__, __FUNCTION__, __LINE__);
+}
 
-  iuprivate::copy(&tmp_cpu, dst);
-  return IU_NO_ERROR;
+inline void deviceToStaging(const void* src, size_t src_pitch, void* staging, size_t staging_pitch,
+                            size_t width_bytes, size_t height)
+{
+  if (width_bytes == 0 || height == 0)
+    return;
+  cudaError_t status = cudaMemcpy2D(staging, staging_pitch, src, src_pitch, width_bytes, height,
+                                    cudaMemcpyDeviceToHost);
+  if (status != cudaSuccess)
+    throw IuException("cudaMemcpy2D returned error code", __FILE__, __FUNCTION__, __LINE__);
 }
 
+/* ***************************************************************************
+ *  Matlab -> host/device
+ * ***************************************************************************/
+
 //-----------------------------------------------------------------------------
-// [device] conversion from matlab to ImageGpu memory layout
-template<typename PixelType, class Allocator, IuPixelType _pixel_type>
-IuStatus convertMatlabToGpu(int* matlab_src_buffer, unsigned int width, unsigned int height,
-                            iu::ImageGpu<PixelType, Allocator, _pixel_type> *dst)
+// [host] conversion from matlab to ImageCpu memory layout (double, single and int32)
+template<typename SrcType, typename PixelType, class Allocator, IuPixelType _pixel_type>
+IuStatus convertMatlabToCpu(SrcType* matlab_src_buffer, unsigned int width, unsigned int height,
+                            iu::ImageCpu<PixelType, Allocator, _pixel_type> *dst)
+
 {
-  iu::ImageCpu_32s_C1 tmp_cpu(dst->size());
-  tmp_cpu.roi() = dst->roi();
+  if(width > dst->width() || height > dst->height())
+  {
+    std::cerr << "Error in convertMatlabToCpu: memory dimensions mismatch!" << std::endl;
+    return IU_MEM_COPY_ERROR;
+  }
 
-  IuStatus status = convertMatlabToCpu(matlab_src_buffer, width, height, &tmp_cpu);
-  if(status != IU_SUCCESS)
-    return status;
+  MatlabBlock block(dst->roi(), width, height);
+  matlabToInterleaved(matlab_src_buffer, width, height, block, 1,
+                      dst->data(block.x_begin, block.y_begin), dst->stride(), 1);
 
-  iuprivate::copy(&tmp_cpu, dst);
   return IU_NO_ERROR;
 }
 
 //-----------------------------------------------------------------------------
-// [host] conversion from matlab 3-channel to ImageCpu 4-channel memory layout
-IuStatus convertMatlabC3ToCpuC4(double* matlab_src_buffer, unsigned int width, unsigned int height,
-                                iu::ImageCpu_32f_C4 *dst)
-
+// [device] conversion from matlab to ImageGpu memory layout (double and int32)
+template<typename SrcType, typename PixelType, class Allocator, IuPixelType _pixel_type>
+IuStatus convertMatlabToGpu(SrcType* matlab_src_buffer, unsigned int width, unsigned int height,
+                            iu::ImageGpu<PixelType, Allocator, _pixel_type> *dst)
 {
   if(width > dst->width() || height > dst->height())
   {
-    std::cerr << "Error in convertMatlabC3ToCpuC4: memory dimensions mismatch!" << std::endl;
+    std::cerr << "Error in convertMatlabToGpu: memory dimensions mismatch!" << std::endl;
     return IU_MEM_COPY_ERROR;
   }
 
-  // iterate over the smaller block of input and output
-  for (unsigned int y = IUMAX(0, dst->roi().y); y<IUMIN(height, dst->roi().height); ++y)
-  {
-    for (unsigned int x = IUMAX(0, dst->roi().x); x<IUMIN(width, dst->roi().width); ++x)
-    {
-      dst->data(x,y)->x = static_cast<float>(matlab_src_buffer[y + x*height]);
-      dst->data(x,y)->y = static_cast<float>(matlab_src_buffer[y + x*height + width*height]);
-      dst->data(x,y)->z = static_cast<float>(matlab_src_buffer[y + x*height + 2*width*height]);
-      dst->data(x,y)->w = 1.0f;
-    }
-  }
-
+  MatlabBlock block(dst->roi(), width, height);
+  const size_t row_bytes = block.width()*sizeof(PixelType);
+  MatlabStagingBuffer staging_buffer(row_bytes*block.height());
+  PixelType* staging = (PixelType*)staging_buffer.data();
+  matlabToInterleaved(matlab_src_buffer, width, height, block, 1, staging, block.width(), 1);
+  stagingToDevice(staging, row_bytes, dst->data(block.x_begin, block.y_begin), dst->pitch(),
+                  row_bytes, block.height());
   return IU_NO_ERROR;
 }
 
 //-----------------------------------------------------------------------------
-// [host] conversion from matlab 2-channel to ImageCpu 2-channel memory layout
-IuStatus convertMatlabC2ToCpuC2(double *matlab_src_buffer, unsigned int width, unsigned int height, iu::ImageCpu_32f_C2 *dst)
+// [host] conversion from matlab 2/3/4-channel to ImageCpu 2/4-channel memory layout
+// (a missing fourth channel is set to 1)
+template<class Image>
+IuStatus convertMatlabPlanesToCpu(double* matlab_src_buffer, unsigned int width, unsigned int height,
+                                  int planes, Image *dst, const char* function)
 {
   if(width > dst->width() || height > dst->height())
   {
-    std::cerr << "Error in convertMatlabC2ToCpuC2: memory dimensions mismatch!" << std::endl;
+    std::cerr << "Error in " << function << ": memory dimensions mismatch!" << std::endl;
     return IU_MEM_COPY_ERROR;
   }
 
-  // iterate over the smaller block of input and output
-  for (unsigned int y = IUMAX(0, dst->roi().y); y<IUMIN(height, dst->roi().height); ++y)
-  {
-    for (unsigned int x = IUMAX(0, dst->roi().x); x<IUMIN(width, dst->roi().width); ++x)
-    {
-      dst->data(x,y)->x = static_cast<float>(matlab_src_buffer[y + x*height]);
-      dst->data(x,y)->y = static_cast<float>(matlab_src_buffer[y + x*height + width*height]);
-    }
-  }
+  const int channels = sizeof(*dst->data())/sizeof(float);
+  MatlabBlock block(dst->roi(), width, height);
+  float* dst_data = (float*)dst->data(block.x_begin, block.y_begin);
+  const size_t dst_stride = dst->stride()*channels;
+  matlabToInterleaved(matlab_src_buffer, width, height, block, planes, dst_data, dst_stride, channels);
+  if (planes < channels)
+    fillChannel(dst_data + planes, dst_stride, channels, block.width(), block.height(), 1.0f);
 
   return IU_NO_ERROR;
 }
 
 //-----------------------------------------------------------------------------
-// [host] conversion from matlab 4-channel to ImageCpu 4-channel memory layout
-IuStatus convertMatlabC4ToCpuC4(double *matlab_src_buffer, unsigned int width, unsigned int height, iu::ImageCpu_32f_C4 *dst)
+// [device] conversion from matlab 2/3/4-channel to ImageGpu 2/4-channel memory layout
+template<class Image>
+IuStatus convertMatlabPlanesToGpu(double* matlab_src_buffer, unsigned int width, unsigned int height,
+                                  int planes, Image *dst, const char* function)
 {
   if(width > dst->width() || height > dst->height())
   {
-    std::cerr << "Error in convertMatlabC4ToCpuC4: memory dimensions mismatch!" << std::endl;
+    std::cerr << "Error in " << function << ": memory dimensions mismatch!" << std::endl;
     return IU_MEM_COPY_ERROR;
   }
 
-  // iterate over the smaller block of input and output
-  for (unsigned int y = IUMAX(0, dst->roi().y); y<IUMIN(height, dst->roi().height); ++y)
-  {
-    for (unsigned int x = IUMAX(0, dst->roi().x); x<IUMIN(width, dst->roi().width); ++x)
-    {
-      dst->data(x,y)->x = static_cast<float>(matlab_src_buffer[y + x*height]);
-      dst->data(x,y)->y = static_cast<float>(matlab_src_buffer[y + x*height + width*height]);
-      dst->data(x,y)->z = static_cast<float>(matlab_src_buffer[y + x*height + 2*width*height]);
-      dst->data(x,y)->w = static_cast<float>(matlab_src_buffer[y + x*height + 3*width*height]);;
-    }
-  }
-
+  const int channels = sizeof(*dst->data())/sizeof(float);
+  MatlabBlock block(dst->roi(), width, height);
+  const size_t row_bytes = block.width()*channels*sizeof(float);
+  MatlabStagingBuffer staging_buffer(row_bytes*block.height());
+  float* staging = (float*)staging_buffer.data();
+  const size_t staging_stride = block.width()*channels;
+  matlabToInterleaved(matlab_src_buffer, width, height, block, planes, staging, staging_stride, channels);
+  if (planes < channels)
+    fillChannel(staging + planes, staging_stride, channels, block.width(), block.height(), 1.0f);
+  stagingToDevice(staging, row_bytes, dst->data(block.x_begin, block.y_begin), dst->pitch(),
+                  row_bytes, block.height());
   return IU_NO_ERROR;
 }
 
 //-----------------------------------------------------------------------------
-// [device] conversion from matlab 2-channel to ImageGpu 2-channel memory layout
-IuStatus convertMatlabC2ToGpuC2(double *matlab_src_buffer, unsigned int width, unsigned int height, iu::ImageGpu_32f_C2 *dst)
+// [host] conversion from matlab 3-channel to ImageCpu 4-channel memory layout
+inline IuStatus convertMatlabC3ToCpuC4(double* matlab_src_buffer, unsigned int width, unsigned int height,
+                                       iu::ImageCpu_32f_C4 *dst)
 {
-  iu::ImageCpu_32f_C2 tmp_cpu(dst->size());
-  tmp_cpu.roi() = dst->roi();
-
-  IuStatus status = iuprivate::convertMatlabC2ToCpuC2(matlab_src_buffer, width, height, &tmp_cpu);
-  if(status != IU_SUCCESS)
-    return status;
+  return convertMatlabPlanesToCpu(matlab_src_buffer, width, height, 3, dst, "convertMatlabC3ToCpuC4");
+}
 
-  iuprivate::copy(&tmp_cpu, dst);
-  return IU_NO_ERROR;
+//-----------------------------------------------------------------------------
+// [host] conversion from matlab 2-channel to ImageCpu 2-channel memory layout
+inline IuStatus convertMatlabC2ToCpuC2(double *matlab_src_buffer, unsigned int width, unsigned int height, iu::ImageCpu_32f_C2 *dst)
+{
+  return convertMatlabPlanesToCpu(matlab_src_buffer, width, height, 2, dst, "convertMatlabC2ToCpuC2");
 }
 
 //-----------------------------------------------------------------------------
-// [device] conversion from matlab 4-channel to ImageGpu 4-channel memory layout
-IuStatus convertMatlabC4ToGpuC4(double *matlab_src_buffer, unsigned int width, unsigned int height, iu::ImageGpu_32f_C4 *dst)
+// [host] conversion from matlab 4-channel to ImageCpu 4-channel memory layout
+inline IuStatus convertMatlabC4ToCpuC4(double *matlab_src_buffer, unsigned int width, unsigned int height, iu::ImageCpu_32f_C4 *dst)
 {
-  iu::ImageCpu_32f_C4 tmp_cpu(dst->size());
-  tmp_cpu.roi() = dst->roi();
+  return convertMatlabPlanesToCpu(matlab_src_buffer, width, height, 4, dst, "convertMatlabC4ToCpuC4");
+}
 
-  IuStatus status = iuprivate::convertMatlabC4ToCpuC4(matlab_src_buffer, width, height, &tmp_cpu);
-  if(status != IU_SUCCESS)
-    return status;
+//-----------------------------------------------------------------------------
+// [device] conversion from matlab 2-channel to ImageGpu 2-channel memory layout
+inline IuStatus convertMatlabC2ToGpuC2(double *matlab_src_buffer, unsigned int width, unsigned int height, iu::ImageGpu_32f_C2 *dst)
+{
+  return convertMatlabPlanesToGpu(matlab_src_buffer, width, height, 2, dst, "convertMatlabC2ToGpuC2");
+}
 
-  iuprivate::copy(&tmp_cpu, dst);
-  return IU_NO_ERROR;
+//-----------------------------------------------------------------------------
+// [device] conversion from matlab 4-channel to ImageGpu 4-channel memory layout
+inline IuStatus convertMatlabC4ToGpuC4(double *matlab_src_buffer, unsigned int width, unsigned int height, iu::ImageGpu_32f_C4 *dst)
+{
+  return convertMatlabPlanesToGpu(matlab_src_buffer, width, height, 4, dst, "convertMatlabC4ToGpuC4");
 }
 
 //-----------------------------------------------------------------------------
 // [device] conversion from matlab 3-channel to ImageGpu 4-channel memory layout
-IuStatus convertMatlabC3ToGpuC4(double* matlab_src_buffer, unsigned int width, unsigned int height,
-                                iu::ImageGpu_32f_C4 *dst)
+inline IuStatus convertMatlabC3ToGpuC4(double* matlab_src_buffer, unsigned int width, unsigned int height,
+                                       iu::ImageGpu_32f_C4 *dst)
 {
-  iu::ImageCpu_32f_C4 tmp_cpu(dst->size());
-  tmp_cpu.roi() = dst->roi();
+  return convertMatlabPlanesToGpu(matlab_src_buffer, width, height, 3, dst, "convertMatlabC3ToGpuC4");
+}
 
-  IuStatus status = iuprivate::convertMatlabC3ToCpuC4(matlab_src_buffer, width, height, &tmp_cpu);
-  if(status != IU_SUCCESS)
-    return status;
+/* ***************************************************************************
+ *  host/device -> Matlab
+ * ***************************************************************************/
+// The multi-channel versions write the whole roi (the matlab buffer has the roi size).
 
-  iuprivate::copy(&tmp_cpu, dst);
+//-----------------------------------------------------------------------------
+// [host] conversion from ImageCpu 2/4-channel to matlab 2/3/4-channel memory layout
+template<class Image>
+IuStatus convertCpuPlanesToMatlab(Image *src, int planes, double* matlab_dst_buffer)
+{
+  const unsigned int width = src->roi().width;
+  const unsigned int height = src->roi().height;
+  const int channels = sizeof(*src->data())/sizeof(float);
+  MatlabBlock block(src->roi(), width, height);
+  interleavedToMatlab((const float*)src->data(block.x_begin, block.y_begin), src->stride()*channels,
+                      channels, planes, matlab_dst_buffer, width, height, block);
   return IU_NO_ERROR;
 }
 
 //-----------------------------------------------------------------------------
-// [host] conversion from ImageCpu 4-channel to matlab 3-channel memory layout
-IuStatus convertCpuC4ToMatlabC3(iu::ImageCpu_32f_C4 *src, double* matlab_dst_buffer)
+// [device] conversion from ImageGpu 2/4-channel to matlab 2/3/4-channel memory layout
+template<class Image>
+IuStatus convertGpuPlanesToMatlab(Image *src, int planes, double* matlab_dst_buffer)
 {
-  unsigned int width = src->roi().width;
-  unsigned int height = src->roi().height;
-
-  // iterate over the smaller block of input and output
-  for (unsigned int y = src->roi().y; y<height; ++y)
-  {
-    for (unsigned int x = src->roi().x; x<width; ++x)
-    {
-      matlab_dst_buffer[y + x*height] = static_cast<double>(src->data(x,y)->x);
-      matlab_dst_buffer[y + x*height + width*height] = static_cast<double>(src->data(x,y)->y);
-      matlab_dst_buffer[y + x*height + 2*width*height] = static_cast<double>(src->data(x,y)->z);
-    }
-  }
-
+  const unsigned int width = src->roi().width;
+  const unsigned int height = src->roi().height;
+  const int channels = sizeof(*src->data())/sizeof(float);
+  MatlabBlock block(src->roi(), width, height);
+  const size_t row_bytes = block.width()*channels*sizeof(float);
+  MatlabStagingBuffer staging_buffer(row_bytes*block.height());
+  float* staging = (float*)staging_buffer.data();
+  deviceToStaging(src->data(block.x_begin, block.y_begin), src->pitch(), staging, row_bytes,
+                  row_bytes, block.height());
+  interleavedToMatlab(staging, block.width()*channels, channels, planes,
+                      matlab_dst_buffer, width, height, block);
   return IU_NO_ERROR;
 }
 
 //-----------------------------------------------------------------------------
-// [host] conversion from ImageCpu 4-channel to matlab 4-channel memory layout
-IuStatus convertCpuC4ToMatlabC4(iu::ImageCpu_32f_C4 *src, double* matlab_dst_buffer)
+// [host] conversion from ImageCpu 4-channel to matlab 3-channel memory layout
+inline IuStatus convertCpuC4ToMatlabC3(iu::ImageCpu_32f_C4 *src, double* matlab_dst_buffer)
 {
-  unsigned int width = src->roi().width;
-  unsigned int height = src->roi().height;
-
-  // iterate over the smaller block of input and output
-  for (unsigned int y = src->roi().y; y<height; ++y)
-  {
-    for (unsigned int x = src->roi().x; x<width; ++x)
-    {
-      matlab_dst_buffer[y + x*height] = static_cast<double>(src->data(x,y)->x);
-      matlab_dst_buffer[y + x*height + width*height] = static_cast<double>(src->data(x,y)->y);
-      matlab_dst_buffer[y + x*height + 2*width*height] = static_cast<double>(src->data(x,y)->z);
-      matlab_dst_buffer[y + x*height + 3*width*height] = static_cast<double>(src->data(x,y)->w);
-    }
-  }
+  return convertCpuPlanesToMatlab(src, 3, matlab_dst_buffer);
+}
 
-  return IU_NO_ERROR;
+//-----------------------------------------------------------------------------
+// [host] conversion from ImageCpu 4-channel to matlab 4-channel memory layout
+inline IuStatus convertCpuC4ToMatlabC4(iu::ImageCpu_32f_C4 *src, double* matlab_dst_buffer)
+{
+  return convertCpuPlanesToMatlab(src, 4, matlab_dst_buffer);
 }
 
 //-----------------------------------------------------------------------------
 // [host] conversion from ImageCpu 2-channel to matlab 2-channel memory layout
-IuStatus convertCpuC2ToMatlabC2(iu::ImageCpu_32f_C2 *src, double* matlab_dst_buffer)
+inline IuStatus convertCpuC2ToMatlabC2(iu::ImageCpu_32f_C2 *src, double* matlab_dst_buffer)
 {
-  unsigned int width = src->roi().width;
-  unsigned int height = src->roi().height;
-
-  // iterate over the smaller block of input and output
-  for (unsigned int y = src->roi().y; y<height; ++y)
-  {
-    for (unsigned int x = src->roi().x; x<width; ++x)
-    {
-      matlab_dst_buffer[y + x*height] = static_cast<double>(src->data(x,y)->x);
-      matlab_dst_buffer[y + x*height + width*height] = static_cast<double>(src->data(x,y)->y);
-    }
-  }
-
-  return IU_NO_ERROR;
+  return convertCpuPlanesToMatlab(src, 2, matlab_dst_buffer);
 }
 
 //-----------------------------------------------------------------------------
 // [device] conversion from ImageGpu 4-channel to matlab 3-channel memory layout
-IuStatus convertGpuC4ToMatlabC3(iu::ImageGpu_32f_C4 *src, double* matlab_dst_buffer)
+inline IuStatus convertGpuC4ToMatlabC3(iu::ImageGpu_32f_C4 *src, double* matlab_dst_buffer)
 {
-  iu::ImageCpu_32f_C4 tmp_cpu(src->size());
-  tmp_cpu.roi() = src->roi();
-  iuprivate::copy(src, &tmp_cpu);
-
-  IuStatus status = iuprivate::convertCpuC4ToMatlabC3(&tmp_cpu, matlab_dst_buffer);
-  if(status != IU_SUCCESS)
-    return status;
-
-  return IU_NO_ERROR;
+  return convertGpuPlanesToMatlab(src, 3, matlab_dst_buffer);
 }
 
 //-----------------------------------------------------------------------------
 // [device] conversion from ImageGpu 4-channel to matlab 4-channel memory layout
-IuStatus convertGpuC4ToMatlabC4(iu::ImageGpu_32f_C4 *src, double* matlab_dst_buffer)
+inline IuStatus convertGpuC4ToMatlabC4(iu::ImageGpu_32f_C4 *src, double* matlab_dst_buffer)
 {
-  iu::ImageCpu_32f_C4 tmp_cpu(src->size());
-  tmp_cpu.roi() = src->roi();
-  iuprivate::copy(src, &tmp_cpu);
-
-  IuStatus status = iuprivate::convertCpuC4ToMatlabC4(&tmp_cpu, matlab_dst_buffer);
-  if(status != IU_SUCCESS)
-    return status;
-
-  return IU_NO_ERROR;
+  return convertGpuPlanesToMatlab(src, 4, matlab_dst_buffer);
 }
 
 //-----------------------------------------------------------------------------
 // [device] conversion from ImageGpu 2-channel to matlab 2-channel memory layout
-IuStatus convertGpuC2ToMatlabC2(iu::ImageGpu_32f_C2 *src, double* matlab_dst_buffer)
+inline IuStatus convertGpuC2ToMatlabC2(iu::ImageGpu_32f_C2 *src, double* matlab_dst_buffer)
 {
-  iu::ImageCpu_32f_C2 tmp_cpu(src->size());
-  tmp_cpu.roi() = src->roi();
-  iuprivate::copy(src, &tmp_cpu);
-
-  IuStatus status = iuprivate::convertCpuC2ToMatlabC2(&tmp_cpu, matlab_dst_buffer);
-  if(status != IU_SUCCESS)
-    return status;
-
-  return IU_NO_ERROR;
+  return convertGpuPlanesToMatlab(src, 2, matlab_dst_buffer);
 }
 
-
 //-----------------------------------------------------------------------------
-// [host] conversion from ImageCpu to matlab memory layout
-template<typename PixelType, class Allocator, IuPixelType _pixel_type>
+// [host] conversion from ImageCpu to matlab memory layout (float -> double, 8-bit)
+template<typename DstType, typename PixelType, class Allocator, IuPixelType _pixel_type>
 IuStatus convertCpuToMatlab(iu::ImageCpu<PixelType, Allocator, _pixel_type> *src,
-                            double* matlab_dst_buffer, unsigned int width, unsigned int height)
+                            DstType* matlab_dst_buffer, unsigned int width, unsigned int height)
 {
   if(width > src->width() || height > src->height())
   {
@@ -394,77 +388,32 @@ IuStatus convertCpuToMatlab(iu::ImageCpu<PixelType, Allocator, _pixel_type> *src
     return IU_MEM_COPY_ERROR;
   }
 
-  // iterate over the smaller block of input and output
-  for (unsigned int y = IUMAX(0, src->roi().y); y<IUMIN(height, src->roi().height); ++y)
-  {
-    for (unsigned int x = IUMAX(0, src->roi().x); x<IUMIN(width, src->roi().width); ++x)
-    {
-      matlab_dst_buffer[y + x*height] = static_cast<double>(*src->data(x,y));
-    }
-  }
+  MatlabBlock block(src->roi(), width, height);
+  interleavedToMatlab(src->data(block.x_begin, block.y_begin), src->stride(), 1, 1,
+                      matlab_dst_buffer, width, height, block);
 
   return IU_NO_ERROR;
 }
 
 //-----------------------------------------------------------------------------
-// [host] conversion from ImageCpu to matlab memory layout
-template<typename PixelType, class Allocator, IuPixelType _pixel_type>
-IuStatus convertCpuToMatlab(iu::ImageCpu<PixelType, Allocator, _pixel_type> *src,
-                            unsigned char* matlab_dst_buffer, unsigned int width, unsigned int height)
+// [device] conversion from ImageGpu to matlab memory layout (float -> double, 8-bit)
+template<typename DstType, typename PixelType, class Allocator, IuPixelType _pixel_type>
+IuStatus convertGpuToMatlab(iu::ImageGpu<PixelType, Allocator, _pixel_type> *src,
+                            DstType* matlab_dst_buffer, unsigned int width, unsigned int height)
 {
   if(width > src->width() || height > src->height())
   {
-    std::cerr << "Error in convertCpuToMatlab: memory dimensions mismatch!" << std::endl;
+    std::cerr << "Error in convertGpuToMatlab: memory dimensions mismatch!" << std::endl;
     return IU_MEM_COPY_ERROR;
   }
 
-  // iterate over the smaller block of input and output
-  for (unsigned int y = IUMAX(0, src->roi().y); y<IUMIN(height, src->roi().height); ++y)
-  {
-    for (unsigned int x = IUMAX(0, src->roi().x); x<IUMIN(width, src->roi().width); ++x)
-    {
-      matlab_dst_buffer[y + x*height] = (*src->data(x,y));
-    }
-  }
-
-  return IU_NO_ERROR;
-}
-
-
-//-----------------------------------------------------------------------------
-// [device] conversion from matlab to ImageGpu memory layout
-template<typename PixelType, class Allocator, IuPixelType _pixel_type>
-IuStatus convertGpuToMatlab(iu::ImageGpu<PixelType, Allocator, _pixel_type> *src,
-                            double* matlab_dst_buffer, unsigned int width, unsigned int height)
-{
-  // BUG? ... should this be 32f_C1 ???
-  // We want a double as output!!
-  iu::ImageCpu_32f_C1 tmp_cpu(src->size());
-  tmp_cpu.roi() = src->roi();
-  iuprivate::copy(src, &tmp_cpu);
-
-  IuStatus status = iuprivate::convertCpuToMatlab(&tmp_cpu, matlab_dst_buffer, width, height);
-  if(status != IU_SUCCESS)
-    return status;
-
-  return IU_NO_ERROR;
-}
-
-
-//-----------------------------------------------------------------------------
-// [device] conversion from matlab to ImageGpu memory layout
-template<typename PixelType, class Allocator, IuPixelType _pixel_type>
-IuStatus convertGpuToMatlab(iu::ImageGpu<PixelType, Allocator, _pixel_type> *src,
-                            unsigned char* matlab_dst_buffer, unsigned int width, unsigned int height)
-{
-  iu::ImageCpu_8u_C1 tmp_cpu(src->size());
-  tmp_cpu.roi() = src->roi();
-  iuprivate::copy(src, &tmp_cpu);
-
-  IuStatus status = iuprivate::convertCpuToMatlab(&tmp_cpu, matlab_dst_buffer, width, height);
-  if(status != IU_SUCCESS)
-    return status;
-
+  MatlabBlock block(src->roi(), width, height);
+  const size_t row_bytes = block.width()*sizeof(PixelType);
+  MatlabStagingBuffer staging_buffer(row_bytes*block.height());
+  PixelType* staging = (PixelType*)staging_buffer.data();
+  deviceToStaging(src->data(block.x_begin, block.y_begin), src->pitch(), staging, row_bytes,
+                  row_bytes, block.height());
+  interleavedToMatlab(staging, block.width(), 1, 1, matlab_dst_buffer, width, height, block);
   return IU_NO_ERROR;
 }
 
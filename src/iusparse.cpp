@@ -1,6 +1,10 @@
 
 #include "iusparse.h"
 #include <iusparse/sparsesum.h>
+#include <iusparse/sparsemultiplication_cpu.h>
+#include <iusparse/sparsesolver_cpu.h>
+#include <iusparse/sparseio_cpu.h>
+#include "iucore/trace.h"
 
 namespace iu {
 
@@ -9,25 +13,73 @@ namespace iu {
  * ***************************************************************************/
 
 IuStatus sumSparseRow(iu::SparseMatrixGpu<float>* A, iu::LinearDeviceMemory_32f_C1* dst, float add_const, IuSparseSum function)
-{ return iuprivate::sumSparseRow(A, dst, add_const, function); }
+{ IU_TRACE_FUNCTION(); return iuprivate::sumSparseRow(A, dst, add_const, function); }
 
 IuStatus sumSparseRow(iu::SparseMatrixGpu<float>* A, iu::ImageGpu_32f_C1* dst, float add_const, IuSparseSum function)
-{ return iuprivate::sumSparseRow(A, dst, add_const, function); }
+{ IU_TRACE_FUNCTION(); return iuprivate::sumSparseRow(A, dst, add_const, function); }
 
 IuStatus sumSparseRow(iu::SparseMatrixGpu<float>* A, iu::VolumeGpu_32f_C1* dst, float add_const, IuSparseSum function)
-{ return iuprivate::sumSparseRow(A, dst, add_const, function); }
+{ IU_TRACE_FUNCTION(); return iuprivate::sumSparseRow(A, dst, add_const, function); }
 
 
 
 IuStatus sumSparseCol(iu::SparseMatrixGpu<float>* A, iu::LinearDeviceMemory_32f_C1* dst, float add_const, IuSparseSum function)
-{ return iuprivate::sumSparseCol(A, dst, add_const, function); }
+{ IU_TRACE_FUNCTION(); return iuprivate::sumSparseCol(A, dst, add_const, function); }
 
 IuStatus sumSparseCol(iu::SparseMatrixGpu<float>* A, iu::ImageGpu_32f_C1* dst, float add_const, IuSparseSum function)
-{ return iuprivate::sumSparseCol(A, dst, add_const, function); }
+{ IU_TRACE_FUNCTION(); return iuprivate::sumSparseCol(A, dst, add_const, function); }
 
 IuStatus sumSparseCol(iu::SparseMatrixGpu<float>* A, iu::VolumeGpu_32f_C1* dst, float add_const, IuSparseSum function)
-{ return iuprivate::sumSparseCol(A, dst, add_const, function); }
+{ IU_TRACE_FUNCTION(); return iuprivate::sumSparseCol(A, dst, add_const, function); }
 
 
 
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::LinearHostMemory_32f_C1* src, iu::LinearHostMemory_32f_C1* dst, cusparseOperation_t transpose)
+{ IU_TRACE_FUNCTION(); return iuprivate::sparseMultiplication(A, src, dst, transpose == CUSPARSE_OPERATION_TRANSPOSE); }
+
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, cusparseOperation_t transpose)
+{ IU_TRACE_FUNCTION(); return iuprivate::sparseMultiplication(A, src, dst, transpose == CUSPARSE_OPERATION_TRANSPOSE); }
+
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C2* dst, cusparseOperation_t transpose)
+{ IU_TRACE_FUNCTION(); return iuprivate::sparseMultiplication(A, src, dst, transpose == CUSPARSE_OPERATION_TRANSPOSE); }
+
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C2* src, iu::ImageCpu_32f_C1* dst, cusparseOperation_t transpose)
+{ IU_TRACE_FUNCTION(); return iuprivate::sparseMultiplication(A, src, dst, transpose == CUSPARSE_OPERATION_TRANSPOSE); }
+
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::VolumeCpu_32f_C1* src, iu::VolumeCpu_32f_C1* dst, cusparseOperation_t transpose)
+{ IU_TRACE_FUNCTION(); return iuprivate::sparseMultiplication(A, src, dst, transpose == CUSPARSE_OPERATION_TRANSPOSE); }
+
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* src, iu::VolumeCpu_32f_C1* dst, cusparseOperation_t transpose)
+{ IU_TRACE_FUNCTION(); return iuprivate::sparseMultiplication(A, src, dst, transpose == CUSPARSE_OPERATION_TRANSPOSE); }
+
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::VolumeCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, cusparseOperation_t transpose)
+{ IU_TRACE_FUNCTION(); return iuprivate::sparseMultiplication(A, src, dst, transpose == CUSPARSE_OPERATION_TRANSPOSE); }
+
+
+int solveCG(iu::SparseMatrixCpu<float>* A, iu::LinearHostMemory_32f_C1* b, iu::LinearHostMemory_32f_C1* x, int max_iterations, float tolerance, bool jacobi_preconditioner, iu::SparseSolverCallback* callback)
+{ IU_TRACE_FUNCTION(); return iuprivate::solveCG(A, b, x, max_iterations, tolerance, jacobi_preconditioner, callback); }
+
+int solveCG(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* b, iu::ImageCpu_32f_C1* x, int max_iterations, float tolerance, bool jacobi_preconditioner, iu::SparseSolverCallback* callback)
+{ IU_TRACE_FUNCTION(); return iuprivate::solveCG(A, b, x, max_iterations, tolerance, jacobi_preconditioner, callback); }
+
+int solveBiCGStab(iu::SparseMatrixCpu<float>* A, iu::LinearHostMemory_32f_C1* b, iu::LinearHostMemory_32f_C1* x, int max_iterations, float tolerance, iu::SparseSolverCallback* callback)
+{ IU_TRACE_FUNCTION(); return iuprivate::solveBiCGStab(A, b, x, max_iterations, tolerance, callback); }
+
+int solveBiCGStab(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* b, iu::ImageCpu_32f_C1* x, int max_iterations, float tolerance, iu::SparseSolverCallback* callback)
+{ IU_TRACE_FUNCTION(); return iuprivate::solveBiCGStab(A, b, x, max_iterations, tolerance, callback); }
+
+
+iu::SparseMatrixCpu<float>* readMatrixMarket(const std::string& filename, IuSparseFormat sformat)
+{ IU_TRACE_FUNCTION(); return iuprivate::readMatrixMarket(filename, sformat); }
+
+bool writeMatrixMarket(iu::SparseMatrixCpu<float>* A, const std::string& filename)
+{ IU_TRACE_FUNCTION(); return iuprivate::writeMatrixMarket(A, filename); }
+
+iu::SparseMatrixCpu<float>* readSparseBinary(const std::string& filename, bool map_file)
+{ IU_TRACE_FUNCTION(); return iuprivate::readSparseBinary(filename, map_file); }
+
+bool writeSparseBinary(iu::SparseMatrixCpu<float>* A, const std::string& filename)
+{ IU_TRACE_FUNCTION(); return iuprivate::writeSparseBinary(A, filename); }
+
+
 } // namespace iu
@@ -2,6 +2,7 @@
 #define IUSPARSE_H
 
 
+#include <string>
 #include "iudefs.h"
 #include <iusparse/sparsematrixdefs.h>
 
@@ -20,6 +21,66 @@ IUCORE_DLLAPI IuStatus sumSparseCol(iu::SparseMatrixGpu<float>* A, iu::LinearDev
 IUCORE_DLLAPI IuStatus sumSparseCol(iu::SparseMatrixGpu<float>* A, iu::ImageGpu_32f_C1* dst, float add_const=0.0f, IuSparseSum function=IU_NO);
 IUCORE_DLLAPI IuStatus sumSparseCol(iu::SparseMatrixGpu<float>* A, iu::VolumeGpu_32f_C1* dst, float add_const=0.0f, IuSparseSum function=IU_NO);
 
+/** Sparse matrix-vector multiplication on the host: dst = A*src or dst = A^T*src.
+ * As on the device the vectors are the buffers of the operands including the row
+ * padding (stride*height elements per image). A can be stored as CSR, CSC or SELL
+ * (see SparseMatrixCpu::changeSparseFormat); SELL is the fastest format for
+ * operators with regular row lengths (e.g. image gradients).
+ */
+IUCORE_DLLAPI IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::LinearHostMemory_32f_C1* src, iu::LinearHostMemory_32f_C1* dst, cusparseOperation_t transpose=CUSPARSE_OPERATION_NON_TRANSPOSE);
+IUCORE_DLLAPI IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, cusparseOperation_t transpose=CUSPARSE_OPERATION_NON_TRANSPOSE);
+IUCORE_DLLAPI IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C2* dst, cusparseOperation_t transpose=CUSPARSE_OPERATION_NON_TRANSPOSE);
+IUCORE_DLLAPI IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C2* src, iu::ImageCpu_32f_C1* dst, cusparseOperation_t transpose=CUSPARSE_OPERATION_NON_TRANSPOSE);
+IUCORE_DLLAPI IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::VolumeCpu_32f_C1* src, iu::VolumeCpu_32f_C1* dst, cusparseOperation_t transpose=CUSPARSE_OPERATION_NON_TRANSPOSE);
+IUCORE_DLLAPI IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* src, iu::VolumeCpu_32f_C1* dst, cusparseOperation_t transpose=CUSPARSE_OPERATION_NON_TRANSPOSE);
+IUCORE_DLLAPI IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::VolumeCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst, cusparseOperation_t transpose=CUSPARSE_OPERATION_NON_TRANSPOSE);
+
+/** Solves A*x = b on the host with (Jacobi preconditioned) conjugate gradients.
+ * A has to be symmetric positive definite. x holds the initial guess and receives the
+ * solution; the solver stops after \a max_iterations or when the relative residual
+ * |b - Ax|/|b| drops below \a tolerance. The optional \a callback is called after
+ * every iteration and can stop the solver. CSC matrices are solved on a temporary CSR
+ * copy; A itself is not modified. With the Jacobi preconditioner a zero diagonal entry
+ * throws an IuException.
+ * Returns the number of iterations; the iterates do not depend on the number of threads.
+ */
+IUCORE_DLLAPI int solveCG(iu::SparseMatrixCpu<float>* A, iu::LinearHostMemory_32f_C1* b, iu::LinearHostMemory_32f_C1* x, int max_iterations=1000, float tolerance=1e-6f, bool jacobi_preconditioner=false, iu::SparseSolverCallback* callback=0);
+IUCORE_DLLAPI int solveCG(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* b, iu::ImageCpu_32f_C1* x, int max_iterations=1000, float tolerance=1e-6f, bool jacobi_preconditioner=false, iu::SparseSolverCallback* callback=0);
+
+/** Solves A*x = b on the host with BiCGStab (for general square matrices).
+ * Same conventions as solveCG.
+ */
+IUCORE_DLLAPI int solveBiCGStab(iu::SparseMatrixCpu<float>* A, iu::LinearHostMemory_32f_C1* b, iu::LinearHostMemory_32f_C1* x, int max_iterations=1000, float tolerance=1e-6f, iu::SparseSolverCallback* callback=0);
+IUCORE_DLLAPI int solveBiCGStab(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* b, iu::ImageCpu_32f_C1* x, int max_iterations=1000, float tolerance=1e-6f, iu::SparseSolverCallback* callback=0);
+
+/** Reads a Matrix Market coordinate file (real, integer or pattern entries; general,
+ * symmetric or skew-symmetric) into a new host matrix in CSR or CSC format. The entries
+ * are parsed by several threads; duplicate entries are summed up. The caller owns the
+ * returned matrix. Throws an IuException for files that cannot be read or parsed
+ * (including lines with more fields than the header announces).
+ */
+IUCORE_DLLAPI iu::SparseMatrixCpu<float>* readMatrixMarket(const std::string& filename, IuSparseFormat sformat=CSR);
+
+/** Writes a CSR or CSC host matrix as a general real Matrix Market coordinate file.
+ * @returns true if the file was written.
+ */
+IUCORE_DLLAPI bool writeMatrixMarket(iu::SparseMatrixCpu<float>* A, const std::string& filename);
+
+/** Reads a binary CSR/CSC file written by writeSparseBinary. With \a map_file the
+ * matrix uses the memory-mapped file in place (copy on write, nothing is parsed or
+ * copied); otherwise the file is read into memory. One parallel pass checks that the
+ * pointer array is non-decreasing and that every index lies inside the matrix; corrupt
+ * files throw an IuException. The caller owns the returned matrix; the mapping is
+ * released with it.
+ */
+IUCORE_DLLAPI iu::SparseMatrixCpu<float>* readSparseBinary(const std::string& filename, bool map_file=true);
+
+/** Writes a CSR or CSC host matrix in the binary format of readSparseBinary (header plus
+ * 64 byte aligned pointer, index and value arrays in host byte order).
+ * @returns true if the file was written.
+ */
+IUCORE_DLLAPI bool writeSparseBinary(iu::SparseMatrixCpu<float>* A, const std::string& filename);
+
 } // namespace iu
 
 #endif // IUSPARSE_H
@@ -0,0 +1,667 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Sparse
+ * Class       : none
+ * Language    : C++
+ * Description : Inline implementation of host sparse format conversions
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IUSPARSE_SPARSECONVERT_CPU_H
+#define IUSPARSE_SPARSECONVERT_CPU_H
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <iucore/coredefs.h>
+#include <iucore/executor.h>
+#include <iucore/linearhostmemory.h>
+
+namespace iu {
+
+/* ****************************************************************************
+ *  Host sparse format conversions
+ *
+ *  The compressed formats store a pointer array of n_major+1 offsets and the
+ *  minor indices of the entries (CSR: major=row, minor=col; CSC: major=col,
+ *  minor=row). All indices are zero based.
+ *
+ *  Conversions are parallel counting sorts: the entries are split into chunks,
+ *  every chunk counts its keys into a private histogram, the histograms are
+ *  turned into per-chunk write offsets and every chunk scatters its entries in
+ *  input order. The result is therefore independent of the number of threads.
+ * ****************************************************************************/
+
+namespace detail {
+
+/** Number of chunks for a counting sort of \a n_entries over \a n_keys keys.
+ * Each chunk owns a histogram of n_keys counters, so the histogram memory is
+ * kept in the order of the input.
+ */
+inline int sparseSortChunks(unsigned int n_entries, unsigned int n_keys)
+{
+  int chunks = std::min(Executor::numThreads(), (int)(n_entries / Executor::MIN_CHUNK_ELEMENTS));
+  chunks = std::min(chunks, (int)(4*(size_t)n_entries / ((size_t)n_keys+1)));
+  return std::max(chunks, 1);
+}
+
+/** First entry of chunk \a c when \a n entries are split into \a chunks chunks. */
+inline size_t sparseChunkBegin(size_t n, int c, int chunks)
+{
+  return n*c / chunks;
+}
+
+/** Counts the keys of every chunk into hist[c*n_keys + key]. */
+struct SparseHistogram
+{
+  const int* keys;
+  size_t n_entries;
+  int n_keys;
+  int chunks;
+  int* hist;
+  int* invalid;
+
+  void operator()(int begin, int end) const
+  {
+    for(int c=begin; c<end; ++c)
+    {
+      int* h = hist + (size_t)c*n_keys;
+      memset(h, 0, n_keys*sizeof(int));
+      const size_t e = sparseChunkBegin(n_entries, c+1, chunks);
+      for(size_t i=sparseChunkBegin(n_entries, c, chunks); i<e; ++i)
+      {
+        const int k = keys[i];
+        if((unsigned int)k >= (unsigned int)n_keys)
+          invalid[c] = 1;
+        else
+          ++h[k];
+      }
+    }
+  }
+};
+
+/** Sums the chunk histograms of every key into ptr[key+1]. */
+struct SparseKeyTotals
+{
+  const int* hist;
+  int n_keys;
+  int chunks;
+  int* ptr;
+
+  void operator()(int begin, int end) const
+  {
+    for(int k=begin; k<end; ++k)
+    {
+      int total = 0;
+      for(int c=0; c<chunks; ++c)
+        total += hist[(size_t)c*n_keys + k];
+      ptr[k+1] = total;
+    }
+  }
+};
+
+/** Replaces the chunk histograms by the first output position of every (chunk, key). */
+struct SparseChunkOffsets
+{
+  int* hist;
+  int n_keys;
+  int chunks;
+  const int* ptr;
+
+  void operator()(int begin, int end) const
+  {
+    for(int k=begin; k<end; ++k)
+    {
+      int pos = ptr[k];
+      for(int c=0; c<chunks; ++c)
+      {
+        int& h = hist[(size_t)c*n_keys + k];
+        const int count = h;
+        h = pos;
+        pos += count;
+      }
+    }
+  }
+};
+
+/** Builds the pointer array \a ptr (n_keys+1) of a counting sort over \a keys and leaves
+ * the write offsets of every chunk in \a hist. Returns false for keys out of range.
+ */
+inline bool sparseCountingSortOffsets(const int* keys, size_t n_entries, int n_keys, int chunks,
+                                      std::vector<int>& hist, int* ptr)
+{
+  hist.resize((size_t)chunks*n_keys);
+  std::vector<int> invalid(chunks, 0);
+
+  SparseHistogram histogram = {keys, n_entries, n_keys, chunks,
+                               hist.empty() ? 0 : &hist[0], &invalid[0]};
+  parallelFor(0, chunks, histogram, 1);
+  for(int c=0; c<chunks; ++c)
+    if(invalid[c])
+      return false;
+
+  const int key_grain = Executor::rowGrain(chunks);
+  SparseKeyTotals totals = {histogram.hist, n_keys, chunks, ptr};
+  parallelFor(0, n_keys, totals, key_grain);
+  ptr[0] = 0;
+  for(int k=0; k<n_keys; ++k)
+    ptr[k+1] += ptr[k];
+  SparseChunkOffsets offsets = {histogram.hist, n_keys, chunks, ptr};
+  parallelFor(0, n_keys, offsets, key_grain);
+  return true;
+}
+
+/** Scatters COO entries to their compressed positions (input order within every key). */
+template<typename PixelType>
+struct SparseScatterCoo
+{
+  const int* major;
+  const int* minor;
+  const PixelType* value;
+  size_t n_entries;
+  int n_major;
+  int n_minor;
+  int chunks;
+  int* hist;
+  int* ind;
+  PixelType* dst;
+  int* invalid;
+
+  void operator()(int begin, int end) const
+  {
+    for(int c=begin; c<end; ++c)
+    {
+      int* pos = hist + (size_t)c*n_major;
+      const size_t e = sparseChunkBegin(n_entries, c+1, chunks);
+      for(size_t i=sparseChunkBegin(n_entries, c, chunks); i<e; ++i)
+      {
+        const int m = minor[i];
+        if((unsigned int)m >= (unsigned int)n_minor)
+          invalid[c] = 1;
+        const int p = pos[major[i]]++;
+        ind[p] = m;
+        dst[p] = value[i];
+      }
+    }
+  }
+};
+
+/** Scatters compressed entries to the transposed layout; the new minor index is the
+ * major index the entry was stored under.
+ */
+template<typename PixelType>
+struct SparseScatterTranspose
+{
+  const int* ptr;
+  const int* ind;
+  const PixelType* value;
+  size_t n_entries;
+  int n_major;
+  int n_minor;
+  int chunks;
+  int* hist;
+  int* t_ind;
+  PixelType* t_value;
+
+  void operator()(int begin, int end) const
+  {
+    for(int c=begin; c<end; ++c)
+    {
+      int* pos = hist + (size_t)c*n_minor;
+      const size_t b = sparseChunkBegin(n_entries, c, chunks);
+      const size_t e = sparseChunkBegin(n_entries, c+1, chunks);
+      if(b == e)
+        continue;
+      int r = (int)(std::upper_bound(ptr, ptr+n_major+1, (int)b) - ptr) - 1;
+      for(size_t i=b; i<e; ++i)
+      {
+        while((size_t)ptr[r+1] <= i)
+          ++r;
+        const int p = pos[ind[i]]++;
+        t_ind[p] = r;
+        t_value[p] = value[i];
+      }
+    }
+  }
+};
+
+template<typename PixelType>
+struct SparseEntryLess
+{
+  bool operator()(const std::pair<int, PixelType>& a, const std::pair<int, PixelType>& b) const
+  {
+    return a.first < b.first;
+  }
+};
+
+/** Sorts the minor indices of every major line (stable) and sums up entries with equal
+ * indices in storage order. The number of remaining entries is written to count[line].
+ */
+template<typename PixelType>
+struct SparseSumDuplicates
+{
+  enum { INSERTION_SORT_LENGTH = 32 };
+
+  const int* ptr;
+  int* ind;
+  PixelType* value;
+  int* count;
+
+  void operator()(int begin, int end) const
+  {
+    std::vector<std::pair<int, PixelType> > entries;
+    for(int r=begin; r<end; ++r)
+    {
+      const int b = ptr[r];
+      const int e = ptr[r+1];
+      if(e-b <= INSERTION_SORT_LENGTH)
+      {
+        for(int i=b+1; i<e; ++i)
+        {
+          const int k = ind[i];
+          const PixelType v = value[i];
+          int j = i;
+          for(; j>b && ind[j-1]>k; --j)
+          {
+            ind[j] = ind[j-1];
+            value[j] = value[j-1];
+          }
+          ind[j] = k;
+          value[j] = v;
+        }
+      }
+      else
+      {
+        entries.resize(e-b);
+        for(int i=b; i<e; ++i)
+          entries[i-b] = std::make_pair(ind[i], value[i]);
+        std::stable_sort(entries.begin(), entries.end(), SparseEntryLess<PixelType>());
+        for(int i=b; i<e; ++i)
+        {
+          ind[i] = entries[i-b].first;
+          value[i] = entries[i-b].second;
+        }
+      }
+
+      int w = b;
+      for(int i=b; i<e; ++i)
+      {
+        if(w > b && ind[w-1] == ind[i])
+          value[w-1] += value[i];
+        else
+        {
+          ind[w] = ind[i];
+          value[w] = value[i];
+          ++w;
+        }
+      }
+      count[r] = w-b;
+    }
+  }
+};
+
+/** Orders rows by decreasing length and increasing index. */
+struct SellRowLonger
+{
+  const int* ptr;
+  bool operator()(int a, int b) const
+  {
+    const int la = ptr[a+1]-ptr[a];
+    const int lb = ptr[b+1]-ptr[b];
+    return la > lb || (la == lb && a < b);
+  }
+};
+
+/** Sorts the rows of every sorting window by decreasing length (stable) and stores the
+ * width of every slice in widths[slice].
+ */
+struct SellSortWindows
+{
+  enum { MAX_COUNTING_LENGTH = 64 };
+
+  const int* ptr;
+  int n_row;
+  int slice_height;
+  int window;
+  int* perm;
+  int* widths;
+
+  void operator()(int begin, int end) const
+  {
+    for(int w=begin; w<end; ++w)
+    {
+      const int b = w*window;
+      const int e = std::min(b+window, n_row);
+      int max_len = 0;
+      for(int i=b; i<e; ++i)
+      {
+        perm[i] = i;
+        max_len = std::max(max_len, ptr[i+1]-ptr[i]);
+      }
+      if(window > slice_height && max_len < MAX_COUNTING_LENGTH)
+      {
+        // counting sort by decreasing length (operators with short rows)
+        int start[MAX_COUNTING_LENGTH+1];
+        for(int l=0; l<=max_len; ++l)
+          start[l] = 0;
+        for(int i=b; i<e; ++i)
+          ++start[max_len - (ptr[i+1]-ptr[i])];
+        for(int l=0, sum=b; l<=max_len; ++l)
+        {
+          const int count = start[l];
+          start[l] = sum;
+          sum += count;
+        }
+        for(int i=b; i<e; ++i)
+          perm[start[max_len - (ptr[i+1]-ptr[i])]++] = i;
+      }
+      else if(window > slice_height)
+      {
+        SellRowLonger longer = {ptr};
+        std::sort(perm+b, perm+e, longer);
+      }
+      for(int s=b/slice_height; s*slice_height<e; ++s)
+      {
+        int width = 0;
+        for(int i=s*slice_height; i<std::min((s+1)*slice_height, e); ++i)
+          width = std::max(width, ptr[perm[i]+1]-ptr[perm[i]]);
+        widths[s] = width;
+      }
+    }
+  }
+};
+
+/** Copies the rows of every slice into the column-major slice layout. Padding entries
+ * repeat the last column index of their row (or 0) with value 0.
+ */
+template<typename PixelType>
+struct SellFillSlices
+{
+  const int* ptr;
+  const int* ind;
+  const PixelType* value;
+  const int* perm;
+  const int* slice_ptr;
+  int n_row;
+  int slice_height;
+  int* sell_ind;
+  PixelType* sell_value;
+
+  void operator()(int begin, int end) const
+  {
+    for(int s=begin; s<end; ++s)
+    {
+      const int c = slice_height;
+      const int width = (slice_ptr[s+1]-slice_ptr[s]) / c;
+      int* d_ind = sell_ind + slice_ptr[s];
+      PixelType* d_value = sell_value + slice_ptr[s];
+      for(int l=0; l<c; ++l)
+      {
+        const int i = s*c + l;
+        int len = 0;
+        int pad = 0;
+        if(i < n_row)
+        {
+          const int b = ptr[perm[i]];
+          len = ptr[perm[i]+1] - b;
+          for(int j=0; j<len; ++j)
+          {
+            d_ind[j*c+l] = ind[b+j];
+            d_value[j*c+l] = value[b+j];
+          }
+          if(len > 0)
+            pad = ind[b+len-1];
+        }
+        for(int j=len; j<width; ++j)
+        {
+          d_ind[j*c+l] = pad;
+          d_value[j*c+l] = PixelType(0);
+        }
+      }
+    }
+  }
+};
+
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+/** Sorts the minor indices within every major line of a compressed (CSR/CSC) matrix and
+ * sums up duplicate entries. Duplicates are summed in storage order, so the result does
+ * not depend on the number of threads.
+ * \param ptr Pointer array (n_major+1 elements), updated in place.
+ * \param ind Minor indices, compacted in place.
+ * \param value Values, compacted in place.
+ * \returns Number of remaining entries (the leading part of \a ind and \a value).
+ */
+template<typename PixelType>
+unsigned int sumSparseDuplicates(LinearHostMemory<int>* ptr, LinearHostMemory<int>* ind,
+                                 LinearHostMemory<PixelType>* value)
+{
+  if(ptr == 0 || ind == 0 || value == 0 || ptr->length() == 0)
+    throw IuException("input data not valid", __FILE__, __FUNCTION__, __LINE__);
+  const int n_major = ptr->length()-1;
+  int* p = ptr->data();
+  if(p[0] != 0 || (unsigned int)p[n_major] > ind->length() || (unsigned int)p[n_major] > value->length())
+    throw IuException("pointer array does not match the entries", __FILE__, __FUNCTION__, __LINE__);
+  if(n_major == 0)
+    return 0;
+
+  std::vector<int> count(n_major);
+  detail::SparseSumDuplicates<PixelType> body = {p, ind->data(), value->data(), &count[0]};
+  parallelFor(0, n_major, body, Executor::rowGrain(std::max(1, p[n_major]/n_major)));
+
+  // compact the lines; new positions never exceed the old ones
+  int w = 0;
+  for(int r=0; r<n_major; ++r)
+  {
+    const int b = p[r];
+    if(w != b)
+    {
+      memmove(ind->data(w), ind->data(b), count[r]*sizeof(int));
+      memmove(value->data(w), value->data(b), count[r]*sizeof(PixelType));
+    }
+    p[r] = w;
+    w += count[r];
+  }
+  p[n_major] = w;
+  return w;
+}
+
+/** Converts a matrix given as COO triplets (row, col, value) into a compressed format.
+ * Entries of the same major line keep their input order (counting sort).
+ * \param coo_row Row indices.
+ * \param coo_col Column indices.
+ * \param coo_value Values.
+ * \param n_row Number of rows of the matrix.
+ * \param n_col Number of columns of the matrix.
+ * \param sformat CSR (ptr over rows, ind=columns) or CSC (ptr over columns, ind=rows).
+ * \param ptr Pointer array (n_row+1 elements for CSR, n_col+1 for CSC).
+ * \param ind Minor indices (at least as many elements as coo_value).
+ * \param value Values (at least as many elements as coo_value).
+ * \param sum_duplicates Sorts the minor indices and sums up duplicate entries.
+ * \returns Number of entries written (the leading part of \a ind and \a value; a
+ *          view with this length can be used to construct a SparseMatrixCpu).
+ */
+template<typename PixelType>
+unsigned int convertCooToSparse(const LinearHostMemory<int>* coo_row, const LinearHostMemory<int>* coo_col,
+                                const LinearHostMemory<PixelType>* coo_value, int n_row, int n_col,
+                                IuSparseFormat sformat, LinearHostMemory<int>* ptr,
+                                LinearHostMemory<int>* ind, LinearHostMemory<PixelType>* value,
+                                bool sum_duplicates = true)
+{
+  if(coo_row == 0 || coo_col == 0 || coo_value == 0 || ptr == 0 || ind == 0 || value == 0)
+    throw IuException("input data not valid", __FILE__, __FUNCTION__, __LINE__);
+  const unsigned int n_entries = coo_value->length();
+  if(coo_row->length() != n_entries || coo_col->length() != n_entries)
+    throw IuException("COO arrays differ in length", __FILE__, __FUNCTION__, __LINE__);
+  if(n_row < 0 || n_col < 0)
+    throw IuException("invalid matrix size", __FILE__, __FUNCTION__, __LINE__);
+
+  const bool csr = (sformat == CSR);
+  const int n_major = csr ? n_row : n_col;
+  const int n_minor = csr ? n_col : n_row;
+  const int* major = csr ? coo_row->data() : coo_col->data();
+  const int* minor = csr ? coo_col->data() : coo_row->data();
+  if(ptr->length() != (unsigned int)n_major+1)
+    throw IuException("pointer array has to hold n_major+1 elements", __FILE__, __FUNCTION__, __LINE__);
+  if(ind->length() < n_entries || value->length() < n_entries)
+    throw IuException("output arrays too small", __FILE__, __FUNCTION__, __LINE__);
+
+  const int chunks = detail::sparseSortChunks(n_entries, n_major);
+  std::vector<int> hist;
+  if(!detail::sparseCountingSortOffsets(major, n_entries, n_major, chunks, hist, ptr->data()))
+    throw IuException("index out of range", __FILE__, __FUNCTION__, __LINE__);
+
+  std::vector<int> invalid(chunks, 0);
+  detail::SparseScatterCoo<PixelType> scatter = {major, minor, coo_value->data(), n_entries,
+                                                 n_major, n_minor, chunks,
+                                                 hist.empty() ? 0 : &hist[0],
+                                                 ind->data(), value->data(), &invalid[0]};
+  parallelFor(0, chunks, scatter, 1);
+  for(int c=0; c<chunks; ++c)
+    if(invalid[c])
+      throw IuException("index out of range", __FILE__, __FUNCTION__, __LINE__);
+
+  if(!sum_duplicates)
+    return n_entries;
+  LinearHostMemory<int> ind_view(*ind, 0, n_entries);
+  LinearHostMemory<PixelType> value_view(*value, 0, n_entries);
+  return sumSparseDuplicates(ptr, &ind_view, &value_view);
+}
+
+/** Transposes a compressed matrix, i.e. converts CSR <-> CSC of the same matrix or builds
+ * the CSR arrays of A^T from the CSR arrays of A. The minor indices of the result are
+ * sorted within every line.
+ * \param ptr Pointer array (n_major+1 elements).
+ * \param ind Minor indices.
+ * \param value Values.
+ * \param n_minor Number of minor lines (columns for CSR input).
+ * \param t_ptr Transposed pointer array (n_minor+1 elements).
+ * \param t_ind Transposed minor indices (same number of entries).
+ * \param t_value Transposed values (same number of entries).
+ */
+template<typename PixelType>
+void transposeSparse(const LinearHostMemory<int>* ptr, const LinearHostMemory<int>* ind,
+                     const LinearHostMemory<PixelType>* value, int n_minor,
+                     LinearHostMemory<int>* t_ptr, LinearHostMemory<int>* t_ind,
+                     LinearHostMemory<PixelType>* t_value)
+{
+  if(ptr == 0 || ind == 0 || value == 0 || t_ptr == 0 || t_ind == 0 || t_value == 0 ||
+     ptr->length() == 0 || n_minor < 0)
+    throw IuException("input data not valid", __FILE__, __FUNCTION__, __LINE__);
+  const int n_major = ptr->length()-1;
+  const int* p = ptr->data();
+  const unsigned int n_entries = p[n_major];
+  if(p[0] != 0 || n_entries > ind->length() || n_entries > value->length())
+    throw IuException("pointer array does not match the entries", __FILE__, __FUNCTION__, __LINE__);
+  if(t_ptr->length() != (unsigned int)n_minor+1)
+    throw IuException("pointer array has to hold n_minor+1 elements", __FILE__, __FUNCTION__, __LINE__);
+  if(t_ind->length() < n_entries || t_value->length() < n_entries)
+    throw IuException("output arrays too small", __FILE__, __FUNCTION__, __LINE__);
+
+  const int chunks = detail::sparseSortChunks(n_entries, n_minor);
+  std::vector<int> hist;
+  if(!detail::sparseCountingSortOffsets(ind->data(), n_entries, n_minor, chunks, hist, t_ptr->data()))
+    throw IuException("index out of range", __FILE__, __FUNCTION__, __LINE__);
+
+  detail::SparseScatterTranspose<PixelType> scatter = {p, ind->data(), value->data(), n_entries,
+                                                       n_major, n_minor, chunks,
+                                                       hist.empty() ? 0 : &hist[0],
+                                                       t_ind->data(), t_value->data()};
+  parallelFor(0, chunks, scatter, 1);
+}
+
+/** Computes the layout of the sliced ELLPACK (SELL-C-sigma) format of a CSR matrix.
+ * The rows are sorted by decreasing length within windows of \a sorting_scope rows and
+ * grouped into slices of \a slice_height rows that are padded to their longest row.
+ * \param ptr CSR pointer array (n_row+1 elements).
+ * \param slice_height Rows per slice (C), typically the SIMD width.
+ * \param sorting_scope Rows per sorting window (sigma); rounded up to a multiple of
+ *        \a slice_height, values <= slice_height disable the sorting.
+ * \param perm Original row of every sorted row (n_row elements).
+ * \param slice_ptr First element of every slice (ceil(n_row/slice_height)+1 elements).
+ * \returns Number of stored elements including the padding.
+ */
+inline unsigned int computeSellLayout(const LinearHostMemory<int>* ptr, int slice_height, int sorting_scope,
+                                      LinearHostMemory<int>* perm, LinearHostMemory<int>* slice_ptr)
+{
+  if(ptr == 0 || perm == 0 || slice_ptr == 0 || ptr->length() == 0 || slice_height <= 0)
+    throw IuException("input data not valid", __FILE__, __FUNCTION__, __LINE__);
+  const int n_row = ptr->length()-1;
+  const int n_slices = (n_row + slice_height-1) / slice_height;
+  if(perm->length() != (unsigned int)n_row || slice_ptr->length() != (unsigned int)n_slices+1)
+    throw IuException("perm or slice_ptr has the wrong length", __FILE__, __FUNCTION__, __LINE__);
+  if(n_row == 0)
+  {
+    *slice_ptr->data() = 0;
+    return 0;
+  }
+
+  const int window = std::max(1, (sorting_scope + slice_height-1) / slice_height) * slice_height;
+  int* p = slice_ptr->data();
+  detail::SellSortWindows sort = {ptr->data(), n_row, slice_height, window, perm->data(), p+1};
+  parallelFor(0, (n_row+window-1)/window, sort, std::max(1, Executor::MIN_CHUNK_ELEMENTS/window));
+
+  size_t total = 0;
+  p[0] = 0;
+  for(int s=0; s<n_slices; ++s)
+  {
+    total += (size_t)p[s+1]*slice_height;
+    if(total > 0x7fffffffu)
+      throw IuException("too many elements for the SELL format", __FILE__, __FUNCTION__, __LINE__);
+    p[s+1] = (int)total;
+  }
+  return (unsigned int)total;
+}
+
+/** Converts a CSR matrix into the SELL-C-sigma layout computed by computeSellLayout.
+ * Every slice stores its entries column-major: element j of the row in lane l is at
+ * slice_ptr[s] + j*slice_height + l. Padding entries have the value 0 and repeat the last
+ * column index of their row, so they must not meet Inf/NaN in a multiplied vector.
+ * \param sell_ind Column indices (slice_ptr[n_slices] elements).
+ * \param sell_value Values (slice_ptr[n_slices] elements).
+ */
+template<typename PixelType>
+void convertSparseToSell(const LinearHostMemory<int>* ptr, const LinearHostMemory<int>* ind,
+                         const LinearHostMemory<PixelType>* value, int slice_height,
+                         const LinearHostMemory<int>* perm, const LinearHostMemory<int>* slice_ptr,
+                         LinearHostMemory<int>* sell_ind, LinearHostMemory<PixelType>* sell_value)
+{
+  if(ptr == 0 || ind == 0 || value == 0 || perm == 0 || slice_ptr == 0 || sell_ind == 0 ||
+     sell_value == 0 || ptr->length() == 0 || slice_height <= 0)
+    throw IuException("input data not valid", __FILE__, __FUNCTION__, __LINE__);
+  const int n_row = ptr->length()-1;
+  const int n_slices = (n_row + slice_height-1) / slice_height;
+  const unsigned int n_entries = ptr->data()[n_row];
+  if(perm->length() != (unsigned int)n_row || slice_ptr->length() != (unsigned int)n_slices+1)
+    throw IuException("perm or slice_ptr has the wrong length", __FILE__, __FUNCTION__, __LINE__);
+  if(n_entries > ind->length() || n_entries > value->length())
+    throw IuException("pointer array does not match the entries", __FILE__, __FUNCTION__, __LINE__);
+  const unsigned int n_stored = slice_ptr->data()[n_slices];
+  if(sell_ind->length() < n_stored || sell_value->length() < n_stored)
+    throw IuException("output arrays too small", __FILE__, __FUNCTION__, __LINE__);
+
+  detail::SellFillSlices<PixelType> fill = {ptr->data(), ind->data(), value->data(), perm->data(),
+                                            slice_ptr->data(), n_row, slice_height,
+                                            sell_ind->data(), sell_value->data()};
+  parallelFor(0, n_slices, fill, std::max(1, Executor::rowGrain(n_stored/std::max(1, n_slices))));
+}
+
+} // namespace iu
+
+#endif // IUSPARSE_SPARSECONVERT_CPU_H
@@ -0,0 +1,791 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Sparse
+ * Class       : none
+ * Language    : C++
+ * Description : Implementation of the host sparse matrix file io
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+
+#ifdef WIN32
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <iucore/executor.h>
+#include "sparseio_cpu.h"
+
+namespace iuprivate {
+
+/* ***************************************************************************
+ *  File access
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+// Read-only view of a whole file: mapped copy-on-write where available, read into
+// memory otherwise. Writes through data() never reach the file.
+class SparseFile
+{
+public:
+  SparseFile(const std::string& filename, bool map_file) :
+    data_(0), size_(0), mapped_(false)
+  {
+#ifndef WIN32
+    if (map_file)
+    {
+      const int fd = open(filename.c_str(), O_RDONLY);
+      if (fd < 0)
+        throw IuException("could not open " + filename, __FILE__, __FUNCTION__, __LINE__);
+      struct stat st;
+      if (fstat(fd, &st) != 0 || st.st_size <= 0)
+      {
+        close(fd);
+        throw IuException("could not read " + filename, __FILE__, __FUNCTION__, __LINE__);
+      }
+      void* data = mmap(0, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+      close(fd);
+      if (data == MAP_FAILED)
+        throw IuException("could not map " + filename, __FILE__, __FUNCTION__, __LINE__);
+      data_ = (char*)data;
+      size_ = st.st_size;
+      mapped_ = true;
+      return;
+    }
+#endif
+    FILE* file = fopen(filename.c_str(), "rb");
+    if (file == 0)
+      throw IuException("could not open " + filename, __FILE__, __FUNCTION__, __LINE__);
+    long size = -1;
+    if (fseek(file, 0, SEEK_END) == 0)
+      size = ftell(file);
+    if (size > 0 && fseek(file, 0, SEEK_SET) == 0)
+    {
+      data_ = (char*)malloc(size);
+      if (data_ != 0 && fread(data_, 1, size, file) == (size_t)size)
+        size_ = size;
+    }
+    fclose(file);
+    if (size_ == 0)
+    {
+      free(data_);
+      throw IuException("could not read " + filename, __FILE__, __FUNCTION__, __LINE__);
+    }
+  }
+
+  ~SparseFile()
+  {
+#ifndef WIN32
+    if (mapped_)
+    {
+      munmap(data_, size_);
+      return;
+    }
+#endif
+    free(data_);
+  }
+
+  char* data() { return data_; }
+  size_t size() const { return size_; }
+
+  /** Asks the kernel to read ahead the mapped range (no-op for files in memory). */
+  void willNeed(size_t offset, size_t length)
+  {
+#ifndef WIN32
+    if (mapped_ && length > 0)
+    {
+      const size_t page = sysconf(_SC_PAGESIZE);
+      const size_t begin = offset / page * page;
+      madvise(data_ + begin, offset + length - begin, MADV_WILLNEED);
+    }
+#endif
+  }
+
+private:
+  SparseFile(const SparseFile&);
+  SparseFile& operator=(const SparseFile&);
+
+  char* data_;
+  size_t size_;
+  bool mapped_;
+};
+
+//-----------------------------------------------------------------------------
+// Matrix whose arrays live in a SparseFile; the file is released with the matrix.
+// Format conversions move the data into own buffers and leave the file untouched.
+class FileSparseMatrixCpu : public iu::SparseMatrixCpu<float>
+{
+public:
+  FileSparseMatrixCpu(SparseFile* file, iu::LinearHostMemory<float>* value,
+                      iu::LinearHostMemory<int>* row, iu::LinearHostMemory<int>* col,
+                      int n_row, int n_col, IuSparseFormat sformat) :
+    iu::SparseMatrixCpu<float>(value, row, col, n_row, n_col, sformat, true),
+    file_(file), file_value_(value), file_row_(row), file_col_(col)
+  {
+  }
+
+  virtual ~FileSparseMatrixCpu()
+  {
+    delete file_value_;
+    delete file_row_;
+    delete file_col_;
+    delete file_;
+  }
+
+private:
+  SparseFile* file_;
+  iu::LinearHostMemory<float>* file_value_;
+  iu::LinearHostMemory<int>* file_row_;
+  iu::LinearHostMemory<int>* file_col_;
+};
+
+/* ***************************************************************************
+ *  Matrix Market
+ * ***************************************************************************/
+// The data section is split into chunks at line boundaries. A first parallel pass
+// counts the entry lines of every chunk, which gives the position of each chunk in
+// the COO arrays; a second pass parses the chunks into their place. Symmetric
+// matrices get their mirrored entries appended by a third pass. The COO triplets are
+// then compressed with convertCooToSparse.
+
+enum MatrixMarketField { MM_REAL, MM_PATTERN };
+enum MatrixMarketSymmetry { MM_GENERAL, MM_SYMMETRIC, MM_SKEW_SYMMETRIC };
+
+static inline bool isBlank(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+// entry lines are all lines but blank lines and comments
+static inline bool isEntryLine(const char* p, const char* end)
+{
+  while (p < end && isBlank(*p))
+    ++p;
+  return p < end && *p != '\n' && *p != '%';
+}
+
+static inline const char* nextLine(const char* p, const char* end)
+{
+  if (p >= end)
+    return end;
+  const char* nl = (const char*)memchr(p, '\n', end - p);
+  return nl ? nl + 1 : end;
+}
+
+// nothing but blanks up to the end of the line
+static inline bool isLineEnd(const char* p, const char* end)
+{
+  while (p < end && isBlank(*p))
+    ++p;
+  return p == end || *p == '\n';
+}
+
+static inline bool parseIndex(const char*& p, const char* end, long long& v)
+{
+  while (p < end && isBlank(*p))
+    ++p;
+  if (p == end || *p < '0' || *p > '9')
+    return false;
+  v = 0;
+  while (p < end && *p >= '0' && *p <= '9' && v < 0x7fffffffLL)
+    v = v*10 + (*p++ - '0');
+  return p == end || isBlank(*p) || *p == '\n';
+}
+
+// Decimal numbers with at most 19 significant digits that fit the double mantissa and
+// powers of ten up to 1e22 are converted exactly with one double operation; anything
+// else (long mantissas, large exponents, inf, nan) is handed to strtod.
+static inline bool parseReal(const char*& p, const char* end, double& v)
+{
+  static const double pow10[23] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+                                   1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19,
+                                   1e20, 1e21, 1e22};
+  while (p < end && isBlank(*p))
+    ++p;
+  const char* token = p;
+  const bool negative = (p < end && *p == '-');
+  if (p < end && (*p == '-' || *p == '+'))
+    ++p;
+
+  unsigned long long mantissa = 0;
+  int digits = 0, exponent = 0;
+  bool any_digit = false;
+  while (p < end && *p >= '0' && *p <= '9')
+  {
+    any_digit = true;
+    if (mantissa != 0 || *p != '0')
+    {
+      if (digits < 19)
+        mantissa = mantissa*10 + (*p - '0');
+      else
+        ++exponent;
+      ++digits;
+    }
+    ++p;
+  }
+  if (p < end && *p == '.')
+  {
+    ++p;
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+      any_digit = true;
+      if (mantissa != 0 || *p != '0')
+      {
+        if (digits < 19)
+        {
+          mantissa = mantissa*10 + (*p - '0');
+          --exponent;
+        }
+        ++digits;
+      }
+      else
+        --exponent;
+      ++p;
+    }
+  }
+  if (any_digit && p < end && (*p == 'e' || *p == 'E'))
+  {
+    const char* q = p + 1;
+    const bool negative_exponent = (q < end && *q == '-');
+    if (q < end && (*q == '-' || *q == '+'))
+      ++q;
+    if (q < end && *q >= '0' && *q <= '9')
+    {
+      int e = 0;
+      while (q < end && *q >= '0' && *q <= '9')
+      {
+        if (e < 100000)
+          e = e*10 + (*q - '0');
+        ++q;
+      }
+      exponent += negative_exponent ? -e : e;
+      p = q;
+    }
+  }
+
+  const bool separated = (p == end || isBlank(*p) || *p == '\n');
+  if (any_digit && separated && digits <= 19 && mantissa <= (1ULL << 53) &&
+      exponent >= -22 && exponent <= 22)
+  {
+    const double m = (double)mantissa;
+    v = exponent < 0 ? m / pow10[-exponent] : m * pow10[exponent];
+    if (negative)
+      v = -v;
+    return true;
+  }
+
+  // slow path on a terminated copy of the token
+  p = token;
+  while (p < end && !isBlank(*p) && *p != '\n')
+    ++p;
+  char buffer[128];
+  const size_t length = p - token;
+  if (length == 0 || length >= sizeof(buffer))
+    return false;
+  memcpy(buffer, token, length);
+  buffer[length] = 0;
+  char* parsed;
+  v = strtod(buffer, &parsed);
+  return parsed == buffer + length;
+}
+
+struct MatrixMarketChunks
+{
+  const char* data;
+  const char* end;
+  std::vector<const char*> begin; // chunk c spans [begin[c], begin[c+1])
+
+  int count() const { return (int)begin.size() - 1; }
+};
+
+struct MatrixMarketCount
+{
+  const MatrixMarketChunks* chunks;
+  size_t* entries;
+
+  void operator()(int begin, int end) const
+  {
+    for (int c=begin; c<end; ++c)
+    {
+      size_t n = 0;
+      const char* chunk_end = chunks->begin[c+1];
+      for (const char* p=chunks->begin[c]; p<chunk_end; p=nextLine(p, chunk_end))
+        if (isEntryLine(p, chunk_end))
+          ++n;
+      entries[c] = n;
+    }
+  }
+};
+
+struct MatrixMarketParse
+{
+  const MatrixMarketChunks* chunks;
+  const size_t* offset;        // first entry of every chunk
+  long long n_row;
+  long long n_col;
+  MatrixMarketField field;
+  int* row;
+  int* col;
+  float* value;
+  size_t* off_diagonal;        // per chunk
+  const char** error;          // per chunk: first invalid line or 0
+
+  void operator()(int begin, int end) const
+  {
+    for (int c=begin; c<end; ++c)
+    {
+      size_t e = offset[c];
+      size_t n_off = 0;
+      error[c] = 0;
+      const char* chunk_end = chunks->begin[c+1];
+      for (const char* line=chunks->begin[c]; line<chunk_end; line=nextLine(line, chunk_end))
+      {
+        if (!isEntryLine(line, chunk_end))
+          continue;
+        const char* p = line;
+        long long i, j;
+        double v = 1.0;
+        if (!parseIndex(p, chunk_end, i) || !parseIndex(p, chunk_end, j) ||
+            (field == MM_REAL && !parseReal(p, chunk_end, v)) || !isLineEnd(p, chunk_end) ||
+            i < 1 || i > n_row || j < 1 || j > n_col)
+        {
+          error[c] = line;
+          break;
+        }
+        row[e] = (int)(i-1);
+        col[e] = (int)(j-1);
+        value[e] = (float)v;
+        ++e;
+        if (i != j)
+          ++n_off;
+      }
+      off_diagonal[c] = n_off;
+    }
+  }
+};
+
+// appends (col, row, sign*value) for the off-diagonal entries of every chunk
+struct MatrixMarketMirror
+{
+  const size_t* offset;        // entries of every chunk
+  const size_t* mirror_offset; // position of the mirrored entries of every chunk
+  float sign;
+  int* row;
+  int* col;
+  float* value;
+
+  void operator()(int begin, int end) const
+  {
+    for (int c=begin; c<end; ++c)
+    {
+      size_t m = mirror_offset[c];
+      for (size_t e=offset[c]; e<offset[c+1]; ++e)
+      {
+        if (row[e] == col[e])
+          continue;
+        row[m] = col[e];
+        col[m] = row[e];
+        value[m] = sign*value[e];
+        ++m;
+      }
+    }
+  }
+};
+
+static std::string lowerCase(std::string s)
+{
+  for (size_t i=0; i<s.size(); ++i)
+    if (s[i] >= 'A' && s[i] <= 'Z')
+      s[i] = s[i] - 'A' + 'a';
+  return s;
+}
+
+//-----------------------------------------------------------------------------
+iu::SparseMatrixCpu<float>* readMatrixMarket(const std::string& filename, IuSparseFormat sformat)
+{
+  if (sformat != CSR && sformat != CSC)
+    throw IuException("Matrix Market files are read as CSR or CSC", __FILE__, __FUNCTION__, __LINE__);
+  SparseFile file(filename, true);
+  const char* p = file.data();
+  const char* end = p + file.size();
+
+  // banner: %%MatrixMarket matrix coordinate <field> <symmetry>
+  char tokens[5][32];
+  const char* banner_end = nextLine(p, end);
+  const std::string banner(p, banner_end);
+  if (sscanf(banner.c_str(), "%31s %31s %31s %31s %31s", tokens[0], tokens[1], tokens[2],
+             tokens[3], tokens[4]) != 5 ||
+      lowerCase(tokens[0]) != "%%matrixmarket" || lowerCase(tokens[1]) != "matrix")
+    throw IuException("not a Matrix Market file: " + filename, __FILE__, __FUNCTION__, __LINE__);
+  const std::string format = lowerCase(tokens[2]);
+  const std::string field_name = lowerCase(tokens[3]);
+  const std::string symmetry_name = lowerCase(tokens[4]);
+  if (format != "coordinate")
+    throw IuException("only Matrix Market coordinate files are supported", __FILE__, __FUNCTION__, __LINE__);
+  MatrixMarketField field;
+  if (field_name == "real" || field_name == "double" || field_name == "integer")
+    field = MM_REAL;
+  else if (field_name == "pattern")
+    field = MM_PATTERN;
+  else
+    throw IuException("unsupported Matrix Market field: " + field_name, __FILE__, __FUNCTION__, __LINE__);
+  MatrixMarketSymmetry symmetry;
+  if (symmetry_name == "general")
+    symmetry = MM_GENERAL;
+  else if (symmetry_name == "symmetric")
+    symmetry = MM_SYMMETRIC;
+  else if (symmetry_name == "skew-symmetric")
+    symmetry = MM_SKEW_SYMMETRIC;
+  else
+    throw IuException("unsupported Matrix Market symmetry: " + symmetry_name, __FILE__, __FUNCTION__, __LINE__);
+
+  // size line after the comments
+  p = banner_end;
+  while (p < end && !isEntryLine(p, end))
+    p = nextLine(p, end);
+  long long n_row, n_col, n_entries;
+  {
+    const char* q = p;
+    const char* size_end = nextLine(p, end);
+    if (!parseIndex(q, size_end, n_row) || !parseIndex(q, size_end, n_col) ||
+        !parseIndex(q, size_end, n_entries) || !isLineEnd(q, size_end) || n_row >= 0x7fffffffLL || n_col >= 0x7fffffffLL ||
+        n_entries >= 0x7fffffffLL)
+      throw IuException("invalid Matrix Market size line", __FILE__, __FUNCTION__, __LINE__);
+    p = size_end;
+  }
+
+  // chunks of about 1MB, cut after the next line break
+  MatrixMarketChunks chunks;
+  chunks.data = p;
+  chunks.end = end;
+  const size_t bytes = end - p;
+  const int n_chunks = (int)std::max<size_t>(1, std::min<size_t>(bytes >> 20, 64*iu::Executor::numThreads()));
+  chunks.begin.push_back(p);
+  for (int c=1; c<n_chunks; ++c)
+  {
+    const char* q = std::max(chunks.begin.back(), p + bytes/n_chunks*c);
+    chunks.begin.push_back(q == end ? end : nextLine(q, end));
+  }
+  chunks.begin.push_back(end);
+
+  std::vector<size_t> offset(n_chunks+1, 0);
+  MatrixMarketCount count = {&chunks, &offset[1]};
+  iu::parallelFor(0, n_chunks, count, 1);
+  for (int c=0; c<n_chunks; ++c)
+    offset[c+1] += offset[c];
+  if (offset[n_chunks] != (size_t)n_entries)
+    throw IuException("number of Matrix Market entries does not match the size line", __FILE__, __FUNCTION__, __LINE__);
+
+  // parse into the COO arrays (with room for the mirrored entries)
+  const size_t capacity = (symmetry == MM_GENERAL) ? n_entries : 2*n_entries;
+  if (capacity >= 0x7fffffffULL)
+    throw IuException("too many Matrix Market entries", __FILE__, __FUNCTION__, __LINE__);
+  iu::LinearHostMemory<int> coo_row(capacity);
+  iu::LinearHostMemory<int> coo_col(capacity);
+  iu::LinearHostMemory<float> coo_value(capacity);
+  std::vector<size_t> off_diagonal(n_chunks+1, 0);
+  std::vector<const char*> error(n_chunks, (const char*)0);
+  MatrixMarketParse parse = {&chunks, &offset[0], n_row, n_col, field, coo_row.data(), coo_col.data(),
+                             coo_value.data(), &off_diagonal[1], &error[0]};
+  iu::parallelFor(0, n_chunks, parse, 1);
+  for (int c=0; c<n_chunks; ++c)
+    if (error[c] != 0)
+    {
+      const std::string line(error[c], std::min<const char*>(nextLine(error[c], end), error[c] + 80));
+      throw IuException("invalid Matrix Market entry: " + line, __FILE__, __FUNCTION__, __LINE__);
+    }
+
+  size_t n_coo = n_entries;
+  if (symmetry != MM_GENERAL)
+  {
+    off_diagonal[0] = n_entries;
+    for (int c=0; c<n_chunks; ++c)
+      off_diagonal[c+1] += off_diagonal[c];
+    MatrixMarketMirror mirror = {&offset[0], &off_diagonal[0], symmetry == MM_SYMMETRIC ? 1.0f : -1.0f,
+                                 coo_row.data(), coo_col.data(), coo_value.data()};
+    iu::parallelFor(0, n_chunks, mirror, 1);
+    n_coo = off_diagonal[n_chunks];
+  }
+
+  // compress (duplicate entries are summed up)
+  iu::LinearHostMemory<int> row_view(coo_row, 0, n_coo);
+  iu::LinearHostMemory<int> col_view(coo_col, 0, n_coo);
+  iu::LinearHostMemory<float> value_view(coo_value, 0, n_coo);
+  const int n_major = (int)((sformat == CSR) ? n_row : n_col);
+  iu::LinearHostMemory<int> ptr(n_major+1);
+  iu::LinearHostMemory<int> ind(n_coo);
+  iu::LinearHostMemory<float> value(n_coo);
+  const unsigned int nnz = iu::convertCooToSparse(&row_view, &col_view, &value_view, (int)n_row,
+                                                  (int)n_col, sformat, &ptr, &ind, &value);
+  iu::LinearHostMemory<int> ind_view(ind, 0, nnz);
+  iu::LinearHostMemory<float> nnz_view(value, 0, nnz);
+  if (sformat == CSR)
+    return new iu::SparseMatrixCpu<float>(&nnz_view, &ptr, &ind_view, (int)n_row, (int)n_col, CSR);
+  return new iu::SparseMatrixCpu<float>(&nnz_view, &ind_view, &ptr, (int)n_row, (int)n_col, CSC);
+}
+
+//-----------------------------------------------------------------------------
+// formats the entries of the major lines [begin, end) of chunk c
+struct MatrixMarketFormat
+{
+  const int* ptr;
+  const int* ind;
+  const float* value;
+  bool csr;
+  int n_major;
+  int n_chunks;
+  std::vector<std::string>* text;
+
+  void operator()(int begin, int end) const
+  {
+    char line[64];
+    for (int c=begin; c<end; ++c)
+    {
+      const int major_begin = (int)((long long)n_major*c/n_chunks);
+      const int major_end = (int)((long long)n_major*(c+1)/n_chunks);
+      std::string& out = (*text)[c];
+      out.reserve((size_t)(ptr[major_end] - ptr[major_begin])*24);
+      for (int m=major_begin; m<major_end; ++m)
+        for (int e=ptr[m]; e<ptr[m+1]; ++e)
+        {
+          const int r = csr ? m : ind[e];
+          const int k = csr ? ind[e] : m;
+          out.append(line, snprintf(line, sizeof(line), "%d %d %.9g\n", r+1, k+1, value[e]));
+        }
+    }
+  }
+};
+
+bool writeMatrixMarket(iu::SparseMatrixCpu<float>* A, const std::string& filename)
+{
+  if (A == 0 || A->value() == 0)
+    throw IuException("input data not valid", __FILE__, __FUNCTION__, __LINE__);
+  if (A->sparseFormat() != CSR && A->sparseFormat() != CSC)
+    throw IuException("only CSR and CSC matrices can be written", __FILE__, __FUNCTION__, __LINE__);
+  const bool csr = (A->sparseFormat() == CSR);
+  const int n_major = csr ? A->n_row() : A->n_col();
+
+  FILE* file = fopen(filename.c_str(), "wb");
+  if (file == 0)
+    return false;
+  bool ok = fprintf(file, "%%%%MatrixMarket matrix coordinate real general\n%d %d %d\n",
+                    A->n_row(), A->n_col(), A->n_elements()) > 0;
+
+  // format blocks of chunks in parallel and write them in order
+  const int n_chunks = std::max(1, std::min(n_major, A->n_elements() / 65536));
+  const int batch = 8*iu::Executor::numThreads();
+  MatrixMarketFormat format = {(csr ? A->row() : A->col())->data(), (csr ? A->col() : A->row())->data(),
+                               A->value()->data(), csr, n_major, n_chunks, 0};
+  for (int c=0; c<n_chunks && ok; c+=batch)
+  {
+    const int c_end = std::min(n_chunks, c + batch);
+    std::vector<std::string> text(n_chunks);
+    format.text = &text;
+    iu::parallelFor(c, c_end, format, 1);
+    for (int i=c; i<c_end && ok; ++i)
+      ok = fwrite(text[i].data(), 1, text[i].size(), file) == text[i].size();
+  }
+  return (fclose(file) == 0) && ok;
+}
+
+/* ***************************************************************************
+ *  Binary CSR/CSC
+ * ***************************************************************************/
+// Little endian, all arrays 64 byte aligned so that they can be used in place:
+//   header | pointer array (int32) | minor indices (int32) | values (float32)
+
+struct SparseBinaryHeader
+{
+  char magic[8];           // "IUSPARSE"
+  uint32_t byte_order;     // 0x01020304 in the byte order of the writer
+  uint32_t version;        // 1
+  int32_t sformat;         // CSR or CSC
+  int32_t value_size;      // sizeof(float)
+  int64_t n_row;
+  int64_t n_col;
+  int64_t n_elements;
+  uint64_t ptr_offset;
+  uint64_t ind_offset;
+  uint64_t value_offset;
+};
+
+static const char SPARSE_BINARY_MAGIC[8] = {'I', 'U', 'S', 'P', 'A', 'R', 'S', 'E'};
+static const uint32_t SPARSE_BINARY_BYTE_ORDER = 0x01020304;
+static const uint64_t SPARSE_BINARY_ALIGNMENT = 64;
+
+static inline uint64_t alignOffset(uint64_t offset)
+{
+  return (offset + SPARSE_BINARY_ALIGNMENT-1) / SPARSE_BINARY_ALIGNMENT * SPARSE_BINARY_ALIGNMENT;
+}
+
+// true if [offset, offset+bytes) lies in a file of the given size (without overflow)
+static inline bool inFile(uint64_t offset, uint64_t bytes, uint64_t size)
+{
+  return offset <= size && bytes <= size - offset;
+}
+
+// Checks blocks of majors: the pointer array has to be non-decreasing within
+// [0, n_elements] and every minor index has to lie in [0, n_minor)
+struct SparseBinaryCheck
+{
+  const int* ptr;
+  const int* ind;
+  int n_major;
+  int n_minor;
+  int n_elements;
+  int block_majors;
+  char* invalid;               // per block
+
+  void operator()(int begin, int end) const
+  {
+    for (int b=begin; b<end; ++b)
+    {
+      const int m_end = std::min(n_major, (b+1)*block_majors);
+      bool ok = true;
+      for (int m=b*block_majors; m<m_end && ok; ++m)
+      {
+        if (ptr[m] < 0 || ptr[m] > ptr[m+1] || ptr[m+1] > n_elements)
+        {
+          ok = false;
+          break;
+        }
+        for (int k=ptr[m]; k<ptr[m+1]; ++k)
+          ok &= (ind[k] >= 0) & (ind[k] < n_minor);
+      }
+      invalid[b] = !ok;
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+iu::SparseMatrixCpu<float>* readSparseBinary(const std::string& filename, bool map_file)
+{
+  SparseFile* file = new SparseFile(filename, map_file);
+  try
+  {
+    SparseBinaryHeader header;
+    if (file->size() < sizeof(header))
+      throw IuException("not a sparse matrix file: " + filename, __FILE__, __FUNCTION__, __LINE__);
+    memcpy(&header, file->data(), sizeof(header));
+    if (memcmp(header.magic, SPARSE_BINARY_MAGIC, sizeof(header.magic)) != 0)
+      throw IuException("not a sparse matrix file: " + filename, __FILE__, __FUNCTION__, __LINE__);
+    if (header.byte_order != SPARSE_BINARY_BYTE_ORDER || header.version != 1 ||
+        header.value_size != sizeof(float) || (header.sformat != CSR && header.sformat != CSC))
+      throw IuException("unsupported sparse matrix file: " + filename, __FILE__, __FUNCTION__, __LINE__);
+
+    const bool csr = (header.sformat == CSR);
+    const int64_t n_major = csr ? header.n_row : header.n_col;
+    const uint64_t ptr_bytes = (uint64_t)(n_major+1)*sizeof(int);
+    const uint64_t ind_bytes = (uint64_t)header.n_elements*sizeof(int);
+    const uint64_t value_bytes = (uint64_t)header.n_elements*sizeof(float);
+    if (header.n_row < 0 || header.n_col < 0 || header.n_elements < 0 ||
+        header.n_row >= 0x7fffffff || header.n_col >= 0x7fffffff || header.n_elements >= 0x7fffffff ||
+        header.ptr_offset % SPARSE_BINARY_ALIGNMENT || header.ind_offset % SPARSE_BINARY_ALIGNMENT ||
+        header.value_offset % SPARSE_BINARY_ALIGNMENT ||
+        header.ptr_offset < sizeof(header) || !inFile(header.ptr_offset, ptr_bytes, file->size()) ||
+        !inFile(header.ind_offset, ind_bytes, file->size()) ||
+        !inFile(header.value_offset, value_bytes, file->size()))
+      throw IuException("corrupt sparse matrix file: " + filename, __FILE__, __FUNCTION__, __LINE__);
+
+    int* ptr = (int*)(file->data() + header.ptr_offset);
+    int* ind = (int*)(file->data() + header.ind_offset);
+    float* value = (float*)(file->data() + header.value_offset);
+    if (ptr[0] != 0 || ptr[n_major] != header.n_elements)
+      throw IuException("corrupt sparse matrix file: " + filename, __FILE__, __FUNCTION__, __LINE__);
+    file->willNeed(header.ptr_offset, file->size() - header.ptr_offset);
+
+    // one parallel pass over the pointer array and the indices
+    const int block_majors = 4096;
+    const int n_blocks = (int)((n_major + block_majors-1) / block_majors);
+    std::vector<char> invalid(n_blocks, 0);
+    SparseBinaryCheck check = {ptr, ind, (int)n_major, (int)(csr ? header.n_col : header.n_row),
+                               (int)header.n_elements, block_majors, n_blocks > 0 ? &invalid[0] : 0};
+    iu::parallelFor(0, n_blocks, check, 1);
+    if (std::find(invalid.begin(), invalid.end(), 1) != invalid.end())
+      throw IuException("corrupt sparse matrix file: " + filename, __FILE__, __FUNCTION__, __LINE__);
+
+    iu::LinearHostMemory<int>* ptr_memory = new iu::LinearHostMemory<int>(ptr, n_major+1, true);
+    iu::LinearHostMemory<int>* ind_memory = new iu::LinearHostMemory<int>(ind, header.n_elements, true);
+    iu::LinearHostMemory<float>* value_memory = new iu::LinearHostMemory<float>(value, header.n_elements, true);
+    if (csr)
+      return new FileSparseMatrixCpu(file, value_memory, ptr_memory, ind_memory,
+                                     (int)header.n_row, (int)header.n_col, CSR);
+    return new FileSparseMatrixCpu(file, value_memory, ind_memory, ptr_memory,
+                                   (int)header.n_row, (int)header.n_col, CSC);
+  }
+  catch (...)
+  {
+    delete file;
+    throw;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool writeSparseBinary(iu::SparseMatrixCpu<float>* A, const std::string& filename)
+{
+  if (A == 0 || A->value() == 0)
+    throw IuException("input data not valid", __FILE__, __FUNCTION__, __LINE__);
+  if (A->sparseFormat() != CSR && A->sparseFormat() != CSC)
+    throw IuException("only CSR and CSC matrices can be written", __FILE__, __FUNCTION__, __LINE__);
+  const bool csr = (A->sparseFormat() == CSR);
+  const int n_major = csr ? A->n_row() : A->n_col();
+
+  SparseBinaryHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, SPARSE_BINARY_MAGIC, sizeof(header.magic));
+  header.byte_order = SPARSE_BINARY_BYTE_ORDER;
+  header.version = 1;
+  header.sformat = A->sparseFormat();
+  header.value_size = sizeof(float);
+  header.n_row = A->n_row();
+  header.n_col = A->n_col();
+  header.n_elements = A->n_elements();
+  header.ptr_offset = alignOffset(sizeof(header));
+  header.ind_offset = alignOffset(header.ptr_offset + (uint64_t)(n_major+1)*sizeof(int));
+  header.value_offset = alignOffset(header.ind_offset + (uint64_t)A->n_elements()*sizeof(int));
+
+  const struct { const void* data; uint64_t offset; uint64_t bytes; } sections[3] = {
+    {(csr ? A->row() : A->col())->data(), header.ptr_offset, (uint64_t)(n_major+1)*sizeof(int)},
+    {(csr ? A->col() : A->row())->data(), header.ind_offset, (uint64_t)A->n_elements()*sizeof(int)},
+    {A->value()->data(), header.value_offset, (uint64_t)A->n_elements()*sizeof(float)}};
+
+  FILE* file = fopen(filename.c_str(), "wb");
+  if (file == 0)
+    return false;
+  static const char zeros[SPARSE_BINARY_ALIGNMENT] = {0};
+  bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+  uint64_t position = sizeof(header);
+  for (int s=0; s<3 && ok; ++s)
+  {
+    ok = fwrite(zeros, 1, sections[s].offset - position, file) == sections[s].offset - position &&
+         fwrite(sections[s].data, 1, sections[s].bytes, file) == sections[s].bytes;
+    position = sections[s].offset + sections[s].bytes;
+  }
+  return (fclose(file) == 0) && ok;
+}
+
+} // namespace iuprivate
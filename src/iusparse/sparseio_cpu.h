@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Sparse
+ * Class       : none
+ * Language    : C++
+ * Description : Definition of the host sparse matrix file io
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+/* ****************************************************************************
+ *  W A R N I N G
+ *  -------------
+ *
+ *  This file is not part of the IU API.  It exists purely as an
+ *  implementation detail.  This header file may change from version to
+ *  version without notice, or even be removed.
+ *
+ *  We mean it.
+ * ****************************************************************************
+ */
+
+#ifndef IUPRIVATE_SPARSEIO_CPU_H
+#define IUPRIVATE_SPARSEIO_CPU_H
+
+#include <string>
+#include <iucore/coredefs.h>
+#include "sparsematrix_cpu.h"
+
+namespace iuprivate {
+
+// host; Matrix Market coordinate files (see iu::readMatrixMarket)
+iu::SparseMatrixCpu<float>* readMatrixMarket(const std::string& filename, IuSparseFormat sformat);
+bool writeMatrixMarket(iu::SparseMatrixCpu<float>* A, const std::string& filename);
+
+// host; binary CSR/CSC files (see iu::readSparseBinary)
+iu::SparseMatrixCpu<float>* readSparseBinary(const std::string& filename, bool map_file);
+bool writeSparseBinary(iu::SparseMatrixCpu<float>* A, const std::string& filename);
+
+} // namespace iuprivate
+
+#endif // IUPRIVATE_SPARSEIO_CPU_H
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Sparse
+ * Class       : none
+ * Language    : C++
+ * Description : Selection of the sparse row kernels by the dispatched instruction set level
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <iucore/cpudispatch.h>
+#include "sparsekernels.h"
+
+namespace iuprivate {
+
+// sparse kernels of every compiled level (sparsekernels_<level>.cpp)
+namespace cpu_generic { void getSparseKernels(SparseKernels& kernels); }
+#ifdef IU_CPU_DISPATCH
+namespace cpu_sse4 { void getSparseKernels(SparseKernels& kernels); }
+namespace cpu_avx2 { void getSparseKernels(SparseKernels& kernels); }
+namespace cpu_avx512 { void getSparseKernels(SparseKernels& kernels); }
+#endif
+
+namespace {
+
+//-----------------------------------------------------------------------------
+// tables of all levels; the level is looked up per call and thus follows
+// iu::CpuDispatch::setLevel
+struct SparseKernelTables
+{
+  SparseKernels kernels[IU_CPU_AVX512+1];
+
+  SparseKernelTables()
+  {
+    cpu_generic::getSparseKernels(kernels[IU_CPU_GENERIC]);
+#ifdef IU_CPU_DISPATCH
+    cpu_sse4::getSparseKernels(kernels[IU_CPU_SSE4]);
+    cpu_avx2::getSparseKernels(kernels[IU_CPU_AVX2]);
+    cpu_avx512::getSparseKernels(kernels[IU_CPU_AVX512]);
+#else
+    for(int l=IU_CPU_SSE4; l<=IU_CPU_AVX512; ++l)
+      kernels[l] = kernels[IU_CPU_GENERIC];
+#endif
+  }
+};
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+const SparseKernels& sparseKernels()
+{
+  static SparseKernelTables tables;
+  return tables.kernels[iu::CpuDispatch::level()];
+}
+
+} // namespace iuprivate
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Sparse
+ * Class       : none
+ * Language    : C++
+ * Description : Row kernels of the host sparse matrix products and solvers
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IUPRIVATE_SPARSEKERNELS_H
+#define IUPRIVATE_SPARSEKERNELS_H
+
+//////////////////////////////////////////////////////////////////////////////
+// DISCLAIMER: the following declarations are internal and may change in any
+// version without notice, or even be removed.
+//////////////////////////////////////////////////////////////////////////////
+
+namespace iuprivate {
+
+/** Row kernels of the sparse module for one instruction set level (compiled
+ * like the core kernels, see iucore/cpukernels.h). All loops run over \a n elements.
+ */
+struct SparseKernels
+{
+  /** sliced ELLPACK SpMV: y[perm[i]] = sum_j value[e]*x[col[e]] for the sorted rows i < n of
+   * slices of c rows; row l of slice s holds the elements e = slice_ptr[s] + j*c + l */
+  void (*spmvSellRows_32f)(const float* value, const int* col, const int* slice_ptr, int c,
+                           const float* x, const int* perm, float* y, int n);
+  /** returns sum a*b (double accumulation; the summation order is the same on every level) */
+  double (*dotRow_32f)(const float* a, const float* b, int n);
+  /** CG update: x += alpha*p, r -= alpha*q, z = dinv*r; sums[0] += r*r, sums[1] += r*z
+   * (without preconditioner dinv and z are 0 and sums[1] += r*r) */
+  void (*cgUpdateRow)(float alpha, const float* p, const float* q, const float* dinv,
+                      float* x, float* r, float* z, double* sums, int n);
+  /** BiCGStab search direction: p = r + beta*(p - omega*v) */
+  void (*bicgstabDirectionRow)(const float* r, const float* v, float beta, float omega, float* p, int n);
+  /** BiCGStab half step: s = r - alpha*v; returns sum s*s */
+  double (*bicgstabHalfStepRow)(const float* r, const float* v, float alpha, float* s, int n);
+  /** BiCGStab update: x += alpha*p + omega*s, r = s - omega*t; sums[0] += r*r, sums[1] += r0*r */
+  void (*bicgstabUpdateRow)(const float* p, const float* s, const float* t, const float* r0,
+                            float alpha, float omega, float* x, float* r, double* sums, int n);
+};
+
+/** Returns the sparse kernels of the level selected by iu::CpuDispatch. */
+const SparseKernels& sparseKernels();
+
+} // namespace iuprivate
+
+#endif // IUPRIVATE_SPARSEKERNELS_H
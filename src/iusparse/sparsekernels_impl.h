@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Sparse
+ * Class       : none
+ * Language    : C++
+ * Description : Row kernels of the sparse module; compiled once per instruction set level
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+// No include guard: this file is included by the sparsekernels_<level>.cpp files,
+// each defining IU_CPU_KERNELS_NAMESPACE and compiled with the target flags of
+// the core kernels of that level (iucore/cpukernels_impl.h).
+
+#ifndef IU_CPU_KERNELS_NAMESPACE
+  #error "IU_CPU_KERNELS_NAMESPACE has to be defined"
+#endif
+
+#include <cstddef>
+#include <iucore/cpukernelsdefs.h>
+#include "sparsekernels.h"
+
+namespace iuprivate {
+namespace IU_CPU_KERNELS_NAMESPACE {
+
+//-----------------------------------------------------------------------------
+template<int C>
+static void spmvSellRowsT(const float* IU_CPU_RESTRICT value, const int* IU_CPU_RESTRICT col,
+                          const int* slice_ptr, const float* IU_CPU_RESTRICT x,
+                          const int* perm, float* IU_CPU_RESTRICT y, int n)
+{
+  for(int s=0; s*C<n; ++s)
+  {
+    float acc[C];
+    for(int l=0; l<C; ++l)
+      acc[l] = 0.0f;
+    const float* v = value + slice_ptr[s];
+    const int* k = col + slice_ptr[s];
+    const int width = (slice_ptr[s+1] - slice_ptr[s]) / C;
+    for(int j=0; j<width; ++j, v+=C, k+=C)
+      for(int l=0; l<C; ++l)
+        acc[l] += v[l]*x[k[l]];
+    const int rows = (n - s*C < C) ? n - s*C : C;
+    for(int l=0; l<rows; ++l)
+      y[perm[s*C + l]] = acc[l];
+  }
+}
+
+static void spmvSellRows_32f(const float* value, const int* col, const int* slice_ptr, int c,
+                             const float* x, const int* perm, float* y, int n)
+{
+  if(c == 4)
+    spmvSellRowsT<4>(value, col, slice_ptr, x, perm, y, n);
+  else if(c == 8)
+    spmvSellRowsT<8>(value, col, slice_ptr, x, perm, y, n);
+  else if(c == 16)
+    spmvSellRowsT<16>(value, col, slice_ptr, x, perm, y, n);
+  else
+  {
+    for(int i=0; i<n; ++i)
+    {
+      const int s = i / c;
+      const int width = (slice_ptr[s+1] - slice_ptr[s]) / c;
+      const int e = slice_ptr[s] + i%c;
+      float acc = 0.0f;
+      for(int j=0; j<width; ++j)
+        acc += value[e + j*c]*x[col[e + j*c]];
+      y[perm[i]] = acc;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Reductions keep REDUCE_LANES partial sums that are combined at the end: the
+// lanes vectorize without reassociating and the summation order is fixed.
+enum { REDUCE_LANES = 8 };
+
+static inline double reduceLanes(const double* acc)
+{
+  return ((acc[0] + acc[1]) + (acc[2] + acc[3])) + ((acc[4] + acc[5]) + (acc[6] + acc[7]));
+}
+
+static double dotRow_32f(const float* IU_CPU_RESTRICT a, const float* IU_CPU_RESTRICT b, int n)
+{
+  double acc[REDUCE_LANES] = {0.0};
+  int x = 0;
+  for(; x+REDUCE_LANES<=n; x+=REDUCE_LANES)
+    for(int l=0; l<REDUCE_LANES; ++l)
+      acc[l] += (double)a[x+l]*(double)b[x+l];
+  for(int l=0; x<n; ++x, ++l)
+    acc[l] += (double)a[x]*(double)b[x];
+  return reduceLanes(acc);
+}
+
+static void cgUpdateRow(float alpha, const float* IU_CPU_RESTRICT p, const float* IU_CPU_RESTRICT q,
+                        const float* IU_CPU_RESTRICT dinv, float* IU_CPU_RESTRICT x,
+                        float* IU_CPU_RESTRICT r, float* IU_CPU_RESTRICT z, double* sums, int n)
+{
+  double rr[REDUCE_LANES] = {0.0};
+  double rz[REDUCE_LANES] = {0.0};
+  int i = 0;
+  if(dinv == 0)
+  {
+    for(; i+REDUCE_LANES<=n; i+=REDUCE_LANES)
+      for(int l=0; l<REDUCE_LANES; ++l)
+      {
+        x[i+l] += alpha*p[i+l];
+        const float ri = r[i+l] - alpha*q[i+l];
+        r[i+l] = ri;
+        rr[l] += (double)ri*(double)ri;
+      }
+    for(int l=0; i<n; ++i, ++l)
+    {
+      x[i] += alpha*p[i];
+      r[i] -= alpha*q[i];
+      rr[l] += (double)r[i]*(double)r[i];
+    }
+    sums[0] += reduceLanes(rr);
+    sums[1] += reduceLanes(rr);
+    return;
+  }
+  for(; i+REDUCE_LANES<=n; i+=REDUCE_LANES)
+    for(int l=0; l<REDUCE_LANES; ++l)
+    {
+      x[i+l] += alpha*p[i+l];
+      const float ri = r[i+l] - alpha*q[i+l];
+      const float zi = dinv[i+l]*ri;
+      r[i+l] = ri;
+      z[i+l] = zi;
+      rr[l] += (double)ri*(double)ri;
+      rz[l] += (double)ri*(double)zi;
+    }
+  for(int l=0; i<n; ++i, ++l)
+  {
+    x[i] += alpha*p[i];
+    r[i] -= alpha*q[i];
+    z[i] = dinv[i]*r[i];
+    rr[l] += (double)r[i]*(double)r[i];
+    rz[l] += (double)r[i]*(double)z[i];
+  }
+  sums[0] += reduceLanes(rr);
+  sums[1] += reduceLanes(rz);
+}
+
+static void bicgstabDirectionRow(const float* IU_CPU_RESTRICT r, const float* IU_CPU_RESTRICT v,
+                                 float beta, float omega, float* IU_CPU_RESTRICT p, int n)
+{
+  for(int x=0; x<n; ++x)
+    p[x] = r[x] + beta*(p[x] - omega*v[x]);
+}
+
+static double bicgstabHalfStepRow(const float* IU_CPU_RESTRICT r, const float* IU_CPU_RESTRICT v,
+                                  float alpha, float* IU_CPU_RESTRICT s, int n)
+{
+  double ss[REDUCE_LANES] = {0.0};
+  int x = 0;
+  for(; x+REDUCE_LANES<=n; x+=REDUCE_LANES)
+    for(int l=0; l<REDUCE_LANES; ++l)
+    {
+      const float si = r[x+l] - alpha*v[x+l];
+      s[x+l] = si;
+      ss[l] += (double)si*(double)si;
+    }
+  for(int l=0; x<n; ++x, ++l)
+  {
+    s[x] = r[x] - alpha*v[x];
+    ss[l] += (double)s[x]*(double)s[x];
+  }
+  return reduceLanes(ss);
+}
+
+static void bicgstabUpdateRow(const float* IU_CPU_RESTRICT p, const float* IU_CPU_RESTRICT s,
+                              const float* IU_CPU_RESTRICT t, const float* IU_CPU_RESTRICT r0,
+                              float alpha, float omega, float* IU_CPU_RESTRICT x,
+                              float* IU_CPU_RESTRICT r, double* sums, int n)
+{
+  double rr[REDUCE_LANES] = {0.0};
+  double r0r[REDUCE_LANES] = {0.0};
+  int i = 0;
+  for(; i+REDUCE_LANES<=n; i+=REDUCE_LANES)
+    for(int l=0; l<REDUCE_LANES; ++l)
+    {
+      x[i+l] += alpha*p[i+l] + omega*s[i+l];
+      const float ri = s[i+l] - omega*t[i+l];
+      r[i+l] = ri;
+      rr[l] += (double)ri*(double)ri;
+      r0r[l] += (double)r0[i+l]*(double)ri;
+    }
+  for(int l=0; i<n; ++i, ++l)
+  {
+    x[i] += alpha*p[i] + omega*s[i];
+    r[i] = s[i] - omega*t[i];
+    rr[l] += (double)r[i]*(double)r[i];
+    r0r[l] += (double)r0[i]*(double)r[i];
+  }
+  sums[0] += reduceLanes(rr);
+  sums[1] += reduceLanes(r0r);
+}
+
+//-----------------------------------------------------------------------------
+void getSparseKernels(SparseKernels& kernels)
+{
+  kernels.spmvSellRows_32f = spmvSellRows_32f;
+  kernels.dotRow_32f = dotRow_32f;
+  kernels.cgUpdateRow = cgUpdateRow;
+  kernels.bicgstabDirectionRow = bicgstabDirectionRow;
+  kernels.bicgstabHalfStepRow = bicgstabHalfStepRow;
+  kernels.bicgstabUpdateRow = bicgstabUpdateRow;
+}
+
+} // namespace IU_CPU_KERNELS_NAMESPACE
+} // namespace iuprivate
@@ -29,6 +29,7 @@
 #include <cstdlib>
 
 #include <iucore/linearhostmemory.h>
+#include "sparseconvert_cpu.h"
 
 namespace iu {
 
@@ -38,7 +39,8 @@ class SparseMatrixCpu
 public:
   SparseMatrixCpu() :
       n_row_(0), n_col_(0), n_elements_(0),
-      value_(0), row_(0), col_(0), sformat_(CSR), ext_data_pointer_(false)
+      value_(0), row_(0), col_(0), slice_ptr_(0), slice_height_(0),
+      sformat_(CSR), ext_data_pointer_(false)
   {
   }
 
@@ -59,14 +61,22 @@ public:
       delete col_;
       col_ = 0;
     }
+    if((!ext_data_pointer_) && (slice_ptr_!=NULL))
+    {
+      delete slice_ptr_;
+      slice_ptr_ = 0;
+    }
   }
 
   SparseMatrixCpu(LinearHostMemory<PixelType>* value, LinearHostMemory<int>* row,
                   LinearHostMemory<int>* col, int n_row, int n_col,
                   IuSparseFormat sformat, bool ext_data_pointer = false) :
      n_row_(n_row), n_col_(n_col), n_elements_(0),
-     value_(0), row_(0), col_(0), sformat_(sformat), ext_data_pointer_(ext_data_pointer)
+     value_(0), row_(0), col_(0), slice_ptr_(0), slice_height_(0),
+     sformat_(sformat), ext_data_pointer_(ext_data_pointer)
   {
+    if(sformat_ == SELL)
+      throw IuException("SELL matrices are created with changeSparseFormat", __FILE__, __FUNCTION__, __LINE__);
     if(ext_data_pointer_)
     {
       // This uses the external memory as internal one.
@@ -103,6 +113,20 @@ public:
     return reinterpret_cast<const LinearHostMemory<int>*>(col_);
   }
 
+  /** SELL: first stored element of every slice (number of slices + 1 elements). */
+  const LinearHostMemory<int>* slicePtr() const
+  {
+    return reinterpret_cast<const LinearHostMemory<int>*>(slice_ptr_);
+  }
+
+  /** SELL: number of rows per slice (C). */
+  int sliceHeight()
+  {
+    return slice_height_;
+  }
+
+  /** Number of non-zero elements. It stays the true count in every format; the stored
+   *  elements of a SELL matrix (including the padding) are value()->length(). */
   int n_elements()
   {
     return n_elements_;
@@ -123,7 +147,107 @@ public:
     return sformat_;
   }
 
+  /** Converts the storage format on the host.
+   *  - CSR <-> CSC by a parallel transposition.
+   *  - CSR/CSC -> SELL (sliced ELLPACK, SELL-C-sigma): the rows are sorted by length within
+   *    windows of \a sorting_scope rows and stored in slices of \a slice_height rows
+   *    (see computeSellLayout). row() then holds the original row of every sorted row,
+   *    col() and value() the padded slices and slicePtr() the start of every slice;
+   *    n_elements() keeps the number of non-zeros. SELL matrices cannot be converted back.
+   * The matrix owns its buffers afterwards.
+   */
+  void changeSparseFormat(IuSparseFormat sformat, int slice_height = 16, int sorting_scope = 256)
+  {
+    if (sformat == sformat_ || value_ == 0)
+      return;
+    if (sformat_ == SELL || (sformat != CSR && sformat != CSC && sformat != SELL))
+      throw IuException("sparse format conversion not supported", __FILE__, __FUNCTION__, __LINE__);
+
+    if (sformat == SELL)
+    {
+      if (sformat_ == CSC)
+        changeSparseFormat(CSR);
+      convertToSell(slice_height, sorting_scope);
+      return;
+    }
+
+    LinearHostMemory<PixelType>* old_value = value_;
+    LinearHostMemory<int>* old_ptr = (sformat_ == CSR) ? row_ : col_;
+    LinearHostMemory<int>* old_ind = (sformat_ == CSR) ? col_ : row_;
+    const int n_minor = (sformat_ == CSR) ? n_col_ : n_row_;
+
+    LinearHostMemory<PixelType>* new_value = new LinearHostMemory<PixelType>(n_elements_);
+    LinearHostMemory<int>* new_ptr = new LinearHostMemory<int>(n_minor+1);
+    LinearHostMemory<int>* new_ind = new LinearHostMemory<int>(n_elements_);
+    try
+    {
+      transposeSparse(old_ptr, old_ind, old_value, n_minor, new_ptr, new_ind, new_value);
+    }
+    catch (...)
+    {
+      delete new_value;
+      delete new_ptr;
+      delete new_ind;
+      throw;
+    }
+
+    if (!ext_data_pointer_)
+    {
+      delete old_value;
+      delete old_ptr;
+      delete old_ind;
+    }
+    ext_data_pointer_ = false;
+
+    value_ = new_value;
+    row_ = (sformat == CSR) ? new_ptr : new_ind;
+    col_ = (sformat == CSR) ? new_ind : new_ptr;
+    sformat_ = sformat;
+  }
+
 protected:
+  /** CSR -> SELL-C-sigma (see changeSparseFormat). */
+  void convertToSell(int slice_height, int sorting_scope)
+  {
+    if (slice_height <= 0)
+      throw IuException("invalid slice height", __FILE__, __FUNCTION__, __LINE__);
+    const int n_slices = (n_row_ + slice_height-1) / slice_height;
+    LinearHostMemory<int>* perm = new LinearHostMemory<int>(n_row_);
+    LinearHostMemory<int>* slice_ptr = new LinearHostMemory<int>(n_slices+1);
+    LinearHostMemory<int>* sell_ind = 0;
+    LinearHostMemory<PixelType>* sell_value = 0;
+    try
+    {
+      const unsigned int n_stored = computeSellLayout(row_, slice_height, sorting_scope, perm, slice_ptr);
+      sell_ind = new LinearHostMemory<int>(n_stored);
+      sell_value = new LinearHostMemory<PixelType>(n_stored);
+      convertSparseToSell(row_, col_, value_, slice_height, perm, slice_ptr, sell_ind, sell_value);
+    }
+    catch (...)
+    {
+      delete perm;
+      delete slice_ptr;
+      delete sell_ind;
+      delete sell_value;
+      throw;
+    }
+
+    if (!ext_data_pointer_)
+    {
+      delete value_;
+      delete row_;
+      delete col_;
+    }
+    ext_data_pointer_ = false;
+
+    value_ = sell_value;
+    row_ = perm;
+    col_ = sell_ind;
+    slice_ptr_ = slice_ptr;
+    slice_height_ = slice_height;
+    sformat_ = SELL;
+    // n_elements_ stays the number of non-zeros; the padded size is value_->length()
+  }
 
 private:
   int n_row_;      /**< Number of rows in the sparse matrix */
@@ -133,6 +257,8 @@ private:
   LinearHostMemory<PixelType>* value_;
   LinearHostMemory<int>* row_;
   LinearHostMemory<int>* col_;
+  LinearHostMemory<int>* slice_ptr_; /**< SELL: first element of every slice */
+  int slice_height_;                 /**< SELL: rows per slice */
 
   IuSparseFormat sformat_;
 
@@ -76,6 +76,8 @@ namespace iu {
     {
       if (input == 0)
         return;
+      if (input->sparseFormat() == SELL)
+        throw IuException("SELL matrices are host only", __FILE__, __FUNCTION__, __LINE__);
 
       // store size
       n_elements_ = input->n_elements();
@@ -6,6 +6,7 @@
 #include "sparsematrix_gpu.h"
 #include "sparsemultiplication.h"
 #include "sparsesum.h"
+#include "sparsesolverdefs.h"
 
 namespace iu {
 
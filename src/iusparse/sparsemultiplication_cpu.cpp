@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Sparse
+ * Class       : none
+ * Language    : C++
+ * Description : Implementation of host sparse matrix-vector multiplications
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <iucore/executor.h>
+#include "sparsekernels.h"
+#include "sparsemultiplication_cpu.h"
+
+namespace iuprivate {
+
+/* ***************************************************************************
+ *  Sparse matrix-vector multiplication
+ * ***************************************************************************/
+// Products that read the input vector for every output element (CSR, SELL and
+// transposed CSC) run in parallel over the output. The scattering products
+// (transposed CSR and SELL, CSC) accumulate serially in storage order, so no
+// result depends on the number of threads. Operators that are applied
+// transposed repeatedly are better kept twice (see iu::transposeSparse).
+
+//-----------------------------------------------------------------------------
+// dst[r] = sum_k value[k]*src[ind[k]] over the entries of every compressed line r
+struct CompressedGatherRows
+{
+  const int* ptr;
+  const int* ind;
+  const float* value;
+  const float* src;
+  float* dst;
+
+  void operator()(int begin, int end) const
+  {
+    for(int r=begin; r<end; ++r)
+    {
+      float acc = 0.0f;
+      for(int k=ptr[r]; k<ptr[r+1]; ++k)
+        acc += value[k]*src[ind[k]];
+      dst[r] = acc;
+    }
+  }
+};
+
+// SELL rows of the slices [begin, end)
+struct SellGatherSlices
+{
+  const float* value;
+  const int* col;
+  const int* slice_ptr;
+  const int* perm;
+  int slice_height;
+  int n_row;
+  const float* src;
+  float* dst;
+
+  void operator()(int begin, int end) const
+  {
+    const int rows = std::min(end*slice_height, n_row) - begin*slice_height;
+    sparseKernels().spmvSellRows_32f(value, col, slice_ptr + begin, slice_height, src,
+                                     perm + begin*slice_height, dst, rows);
+  }
+};
+
+//-----------------------------------------------------------------------------
+// dst[ind[k]] += value[k]*src[r] over the entries of every compressed line r
+static void compressedScatter(const int* ptr, const int* ind, const float* value, int n_major,
+                              const float* src, float* dst, int n_dst)
+{
+  memset(dst, 0, n_dst*sizeof(float));
+  for(int r=0; r<n_major; ++r)
+  {
+    const float s = src[r];
+    for(int k=ptr[r]; k<ptr[r+1]; ++k)
+      dst[ind[k]] += value[k]*s;
+  }
+}
+
+// transposed SELL product (padding entries add zeros)
+static void sellScatter(const float* value, const int* col, const int* slice_ptr, const int* perm,
+                        int slice_height, int n_row, const float* src, float* dst, int n_dst)
+{
+  memset(dst, 0, n_dst*sizeof(float));
+  const int n_slices = (n_row + slice_height-1) / slice_height;
+  for(int s=0; s<n_slices; ++s)
+  {
+    const int rows = std::min(slice_height, n_row - s*slice_height);
+    const int width = (slice_ptr[s+1] - slice_ptr[s]) / slice_height;
+    for(int j=0; j<width; ++j)
+    {
+      const int e = slice_ptr[s] + j*slice_height;
+      for(int l=0; l<rows; ++l)
+        dst[col[e+l]] += value[e+l]*src[perm[s*slice_height + l]];
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+static IuStatus multiply(iu::SparseMatrixCpu<float>* A, const float* src, size_t src_length,
+                         float* dst, size_t dst_length, bool transpose)
+{
+  const int n_in = transpose ? A->n_row() : A->n_col();
+  const int n_out = transpose ? A->n_col() : A->n_row();
+  if (src_length != (size_t)n_in || dst_length != (size_t)n_out)
+  {
+    printf("ERROR in sparseMultiplication: matrix size does not match the vector sizes!\n");
+    return IU_ERROR;
+  }
+  if (A->value() == 0 || A->value()->length() == 0)
+  {
+    memset(dst, 0, n_out*sizeof(float));
+    return IU_NO_ERROR;
+  }
+
+  const float* value = A->value()->data();
+  const int* row = A->row()->data();
+  const int* col = A->col()->data();
+  // work per row from the stored elements (SELL: including the padding)
+  const int n_stored = (int)A->value()->length();
+  const int grain = iu::Executor::rowGrain(std::max(1, n_stored/std::max(1, n_out)));
+
+  switch (A->sparseFormat())
+  {
+  case CSR:
+    if (!transpose)
+    {
+      CompressedGatherRows body = {row, col, value, src, dst};
+      iu::parallelFor(0, n_out, body, grain);
+    }
+    else
+      compressedScatter(row, col, value, A->n_row(), src, dst, n_out);
+    break;
+  case CSC:
+    if (transpose)
+    {
+      CompressedGatherRows body = {col, row, value, src, dst};
+      iu::parallelFor(0, n_out, body, grain);
+    }
+    else
+      compressedScatter(col, row, value, A->n_col(), src, dst, n_out);
+    break;
+  case SELL:
+  {
+    const int c = A->sliceHeight();
+    const int* slice_ptr = A->slicePtr()->data();
+    if (!transpose)
+    {
+      const int n_slices = (n_out + c-1) / c;
+      SellGatherSlices body = {value, col, slice_ptr, row, c, n_out, src, dst};
+      iu::parallelFor(0, n_slices, body,
+                      iu::Executor::rowGrain(std::max(1, slice_ptr[n_slices]/std::max(1, n_slices))));
+    }
+    else
+      sellScatter(value, col, slice_ptr, row, c, A->n_row(), src, dst, n_out);
+    break;
+  }
+  default:
+    printf("ERROR: Sparse matrix format not supported!\n");
+    return IU_ERROR;
+  }
+  return IU_NO_ERROR;
+}
+
+//-----------------------------------------------------------------------------
+// rows per block of the fused products (rounded to whole slices)
+static const int BLOCK_ROWS = 4096;
+
+int sparseBlockRows(iu::SparseMatrixCpu<float>* A)
+{
+  const int c = (A->sparseFormat() == SELL) ? A->sliceHeight() : 1;
+  return (BLOCK_ROWS + c-1) / c * c;
+}
+
+void sparseMultiplyBlock(iu::SparseMatrixCpu<float>* A, const float* src, float* dst,
+                         const float* dot, double* sums, int block)
+{
+  const int rows = sparseBlockRows(A);
+  const int begin = block*rows;
+  const int end = std::min(begin + rows, A->n_row());
+  const float* value = A->value()->data();
+  const int* row = A->row()->data();
+  const int* col = A->col()->data();
+
+  if (A->sparseFormat() == SELL)
+  {
+    const int c = A->sliceHeight();
+    SellGatherSlices body = {value, col, A->slicePtr()->data(), row, c, A->n_row(), src, dst};
+    body(begin/c, (end + c-1)/c);
+    if (sums != 0)
+    {
+      // every sorted row of the block is written by this block
+      double dot_sum = 0.0, sqr_sum = 0.0;
+      for (int i=begin; i<end; ++i)
+      {
+        const double d = dst[row[i]];
+        dot_sum += (double)dot[row[i]]*d;
+        sqr_sum += d*d;
+      }
+      sums[0] = dot_sum;
+      sums[1] = sqr_sum;
+    }
+    return;
+  }
+
+  CompressedGatherRows body = {row, col, value, src, dst};
+  body(begin, end);
+  if (sums != 0)
+  {
+    sums[0] = sparseKernels().dotRow_32f(dot + begin, dst + begin, end-begin);
+    sums[1] = sparseKernels().dotRow_32f(dst + begin, dst + begin, end-begin);
+  }
+}
+
+//-----------------------------------------------------------------------------
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::LinearHostMemory_32f_C1* src,
+                              iu::LinearHostMemory_32f_C1* dst, bool transpose)
+{
+  return multiply(A, src->data(), src->length(), dst->data(), dst->length(), transpose);
+}
+
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* src,
+                              iu::ImageCpu_32f_C1* dst, bool transpose)
+{
+  return multiply(A, src->data(), src->stride()*src->height(),
+                  dst->data(), dst->stride()*dst->height(), transpose);
+}
+
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* src,
+                              iu::ImageCpu_32f_C2* dst, bool transpose)
+{
+  return multiply(A, src->data(), src->stride()*src->height(),
+                  (float*)dst->data(), 2*dst->stride()*dst->height(), transpose);
+}
+
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C2* src,
+                              iu::ImageCpu_32f_C1* dst, bool transpose)
+{
+  return multiply(A, (const float*)src->data(), 2*src->stride()*src->height(),
+                  dst->data(), dst->stride()*dst->height(), transpose);
+}
+
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::VolumeCpu_32f_C1* src,
+                              iu::VolumeCpu_32f_C1* dst, bool transpose)
+{
+  return multiply(A, src->data(), src->slice_stride()*src->depth(),
+                  dst->data(), dst->slice_stride()*dst->depth(), transpose);
+}
+
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* src,
+                              iu::VolumeCpu_32f_C1* dst, bool transpose)
+{
+  return multiply(A, src->data(), src->stride()*src->height(),
+                  dst->data(), dst->slice_stride()*dst->depth(), transpose);
+}
+
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::VolumeCpu_32f_C1* src,
+                              iu::ImageCpu_32f_C1* dst, bool transpose)
+{
+  return multiply(A, src->data(), src->slice_stride()*src->depth(),
+                  dst->data(), dst->stride()*dst->height(), transpose);
+}
+
+} // namespace iuprivate
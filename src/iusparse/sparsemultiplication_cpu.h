@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Sparse
+ * Class       : none
+ * Language    : C++
+ * Description : Definition of host sparse matrix-vector multiplications
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+/* ****************************************************************************
+ *  W A R N I N G
+ *  -------------
+ *
+ *  This file is not part of the IU API.  It exists purely as an
+ *  implementation detail.  This header file may change from version to
+ *  version without notice, or even be removed.
+ *
+ *  We mean it.
+ * ****************************************************************************
+ */
+
+#ifndef IUPRIVATE_SPARSEMULTIPLICATION_CPU_H
+#define IUPRIVATE_SPARSEMULTIPLICATION_CPU_H
+
+#include <iucore/coredefs.h>
+#include <iucore/memorydefs.h>
+#include "sparsematrix_cpu.h"
+
+namespace iuprivate {
+
+/** host; dst = A*src or dst = A^T*src (see iu::sparseMultiplication). The vectors are the
+ * buffers of the operands including the row padding (stride*height elements per image).
+ */
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::LinearHostMemory_32f_C1* src,
+                              iu::LinearHostMemory_32f_C1* dst, bool transpose);
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* src,
+                              iu::ImageCpu_32f_C1* dst, bool transpose);
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* src,
+                              iu::ImageCpu_32f_C2* dst, bool transpose);
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C2* src,
+                              iu::ImageCpu_32f_C1* dst, bool transpose);
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::VolumeCpu_32f_C1* src,
+                              iu::VolumeCpu_32f_C1* dst, bool transpose);
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* src,
+                              iu::VolumeCpu_32f_C1* dst, bool transpose);
+IuStatus sparseMultiplication(iu::SparseMatrixCpu<float>* A, iu::VolumeCpu_32f_C1* src,
+                              iu::ImageCpu_32f_C1* dst, bool transpose);
+
+/** host; rows of the blocks used by sparseMultiplyBlock (a multiple of the SELL slice height). */
+int sparseBlockRows(iu::SparseMatrixCpu<float>* A);
+
+/** host; dst = A*src for the rows of block \a block of a CSR or SELL matrix. If \a sums is
+ * given, sums[0] = sum dot[i]*dst[i] and sums[1] = sum dst[i]*dst[i] over these rows (in a
+ * fixed order). Lets the solvers fuse products and reductions.
+ */
+void sparseMultiplyBlock(iu::SparseMatrixCpu<float>* A, const float* src, float* dst,
+                         const float* dot, double* sums, int block);
+
+} // namespace iuprivate
+
+#endif // IUPRIVATE_SPARSEMULTIPLICATION_CPU_H
@@ -0,0 +1,517 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Sparse
+ * Class       : none
+ * Language    : C++
+ * Description : Implementation of the host iterative sparse solvers
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include <iucore/executor.h>
+#include <iucore/cpukernels.h>
+#include "sparsekernels.h"
+#include "sparsemultiplication_cpu.h"
+#include "sparsesolver_cpu.h"
+
+namespace iuprivate {
+
+/* ***************************************************************************
+ *  Iterative solvers
+ * ***************************************************************************/
+// All vector passes run over the row blocks of sparseMultiplyBlock. Every pass
+// that needs a reduction fuses it with its updates (product and dot product,
+// vector updates and residual norms) and stores one partial sum per block; the
+// partial sums are added up in block order, so the iterates do not depend on
+// the number of threads.
+
+//-----------------------------------------------------------------------------
+// Row range of a block
+struct SolverBlocks
+{
+  int rows;
+  int n;
+
+  int count() const { return (n + rows-1) / rows; }
+  int begin(int block) const { return block*rows; }
+  int length(int block) const { return std::min(rows, n - block*rows); }
+};
+
+static void sumPartials(const std::vector<double>& partial, double* sums)
+{
+  sums[0] = 0.0;
+  sums[1] = 0.0;
+  for (size_t b=0; b<partial.size(); b+=2)
+  {
+    sums[0] += partial[b];
+    sums[1] += partial[b+1];
+  }
+}
+
+//-----------------------------------------------------------------------------
+// dst = A*src; partial[2*block] = sum dot*dst, partial[2*block+1] = sum dst*dst
+struct ProductBlocks
+{
+  iu::SparseMatrixCpu<float>* A;
+  const float* src;
+  float* dst;
+  const float* dot;
+  double* partial;
+
+  void operator()(int begin, int end) const
+  {
+    for (int b=begin; b<end; ++b)
+      sparseMultiplyBlock(A, src, dst, dot, partial ? partial + 2*b : 0, b);
+  }
+};
+
+// r = b - q, z = dinv*r; partial sums r*r and r*z
+struct ResidualBlocks
+{
+  SolverBlocks blocks;
+  const float* b;
+  const float* q;
+  const float* dinv;
+  float* r;
+  float* z;
+  double* partial;
+
+  void operator()(int begin, int end) const
+  {
+    const CpuKernels& k = cpuKernels();
+    const SparseKernels& sk = sparseKernels();
+    for (int i=begin; i<end; ++i)
+    {
+      const int o = blocks.begin(i);
+      const int n = blocks.length(i);
+      k.affineRow(b + o, 1.0f, q + o, -1.0f, 0.0f, r + o, n);
+      if (dinv != 0)
+      {
+        for (int x=0; x<n; ++x)
+          z[o+x] = dinv[o+x]*r[o+x];
+        partial[2*i+1] = sk.dotRow_32f(r + o, z + o, n);
+      }
+      partial[2*i] = sk.dotRow_32f(r + o, r + o, n);
+      if (dinv == 0)
+        partial[2*i+1] = partial[2*i];
+    }
+  }
+};
+
+// d = a*s1 + c*s2 (d may be s2)
+struct AffineBlocks
+{
+  SolverBlocks blocks;
+  const float* s1;
+  float a;
+  const float* s2;
+  float c;
+  float* d;
+
+  void operator()(int begin, int end) const
+  {
+    for (int i=begin; i<end; ++i)
+    {
+      const int o = blocks.begin(i);
+      cpuKernels().affineRow(s1 + o, a, s2 + o, c, 0.0f, d + o, blocks.length(i));
+    }
+  }
+};
+
+// CG: x += alpha*p, r -= alpha*q, z = dinv*r; partial sums r*r and r*z
+struct CgUpdateBlocks
+{
+  SolverBlocks blocks;
+  float alpha;
+  const float* p;
+  const float* q;
+  const float* dinv;
+  float* x;
+  float* r;
+  float* z;
+  double* partial;
+
+  void operator()(int begin, int end) const
+  {
+    for (int i=begin; i<end; ++i)
+    {
+      const int o = blocks.begin(i);
+      partial[2*i] = 0.0;
+      partial[2*i+1] = 0.0;
+      sparseKernels().cgUpdateRow(alpha, p + o, q + o, dinv ? dinv + o : 0, x + o, r + o,
+                                  dinv ? z + o : 0, partial + 2*i, blocks.length(i));
+    }
+  }
+};
+
+// BiCGStab: p = r + beta*(p - omega*v)
+struct BicgstabDirectionBlocks
+{
+  SolverBlocks blocks;
+  const float* r;
+  const float* v;
+  float beta;
+  float omega;
+  float* p;
+
+  void operator()(int begin, int end) const
+  {
+    for (int i=begin; i<end; ++i)
+    {
+      const int o = blocks.begin(i);
+      sparseKernels().bicgstabDirectionRow(r + o, v + o, beta, omega, p + o, blocks.length(i));
+    }
+  }
+};
+
+// BiCGStab: s = r - alpha*v; partial sums s*s
+struct BicgstabHalfStepBlocks
+{
+  SolverBlocks blocks;
+  const float* r;
+  const float* v;
+  float alpha;
+  float* s;
+  double* partial;
+
+  void operator()(int begin, int end) const
+  {
+    for (int i=begin; i<end; ++i)
+    {
+      const int o = blocks.begin(i);
+      partial[2*i] = sparseKernels().bicgstabHalfStepRow(r + o, v + o, alpha, s + o, blocks.length(i));
+      partial[2*i+1] = 0.0;
+    }
+  }
+};
+
+// BiCGStab: x += alpha*p + omega*s, r = s - omega*t; partial sums r*r and r0*r
+struct BicgstabUpdateBlocks
+{
+  SolverBlocks blocks;
+  const float* p;
+  const float* s;
+  const float* t;
+  const float* r0;
+  float alpha;
+  float omega;
+  float* x;
+  float* r;
+  double* partial;
+
+  void operator()(int begin, int end) const
+  {
+    for (int i=begin; i<end; ++i)
+    {
+      const int o = blocks.begin(i);
+      partial[2*i] = 0.0;
+      partial[2*i+1] = 0.0;
+      sparseKernels().bicgstabUpdateRow(p + o, s + o, t + o, r0 + o, alpha, omega, x + o, r + o,
+                                        partial + 2*i, blocks.length(i));
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+// Private CSR copy of a CSC system matrix, released at the end of the solve
+struct SystemCopy
+{
+  iu::SparseMatrixCpu<float>* csr;
+
+  SystemCopy() : csr(0) {}
+  ~SystemCopy() { delete csr; }
+
+private:
+  SystemCopy(const SystemCopy&);
+  SystemCopy& operator=(const SystemCopy&);
+};
+
+// Checks the system and points A to a matrix with row-wise products; a CSC matrix
+// is transposed into \a copy so that the caller's matrix is left untouched
+static SolverBlocks prepareSystem(iu::SparseMatrixCpu<float>*& A, SystemCopy& copy,
+                                  size_t b_length, size_t x_length)
+{
+  if (A == 0 || A->value() == 0)
+    throw IuException("input data not valid", __FILE__, __FUNCTION__, __LINE__);
+  if (A->n_row() != A->n_col())
+    throw IuException("the system matrix has to be square", __FILE__, __FUNCTION__, __LINE__);
+  if (b_length != (size_t)A->n_row() || x_length != (size_t)A->n_row())
+    throw IuException("matrix size does not match the vector sizes", __FILE__, __FUNCTION__, __LINE__);
+  if (A->sparseFormat() == CSC)
+  {
+    // the constructor copies the arrays
+    copy.csr = new iu::SparseMatrixCpu<float>(const_cast<iu::LinearHostMemory<float>*>(A->value()),
+                                              const_cast<iu::LinearHostMemory<int>*>(A->row()),
+                                              const_cast<iu::LinearHostMemory<int>*>(A->col()),
+                                              A->n_row(), A->n_col(), CSC);
+    copy.csr->changeSparseFormat(CSR);
+    A = copy.csr;
+  }
+
+  SolverBlocks blocks = {sparseBlockRows(A), A->n_row()};
+  return blocks;
+}
+
+// inverse diagonal of A (duplicates and padding entries are summed up)
+static void inverseDiagonal(iu::SparseMatrixCpu<float>* A, std::vector<float>& dinv)
+{
+  const int n = A->n_row();
+  const float* value = A->value()->data();
+  const int* row = A->row()->data();
+  const int* col = A->col()->data();
+  std::vector<float> diag(n, 0.0f);
+  if (A->sparseFormat() == SELL)
+  {
+    const int c = A->sliceHeight();
+    const int* slice_ptr = A->slicePtr()->data();
+    for (int i=0; i<n; ++i)
+    {
+      const int s = i / c;
+      const int width = (slice_ptr[s+1] - slice_ptr[s]) / c;
+      for (int j=0, e=slice_ptr[s] + i%c; j<width; ++j, e+=c)
+        if (col[e] == row[i])
+          diag[row[i]] += value[e];
+    }
+  }
+  else
+  {
+    for (int r=0; r<n; ++r)
+      for (int k=row[r]; k<row[r+1]; ++k)
+        if (col[k] == r)
+          diag[r] += value[k];
+  }
+
+  dinv.resize(n);
+  for (int r=0; r<n; ++r)
+  {
+    if (diag[r] == 0.0f)
+      throw IuException("zero on the diagonal (Jacobi preconditioner)", __FILE__, __FUNCTION__, __LINE__);
+    dinv[r] = 1.0f/diag[r];
+  }
+}
+
+//-----------------------------------------------------------------------------
+static int conjugateGradients(iu::SparseMatrixCpu<float>* A, const float* b, float* x,
+                              const SolverBlocks& blocks, int max_iterations, float tolerance,
+                              bool jacobi_preconditioner, iu::SparseSolverCallback* callback)
+{
+  const int n = blocks.n;
+  const int n_blocks = blocks.count();
+  const int grain = std::max(1, iu::Executor::MIN_CHUNK_ELEMENTS / blocks.rows);
+  std::vector<float> r(n), p(n), q(n), z, dinv;
+  std::vector<double> partial(2*n_blocks);
+  double sums[2];
+  if (n == 0)
+    return 0;
+  if (jacobi_preconditioner)
+  {
+    inverseDiagonal(A, dinv);
+    z.resize(n);
+  }
+  const float* dinv_ptr = jacobi_preconditioner ? &dinv[0] : 0;
+  float* z_ptr = jacobi_preconditioner ? &z[0] : &r[0];
+
+  const double b_norm = sqrt(sparseKernels().dotRow_32f(b, b, n));
+  if (b_norm == 0.0)
+  {
+    memset(x, 0, n*sizeof(float));
+    return 0;
+  }
+
+  // r = b - A*x, z = M^-1 r
+  ProductBlocks product = {A, x, &q[0], 0, 0};
+  iu::parallelFor(0, n_blocks, product, grain);
+  ResidualBlocks residual = {blocks, b, &q[0], dinv_ptr, &r[0], z_ptr, &partial[0]};
+  iu::parallelFor(0, n_blocks, residual, grain);
+  sumPartials(partial, sums);
+  if (sqrt(sums[0])/b_norm <= tolerance)
+    return 0;
+  double rz = sums[1];
+  memcpy(&p[0], z_ptr, n*sizeof(float));
+
+  int iteration = 0;
+  while (iteration < max_iterations)
+  {
+    ++iteration;
+
+    // q = A*p with p*q
+    ProductBlocks pq = {A, &p[0], &q[0], &p[0], &partial[0]};
+    iu::parallelFor(0, n_blocks, pq, grain);
+    sumPartials(partial, sums);
+    if (!(sums[0] > 0.0))
+      break; // A is not positive definite (or p vanished)
+    const float alpha = (float)(rz/sums[0]);
+
+    // x += alpha*p, r -= alpha*q, z = M^-1 r with r*r and r*z
+    CgUpdateBlocks update = {blocks, alpha, &p[0], &q[0], dinv_ptr, x, &r[0],
+                             jacobi_preconditioner ? z_ptr : 0, &partial[0]};
+    iu::parallelFor(0, n_blocks, update, grain);
+    sumPartials(partial, sums);
+
+    const float residual_norm = (float)(sqrt(sums[0])/b_norm);
+    if (callback != 0 && !(*callback)(iteration, residual_norm))
+      break;
+    if (residual_norm <= tolerance)
+      break;
+
+    // p = z + beta*p
+    const float beta = (float)(sums[1]/rz);
+    rz = sums[1];
+    AffineBlocks direction = {blocks, z_ptr, 1.0f, &p[0], beta, &p[0]};
+    iu::parallelFor(0, n_blocks, direction, grain);
+  }
+  return iteration;
+}
+
+//-----------------------------------------------------------------------------
+static int biconjugateGradientsStabilized(iu::SparseMatrixCpu<float>* A, const float* b, float* x,
+                                          const SolverBlocks& blocks, int max_iterations,
+                                          float tolerance, iu::SparseSolverCallback* callback)
+{
+  const int n = blocks.n;
+  const int n_blocks = blocks.count();
+  const int grain = std::max(1, iu::Executor::MIN_CHUNK_ELEMENTS / blocks.rows);
+  std::vector<float> r(n), r0(n), p(n), v(n), s(n), t(n);
+  std::vector<double> partial(2*n_blocks);
+  double sums[2];
+  if (n == 0)
+    return 0;
+
+  const double b_norm = sqrt(sparseKernels().dotRow_32f(b, b, n));
+  if (b_norm == 0.0)
+  {
+    memset(x, 0, n*sizeof(float));
+    return 0;
+  }
+
+  // r = r0 = b - A*x
+  ProductBlocks product = {A, x, &v[0], 0, 0};
+  iu::parallelFor(0, n_blocks, product, grain);
+  ResidualBlocks residual = {blocks, b, &v[0], 0, &r[0], 0, &partial[0]};
+  iu::parallelFor(0, n_blocks, residual, grain);
+  sumPartials(partial, sums);
+  if (sqrt(sums[0])/b_norm <= tolerance)
+    return 0;
+  memcpy(&r0[0], &r[0], n*sizeof(float));
+
+  double rho = sums[0];
+  double rho_old = rho;
+  float alpha = 1.0f;
+  float omega = 1.0f;
+  int iteration = 0;
+  while (iteration < max_iterations)
+  {
+    ++iteration;
+
+    // p = r + beta*(p - omega*v)
+    if (iteration == 1)
+      memcpy(&p[0], &r[0], n*sizeof(float));
+    else
+    {
+      BicgstabDirectionBlocks direction = {blocks, &r[0], &v[0], (float)(rho/rho_old*alpha/omega), omega, &p[0]};
+      iu::parallelFor(0, n_blocks, direction, grain);
+    }
+
+    // v = A*p with r0*v
+    ProductBlocks pv = {A, &p[0], &v[0], &r0[0], &partial[0]};
+    iu::parallelFor(0, n_blocks, pv, grain);
+    sumPartials(partial, sums);
+    if (sums[0] == 0.0)
+      break; // breakdown
+    alpha = (float)(rho/sums[0]);
+
+    // s = r - alpha*v with s*s
+    BicgstabHalfStepBlocks half_step = {blocks, &r[0], &v[0], alpha, &s[0], &partial[0]};
+    iu::parallelFor(0, n_blocks, half_step, grain);
+    sumPartials(partial, sums);
+    if (sqrt(sums[0])/b_norm <= tolerance)
+    {
+      AffineBlocks finish = {blocks, &p[0], alpha, x, 1.0f, x};
+      iu::parallelFor(0, n_blocks, finish, grain);
+      if (callback != 0)
+        (*callback)(iteration, (float)(sqrt(sums[0])/b_norm));
+      break;
+    }
+
+    // t = A*s with s*t and t*t
+    ProductBlocks st = {A, &s[0], &t[0], &s[0], &partial[0]};
+    iu::parallelFor(0, n_blocks, st, grain);
+    sumPartials(partial, sums);
+    if (sums[1] == 0.0)
+      break; // breakdown
+    omega = (float)(sums[0]/sums[1]);
+
+    // x += alpha*p + omega*s, r = s - omega*t with r*r and r0*r
+    BicgstabUpdateBlocks update = {blocks, &p[0], &s[0], &t[0], &r0[0], alpha, omega, x, &r[0], &partial[0]};
+    iu::parallelFor(0, n_blocks, update, grain);
+    sumPartials(partial, sums);
+
+    const float residual_norm = (float)(sqrt(sums[0])/b_norm);
+    if (callback != 0 && !(*callback)(iteration, residual_norm))
+      break;
+    if (residual_norm <= tolerance || sums[1] == 0.0 || omega == 0.0f)
+      break;
+    rho_old = rho;
+    rho = sums[1];
+  }
+  return iteration;
+}
+
+//-----------------------------------------------------------------------------
+int solveCG(iu::SparseMatrixCpu<float>* A, iu::LinearHostMemory_32f_C1* b, iu::LinearHostMemory_32f_C1* x,
+            int max_iterations, float tolerance, bool jacobi_preconditioner,
+            iu::SparseSolverCallback* callback)
+{
+  SystemCopy copy;
+  const SolverBlocks blocks = prepareSystem(A, copy, b->length(), x->length());
+  return conjugateGradients(A, b->data(), x->data(), blocks, max_iterations, tolerance,
+                            jacobi_preconditioner, callback);
+}
+
+int solveCG(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* b, iu::ImageCpu_32f_C1* x,
+            int max_iterations, float tolerance, bool jacobi_preconditioner,
+            iu::SparseSolverCallback* callback)
+{
+  SystemCopy copy;
+  const SolverBlocks blocks = prepareSystem(A, copy, b->stride()*b->height(), x->stride()*x->height());
+  return conjugateGradients(A, b->data(), x->data(), blocks, max_iterations, tolerance,
+                            jacobi_preconditioner, callback);
+}
+
+int solveBiCGStab(iu::SparseMatrixCpu<float>* A, iu::LinearHostMemory_32f_C1* b, iu::LinearHostMemory_32f_C1* x,
+                  int max_iterations, float tolerance, iu::SparseSolverCallback* callback)
+{
+  SystemCopy copy;
+  const SolverBlocks blocks = prepareSystem(A, copy, b->length(), x->length());
+  return biconjugateGradientsStabilized(A, b->data(), x->data(), blocks, max_iterations, tolerance,
+                                        callback);
+}
+
+int solveBiCGStab(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* b, iu::ImageCpu_32f_C1* x,
+                  int max_iterations, float tolerance, iu::SparseSolverCallback* callback)
+{
+  SystemCopy copy;
+  const SolverBlocks blocks = prepareSystem(A, copy, b->stride()*b->height(), x->stride()*x->height());
+  return biconjugateGradientsStabilized(A, b->data(), x->data(), blocks, max_iterations, tolerance,
+                                        callback);
+}
+
+} // namespace iuprivate
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Sparse
+ * Class       : none
+ * Language    : C++
+ * Description : Definition of the host iterative sparse solvers
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+/* ****************************************************************************
+ *  W A R N I N G
+ *  -------------
+ *
+ *  This file is not part of the IU API.  It exists purely as an
+ *  implementation detail.  This header file may change from version to
+ *  version without notice, or even be removed.
+ *
+ *  We mean it.
+ * ****************************************************************************
+ */
+
+#ifndef IUPRIVATE_SPARSESOLVER_CPU_H
+#define IUPRIVATE_SPARSESOLVER_CPU_H
+
+#include <iucore/coredefs.h>
+#include <iucore/memorydefs.h>
+#include "sparsematrix_cpu.h"
+#include "sparsesolverdefs.h"
+
+namespace iuprivate {
+
+// host; (Jacobi preconditioned) conjugate gradients (see iu::solveCG)
+int solveCG(iu::SparseMatrixCpu<float>* A, iu::LinearHostMemory_32f_C1* b, iu::LinearHostMemory_32f_C1* x,
+            int max_iterations, float tolerance, bool jacobi_preconditioner,
+            iu::SparseSolverCallback* callback);
+int solveCG(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* b, iu::ImageCpu_32f_C1* x,
+            int max_iterations, float tolerance, bool jacobi_preconditioner,
+            iu::SparseSolverCallback* callback);
+
+// host; BiCGStab (see iu::solveBiCGStab)
+int solveBiCGStab(iu::SparseMatrixCpu<float>* A, iu::LinearHostMemory_32f_C1* b, iu::LinearHostMemory_32f_C1* x,
+                  int max_iterations, float tolerance, iu::SparseSolverCallback* callback);
+int solveBiCGStab(iu::SparseMatrixCpu<float>* A, iu::ImageCpu_32f_C1* b, iu::ImageCpu_32f_C1* x,
+                  int max_iterations, float tolerance, iu::SparseSolverCallback* callback);
+
+} // namespace iuprivate
+
+#endif // IUPRIVATE_SPARSESOLVER_CPU_H
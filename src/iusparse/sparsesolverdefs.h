@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Sparse
+ * Class       : none
+ * Language    : C++
+ * Description : Definitions for the host sparse solvers
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+
+#ifndef IUSPARSE_SPARSESOLVERDEFS_H
+#define IUSPARSE_SPARSESOLVERDEFS_H
+
+namespace iu {
+
+/** \brief Progress callback of the host sparse solvers (see iu::solveCG).
+ *
+ * \code
+ * struct PrintResidual : public iu::SparseSolverCallback
+ * {
+ *   bool operator()(int iteration, float residual)
+ *   { printf("%d: %g\n", iteration, residual); return true; }
+ * };
+ * \endcode
+ */
+class SparseSolverCallback
+{
+public:
+  virtual ~SparseSolverCallback() {}
+
+  /** Called after every iteration with the relative residual |b - Ax|/|b|.
+   * Returning false stops the solver.
+   */
+  virtual bool operator()(int iteration, float residual) = 0;
+};
+
+} // namespace iu
+
+#endif // IUSPARSE_SPARSESOLVERDEFS_H
@@ -26,6 +26,11 @@
 #include "iutransform/reduce.h"
 #include "iutransform/prolongate.h"
 #include "iutransform/remap.h"
+#include "iutransform/transform_cpu.h"
+#include "iutransform/flow_cpu.h"
+#include "iutransform/stereo_cpu.h"
+#include "iutransform/warp_cpu.h"
+#include "iucore/trace.h"
 
 namespace iu {
 
@@ -39,7 +44,22 @@ namespace iu {
 void reduce(const iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C1* dst,
             IuInterpolationType interpolation,
             bool gauss_prefilter, bool bicubic_bspline_prefilter)
-{iuprivate::reduce(src, dst, interpolation, gauss_prefilter, bicubic_bspline_prefilter);}
+{ IU_TRACE_FUNCTION(); iuprivate::reduce(src, dst, interpolation, gauss_prefilter, bicubic_bspline_prefilter);}
+
+void reduce(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+            IuInterpolationType interpolation,
+            bool gauss_prefilter, bool bicubic_bspline_prefilter)
+{ IU_TRACE_FUNCTION(); iuprivate::reduce(src, dst, interpolation, gauss_prefilter, bicubic_bspline_prefilter);}
+
+void reduce(const iu::ImageCpu_32f_C2* src, iu::ImageCpu_32f_C2* dst,
+            IuInterpolationType interpolation,
+            bool gauss_prefilter, bool bicubic_bspline_prefilter)
+{ IU_TRACE_FUNCTION(); iuprivate::reduce(src, dst, interpolation, gauss_prefilter, bicubic_bspline_prefilter);}
+
+void reduce(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+            IuInterpolationType interpolation,
+            bool gauss_prefilter, bool bicubic_bspline_prefilter)
+{ IU_TRACE_FUNCTION(); iuprivate::reduce(src, dst, interpolation, gauss_prefilter, bicubic_bspline_prefilter);}
 
 
 /*
@@ -47,15 +67,27 @@ void reduce(const iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C1* dst,
  */
 void prolongate(const iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C1* dst,
                 IuInterpolationType interpolation)
-{iuprivate::prolongate(src, dst, interpolation);}
+{ IU_TRACE_FUNCTION(); iuprivate::prolongate(src, dst, interpolation);}
 
 void prolongate(const iu::ImageGpu_32f_C2* src, iu::ImageGpu_32f_C2* dst,
                 IuInterpolationType interpolation)
-{iuprivate::prolongate(src, dst, interpolation);}
+{ IU_TRACE_FUNCTION(); iuprivate::prolongate(src, dst, interpolation);}
 
 void prolongate(const iu::ImageGpu_32f_C4* src, iu::ImageGpu_32f_C4* dst,
                 IuInterpolationType interpolation)
-{iuprivate::prolongate(src, dst, interpolation);}
+{ IU_TRACE_FUNCTION(); iuprivate::prolongate(src, dst, interpolation);}
+
+void prolongate(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::prolongate(src, dst, interpolation);}
+
+void prolongate(const iu::ImageCpu_32f_C2* src, iu::ImageCpu_32f_C2* dst,
+                IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::prolongate(src, dst, interpolation);}
+
+void prolongate(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::prolongate(src, dst, interpolation);}
 
 /*
   image remapping (warping)
@@ -64,23 +96,138 @@ void prolongate(const iu::ImageGpu_32f_C4* src, iu::ImageGpu_32f_C4* dst,
 void remap(iu::ImageGpu_8u_C1* src,
            iu::ImageGpu_32f_C1* dx_map, iu::ImageGpu_32f_C1* dy_map,
            iu::ImageGpu_8u_C1* dst, IuInterpolationType interpolation)
-{iuprivate::remap(src, dx_map, dy_map, dst, interpolation);}
+{ IU_TRACE_FUNCTION(); iuprivate::remap(src, dx_map, dy_map, dst, interpolation);}
 
 // 32f_C1
 void remap(iu::ImageGpu_32f_C1* src,
            iu::ImageGpu_32f_C1* dx_map, iu::ImageGpu_32f_C1* dy_map,
            iu::ImageGpu_32f_C1* dst, IuInterpolationType interpolation)
-{iuprivate::remap(src, dx_map, dy_map, dst, interpolation);}
+{ IU_TRACE_FUNCTION(); iuprivate::remap(src, dx_map, dy_map, dst, interpolation);}
+
+// host; 32f_C1
+void remap(const iu::ImageCpu_32f_C1* src,
+           const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+           iu::ImageCpu_32f_C1* dst, IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::remap(src, dx_map, dy_map, dst, interpolation);}
+
+// host; planar 32f_C3
+void remap(const iu::ImagePlanarCpu_32f_C3* src,
+           const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+           iu::ImagePlanarCpu_32f_C3* dst, IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::remap(src, dx_map, dy_map, dst, interpolation);}
+
+// host; planar 32f_C4
+void remap(const iu::ImagePlanarCpu_32f_C4* src,
+           const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+           iu::ImagePlanarCpu_32f_C4* dst, IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::remap(src, dx_map, dy_map, dst, interpolation);}
+
+// host; compact maps
+void convertRemapMaps(const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+                      iu::ImageCpu_16u_C2* coords, iu::ImageCpu_16u_C1* fractions)
+{ IU_TRACE_FUNCTION(); iuprivate::convertRemapMaps(dx_map, dy_map, coords, fractions);}
+
+// host; 32f_C1; compact maps
+void remap(const iu::ImageCpu_32f_C1* src,
+           const iu::ImageCpu_16u_C2* coords, const iu::ImageCpu_16u_C1* fractions,
+           iu::ImageCpu_32f_C1* dst, IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::remap(src, coords, fractions, dst, interpolation);}
+
+// host; planar 32f_C3; compact maps
+void remap(const iu::ImagePlanarCpu_32f_C3* src,
+           const iu::ImageCpu_16u_C2* coords, const iu::ImageCpu_16u_C1* fractions,
+           iu::ImagePlanarCpu_32f_C3* dst, IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::remap(src, coords, fractions, dst, interpolation);}
+
+// host; planar 32f_C4; compact maps
+void remap(const iu::ImagePlanarCpu_32f_C4* src,
+           const iu::ImageCpu_16u_C2* coords, const iu::ImageCpu_16u_C1* fractions,
+           iu::ImagePlanarCpu_32f_C4* dst, IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::remap(src, coords, fractions, dst, interpolation);}
+
+
+/*
+  affine and perspective warps
+ */
+// host; affine
+void warpAffine(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                const float coeffs[6], IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::warpAffine(src, dst, coeffs, interpolation);}
+void warpAffine(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                const float coeffs[6], IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::warpAffine(src, dst, coeffs, interpolation);}
+void warpAffine(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                const float coeffs[6], IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::warpAffine(src, dst, coeffs, interpolation);}
+void warpAffine(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                const float coeffs[6], IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::warpAffine(src, dst, coeffs, interpolation);}
+
+// host; perspective
+void warpPerspective(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                     const float coeffs[9], IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::warpPerspective(src, dst, coeffs, interpolation);}
+void warpPerspective(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                     const float coeffs[9], IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::warpPerspective(src, dst, coeffs, interpolation);}
+void warpPerspective(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                     const float coeffs[9], IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::warpPerspective(src, dst, coeffs, interpolation);}
+void warpPerspective(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                     const float coeffs[9], IuInterpolationType interpolation)
+{ IU_TRACE_FUNCTION(); iuprivate::warpPerspective(src, dst, coeffs, interpolation);}
+
+/*
+  optical flow
+ */
+// host; TV-L1
+void opticalFlowTVL1(const iu::ImageCpu_32f_C1* i0, const iu::ImageCpu_32f_C1* i1,
+                     iu::ImageCpu_32f_C2* flow, float lambda, float theta,
+                     unsigned int num_levels, float scale_factor,
+                     unsigned int num_warps, unsigned int num_iterations)
+{ IU_TRACE_FUNCTION(); iuprivate::opticalFlowTVL1(i0, i1, flow, lambda, theta, num_levels, scale_factor,
+                                                  num_warps, num_iterations);}
+
+
+/*
+  stereo matching
+ */
+// host; cost volumes
+void stereoCostVolume(const iu::ImageCpu_8u_C1* left, const iu::ImageCpu_8u_C1* right,
+                      iu::VolumeCpu_8u_C1* costs, IuStereoCost cost, unsigned int radius)
+{ IU_TRACE_FUNCTION(); iuprivate::stereoCostVolume(left, right, costs, cost, radius);}
+void stereoCostVolume(const iu::ImageCpu_8u_C1* left, const iu::ImageCpu_8u_C1* right,
+                      iu::VolumeCpu_16u_C1* costs, IuStereoCost cost, unsigned int radius)
+{ IU_TRACE_FUNCTION(); iuprivate::stereoCostVolume(left, right, costs, cost, radius);}
+void stereoCostVolume(const iu::ImageCpu_32f_C1* left, const iu::ImageCpu_32f_C1* right,
+                      iu::VolumeCpu_8u_C1* costs, IuStereoCost cost, unsigned int radius)
+{ IU_TRACE_FUNCTION(); iuprivate::stereoCostVolume(left, right, costs, cost, radius);}
+void stereoCostVolume(const iu::ImageCpu_32f_C1* left, const iu::ImageCpu_32f_C1* right,
+                      iu::VolumeCpu_16u_C1* costs, IuStereoCost cost, unsigned int radius)
+{ IU_TRACE_FUNCTION(); iuprivate::stereoCostVolume(left, right, costs, cost, radius);}
+
+// host; semi-global matching
+void stereoAggregateSGM(const iu::VolumeCpu_8u_C1* costs, iu::VolumeCpu_16u_C1* aggregated,
+                        unsigned int p1, unsigned int p2, unsigned int num_paths)
+{ IU_TRACE_FUNCTION(); iuprivate::stereoAggregateSGM(costs, aggregated, p1, p2, num_paths);}
+void stereoAggregateSGM(const iu::VolumeCpu_16u_C1* costs, iu::VolumeCpu_16u_C1* aggregated,
+                        unsigned int p1, unsigned int p2, unsigned int num_paths)
+{ IU_TRACE_FUNCTION(); iuprivate::stereoAggregateSGM(costs, aggregated, p1, p2, num_paths);}
+
+// host; winner-takes-all
+void stereoDisparityWTA(const iu::VolumeCpu_16u_C1* costs, iu::ImageCpu_32f_C1* disparities,
+                        bool subpixel, float uniqueness)
+{ IU_TRACE_FUNCTION(); iuprivate::stereoDisparityWTA(costs, disparities, subpixel, uniqueness);}
 
 
 //IuStatus remap(iu::ImageGpu_32f_C2* src,
 //           iu::ImageGpu_32f_C1* dx_map, iu::ImageGpu_32f_C1* dy_map,
 //           iu::ImageGpu_32f_C2* dst, IuInterpolationType interpolation)
-//{return iuprivate::remap(src, dx_map, dy_map, dst, interpolation);}
+//{ IU_TRACE_FUNCTION(); return iuprivate::remap(src, dx_map, dy_map, dst, interpolation);}
 
 //IuStatus remap(iu::ImageGpu_32f_C4* src,
 //           iu::ImageGpu_32f_C1* dx_map, iu::ImageGpu_32f_C1* dy_map,
 //           iu::ImageGpu_32f_C4* dst, IuInterpolationType interpolation)
-//{return iuprivate::remap(src, dx_map, dy_map, dst, interpolation);}
+//{ IU_TRACE_FUNCTION(); return iuprivate::remap(src, dx_map, dy_map, dst, interpolation);}
 
 } // namespace iu
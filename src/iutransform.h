@@ -62,6 +62,28 @@ IUCORE_DLLAPI void reduce(const iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C1* d
                       IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR,
                       bool gauss_prefilter = true, bool bicubic_bspline_prefilter = false);
 
+/** Image reduction on the host.
+ * \brief Scaling the image \a src down to the size of \a dst.
+ * \param[in] src Source image [host]
+ * \param[out] dst Destination image [host]
+ * \param[in] interpolation The type of interpolation used for scaling down the image.
+ * \param[in] gauss_prefilter Toggles gauss prefiltering. The sigma and kernel size is chosen dependent on the scale factor.
+ * \param[in] bicubic_bspline_prefilter Only reasonable for cubic (spline) interpolation.
+ *
+ * \note The gaussian prefilter is fused into the separable resampling weights, i.e. no temporary
+ *       filtered image is created. IU_INTERPOLATE_CUBIC and IU_INTERPOLATE_CUBIC_SPLINE both sample
+ *       with the cubic bspline basis (as the device versions).
+ */
+IUCORE_DLLAPI void reduce(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                          IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR,
+                          bool gauss_prefilter = true, bool bicubic_bspline_prefilter = false);
+IUCORE_DLLAPI void reduce(const iu::ImageCpu_32f_C2* src, iu::ImageCpu_32f_C2* dst,
+                          IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR,
+                          bool gauss_prefilter = true, bool bicubic_bspline_prefilter = false);
+IUCORE_DLLAPI void reduce(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                          IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR,
+                          bool gauss_prefilter = true, bool bicubic_bspline_prefilter = false);
+
 /** Image prolongation.
  * \brief Scaling the image \a src up to the size of \a dst.
  * \param[in] src Source image [device]
@@ -78,6 +100,19 @@ IUCORE_DLLAPI void prolongate(const iu::ImageGpu_32f_C2* src, iu::ImageGpu_32f_C
 IUCORE_DLLAPI void prolongate(const iu::ImageGpu_32f_C4* src, iu::ImageGpu_32f_C4* dst,
                           IuInterpolationType interpolation = IU_INTERPOLATE_NEAREST);
 
+/** Image prolongation on the host.
+ * \brief Scaling the image \a src up to the size of \a dst.
+ * \param[in] src Source image [host]
+ * \param[out] dst Destination image [host]
+ * \param[in] interpolation The type of interpolation used for scaling up the image.
+ */
+IUCORE_DLLAPI void prolongate(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                              IuInterpolationType interpolation = IU_INTERPOLATE_NEAREST);
+IUCORE_DLLAPI void prolongate(const iu::ImageCpu_32f_C2* src, iu::ImageCpu_32f_C2* dst,
+                              IuInterpolationType interpolation = IU_INTERPOLATE_NEAREST);
+IUCORE_DLLAPI void prolongate(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                              IuInterpolationType interpolation = IU_INTERPOLATE_NEAREST);
+
 /** Image remapping (warping).
  * \brief Remapping the image \a src with the given disparity fields dx, dy.
  * \param[in] src Source image [device]
@@ -97,6 +132,55 @@ IUCORE_DLLAPI void remap(iu::ImageGpu_32f_C1* src,
                      iu::ImageGpu_32f_C1* dx_map, iu::ImageGpu_32f_C1* dy_map,
                      iu::ImageGpu_32f_C1* dst,
                      IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
+
+/** Host image remapping (warping); see the device version above.
+ * Color images are remapped in the planar layout: the sample positions are computed
+ * once per pixel and reused for every channel plane. The maps have to be of the size of
+ * \a dst (IuException otherwise).
+ */
+IUCORE_DLLAPI void remap(const iu::ImageCpu_32f_C1* src,
+                     const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+                     iu::ImageCpu_32f_C1* dst,
+                     IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
+IUCORE_DLLAPI void remap(const iu::ImagePlanarCpu_32f_C3* src,
+                     const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+                     iu::ImagePlanarCpu_32f_C3* dst,
+                     IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
+IUCORE_DLLAPI void remap(const iu::ImagePlanarCpu_32f_C4* src,
+                     const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+                     iu::ImagePlanarCpu_32f_C4* dst,
+                     IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
+
+/** Compact maps for repeated host remapping with the same disparities (e.g. rectification).
+ * \brief Converts the disparities into integer texture coordinates (16 bits per axis) and
+ * fractions quantized to 1/32 pixel (5 bits per axis) which index precomputed weight tables.
+ * The compact maps need 6 instead of 8 bytes per pixel and save the computation of the
+ * taps; they can be used with every interpolation type and every source image size.
+ * \param[in] dx_map Disparities (dense) in x direction [host]
+ * \param[in] dy_map Disparities (dense) in y direction [host]
+ * \param[out] coords Integer coordinates [host] of the size of the maps
+ * \param[out] fractions Fractions [host] of the size of the maps
+ */
+IUCORE_DLLAPI void convertRemapMaps(const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+                                    iu::ImageCpu_16u_C2* coords, iu::ImageCpu_16u_C1* fractions);
+
+/** Host image remapping with compact maps (see convertRemapMaps).
+ * Same sampling as the remapping with the float disparities up to the quantization
+ * of the sample positions to 1/32 pixel.
+ */
+IUCORE_DLLAPI void remap(const iu::ImageCpu_32f_C1* src,
+                     const iu::ImageCpu_16u_C2* coords, const iu::ImageCpu_16u_C1* fractions,
+                     iu::ImageCpu_32f_C1* dst,
+                     IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
+IUCORE_DLLAPI void remap(const iu::ImagePlanarCpu_32f_C3* src,
+                     const iu::ImageCpu_16u_C2* coords, const iu::ImageCpu_16u_C1* fractions,
+                     iu::ImagePlanarCpu_32f_C3* dst,
+                     IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
+IUCORE_DLLAPI void remap(const iu::ImagePlanarCpu_32f_C4* src,
+                     const iu::ImageCpu_16u_C2* coords, const iu::ImageCpu_16u_C1* fractions,
+                     iu::ImagePlanarCpu_32f_C4* dst,
+                     IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
+
 //IUCORE_DLLAPI IuStatus remap(iu::ImageGpu_32f_C2* src,
 //                     iu::ImageGpu_32f_C1* dx_map, iu::ImageGpu_32f_C1* dy_map,
 //                     iu::ImageGpu_32f_C2* dst,
@@ -107,9 +191,144 @@ IUCORE_DLLAPI void remap(iu::ImageGpu_32f_C1* src,
 //                     IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
 
 
+/** Affine warp on the host.
+ * \brief dst(x,y) = src(c[0]*x + c[1]*y + c[2], c[3]*x + c[4]*y + c[5]), i.e. \a coeffs maps the
+ * destination pixel coordinates to the source pixel coordinates (pixel centers at integer
+ * positions). Pixels that map outside of the source image are set to 0; the samples near the
+ * border use clamped taps. The source positions are generated per row, no maps are stored.
+ * \param[in] src Source image [host]
+ * \param[out] dst Destination image [host]
+ * \param[in] coeffs The 2x3 transformation (row-major).
+ * \param[in] interpolation Nearest, linear or cubic bspline (IU_INTERPOLATE_CUBIC and
+ *                          IU_INTERPOLATE_CUBIC_SPLINE, see cubicBSplinePrefilter) sampling.
+ */
+IUCORE_DLLAPI void warpAffine(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                              const float coeffs[6], IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
+IUCORE_DLLAPI void warpAffine(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                              const float coeffs[6], IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
+IUCORE_DLLAPI void warpAffine(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                              const float coeffs[6], IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
+IUCORE_DLLAPI void warpAffine(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                              const float coeffs[6], IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
+
+/** Perspective warp on the host.
+ * \brief dst(x,y) = src(X/W, Y/W) with (X,Y,W) = H*(x,y,1); see warpAffine. Pixels with W <= 0
+ * are set to 0.
+ * \param[in] coeffs The 3x3 homography H (row-major) from destination to source pixel coordinates.
+ */
+IUCORE_DLLAPI void warpPerspective(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                                   const float coeffs[9], IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
+IUCORE_DLLAPI void warpPerspective(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                                   const float coeffs[9], IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
+IUCORE_DLLAPI void warpPerspective(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                                   const float coeffs[9], IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
+IUCORE_DLLAPI void warpPerspective(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                                   const float coeffs[9], IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR);
+
 /** @} */ // end of Image Transformations
 
 
+//////////////////////////////////////////////////////////////////////////////
+/* ***************************************************************************
+     Optical flow
+ * ***************************************************************************/
+/** @defgroup Optical Flow
+ *  @ingroup Geometric Transformation
+ *  @{
+ */
+
+/** TV-L1 optical flow on the host.
+ * \brief Estimates the dense flow from \a i0 to \a i1, i.e. i1(x+flow(x)) ~ i0(x), by
+ * minimizing the L1 data term plus the total variation of both flow components
+ * (Zach et al., "A duality based approach for realtime TV-L1 optical flow", 2007).
+ * The images are processed coarse-to-fine on an image pyramid (host reduce); on every
+ * level i1 and its derivatives are warped (host remap) \a num_warps times and the
+ * linearized energy is minimized with \a num_iterations primal-dual iterations.
+ * Several iterations are fused per cache-sized tile and the tiles run in parallel.
+ * \param[in] i0 First image [host]; intensities in [0,1].
+ * \param[in] i1 Second image [host] of the same size.
+ * \param[out] flow Flow field (u,v) in pixels [host] of the size of the images.
+ * \param[in] lambda Weight of the data term; smaller values give smoother flow fields.
+ * \param[in] theta Coupling of the thresholding and the TV step.
+ * \param[in] num_levels Maximal number of pyramid levels (the coarsest level is at least 16 pixels).
+ * \param[in] scale_factor Scale factor between two pyramid levels in ]0,1[.
+ * \param[in] num_warps Number of warps per level.
+ * \param[in] num_iterations Number of iterations per warp.
+ */
+IUCORE_DLLAPI void opticalFlowTVL1(const iu::ImageCpu_32f_C1* i0, const iu::ImageCpu_32f_C1* i1,
+                                   iu::ImageCpu_32f_C2* flow, float lambda = 40.0f, float theta = 0.3f,
+                                   unsigned int num_levels = 5, float scale_factor = 0.5f,
+                                   unsigned int num_warps = 5, unsigned int num_iterations = 30);
+
+/** @} */ // end of Optical Flow
+
+
+//////////////////////////////////////////////////////////////////////////////
+/* ***************************************************************************
+     Stereo matching
+ * ***************************************************************************/
+/** @defgroup Stereo Matching
+ *  @ingroup Geometric Transformation
+ *  @{
+ */
+
+/** Matching costs of a rectified stereo pair on the host.
+ * \brief Computes the costs of matching the left pixel (x,y) with the right pixel (x-d,y)
+ * for all disparities d. The volume stores the costs of a pixel contiguously, i.e. it has
+ * the size disparities x width x height and the cost is costs->data(d,x,y). Disparities
+ * beyond the left border of the right image get the maximal cost.
+ * \param[in] left Left (reference) image [host].
+ * \param[in] right Right image [host] of the same size; 32-bit images are expected in [0,1].
+ * \param[out] costs Cost volume [host]; its width defines the number of disparities.
+ * \param[in] cost IU_STEREO_CENSUS: Hamming distances of the census transforms of the
+ *                 (2*radius+1)^2 windows (radius in [1,3]). IU_STEREO_SAD: sum of absolute
+ *                 (8-bit) differences over the (2*radius+1)^2 windows (radius in [0,7]);
+ *                 8-bit volumes store the mean difference.
+ * \param[in] radius Radius of the matching window.
+ */
+IUCORE_DLLAPI void stereoCostVolume(const iu::ImageCpu_8u_C1* left, const iu::ImageCpu_8u_C1* right,
+                                    iu::VolumeCpu_8u_C1* costs, IuStereoCost cost = IU_STEREO_CENSUS,
+                                    unsigned int radius = 3);
+IUCORE_DLLAPI void stereoCostVolume(const iu::ImageCpu_8u_C1* left, const iu::ImageCpu_8u_C1* right,
+                                    iu::VolumeCpu_16u_C1* costs, IuStereoCost cost = IU_STEREO_CENSUS,
+                                    unsigned int radius = 3);
+IUCORE_DLLAPI void stereoCostVolume(const iu::ImageCpu_32f_C1* left, const iu::ImageCpu_32f_C1* right,
+                                    iu::VolumeCpu_8u_C1* costs, IuStereoCost cost = IU_STEREO_CENSUS,
+                                    unsigned int radius = 3);
+IUCORE_DLLAPI void stereoCostVolume(const iu::ImageCpu_32f_C1* left, const iu::ImageCpu_32f_C1* right,
+                                    iu::VolumeCpu_16u_C1* costs, IuStereoCost cost = IU_STEREO_CENSUS,
+                                    unsigned int radius = 3);
+
+/** Semi-global matching on the host.
+ * \brief Aggregates the matching costs along 4 (horizontal, vertical) or 8 (plus
+ * diagonal) paths (Hirschmueller, "Stereo processing by semiglobal matching and mutual
+ * information", 2008). The sums are saturated to 16 bits. The scanlines of every path
+ * direction are processed in parallel.
+ * \param[in] costs Cost volume [host] (see stereoCostVolume).
+ * \param[out] aggregated Aggregated costs [host] of the same size.
+ * \param[in] p1 Penalty of disparity changes by one.
+ * \param[in] p2 Penalty of larger disparity changes.
+ * \param[in] num_paths Number of paths (4 or 8).
+ */
+IUCORE_DLLAPI void stereoAggregateSGM(const iu::VolumeCpu_8u_C1* costs, iu::VolumeCpu_16u_C1* aggregated,
+                                      unsigned int p1 = 10, unsigned int p2 = 120, unsigned int num_paths = 8);
+IUCORE_DLLAPI void stereoAggregateSGM(const iu::VolumeCpu_16u_C1* costs, iu::VolumeCpu_16u_C1* aggregated,
+                                      unsigned int p1 = 10, unsigned int p2 = 120, unsigned int num_paths = 8);
+
+/** Winner-takes-all disparities on the host.
+ * \brief Selects the disparity of minimal cost for every pixel.
+ * \param[in] costs (Aggregated) cost volume [host].
+ * \param[out] disparities Disparity map [host] of the size of the images.
+ * \param[in] subpixel Refines the disparities with a parabola through the neighbouring costs.
+ * \param[in] uniqueness If > 0 pixels are marked invalid (-1) if a disparity that is not a
+ *                       neighbour of the best one has a cost below best*(1+uniqueness).
+ */
+IUCORE_DLLAPI void stereoDisparityWTA(const iu::VolumeCpu_16u_C1* costs, iu::ImageCpu_32f_C1* disparities,
+                                      bool subpixel = true, float uniqueness = 0.0f);
+
+/** @} */ // end of Stereo Matching
+
+
 } // namespace iu
 
 
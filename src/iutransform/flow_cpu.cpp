@@ -0,0 +1,496 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Geometric Transformations
+ * Class       : none
+ * Language    : C++
+ * Description : Implementation of the host TV-L1 optical flow
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include <iucutil.h>
+#include <iucore/executor.h>
+#include <iucore/imagepyramid.h>
+#include <iucore/setvalue.h>
+#include "transformkernels.h"
+#include "prolongate.h"
+#include "transform_cpu.h"
+#include "flow_cpu.h"
+
+namespace iuprivate {
+
+/* ***************************************************************************
+ *  TV-L1 optical flow
+ * ***************************************************************************/
+// Coarse-to-fine TV-L1 flow (Zach, Pock, Bischof 2007) in the formulation of
+// Sanchez, Meinhardt-Llopis, Facciolo (IPOL 2013). On every level I1 and its
+// derivatives are warped with the current flow and the linearized energy is
+// minimized by alternating the pointwise thresholding step, the primal step
+// u = v + theta*div(p) and the dual step of p (both flow components have their
+// own dual variable p = (px, py)).
+//
+// One iteration reads each row of the flow and dual fields once (the dual step
+// of row y-1 follows the primal step of row y). Several iterations are run on
+// a tile before the next one is touched: a tile is copied with a halo of one
+// row/column per iteration (plus one) into a private buffer and only its inner
+// part is written back (into a second set of fields, the neighbours still read
+// the old halo). The tile stays in the L2 cache for all its iterations; more
+// iterations per sweep save memory traffic but recompute larger halos.
+
+static const float TVL1_TAU = 0.25f;
+static const float TVL1_GRAD_IS_ZERO = 1e-10f;
+// shorter side of the coarsest level
+static const unsigned int TVL1_MIN_LEVEL_SIZE = 16;
+// iterations per tile and sweep (the halo of the tiles is one more)
+static const int TVL1_SWEEP_ITERATIONS = 4;
+// maximal width of a tile including its halo
+static const int TVL1_TILE_WIDTH = 256;
+// working set of a tile: flow and dual fields plus the residual, gradient and 1/|gradient|^2
+static const int TVL1_TILE_BYTES = 1024*1024;
+static const int TVL1_TILE_ARRAYS = 10;
+
+enum { U1 = 0, U2, P1X, P1Y, P2X, P2Y, NUM_FIELDS };
+
+//-----------------------------------------------------------------------------
+/** Primal (u1, u2) and dual (p1x, p1y, p2x, p2y) variables of one level. */
+class FlowFields
+{
+public:
+  explicit FlowFields(const IuSize& size) :
+    u1(size), u2(size), p1x(size), p1y(size), p2x(size), p2y(size)
+  {
+  }
+
+  iu::ImageCpu_32f_C1* field(int i)
+  {
+    iu::ImageCpu_32f_C1* fields[NUM_FIELDS] = {&u1, &u2, &p1x, &p1y, &p2x, &p2y};
+    return fields[i];
+  }
+
+  iu::ImageCpu_32f_C1 u1;
+  iu::ImageCpu_32f_C1 u2;
+  iu::ImageCpu_32f_C1 p1x;
+  iu::ImageCpu_32f_C1 p1y;
+  iu::ImageCpu_32f_C1 p2x;
+  iu::ImageCpu_32f_C1 p2y;
+
+private:
+  FlowFields(const FlowFields&);
+  FlowFields& operator= (const FlowFields&);
+};
+
+//-----------------------------------------------------------------------------
+// planes of dst: image, d/dx, d/dy (central differences, clamped at the border)
+struct GradientRows
+{
+  const float* src;
+  size_t src_stride;
+  float* dst;
+  size_t dst_stride;
+  size_t plane_stride;
+  int width;
+  int height;
+
+  void operator()(int begin, int end) const
+  {
+    for(int y=begin; y<end; ++y)
+    {
+      const float* s = src + y*src_stride;
+      const float* s_up = src + IUMAX(y-1, 0)*src_stride;
+      const float* s_down = src + IUMIN(y+1, height-1)*src_stride;
+      float* d = dst + y*dst_stride;
+      float* dx = d + plane_stride;
+      float* dy = dx + plane_stride;
+      for(int x=0; x<width; ++x)
+      {
+        d[x] = s[x];
+        dx[x] = 0.5f*(s[IUMIN(x+1, width-1)] - s[IUMAX(x-1, 0)]);
+        dy[x] = 0.5f*(s_down[x] - s_up[x]);
+      }
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+// linearization at the warping flow u0: plane 0 of the warped image becomes
+// rho_c = I1(x+u0) - grad I1(x+u0)*u0 - I0(x), ig = 1/|grad I1(x+u0)|^2
+struct ResidualRows
+{
+  const float* i0;
+  size_t i0_stride;
+  const float* u1;
+  const float* u2;
+  size_t u_stride;
+  float* warped;
+  size_t warped_stride;
+  size_t plane_stride;
+  float* ig;
+  size_t ig_stride;
+  int width;
+
+  void operator()(int begin, int end) const
+  {
+    for(int y=begin; y<end; ++y)
+    {
+      const float* i = i0 + y*i0_stride;
+      const float* v1 = u1 + y*u_stride;
+      const float* v2 = u2 + y*u_stride;
+      float* rho = warped + y*warped_stride;
+      const float* ix = rho + plane_stride;
+      const float* iy = ix + plane_stride;
+      float* g = ig + y*ig_stride;
+      for(int x=0; x<width; ++x)
+      {
+        const float grad = ix[x]*ix[x] + iy[x]*iy[x];
+        rho[x] = rho[x] - ix[x]*v1[x] - iy[x]*v2[x] - i[x];
+        g[x] = (grad > TVL1_GRAD_IS_ZERO) ? 1.0f/grad : 0.0f;
+      }
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+struct ScaleRows
+{
+  float* data;
+  size_t stride;
+  int width;
+  float factor;
+
+  void operator()(int begin, int end) const
+  {
+    for(int y=begin; y<end; ++y)
+    {
+      float* d = data + y*stride;
+      for(int x=0; x<width; ++x)
+        d[x] *= factor;
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+struct InterleaveRows
+{
+  const float* u1;
+  const float* u2;
+  size_t u_stride;
+  float2* flow;
+  size_t flow_stride;
+  int width;
+
+  void operator()(int begin, int end) const
+  {
+    for(int y=begin; y<end; ++y)
+    {
+      const float* v1 = u1 + y*u_stride;
+      const float* v2 = u2 + y*u_stride;
+      float2* f = flow + y*flow_stride;
+      for(int x=0; x<width; ++x)
+        f[x] = make_float2(v1[x], v2[x]);
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+/* Runs 'iterations' iterations on every tile: src fields (with halo) -> private
+ * buffer -> inner part into the dst fields. The private buffer is processed with
+ * the boundary conditions of the image at all its edges; the wrong values at
+ * inner edges travel one row/column per iteration (the dual variables at the
+ * bottom/right edge start one row/column further in) and stay within the halo.
+ */
+struct Tvl1Sweep
+{
+  const float* src[NUM_FIELDS];
+  float* dst[NUM_FIELDS];
+  size_t stride;
+  const float* rho;
+  const float* ix;
+  const float* iy;
+  size_t data_stride;
+  const float* ig;
+  size_t ig_stride;
+  int width;
+  int height;
+  int tile_width;
+  int tile_height;
+  int tiles_x;
+  int iterations;
+  float lt;
+  float theta;
+  float taut;
+  const TransformKernels* kernels;
+
+  void operator()(int begin, int end) const
+  {
+    const int halo = iterations + 1;
+    const int ext_w = IUMIN(width, tile_width + 2*halo);
+    const int ext_h = IUMIN(height, tile_height + 2*halo);
+    const size_t area = (size_t)ext_w*ext_h;
+    // the fields and a row of zeros (dual variables outside the image)
+    std::vector<float> buffer(NUM_FIELDS*area + ext_w, 0.0f);
+    const float* zeros = &buffer[NUM_FIELDS*area];
+
+    for(int t=begin; t<end; ++t)
+    {
+      const int x0 = (t % tiles_x)*tile_width;
+      const int y0 = (t / tiles_x)*tile_height;
+      const int x1 = IUMIN(x0 + tile_width, width);
+      const int y1 = IUMIN(y0 + tile_height, height);
+      const int ex0 = IUMAX(x0 - halo, 0);
+      const int ey0 = IUMAX(y0 - halo, 0);
+      const int w = IUMIN(x1 + halo, width) - ex0;
+      const int h = IUMIN(y1 + halo, height) - ey0;
+
+      float* f[NUM_FIELDS];
+      for(int i=0; i<NUM_FIELDS; ++i)
+      {
+        f[i] = &buffer[i*area];
+        for(int y=0; y<h; ++y)
+          memcpy(f[i] + y*w, src[i] + (ey0+y)*stride + ex0, w*sizeof(float));
+      }
+
+      for(int it=0; it<iterations; ++it)
+        iterate(f, ex0, ey0, w, h, zeros);
+
+      for(int i=0; i<NUM_FIELDS; ++i)
+        for(int y=y0; y<y1; ++y)
+          memcpy(dst[i] + y*stride + x0, f[i] + (y-ey0)*w + (x0-ex0), (x1-x0)*sizeof(float));
+    }
+  }
+
+  void iterate(float* const* f, int ex0, int ey0, int w, int h, const float* zeros) const
+  {
+    float* u1 = f[U1];
+    float* u2 = f[U2];
+    float* p1x = f[P1X];
+    float* p1y = f[P1Y];
+    float* p2x = f[P2X];
+    float* p2y = f[P2Y];
+
+    for(int y=0; y<h; ++y)
+    {
+      const size_t o = (size_t)y*w;
+      const size_t d = (ey0+y)*data_stride + ex0;
+      const bool last = (y == h-1);
+      kernels->tvl1PrimalRow(ix + d, iy + d, rho + d, ig + (ey0+y)*ig_stride + ex0,
+                             p1x + o, last ? zeros : p1y + o, (y > 0) ? p1y + o - w : zeros,
+                             p2x + o, last ? zeros : p2y + o, (y > 0) ? p2y + o - w : zeros,
+                             lt, theta, u1 + o, u2 + o, w);
+      // the dual step of the row above needs this primal row
+      if(y > 0)
+        kernels->tvl1DualRow(u1 + o - w, u2 + o - w, u1 + o, u2 + o, taut,
+                             p1x + o - w, p1y + o - w, p2x + o - w, p2y + o - w, w);
+    }
+    const size_t o = (size_t)(h-1)*w;
+    kernels->tvl1DualRow(u1 + o, u2 + o, u1 + o, u2 + o, taut,
+                         p1x + o, p1y + o, p2x + o, p2y + o, w);
+  }
+};
+
+//-----------------------------------------------------------------------------
+// iterations of one warp; fields and other are swapped after every sweep
+static void tvl1Iterations(FlowFields*& fields, FlowFields*& other,
+                           const iu::ImagePlanarCpu_32f_C3& warped, const iu::ImageCpu_32f_C1& ig,
+                           float lambda, float theta, int iterations)
+{
+  const int width = fields->u1.width();
+  const int height = fields->u1.height();
+
+  Tvl1Sweep body;
+  body.stride = fields->u1.stride();
+  body.rho = warped.plane(0);
+  body.ix = warped.plane(1);
+  body.iy = warped.plane(2);
+  body.data_stride = warped.stride();
+  body.ig = ig.data();
+  body.ig_stride = ig.stride();
+  body.width = width;
+  body.height = height;
+  body.lt = lambda*theta;
+  body.theta = theta;
+  body.taut = TVL1_TAU/theta;
+  body.kernels = &transformKernels();
+
+  // small levels are one tile, i.e. all iterations in one sweep
+  const size_t tile_pixels = TVL1_TILE_BYTES/(TVL1_TILE_ARRAYS*sizeof(float));
+  int sweep_iterations = TVL1_SWEEP_ITERATIONS;
+  if((size_t)width*height <= tile_pixels)
+  {
+    body.tile_width = width;
+    body.tile_height = height;
+    sweep_iterations = iterations;
+  }
+  else
+  {
+    const int halo = TVL1_SWEEP_ITERATIONS + 1;
+    body.tile_width = (width <= TVL1_TILE_WIDTH) ? width : TVL1_TILE_WIDTH - 2*halo;
+    const int ext_w = IUMIN(width, body.tile_width + 2*halo);
+    body.tile_height = IUMAX(halo, (int)(tile_pixels/ext_w) - 2*halo);
+  }
+  body.tiles_x = (width + body.tile_width-1)/body.tile_width;
+  const int tiles = body.tiles_x*((height + body.tile_height-1)/body.tile_height);
+
+  for(int done=0; done<iterations; done+=sweep_iterations)
+  {
+    body.iterations = IUMIN(sweep_iterations, iterations-done);
+    for(int i=0; i<NUM_FIELDS; ++i)
+    {
+      body.src[i] = fields->field(i)->data();
+      body.dst[i] = other->field(i)->data();
+    }
+    iu::parallelFor(0, tiles, body, 1);
+    std::swap(fields, other);
+  }
+}
+
+//-----------------------------------------------------------------------------
+// initialization of a level with the flow (and the dual variables) of the coarser level
+static void prolongateFields(FlowFields* coarse, FlowFields* fine)
+{
+  for(int i=0; i<NUM_FIELDS; ++i)
+    prolongate(coarse->field(i), fine->field(i), IU_INTERPOLATE_LINEAR);
+
+  ScaleRows body;
+  body.stride = fine->u1.stride();
+  body.width = fine->u1.width();
+  body.data = fine->u1.data();
+  body.factor = (float)fine->u1.width()/(float)coarse->u1.width();
+  iu::parallelFor(0, fine->u1.height(), body, iu::Executor::rowGrain(body.width));
+  body.data = fine->u2.data();
+  body.factor = (float)fine->u1.height()/(float)coarse->u1.height();
+  iu::parallelFor(0, fine->u1.height(), body, iu::Executor::rowGrain(body.width));
+}
+
+//-----------------------------------------------------------------------------
+// the current fields and the second set of a level, released on every exit
+struct FlowFieldsPair
+{
+  FlowFields* fields;
+  FlowFields* other;
+
+  FlowFieldsPair() : fields(0), other(0) {}
+  ~FlowFieldsPair()
+  {
+    delete fields;
+    delete other;
+  }
+
+  // replaces the second set by a new one of the given size
+  void renewOther(const IuSize& size)
+  {
+    delete other;
+    other = 0;
+    other = new FlowFields(size);
+  }
+
+private:
+  FlowFieldsPair(const FlowFieldsPair&);
+  FlowFieldsPair& operator= (const FlowFieldsPair&);
+};
+
+/* ***************************************************************************
+ *  FUNCTION IMPLEMENTATIONS
+ * ***************************************************************************/
+
+// host; 32-bit; flow from i0 to i1
+void opticalFlowTVL1(const iu::ImageCpu_32f_C1* i0, const iu::ImageCpu_32f_C1* i1,
+                     iu::ImageCpu_32f_C2* flow, float lambda, float theta,
+                     unsigned int num_levels, float scale_factor,
+                     unsigned int num_warps, unsigned int num_iterations)
+{
+  if(i0->size() != i1->size() || i0->size() != flow->size())
+    throw IuException("both images and the flow field have to be of the same size",
+                      __FILE__, __FUNCTION__, __LINE__);
+  if(lambda <= 0.0f || theta <= 0.0f)
+    throw IuException("lambda and theta have to be positive", __FILE__, __FUNCTION__, __LINE__);
+
+  // the pyramids only read the input images
+  iu::ImagePyramid pyramid0;
+  iu::ImagePyramid pyramid1;
+  const unsigned int levels = pyramid0.init(num_levels, i0->size(), scale_factor, TVL1_MIN_LEVEL_SIZE);
+  pyramid1.init(num_levels, i1->size(), scale_factor, TVL1_MIN_LEVEL_SIZE);
+  pyramid0.setImage(const_cast<iu::ImageCpu_32f_C1*>(i0));
+  pyramid1.setImage(const_cast<iu::ImageCpu_32f_C1*>(i1));
+
+  FlowFieldsPair buffers;
+  for(int level=levels-1; level>=0; --level)
+  {
+    const iu::ImageCpu_32f_C1* level0 = pyramid0.imageCpu_32f_C1(level);
+    const iu::ImageCpu_32f_C1* level1 = pyramid1.imageCpu_32f_C1(level);
+    const IuSize size = level0->size();
+
+    // the coarser fields are prolongated into the second set, which becomes the current one
+    buffers.renewOther(size);
+    if(buffers.fields == 0)
+    {
+      for(int i=0; i<NUM_FIELDS; ++i)
+        setValue(0.0f, buffers.other->field(i), buffers.other->field(i)->roi());
+    }
+    else
+      prolongateFields(buffers.fields, buffers.other);
+    std::swap(buffers.fields, buffers.other);
+    buffers.renewOther(size);
+
+    // I1 and its derivatives are warped together (sample positions computed once)
+    iu::ImagePlanarCpu_32f_C3 i1_planes(size);
+    iu::ImagePlanarCpu_32f_C3 warped(size);
+    iu::ImageCpu_32f_C1 ig(size);
+    GradientRows gradient;
+    gradient.src = level1->data();
+    gradient.src_stride = level1->stride();
+    gradient.dst = i1_planes.plane(0);
+    gradient.dst_stride = i1_planes.stride();
+    gradient.plane_stride = i1_planes.planeStride();
+    gradient.width = size.width;
+    gradient.height = size.height;
+    iu::parallelFor(0, size.height, gradient, iu::Executor::rowGrain(3*size.width));
+
+    for(unsigned int warp=0; warp<num_warps; ++warp)
+    {
+      remap(&i1_planes, &buffers.fields->u1, &buffers.fields->u2, &warped, IU_INTERPOLATE_LINEAR);
+
+      ResidualRows residual;
+      residual.i0 = level0->data();
+      residual.i0_stride = level0->stride();
+      residual.u1 = buffers.fields->u1.data();
+      residual.u2 = buffers.fields->u2.data();
+      residual.u_stride = buffers.fields->u1.stride();
+      residual.warped = warped.plane(0);
+      residual.warped_stride = warped.stride();
+      residual.plane_stride = warped.planeStride();
+      residual.ig = ig.data();
+      residual.ig_stride = ig.stride();
+      residual.width = size.width;
+      iu::parallelFor(0, size.height, residual, iu::Executor::rowGrain(4*size.width));
+
+      tvl1Iterations(buffers.fields, buffers.other, warped, ig, lambda, theta, num_iterations);
+    }
+  }
+
+  InterleaveRows body;
+  body.u1 = buffers.fields->u1.data();
+  body.u2 = buffers.fields->u2.data();
+  body.u_stride = buffers.fields->u1.stride();
+  body.flow = flow->data();
+  body.flow_stride = flow->stride();
+  body.width = flow->width();
+  iu::parallelFor(0, flow->height(), body, iu::Executor::rowGrain(2*body.width));
+}
+
+} // namespace iuprivate
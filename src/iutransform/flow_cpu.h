@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Geometric Transformations
+ * Class       : none
+ * Language    : C++
+ * Description : Definition of the host TV-L1 optical flow
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+/* ****************************************************************************
+ *  W A R N I N G
+ *  -------------
+ *
+ *  This file is not part of the IU API.  It exists purely as an
+ *  implementation detail.  This header file may change from version to
+ *  version without notice, or even be removed.
+ *
+ *  We mean it.
+ * ****************************************************************************
+ */
+
+#ifndef IUPRIVATE_FLOW_CPU_H
+#define IUPRIVATE_FLOW_CPU_H
+
+#include <iucore/coredefs.h>
+#include <iucore/memorydefs.h>
+
+namespace iuprivate {
+
+// host; TV-L1 optical flow from i0 to i1 (see iu::opticalFlowTVL1)
+void opticalFlowTVL1(const iu::ImageCpu_32f_C1* i0, const iu::ImageCpu_32f_C1* i1,
+                     iu::ImageCpu_32f_C2* flow, float lambda, float theta,
+                     unsigned int num_levels, float scale_factor,
+                     unsigned int num_warps, unsigned int num_iterations);
+
+} // namespace iuprivate
+
+#endif // IUPRIVATE_FLOW_CPU_H
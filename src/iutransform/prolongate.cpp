@@ -25,6 +25,7 @@
 #include <math.h>
 #include <iucore/copy.h>
 #include <iufilter/filter.h>
+#include "transform_cpu.h"
 #include "prolongate.h"
 
 namespace iuprivate {
@@ -67,4 +68,28 @@ IuStatus prolongate(const iu::ImageGpu_32f_C4* src, iu::ImageGpu_32f_C4* dst,
   return cuProlongate(const_cast<iu::ImageGpu_32f_C4*>(src), dst, interpolation);
 }
 
+// host; 32-bit; 1-channel
+IuStatus prolongate(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                    IuInterpolationType interpolation)
+{
+  resample(src, dst, interpolation);
+  return IU_SUCCESS;
+}
+
+// host; 32-bit; 2-channel
+IuStatus prolongate(const iu::ImageCpu_32f_C2* src, iu::ImageCpu_32f_C2* dst,
+                    IuInterpolationType interpolation)
+{
+  resample(src, dst, interpolation);
+  return IU_SUCCESS;
+}
+
+// host; 32-bit; 4-channel
+IuStatus prolongate(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                    IuInterpolationType interpolation)
+{
+  resample(src, dst, interpolation);
+  return IU_SUCCESS;
+}
+
 }
@@ -36,7 +36,13 @@ IuStatus prolongate(const iu::ImageGpu_32f_C2* src, iu::ImageGpu_32f_C2* dst,
 IuStatus prolongate(const iu::ImageGpu_32f_C4* src, iu::ImageGpu_32f_C4* dst,
                     IuInterpolationType interpolation = IU_INTERPOLATE_NEAREST);
 
-
+// host
+IuStatus prolongate(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                    IuInterpolationType interpolation = IU_INTERPOLATE_NEAREST);
+IuStatus prolongate(const iu::ImageCpu_32f_C2* src, iu::ImageCpu_32f_C2* dst,
+                    IuInterpolationType interpolation = IU_INTERPOLATE_NEAREST);
+IuStatus prolongate(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                    IuInterpolationType interpolation = IU_INTERPOLATE_NEAREST);
 
 }  // namespace iuprivate
 
@@ -25,6 +25,7 @@
 #include <math.h>
 #include <iucore/copy.h>
 #include <iufilter/filter.h>
+#include "transform_cpu.h"
 #include "reduce.h"
 
 namespace iuprivate {
@@ -42,6 +43,19 @@ extern IuStatus cuReduce(iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C1* dst,
  *  FUNCTION IMPLEMENTATIONS
  * ***************************************************************************/
 
+// kernel size of the gaussian pre-smoothing
+static const int REDUCE_GAUSS_KERNEL_SIZE = 5;
+
+// sigma of the gaussian pre-smoothing dependent on the scale factor (x_/y_factor < 0)
+static float reduceGaussSigma(const IuSize& src_size, const IuSize& dst_size)
+{
+  float x_factor = (float)dst_size.width / (float)src_size.width;
+  float y_factor = (float)dst_size.height / (float)src_size.height;
+
+  return /*0.5774f*/0.3f * sqrtf(0.5f*(x_factor+y_factor));
+  //return 0.1f * sqrtf(0.5f*(x_factor+y_factor));
+}
+
 // device; 32-bit; 1-channel
 IuStatus reduce(const iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C1* dst,
                 IuInterpolationType interpolation,
@@ -59,13 +73,8 @@ IuStatus reduce(const iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C1* dst,
     filtered = new iu::ImageGpu_32f_C1(src->size());
     filter_mem_flag = true;
 
-    // x_/y_factor < 0
-    float x_factor = (float)dst->width() / (float)src->width();
-    float y_factor = (float)dst->height() / (float)src->height();
-
-    float sigma =/*0.5774f*/0.3f * sqrtf(0.5f*(x_factor+y_factor));
-    //float sigma = 0.1f * sqrtf(0.5f*(x_factor+y_factor));
-    unsigned int kernel_size = 5;
+    float sigma = reduceGaussSigma(src->size(), dst->size());
+    unsigned int kernel_size = REDUCE_GAUSS_KERNEL_SIZE;
 
     iuprivate::filterGauss(src, filtered, src->roi(), sigma, kernel_size);
   }
@@ -96,4 +105,51 @@ IuStatus reduce(const iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C1* dst,
   return status;
 }
 
+// host; generic for all pixel types
+template<class ImageType>
+static IuStatus reduceCpu(const ImageType* src, ImageType* dst,
+                          IuInterpolationType interpolation,
+                          bool gauss_prefilter, bool bicubic_bspline_prefilter)
+{
+  // the gaussian pre-smoothing is fused into the resampling weights
+  float sigma = gauss_prefilter ? reduceGaussSigma(src->size(), dst->size()) : 0.0f;
+
+  // convert a copy of the input image into cubic bspline coefficients
+  // (only useful for cubic interpolation!)
+  if(bicubic_bspline_prefilter && interpolation==IU_INTERPOLATE_CUBIC)
+  {
+    ImageType coefficients(*src);
+    iuprivate::cubicBSplinePrefilter(&coefficients);
+    resample(&coefficients, dst, interpolation, sigma, REDUCE_GAUSS_KERNEL_SIZE);
+  }
+  else
+    resample(src, dst, interpolation, sigma, REDUCE_GAUSS_KERNEL_SIZE);
+
+  return IU_SUCCESS;
+}
+
+// host; 32-bit; 1-channel
+IuStatus reduce(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                IuInterpolationType interpolation,
+                bool gauss_prefilter, bool bicubic_bspline_prefilter)
+{
+  return reduceCpu(src, dst, interpolation, gauss_prefilter, bicubic_bspline_prefilter);
+}
+
+// host; 32-bit; 2-channel
+IuStatus reduce(const iu::ImageCpu_32f_C2* src, iu::ImageCpu_32f_C2* dst,
+                IuInterpolationType interpolation,
+                bool gauss_prefilter, bool bicubic_bspline_prefilter)
+{
+  return reduceCpu(src, dst, interpolation, gauss_prefilter, bicubic_bspline_prefilter);
+}
+
+// host; 32-bit; 4-channel
+IuStatus reduce(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                IuInterpolationType interpolation,
+                bool gauss_prefilter, bool bicubic_bspline_prefilter)
+{
+  return reduceCpu(src, dst, interpolation, gauss_prefilter, bicubic_bspline_prefilter);
+}
+
 }
@@ -34,6 +34,19 @@ IuStatus reduce(const iu::ImageGpu_32f_C1* src, iu::ImageGpu_32f_C1* dst,
             IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR,
             bool gauss_prefilter = true, bool bicubic_bspline_prefilter = false);
 
+// host; 32-bit; 1-channel
+IuStatus reduce(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR,
+                bool gauss_prefilter = true, bool bicubic_bspline_prefilter = false);
+// host; 32-bit; 2-channel
+IuStatus reduce(const iu::ImageCpu_32f_C2* src, iu::ImageCpu_32f_C2* dst,
+                IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR,
+                bool gauss_prefilter = true, bool bicubic_bspline_prefilter = false);
+// host; 32-bit; 4-channel
+IuStatus reduce(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                IuInterpolationType interpolation = IU_INTERPOLATE_LINEAR,
+                bool gauss_prefilter = true, bool bicubic_bspline_prefilter = false);
+
 } // namespace iuprivate
 
 #endif // IUPRIVATE_REDUCE_H
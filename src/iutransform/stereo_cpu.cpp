@@ -0,0 +1,689 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Geometric Transformations
+ * Class       : none
+ * Language    : C++
+ * Description : Implementation of the host stereo matching (cost volumes, SGM)
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include <iucutil.h>
+#include <iucore/executor.h>
+#include <iucore/cpukernels.h>
+#include "stereokernels.h"
+#include "stereo_cpu.h"
+
+namespace iuprivate {
+
+/* ***************************************************************************
+ *  Stereo matching
+ * ***************************************************************************/
+// The cost volumes hold the costs of a pixel for all disparities contiguously:
+// the volume has the size disparities x width x height, i.e. the cost of the
+// left pixel (x,y) and the right pixel (x-d,y) is costs->data(d, x, y). This
+// layout turns the matching, the path updates of SGM and the WTA search into
+// loops over the disparity axis. To make the right samples (x-d) of a left
+// pixel contiguous too, the right descriptors/rows are stored mirrored.
+// Disparities beyond the left image border (d > x) get the maximal cost.
+
+// largest census window (the descriptors have 64 bits)
+static const unsigned int STEREO_MAX_CENSUS_RADIUS = 3;
+// largest SAD window (16-bit sums of 8-bit differences)
+static const unsigned int STEREO_MAX_SAD_RADIUS = 7;
+
+//-----------------------------------------------------------------------------
+// kernels by type
+static inline void censusRow(const StereoKernels& k, const unsigned char* s, const unsigned char* c,
+                             unsigned long long* d, int n)
+{ k.censusRow_8u(s, c, d, n); }
+static inline void censusRow(const StereoKernels& k, const float* s, const float* c,
+                             unsigned long long* d, int n)
+{ k.censusRow_32f(s, c, d, n); }
+
+static inline void hammingRow(const StereoKernels& k, unsigned long long a, const unsigned long long* b,
+                              unsigned char* d, int n)
+{ k.hammingRow_8u(a, b, d, n); }
+static inline void hammingRow(const StereoKernels& k, unsigned long long a, const unsigned long long* b,
+                              unsigned short* d, int n)
+{ k.hammingRow_16u(a, b, d, n); }
+
+// SAD of the window, 8-bit volumes store the mean difference
+static inline void storeSad(const StereoKernels& k, const unsigned short* sad, float scale, unsigned char* d, int n)
+{ k.scaleRow_16u8u(sad, scale, d, n); }
+static inline void storeSad(const StereoKernels&, const unsigned short* sad, float, unsigned short* d, int n)
+{ memcpy(d, sad, n*sizeof(unsigned short)); }
+
+static inline unsigned int sgmPathRow(const StereoKernels& k, const unsigned short* prev, unsigned int prev_min,
+                                      const unsigned char* c, unsigned int p1, unsigned int p2,
+                                      unsigned short* cur, int n)
+{ return k.sgmPathRow_8u(prev, prev_min, c, p1, p2, cur, n); }
+static inline unsigned int sgmPathRow(const StereoKernels& k, const unsigned short* prev, unsigned int prev_min,
+                                      const unsigned short* c, unsigned int p1, unsigned int p2,
+                                      unsigned short* cur, int n)
+{ return k.sgmPathRow_16u(prev, prev_min, c, p1, p2, cur, n); }
+
+//-----------------------------------------------------------------------------
+// census descriptors of the (2*radius+1)^2 window (clamped borders), optionally mirrored
+template<typename PixelType>
+struct CensusRows
+{
+  const PixelType* src;
+  size_t src_stride;
+  unsigned long long* dst;
+  int width;
+  int height;
+  int radius;
+  bool mirror;
+  const StereoKernels* kernels;
+
+  void operator()(int begin, int end) const
+  {
+    const int r = radius;
+    const int padded_width = width + 2*r;
+    std::vector<PixelType> padded((2*r+1)*padded_width);
+    for(int y=begin; y<end; ++y)
+    {
+      for(int j=0; j<=2*r; ++j)
+      {
+        const PixelType* s = src + IUMIN(IUMAX(y+j-r, 0), height-1)*src_stride;
+        PixelType* p = &padded[j*padded_width];
+        for(int i=0; i<r; ++i)
+        {
+          p[i] = s[0];
+          p[r+width+i] = s[width-1];
+        }
+        memcpy(p + r, s, width*sizeof(PixelType));
+      }
+
+      const PixelType* center = &padded[r*padded_width + r];
+      unsigned long long* d = dst + (size_t)y*width;
+      memset(d, 0, width*sizeof(unsigned long long));
+      for(int j=0; j<=2*r; ++j)
+        for(int i=0; i<=2*r; ++i)
+          if(j != r || i != r)
+            censusRow(*kernels, &padded[j*padded_width + i], center, d, width);
+      if(mirror)
+        std::reverse(d, d + width);
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+template<typename CostType>
+struct CensusCostRows
+{
+  const unsigned long long* left;
+  const unsigned long long* right;  // mirrored
+  CostType* costs;
+  size_t cost_stride;
+  size_t cost_slice_stride;
+  int width;
+  int disparities;
+  CostType max_cost;
+  const StereoKernels* kernels;
+
+  void operator()(int begin, int end) const
+  {
+    for(int y=begin; y<end; ++y)
+    {
+      const unsigned long long* l = left + (size_t)y*width;
+      const unsigned long long* r = right + (size_t)y*width;
+      for(int x=0; x<width; ++x)
+      {
+        CostType* c = costs + y*cost_slice_stride + x*cost_stride;
+        const int n = IUMIN(disparities, x+1);
+        hammingRow(*kernels, l[x], r + (width-1-x), c, n);
+        std::fill(c + n, c + disparities, max_cost);
+      }
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+// mirrored right rows padded with the first pixel for d > x (width+disparities per row)
+struct MirrorRows
+{
+  const unsigned char* src;
+  size_t src_stride;
+  unsigned char* dst;
+  size_t dst_stride;
+  int width;
+  int disparities;
+
+  void operator()(int begin, int end) const
+  {
+    for(int y=begin; y<end; ++y)
+    {
+      const unsigned char* s = src + y*src_stride;
+      unsigned char* d = dst + y*dst_stride;
+      for(int x=0; x<width; ++x)
+        d[x] = s[width-1-x];
+      memset(d + width, s[0], disparities);
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+// 8-bit intensities of [0,1] images
+struct QuantizeRows
+{
+  const float* src;
+  size_t src_stride;
+  unsigned char* dst;
+  size_t dst_stride;
+  int width;
+  const CpuKernels* kernels;
+
+  void operator()(int begin, int end) const
+  {
+    std::vector<float> scaled(width);
+    for(int y=begin; y<end; ++y)
+    {
+      kernels->scaleRow(src + y*src_stride, 255.0f, &scaled[0], width);
+      kernels->saturateRow_32f8u(&scaled[0], dst + y*dst_stride, width);
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+/* SAD over the (2*radius+1)^2 window (clamped borders) for bands of rows: the
+ * absolute differences of the last 2*radius+2 rows are kept in a ring buffer,
+ * their column sums are updated per row and the window sums per pixel are
+ * running sums over the columns.
+ */
+template<typename CostType>
+struct SadCostBands
+{
+  const unsigned char* left;
+  size_t left_stride;
+  const unsigned char* right;  // mirrored and padded
+  size_t right_stride;
+  CostType* costs;
+  size_t cost_stride;
+  size_t cost_slice_stride;
+  int width;
+  int height;
+  int disparities;
+  int radius;
+  int bands;
+  CostType max_cost;
+  const StereoKernels* kernels;
+
+  void differences(int y, unsigned char* d) const
+  {
+    y = IUMIN(IUMAX(y, 0), height-1);
+    const unsigned char* l = left + y*left_stride;
+    const unsigned char* r = right + y*right_stride;
+    for(int x=0; x<width; ++x)
+      kernels->absDiffRow_8u(l[x], r + (width-1-x), d + (size_t)x*disparities, disparities);
+  }
+
+  void operator()(int begin, int end) const
+  {
+    const int r = radius;
+    const int slots = 2*r + 2;
+    const int n = disparities;
+    const size_t row_size = (size_t)width*n;
+    const float scale = 1.0f/((2*r+1)*(2*r+1));
+    std::vector<unsigned char> ring(slots*row_size);
+    std::vector<unsigned char> zeros(row_size, 0);
+    std::vector<unsigned short> columns(row_size);
+    std::vector<unsigned short> sum(n);
+    std::vector<unsigned short> zeros16(n, 0);
+
+    for(int band=begin; band<end; ++band)
+    {
+      const int y0 = (int)((long long)band*height/bands);
+      const int y1 = (int)((long long)(band+1)*height/bands);
+      std::fill(columns.begin(), columns.end(), 0);
+      for(int j=y0-r; j<=y0+r; ++j)
+      {
+        unsigned char* d = &ring[((j%slots + slots)%slots)*row_size];
+        differences(j, d);
+        kernels->updateSumRow_16u(d, &zeros[0], &columns[0], (int)row_size);
+      }
+
+      for(int y=y0; y<y1; ++y)
+      {
+        if(y > y0)
+        {
+          unsigned char* add = &ring[(((y+r)%slots + slots)%slots)*row_size];
+          const unsigned char* sub = &ring[(((y-r-1)%slots + slots)%slots)*row_size];
+          differences(y+r, add);
+          kernels->updateSumRow_16u(add, sub, &columns[0], (int)row_size);
+        }
+
+        std::fill(sum.begin(), sum.end(), 0);
+        for(int i=-r; i<=r; ++i)
+          kernels->boxStepRow_16u(&sum[0], &columns[IUMIN(IUMAX(i, 0), width-1)*n], &zeros16[0], &sum[0], n);
+        for(int x=0; x<width; ++x)
+        {
+          if(x > 0)
+            kernels->boxStepRow_16u(&sum[0], &columns[IUMIN(x+r, width-1)*n],
+                                    &columns[IUMAX(x-r-1, 0)*n], &sum[0], n);
+          CostType* c = costs + y*cost_slice_stride + x*cost_stride;
+          const int valid = IUMIN(n, x+1);
+          storeSad(*kernels, &sum[0], scale, c, valid);
+          std::fill(c + valid, c + n, max_cost);
+        }
+      }
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+template<typename PixelType, typename CostType>
+static void censusCosts(const PixelType* left, size_t left_stride, const PixelType* right, size_t right_stride,
+                        int width, int height, int radius, CostType* costs, size_t cost_stride,
+                        size_t cost_slice_stride, int disparities)
+{
+  std::vector<unsigned long long> descriptors(2*(size_t)width*height);
+
+  CensusRows<PixelType> census;
+  census.width = width;
+  census.height = height;
+  census.radius = radius;
+  census.kernels = &stereoKernels();
+  census.src = left;
+  census.src_stride = left_stride;
+  census.dst = &descriptors[0];
+  census.mirror = false;
+  iu::parallelFor(0, height, census, iu::Executor::rowGrain(width*(2*radius+1)*(2*radius+1)));
+  census.src = right;
+  census.src_stride = right_stride;
+  census.dst = &descriptors[(size_t)width*height];
+  census.mirror = true;
+  iu::parallelFor(0, height, census, iu::Executor::rowGrain(width*(2*radius+1)*(2*radius+1)));
+
+  CensusCostRows<CostType> body;
+  body.left = &descriptors[0];
+  body.right = &descriptors[(size_t)width*height];
+  body.costs = costs;
+  body.cost_stride = cost_stride;
+  body.cost_slice_stride = cost_slice_stride;
+  body.width = width;
+  body.disparities = disparities;
+  body.max_cost = (CostType)((2*radius+1)*(2*radius+1) - 1);
+  body.kernels = census.kernels;
+  iu::parallelFor(0, height, body, iu::Executor::rowGrain(width*disparities));
+}
+
+template<typename CostType>
+static void sadCosts(const unsigned char* left, size_t left_stride, const unsigned char* right, size_t right_stride,
+                     int width, int height, int radius, CostType* costs, size_t cost_stride,
+                     size_t cost_slice_stride, int disparities)
+{
+  const size_t mirrored_stride = width + disparities;
+  std::vector<unsigned char> mirrored(mirrored_stride*height);
+  MirrorRows mirror;
+  mirror.src = right;
+  mirror.src_stride = right_stride;
+  mirror.dst = &mirrored[0];
+  mirror.dst_stride = mirrored_stride;
+  mirror.width = width;
+  mirror.disparities = disparities;
+  iu::parallelFor(0, height, mirror, iu::Executor::rowGrain(mirrored_stride));
+
+  SadCostBands<CostType> body;
+  body.left = left;
+  body.left_stride = left_stride;
+  body.right = &mirrored[0];
+  body.right_stride = mirrored_stride;
+  body.costs = costs;
+  body.cost_stride = cost_stride;
+  body.cost_slice_stride = cost_slice_stride;
+  body.width = width;
+  body.height = height;
+  body.disparities = disparities;
+  body.radius = radius;
+  // every band recomputes the differences of 2*radius rows above it
+  body.bands = IUMAX(1, IUMIN(iu::Executor::numThreads(), height/(4*(2*radius+1))));
+  body.max_cost = (sizeof(CostType) == 1) ? (CostType)255 : (CostType)((2*radius+1)*(2*radius+1)*255);
+  body.kernels = &stereoKernels();
+  iu::parallelFor(0, body.bands, body, 1);
+}
+
+//-----------------------------------------------------------------------------
+template<class Image, class Volume>
+static void checkCostVolume(const Image* left, const Image* right, const Volume* costs,
+                            IuStereoCost cost, unsigned int radius)
+{
+  if(left->size() != right->size())
+    throw IuException("left and right image have to be of the same size", __FILE__, __FUNCTION__, __LINE__);
+  if(costs->height() != left->width() || costs->depth() != left->height() || costs->width() == 0)
+    throw IuException("the cost volume has to be of the size disparities x width x height",
+                      __FILE__, __FUNCTION__, __LINE__);
+  if(cost == IU_STEREO_CENSUS && (radius == 0 || radius > STEREO_MAX_CENSUS_RADIUS))
+    throw IuException("the census radius has to be in [1,3]", __FILE__, __FUNCTION__, __LINE__);
+  if(cost == IU_STEREO_SAD && radius > STEREO_MAX_SAD_RADIUS)
+    throw IuException("the SAD radius has to be in [0,7]", __FILE__, __FUNCTION__, __LINE__);
+}
+
+template<class Volume>
+static void costVolume(const iu::ImageCpu_8u_C1* left, const iu::ImageCpu_8u_C1* right, Volume* costs,
+                       IuStereoCost cost, unsigned int radius)
+{
+  checkCostVolume(left, right, costs, cost, radius);
+  if(cost == IU_STEREO_CENSUS)
+    censusCosts(left->data(), left->stride(), right->data(), right->stride(), left->width(), left->height(),
+                radius, costs->data(), costs->stride(), costs->slice_stride(), costs->width());
+  else
+    sadCosts(left->data(), left->stride(), right->data(), right->stride(), left->width(), left->height(),
+             radius, costs->data(), costs->stride(), costs->slice_stride(), costs->width());
+}
+
+template<class Volume>
+static void costVolume(const iu::ImageCpu_32f_C1* left, const iu::ImageCpu_32f_C1* right, Volume* costs,
+                       IuStereoCost cost, unsigned int radius)
+{
+  checkCostVolume(left, right, costs, cost, radius);
+  if(cost == IU_STEREO_CENSUS)
+  {
+    censusCosts(left->data(), left->stride(), right->data(), right->stride(), left->width(), left->height(),
+                radius, costs->data(), costs->stride(), costs->slice_stride(), costs->width());
+    return;
+  }
+
+  iu::ImageCpu_8u_C1 left_8u(left->size());
+  iu::ImageCpu_8u_C1 right_8u(right->size());
+  QuantizeRows quantize;
+  quantize.width = left->width();
+  quantize.kernels = &cpuKernels();
+  quantize.src = left->data();
+  quantize.src_stride = left->stride();
+  quantize.dst = left_8u.data();
+  quantize.dst_stride = left_8u.stride();
+  iu::parallelFor(0, left->height(), quantize, iu::Executor::rowGrain(2*left->width()));
+  quantize.src = right->data();
+  quantize.src_stride = right->stride();
+  quantize.dst = right_8u.data();
+  quantize.dst_stride = right_8u.stride();
+  iu::parallelFor(0, left->height(), quantize, iu::Executor::rowGrain(2*left->width()));
+  costVolume(&left_8u, &right_8u, costs, cost, radius);
+}
+
+//-----------------------------------------------------------------------------
+/* Semi-global matching along the scanlines of one path direction (dx,dy) and
+ * its opposite. The forward path costs of a scanline are kept in a private
+ * buffer and added to the aggregated costs with the backward ones, so each
+ * pair of paths reads and writes the aggregated costs once. Scanlines of one
+ * direction do not share pixels and run in parallel.
+ */
+template<typename CostType>
+struct SgmScanlines
+{
+  const CostType* costs;
+  size_t cost_stride;
+  size_t cost_slice_stride;
+  unsigned short* sum;
+  size_t sum_stride;
+  size_t sum_slice_stride;
+  int width;
+  int height;
+  int disparities;
+  int dx;
+  int dy;
+  // the first pair of paths initializes the sums
+  bool first;
+  unsigned int p1;
+  unsigned int p2;
+  const StereoKernels* kernels;
+
+  int lines() const
+  {
+    if(dy == 0)
+      return height;
+    if(dx == 0)
+      return width;
+    return width + height - 1;
+  }
+
+  void line(int l, int& x, int& y, int& length) const
+  {
+    if(dy == 0)
+    {
+      x = 0;
+      y = l;
+      length = width;
+    }
+    else if(dx == 0)
+    {
+      x = l;
+      y = 0;
+      length = height;
+    }
+    else if(dx > 0)
+    {
+      const int k = l - (height-1);
+      x = IUMAX(k, 0);
+      y = IUMAX(-k, 0);
+      length = IUMIN(width-x, height-y);
+    }
+    else
+    {
+      x = IUMIN(l, width-1);
+      y = l - x;
+      length = IUMIN(x+1, height-y);
+    }
+  }
+
+  void operator()(int begin, int end) const
+  {
+    // path costs are stored with a guard of 0xffff on both sides (see sgmPathRow)
+    const int n = disparities;
+    const int row = n + 2;
+    std::vector<unsigned short> forward((size_t)IUMAX(width, height)*row, 0xffff);
+    std::vector<unsigned short> backward(2*row, 0xffff);
+    std::vector<unsigned short> zeros(row, 0);
+    zeros[0] = zeros[n+1] = 0xffff;
+
+    for(int l=begin; l<end; ++l)
+    {
+      int x0, y0, length;
+      line(l, x0, y0, length);
+
+      const unsigned short* prev = &zeros[1];
+      unsigned int prev_min = 0;
+      for(int i=0; i<length; ++i)
+      {
+        const CostType* c = costs + (y0+i*dy)*cost_slice_stride + (x0+i*dx)*cost_stride;
+        unsigned short* cur = &forward[(size_t)i*row + 1];
+        prev_min = sgmPathRow(*kernels, prev, prev_min, c, p1, p2, cur, n);
+        prev = cur;
+      }
+
+      prev = &zeros[1];
+      prev_min = 0;
+      for(int i=length-1; i>=0; --i)
+      {
+        const size_t offset = (y0+i*dy)*sum_slice_stride + (x0+i*dx)*sum_stride;
+        const CostType* c = costs + (y0+i*dy)*cost_slice_stride + (x0+i*dx)*cost_stride;
+        unsigned short* cur = &backward[(i&1)*row + 1];
+        prev_min = sgmPathRow(*kernels, prev, prev_min, c, p1, p2, cur, n);
+        prev = cur;
+
+        unsigned short* s = sum + offset;
+        const unsigned short* f = &forward[(size_t)i*row + 1];
+        if(first)
+          kernels->addRow_16u(f, cur, s, n);
+        else
+        {
+          kernels->addRow_16u(s, f, s, n);
+          kernels->addRow_16u(s, cur, s, n);
+        }
+      }
+    }
+  }
+};
+
+template<typename CostType, class Allocator, IuPixelType _pixel_type>
+static void aggregateSGM(const iu::VolumeCpu<CostType, Allocator, _pixel_type>* costs, iu::VolumeCpu_16u_C1* aggregated,
+                         unsigned int p1, unsigned int p2, unsigned int num_paths)
+{
+  if(costs->size() != aggregated->size())
+    throw IuException("cost volume and aggregated costs have to be of the same size",
+                      __FILE__, __FUNCTION__, __LINE__);
+  if(num_paths != 4 && num_paths != 8)
+    throw IuException("SGM aggregates 4 or 8 paths", __FILE__, __FUNCTION__, __LINE__);
+
+  // horizontal, vertical, diagonal and anti-diagonal paths
+  static const int directions[4][2] = {{1, 0}, {0, 1}, {1, 1}, {-1, 1}};
+
+  SgmScanlines<CostType> body;
+  body.costs = costs->data();
+  body.cost_stride = costs->stride();
+  body.cost_slice_stride = costs->slice_stride();
+  body.sum = aggregated->data();
+  body.sum_stride = aggregated->stride();
+  body.sum_slice_stride = aggregated->slice_stride();
+  body.width = costs->height();
+  body.height = costs->depth();
+  body.disparities = costs->width();
+  body.p1 = p1;
+  body.p2 = p2;
+  body.kernels = &stereoKernels();
+  for(unsigned int i=0; i<num_paths/2; ++i)
+  {
+    body.dx = directions[i][0];
+    body.dy = directions[i][1];
+    body.first = (i == 0);
+    const int length = (body.dy == 0) ? body.width : body.height;
+    iu::parallelFor(0, body.lines(), body, iu::Executor::rowGrain(length*body.disparities));
+  }
+}
+
+//-----------------------------------------------------------------------------
+struct WtaRows
+{
+  const unsigned short* costs;
+  size_t stride;
+  size_t slice_stride;
+  float* disparities;
+  size_t disparity_stride;
+  int width;
+  int num_disparities;
+  bool subpixel;
+  float uniqueness;
+  const StereoKernels* kernels;
+
+  void operator()(int begin, int end) const
+  {
+    const int n = num_disparities;
+    for(int y=begin; y<end; ++y)
+    {
+      float* d = disparities + y*disparity_stride;
+      for(int x=0; x<width; ++x)
+      {
+        const unsigned short* c = costs + y*slice_stride + x*stride;
+        const int k = kernels->argminRow_16u(c, n);
+        float disparity = (float)k;
+        if(uniqueness > 0.0f)
+        {
+          const float limit = c[k]*(1.0f + uniqueness);
+          for(int i=0; i<n; ++i)
+            if((i < k-1 || i > k+1) && c[i] < limit)
+            {
+              disparity = -1.0f;
+              break;
+            }
+        }
+        if(subpixel && disparity >= 0.0f && k > 0 && k < n-1)
+        {
+          // vertex of the parabola through the neighbouring costs
+          const int denominator = c[k-1] - 2*c[k] + c[k+1];
+          if(denominator > 0)
+            disparity += 0.5f*(c[k-1] - c[k+1])/(float)denominator;
+        }
+        d[x] = disparity;
+      }
+    }
+  }
+};
+
+/* ***************************************************************************
+ *  FUNCTION IMPLEMENTATIONS
+ * ***************************************************************************/
+
+// host; 8-bit images; 8-bit costs
+void stereoCostVolume(const iu::ImageCpu_8u_C1* left, const iu::ImageCpu_8u_C1* right,
+                      iu::VolumeCpu_8u_C1* costs, IuStereoCost cost, unsigned int radius)
+{
+  costVolume(left, right, costs, cost, radius);
+}
+
+// host; 8-bit images; 16-bit costs
+void stereoCostVolume(const iu::ImageCpu_8u_C1* left, const iu::ImageCpu_8u_C1* right,
+                      iu::VolumeCpu_16u_C1* costs, IuStereoCost cost, unsigned int radius)
+{
+  costVolume(left, right, costs, cost, radius);
+}
+
+// host; 32-bit images; 8-bit costs
+void stereoCostVolume(const iu::ImageCpu_32f_C1* left, const iu::ImageCpu_32f_C1* right,
+                      iu::VolumeCpu_8u_C1* costs, IuStereoCost cost, unsigned int radius)
+{
+  costVolume(left, right, costs, cost, radius);
+}
+
+// host; 32-bit images; 16-bit costs
+void stereoCostVolume(const iu::ImageCpu_32f_C1* left, const iu::ImageCpu_32f_C1* right,
+                      iu::VolumeCpu_16u_C1* costs, IuStereoCost cost, unsigned int radius)
+{
+  costVolume(left, right, costs, cost, radius);
+}
+
+// host; 8-bit costs
+void stereoAggregateSGM(const iu::VolumeCpu_8u_C1* costs, iu::VolumeCpu_16u_C1* aggregated,
+                        unsigned int p1, unsigned int p2, unsigned int num_paths)
+{
+  aggregateSGM(costs, aggregated, p1, p2, num_paths);
+}
+
+// host; 16-bit costs
+void stereoAggregateSGM(const iu::VolumeCpu_16u_C1* costs, iu::VolumeCpu_16u_C1* aggregated,
+                        unsigned int p1, unsigned int p2, unsigned int num_paths)
+{
+  aggregateSGM(costs, aggregated, p1, p2, num_paths);
+}
+
+// host; 16-bit costs
+void stereoDisparityWTA(const iu::VolumeCpu_16u_C1* costs, iu::ImageCpu_32f_C1* disparities,
+                        bool subpixel, float uniqueness)
+{
+  if(costs->height() != disparities->width() || costs->depth() != disparities->height())
+    throw IuException("the cost volume has to be of the size disparities x width x height",
+                      __FILE__, __FUNCTION__, __LINE__);
+
+  WtaRows body;
+  body.costs = costs->data();
+  body.stride = costs->stride();
+  body.slice_stride = costs->slice_stride();
+  body.disparities = disparities->data();
+  body.disparity_stride = disparities->stride();
+  body.width = disparities->width();
+  body.num_disparities = costs->width();
+  body.subpixel = subpixel;
+  body.uniqueness = uniqueness;
+  body.kernels = &stereoKernels();
+  iu::parallelFor(0, disparities->height(), body,
+                  iu::Executor::rowGrain(body.width*body.num_disparities));
+}
+
+} // namespace iuprivate
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Geometric Transformations
+ * Class       : none
+ * Language    : C++
+ * Description : Definition of the host stereo matching (cost volumes, SGM)
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+/* ****************************************************************************
+ *  W A R N I N G
+ *  -------------
+ *
+ *  This file is not part of the IU API.  It exists purely as an
+ *  implementation detail.  This header file may change from version to
+ *  version without notice, or even be removed.
+ *
+ *  We mean it.
+ * ****************************************************************************
+ */
+
+#ifndef IUPRIVATE_STEREO_CPU_H
+#define IUPRIVATE_STEREO_CPU_H
+
+#include <iucore/coredefs.h>
+#include <iucore/memorydefs.h>
+
+namespace iuprivate {
+
+// host; matching costs of left(x,y) and right(x-d,y) into costs(d,x,y) (see iu::stereoCostVolume)
+void stereoCostVolume(const iu::ImageCpu_8u_C1* left, const iu::ImageCpu_8u_C1* right,
+                      iu::VolumeCpu_8u_C1* costs, IuStereoCost cost, unsigned int radius);
+void stereoCostVolume(const iu::ImageCpu_8u_C1* left, const iu::ImageCpu_8u_C1* right,
+                      iu::VolumeCpu_16u_C1* costs, IuStereoCost cost, unsigned int radius);
+void stereoCostVolume(const iu::ImageCpu_32f_C1* left, const iu::ImageCpu_32f_C1* right,
+                      iu::VolumeCpu_8u_C1* costs, IuStereoCost cost, unsigned int radius);
+void stereoCostVolume(const iu::ImageCpu_32f_C1* left, const iu::ImageCpu_32f_C1* right,
+                      iu::VolumeCpu_16u_C1* costs, IuStereoCost cost, unsigned int radius);
+
+// host; semi-global matching (see iu::stereoAggregateSGM)
+void stereoAggregateSGM(const iu::VolumeCpu_8u_C1* costs, iu::VolumeCpu_16u_C1* aggregated,
+                        unsigned int p1, unsigned int p2, unsigned int num_paths);
+void stereoAggregateSGM(const iu::VolumeCpu_16u_C1* costs, iu::VolumeCpu_16u_C1* aggregated,
+                        unsigned int p1, unsigned int p2, unsigned int num_paths);
+
+// host; winner-takes-all disparities (see iu::stereoDisparityWTA)
+void stereoDisparityWTA(const iu::VolumeCpu_16u_C1* costs, iu::ImageCpu_32f_C1* disparities,
+                        bool subpixel, float uniqueness);
+
+} // namespace iuprivate
+
+#endif // IUPRIVATE_STEREO_CPU_H
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Geometric Transformations
+ * Class       : none
+ * Language    : C++
+ * Description : Row kernels of the host stereo matching
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IUPRIVATE_STEREOKERNELS_H
+#define IUPRIVATE_STEREOKERNELS_H
+
+//////////////////////////////////////////////////////////////////////////////
+// DISCLAIMER: the following declarations are internal and may change in any
+// version without notice, or even be removed.
+//////////////////////////////////////////////////////////////////////////////
+
+namespace iuprivate {
+
+/** Row kernels of the stereo matching for one instruction set level (compiled
+ * like the core kernels, see iucore/cpukernels.h). All loops run over \a n elements.
+ */
+struct StereoKernels
+{
+  /** census transform: d = (d << 1) | (s < c) for one offset s of the window around the centers c */
+  void (*censusRow_8u)(const unsigned char* s, const unsigned char* c, unsigned long long* d, int n);
+  void (*censusRow_32f)(const float* s, const float* c, unsigned long long* d, int n);
+  /** d[k] = popcount(a ^ b[k]) */
+  void (*hammingRow_8u)(unsigned long long a, const unsigned long long* b, unsigned char* d, int n);
+  void (*hammingRow_16u)(unsigned long long a, const unsigned long long* b, unsigned short* d, int n);
+  /** d[k] = |a - b[k]| */
+  void (*absDiffRow_8u)(unsigned char a, const unsigned char* b, unsigned char* d, int n);
+  /** d += add - sub (running column sums) */
+  void (*updateSumRow_16u)(const unsigned char* add, const unsigned char* sub, unsigned short* d, int n);
+  /** d = prev + add - sub (running row sums, d may be prev) */
+  void (*boxStepRow_16u)(const unsigned short* prev, const unsigned short* add, const unsigned short* sub,
+                         unsigned short* d, int n);
+  /** d = s*scale rounded (at most 255) */
+  void (*scaleRow_16u8u)(const unsigned short* s, float scale, unsigned char* d, int n);
+  /** semi-global matching along a path: cur = c + min(prev, prev[d-1]+p1, prev[d+1]+p1, prev_min+p2) - prev_min
+   * (saturated to 16 bits); returns the minimum of cur. prev[-1] and prev[n] have to be 0xffff. */
+  unsigned int (*sgmPathRow_8u)(const unsigned short* prev, unsigned int prev_min, const unsigned char* c,
+                                unsigned int p1, unsigned int p2, unsigned short* cur, int n);
+  unsigned int (*sgmPathRow_16u)(const unsigned short* prev, unsigned int prev_min, const unsigned short* c,
+                                 unsigned int p1, unsigned int p2, unsigned short* cur, int n);
+  /** d = a + b (saturated) */
+  void (*addRow_16u)(const unsigned short* a, const unsigned short* b, unsigned short* d, int n);
+  /** returns the index of the first minimum of s */
+  int (*argminRow_16u)(const unsigned short* s, int n);
+};
+
+/** Returns the stereo kernels of the level selected by iu::CpuDispatch. */
+const StereoKernels& stereoKernels();
+
+} // namespace iuprivate
+
+#endif // IUPRIVATE_STEREOKERNELS_H
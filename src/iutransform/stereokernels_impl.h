@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Geometric Transformations
+ * Class       : none
+ * Language    : C++
+ * Description : Row kernels of the stereo matching; compiled once per instruction set level
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+// No include guard: this file is included by the stereokernels_<level>.cpp files,
+// each defining IU_CPU_KERNELS_NAMESPACE and compiled with the target flags of
+// the core kernels of that level (iucore/cpukernels_impl.h).
+
+#ifndef IU_CPU_KERNELS_NAMESPACE
+  #error "IU_CPU_KERNELS_NAMESPACE has to be defined"
+#endif
+
+#include <cstddef>
+#include <algorithm>
+#include <iucore/cpukernelsdefs.h>
+#include "stereokernels.h"
+
+namespace iuprivate {
+namespace IU_CPU_KERNELS_NAMESPACE {
+
+//-----------------------------------------------------------------------------
+template<typename T>
+static void censusRow(const T* IU_CPU_RESTRICT s, const T* IU_CPU_RESTRICT c,
+                      unsigned long long* IU_CPU_RESTRICT d, int n)
+{
+  for(int x=0; x<n; ++x)
+    d[x] = (d[x] << 1) | (unsigned long long)(s[x] < c[x]);
+}
+
+//-----------------------------------------------------------------------------
+/* Hamming distances with a SWAR popcount (the lanes of the vectors are the 64
+ * bit descriptors; no popcount instruction is required).
+ */
+static inline unsigned int popcount64(unsigned long long v)
+{
+  v = v - ((v >> 1) & 0x5555555555555555ULL);
+  v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+  v = (v + (v >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+  v = v + (v >> 8);
+  v = v + (v >> 16);
+  v = v + (v >> 32);
+  return (unsigned int)(v & 0x7f);
+}
+
+template<typename T>
+static void hammingRow(unsigned long long a, const unsigned long long* IU_CPU_RESTRICT b,
+                       T* IU_CPU_RESTRICT d, int n)
+{
+  for(int k=0; k<n; ++k)
+    d[k] = (T)popcount64(a ^ b[k]);
+}
+
+//-----------------------------------------------------------------------------
+static void absDiffRow_8u(unsigned char a, const unsigned char* IU_CPU_RESTRICT b,
+                          unsigned char* IU_CPU_RESTRICT d, int n)
+{
+  for(int k=0; k<n; ++k)
+    d[k] = (unsigned char)((a > b[k]) ? a - b[k] : b[k] - a);
+}
+
+static void updateSumRow_16u(const unsigned char* IU_CPU_RESTRICT add, const unsigned char* IU_CPU_RESTRICT sub,
+                             unsigned short* IU_CPU_RESTRICT d, int n)
+{
+  for(int x=0; x<n; ++x)
+    d[x] = (unsigned short)(d[x] + add[x] - sub[x]);
+}
+
+// d may alias prev
+static void boxStepRow_16u(const unsigned short* prev, const unsigned short* IU_CPU_RESTRICT add,
+                           const unsigned short* IU_CPU_RESTRICT sub, unsigned short* d, int n)
+{
+  IU_CPU_IVDEP
+  for(int x=0; x<n; ++x)
+    d[x] = (unsigned short)(prev[x] + add[x] - sub[x]);
+}
+
+static void scaleRow_16u8u(const unsigned short* IU_CPU_RESTRICT s, float scale,
+                           unsigned char* IU_CPU_RESTRICT d, int n)
+{
+  for(int x=0; x<n; ++x)
+  {
+    const int v = (int)(s[x]*scale + 0.5f);
+    d[x] = (unsigned char)((v < 255) ? v : 255);
+  }
+}
+
+//-----------------------------------------------------------------------------
+/* One step of a semi-global matching path (Hirschmueller 2008). The path costs
+ * are bounded by max(c) + p2 but are saturated to 16 bits anyway.
+ */
+// prev[-1] and prev[n] are guards of 0xffff
+template<typename T>
+static unsigned int sgmPathRow(const unsigned short* IU_CPU_RESTRICT prev, unsigned int prev_min,
+                               const T* IU_CPU_RESTRICT c, unsigned int p1, unsigned int p2,
+                               unsigned short* IU_CPU_RESTRICT cur, int n)
+{
+  const unsigned int jump = prev_min + p2;
+  unsigned int cur_min = 0xffff;
+  for(int k=0; k<n; ++k)
+  {
+    unsigned int m = prev[k];
+    m = std::min(m, prev[k-1] + p1);
+    m = std::min(m, prev[k+1] + p1);
+    m = std::min(m, jump);
+    const unsigned int v = std::min(c[k] + m - prev_min, 0xffffu);
+    cur[k] = (unsigned short)v;
+    cur_min = std::min(cur_min, v);
+  }
+  return cur_min;
+}
+
+static void addRow_16u(const unsigned short* a, const unsigned short* b, unsigned short* d, int n)
+{
+  IU_CPU_IVDEP
+  for(int x=0; x<n; ++x)
+  {
+    const unsigned int v = (unsigned int)a[x] + b[x];
+    d[x] = (unsigned short)((v < 0xffff) ? v : 0xffff);
+  }
+}
+
+static int argminRow_16u(const unsigned short* IU_CPU_RESTRICT s, int n)
+{
+  unsigned short m = 0xffff;
+  for(int k=0; k<n; ++k)
+    m = (s[k] < m) ? s[k] : m;
+  for(int k=0; k<n; ++k)
+    if(s[k] == m)
+      return k;
+  return 0;
+}
+
+//-----------------------------------------------------------------------------
+void getStereoKernels(StereoKernels& kernels)
+{
+  kernels.censusRow_8u = censusRow<unsigned char>;
+  kernels.censusRow_32f = censusRow<float>;
+  kernels.hammingRow_8u = hammingRow<unsigned char>;
+  kernels.hammingRow_16u = hammingRow<unsigned short>;
+  kernels.absDiffRow_8u = absDiffRow_8u;
+  kernels.updateSumRow_16u = updateSumRow_16u;
+  kernels.boxStepRow_16u = boxStepRow_16u;
+  kernels.scaleRow_16u8u = scaleRow_16u8u;
+  kernels.sgmPathRow_8u = sgmPathRow<unsigned char>;
+  kernels.sgmPathRow_16u = sgmPathRow<unsigned short>;
+  kernels.addRow_16u = addRow_16u;
+  kernels.argminRow_16u = argminRow_16u;
+}
+
+} // namespace IU_CPU_KERNELS_NAMESPACE
+} // namespace iuprivate
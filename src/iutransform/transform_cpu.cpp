@@ -0,0 +1,691 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Geometric Transform
+ * Class       : none
+ * Language    : C++
+ * Description : Implementation of host resampling (reduce/prolongate) and remapping
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <math.h>
+#include <iucutil.h>
+#include <iucore/executor.h>
+#include <iucore/cpukernels.h>
+#include "transformkernels.h"
+#include "transform_cpu.h"
+
+namespace iuprivate {
+
+/* ***************************************************************************
+ *  HELPERS
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+static inline int clampIndex(int i, int length)
+{
+  return (i < 0) ? 0 : ((i >= length) ? length-1 : i);
+}
+
+//-----------------------------------------------------------------------------
+// cubic bspline basis (same weights as the device textures in bsplinetexture_kernels.cuh)
+static inline void bsplineWeights(float fraction, float* w)
+{
+  const float one_frac = 1.0f - fraction;
+  const float squared = fraction * fraction;
+  const float one_sqd = one_frac * one_frac;
+
+  w[0] = 1.0f/6.0f * one_sqd * one_frac;
+  w[1] = 2.0f/3.0f - 0.5f * squared * (2.0f-fraction);
+  w[2] = 2.0f/3.0f - 0.5f * one_sqd * (2.0f-one_frac);
+  w[3] = 1.0f/6.0f * squared * fraction;
+}
+
+/* ***************************************************************************
+ *  WEIGHT TABLES
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+void computeResampleWeights(int src_length, int dst_length,
+                            IuInterpolationType interpolation,
+                            float gauss_sigma, int gauss_kernel_size,
+                            ResampleWeights& weights)
+{
+  weights.offset.assign(dst_length, 0);
+  if(src_length <= 0 || dst_length <= 0)
+  {
+    weights.taps = 0;
+    weights.weight.clear();
+    return;
+  }
+
+  // interpolation support
+  int interp_taps;
+  switch(interpolation)
+  {
+  case IU_INTERPOLATE_NEAREST: interp_taps = 1; break;
+  case IU_INTERPOLATE_CUBIC:
+  case IU_INTERPOLATE_CUBIC_SPLINE: interp_taps = 4; break;
+  case IU_INTERPOLATE_LINEAR:
+  default: interp_taps = 2; break;
+  }
+
+  // normalized gaussian (identity if no pre-smoothing is wanted)
+  int radius = 0;
+  std::vector<float> gauss(1, 1.0f);
+  if(gauss_sigma > 0.0f && gauss_kernel_size > 1)
+  {
+    radius = (gauss_kernel_size-1)/2;
+    gauss.resize(2*radius+1);
+    float sum = 0.0f;
+    for(int t=-radius; t<=radius; ++t)
+    {
+      gauss[t+radius] = expf(-0.5f*t*t/(gauss_sigma*gauss_sigma));
+      sum += gauss[t+radius];
+    }
+    for(int t=0; t<=2*radius; ++t)
+      gauss[t] /= sum;
+  }
+
+  weights.taps = IUMIN(interp_taps + 2*radius, src_length);
+  weights.weight.assign(dst_length*weights.taps, 0.0f);
+
+  const float factor = (float)src_length / (float)dst_length;
+  int idx[4];
+  float w[4];
+
+  for(int o=0; o<dst_length; ++o)
+  {
+    // texture coordinate of the output sample
+    const float pos = (o + 0.5f) * factor;
+
+    if(interp_taps == 1)
+    {
+      idx[0] = (int)floorf(pos);
+      w[0] = 1.0f;
+    }
+    else
+    {
+      const float coord = pos - 0.5f;
+      const float index = floorf(coord);
+      const float fraction = coord - index;
+      if(interp_taps == 2)
+      {
+        idx[0] = (int)index;
+        idx[1] = idx[0]+1;
+        w[0] = 1.0f - fraction;
+        w[1] = fraction;
+      }
+      else
+      {
+        idx[0] = (int)index - 1;
+        for(int k=1; k<4; ++k)
+          idx[k] = idx[0]+k;
+        bsplineWeights(fraction, w);
+      }
+    }
+
+    // first source sample touched; the window is shifted to stay inside the source
+    int first = clampIndex(idx[0]-radius, src_length);
+    first = IUMIN(first, src_length-weights.taps);
+    weights.offset[o] = first;
+
+    // fold smoothing, interpolation and border clamping into one set of taps; as for
+    // filtering first and sampling then, the interpolation taps are clamped to the
+    // image and the smoothing around each of them clamps on its own
+    float* ow = &weights.weight[o*weights.taps];
+    for(int k=0; k<interp_taps; ++k)
+    {
+      const int sample = clampIndex(idx[k], src_length);
+      for(int t=-radius; t<=radius; ++t)
+      {
+        const int s = clampIndex(sample+t, src_length);
+        ow[s-first] += w[k]*gauss[t+radius];
+      }
+    }
+  }
+}
+
+/* ***************************************************************************
+ *  SEPARABLE RESAMPLING
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+// horizontal pass: source rows -> rows of the dense buffer
+template<int Channels>
+struct ResampleRowsX
+{
+  const float* src;
+  size_t src_stride;
+  float* buffer;
+  int dst_width;
+  const ResampleWeights* wx;
+
+  void operator()(int begin, int end) const
+  {
+    const int row_length = dst_width*Channels;
+    for(int y=begin; y<end; ++y)
+    {
+      const float* src_row = src + y*src_stride;
+      float* buf_row = buffer + (size_t)y*row_length;
+      for(int x=0; x<dst_width; ++x)
+      {
+        const float* s = src_row + wx->offset[x]*Channels;
+        const float* w = &wx->weight[x*wx->taps];
+        float sum[Channels];
+        for(int c=0; c<Channels; ++c)
+          sum[c] = 0.0f;
+        for(int t=0; t<wx->taps; ++t)
+          for(int c=0; c<Channels; ++c)
+            sum[c] += w[t]*s[t*Channels+c];
+        for(int c=0; c<Channels; ++c)
+          buf_row[x*Channels+c] = sum[c];
+      }
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+// vertical pass: weighted sums of whole buffer rows
+struct ResampleRowsY
+{
+  const float* buffer;
+  int row_length;
+  float* dst;
+  size_t dst_stride;
+  const ResampleWeights* wy;
+  const CpuKernels* kernels;
+
+  void operator()(int begin, int end) const
+  {
+    for(int y=begin; y<end; ++y)
+    {
+      float* dst_row = dst + y*dst_stride;
+      const float* w = &wy->weight[y*wy->taps];
+      const float* b = buffer + (size_t)wy->offset[y]*row_length;
+      kernels->scaleRow(b, w[0], dst_row, row_length);
+      for(int t=1; t<wy->taps; ++t)
+        kernels->axpyRow(b + (size_t)t*row_length, w[t], dst_row, row_length);
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+/* Resamples an interleaved image with Channels floats per pixel. The horizontal
+ * pass writes into a dense (src_height x dst_width) buffer, the vertical pass then
+ * accumulates whole rows of that buffer so the inner loop is contiguous.
+ */
+template<int Channels>
+static void resampleSeparable(const float* src, size_t src_stride, int src_width, int src_height,
+                              float* dst, size_t dst_stride, int dst_width, int dst_height,
+                              IuInterpolationType interpolation,
+                              float gauss_sigma, int gauss_kernel_size)
+{
+  if(src_width<=0 || src_height<=0 || dst_width<=0 || dst_height<=0)
+    return;
+
+  ResampleWeights wx, wy;
+  computeResampleWeights(src_width, dst_width, interpolation, gauss_sigma, gauss_kernel_size, wx);
+  computeResampleWeights(src_height, dst_height, interpolation, gauss_sigma, gauss_kernel_size, wy);
+
+  const int row_length = dst_width*Channels;
+  std::vector<float> buffer((size_t)src_height*row_length);
+
+  ResampleRowsX<Channels> pass_x;
+  pass_x.src = src;
+  pass_x.src_stride = src_stride;
+  pass_x.buffer = &buffer[0];
+  pass_x.dst_width = dst_width;
+  pass_x.wx = &wx;
+  iu::parallelFor(0, src_height, pass_x, iu::Executor::rowGrain(row_length*wx.taps));
+
+  ResampleRowsY pass_y;
+  pass_y.buffer = &buffer[0];
+  pass_y.row_length = row_length;
+  pass_y.dst = dst;
+  pass_y.dst_stride = dst_stride;
+  pass_y.wy = &wy;
+  pass_y.kernels = &cpuKernels();
+  iu::parallelFor(0, dst_height, pass_y, iu::Executor::rowGrain(row_length*wy.taps));
+}
+
+//-----------------------------------------------------------------------------
+// host; 32-bit; 1-channel
+void resample(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+              IuInterpolationType interpolation,
+              float gauss_sigma, int gauss_kernel_size)
+{
+  resampleSeparable<1>(src->data(), src->stride(), src->width(), src->height(),
+                       dst->data(), dst->stride(), dst->width(), dst->height(),
+                       interpolation, gauss_sigma, gauss_kernel_size);
+}
+
+// host; 32-bit; 2-channel
+void resample(const iu::ImageCpu_32f_C2* src, iu::ImageCpu_32f_C2* dst,
+              IuInterpolationType interpolation,
+              float gauss_sigma, int gauss_kernel_size)
+{
+  resampleSeparable<2>(reinterpret_cast<const float*>(src->data()), 2*src->stride(),
+                       src->width(), src->height(),
+                       reinterpret_cast<float*>(dst->data()), 2*dst->stride(),
+                       dst->width(), dst->height(),
+                       interpolation, gauss_sigma, gauss_kernel_size);
+}
+
+// host; 32-bit; 4-channel
+void resample(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+              IuInterpolationType interpolation,
+              float gauss_sigma, int gauss_kernel_size)
+{
+  resampleSeparable<4>(reinterpret_cast<const float*>(src->data()), 4*src->stride(),
+                       src->width(), src->height(),
+                       reinterpret_cast<float*>(dst->data()), 4*dst->stride(),
+                       dst->width(), dst->height(),
+                       interpolation, gauss_sigma, gauss_kernel_size);
+}
+
+/* ***************************************************************************
+ *  REMAPPING
+ * ***************************************************************************/
+
+// compact maps: integer coordinates (offset by REMAP_COORD_OFFSET) and fractions
+// of REMAP_FRACTION_BITS bits per axis (x in the low bits)
+static const int REMAP_FRACTION_BITS = 5;
+static const int REMAP_FRACTION_STEPS = 1 << REMAP_FRACTION_BITS;
+static const int REMAP_COORD_OFFSET = 2;
+static const int REMAP_MAX_COORD = 0xffff;
+
+//-----------------------------------------------------------------------------
+/* Taps (1: nearest, 2: linear, 4: cubic bspline) of one axis for the texture
+ * coordinate \a pos. The indices are clamped so the caller needs no border checks.
+ */
+template<int Taps>
+static inline void remapTaps(float pos, int length, int* idx, float* w)
+{
+  if(Taps == 1)
+  {
+    idx[0] = clampIndex((int)floorf(pos), length);
+    w[0] = 1.0f;
+    return;
+  }
+
+  const float coord = pos - 0.5f;
+  const float index = floorf(coord);
+  const float fraction = coord - index;
+  if(Taps == 2)
+  {
+    w[0] = 1.0f - fraction;
+    w[1] = fraction;
+  }
+  else
+    bsplineWeights(fraction, w);
+
+  const int first = (int)index - (Taps == 4 ? 1 : 0);
+  for(int k=0; k<Taps; ++k)
+    idx[k] = clampIndex(first+k, length);
+}
+
+//-----------------------------------------------------------------------------
+/* Taps of one axis from the compact maps: \a index is the integer part of the
+ * texture coordinate minus 0.5 and \a fraction its fractional part in units of
+ * 1/REMAP_FRACTION_STEPS; \a table holds the weights of all fractions.
+ */
+template<int Taps>
+static inline void compactRemapTaps(int index, int fraction, int length, const float* table,
+                                    int* idx, float* w)
+{
+  if(Taps == 1)
+  {
+    idx[0] = clampIndex(index + (fraction >= REMAP_FRACTION_STEPS/2 ? 1 : 0), length);
+    w[0] = 1.0f;
+    return;
+  }
+
+  const int first = index - (Taps == 4 ? 1 : 0);
+  for(int k=0; k<Taps; ++k)
+  {
+    idx[k] = clampIndex(first+k, length);
+    w[k] = table[fraction*Taps + k];
+  }
+}
+
+//-----------------------------------------------------------------------------
+/* Remaps \a num_planes float planes at once. For every output row the taps of
+ * all pixels are computed first (from the float disparities or from the compact
+ * maps); then every plane is sampled with the same taps in its own loop.
+ */
+template<int Taps>
+struct RemapRows
+{
+  const float* const* src;
+  size_t src_stride;
+  int src_width;
+  int src_height;
+  const iu::ImageCpu_32f_C1* dx_map;
+  const iu::ImageCpu_32f_C1* dy_map;
+  // compact maps (used instead of dx_map/dy_map if given)
+  const iu::ImageCpu_16u_C2* coords;
+  const iu::ImageCpu_16u_C1* fractions;
+  const float* table;
+  float* const* dst;
+  size_t dst_stride;
+  int dst_width;
+  int num_planes;
+  // dispatched row kernel for 2 and 4 taps (0: generic loop below)
+  void (*row)(const float*, size_t, const int*, const int*, const float*, const float*, float*, int);
+
+  void taps(int y, int* ix, int* iy, float* wx, float* wy) const
+  {
+    if(coords != 0)
+    {
+      const ushort2* c = coords->data(0,y);
+      const unsigned short* f = fractions->data(0,y);
+      for(int x=0; x<dst_width; ++x)
+      {
+        compactRemapTaps<Taps>(c[x].x - REMAP_COORD_OFFSET, f[x] & (REMAP_FRACTION_STEPS-1), src_width,
+                               table, &ix[x*Taps], &wx[x*Taps]);
+        compactRemapTaps<Taps>(c[x].y - REMAP_COORD_OFFSET, f[x] >> REMAP_FRACTION_BITS, src_height,
+                               table, &iy[x*Taps], &wy[x*Taps]);
+      }
+      return;
+    }
+
+    const float* dx = dx_map->data(0,y);
+    const float* dy = dy_map->data(0,y);
+    for(int x=0; x<dst_width; ++x)
+    {
+      remapTaps<Taps>(x+0.5f+dx[x], src_width, &ix[x*Taps], &wx[x*Taps]);
+      remapTaps<Taps>(y+0.5f+dy[x], src_height, &iy[x*Taps], &wy[x*Taps]);
+    }
+  }
+
+  void operator()(int begin, int end) const
+  {
+    // tap buffers for one output row (one set per chunk)
+    std::vector<int> ix(dst_width*Taps), iy(dst_width*Taps);
+    std::vector<float> wx(dst_width*Taps), wy(dst_width*Taps);
+
+    for(int y=begin; y<end; ++y)
+    {
+      taps(y, &ix[0], &iy[0], &wx[0], &wy[0]);
+
+      for(int c=0; c<num_planes; ++c)
+      {
+        const float* s = src[c];
+        float* d = dst[c] + y*dst_stride;
+        if(row != 0)
+        {
+          row(s, src_stride, &ix[0], &iy[0], &wx[0], &wy[0], d, dst_width);
+          continue;
+        }
+        for(int x=0; x<dst_width; ++x)
+        {
+          const int* xi = &ix[x*Taps];
+          const int* yi = &iy[x*Taps];
+          const float* xw = &wx[x*Taps];
+          const float* yw = &wy[x*Taps];
+          float sum = 0.0f;
+          for(int ky=0; ky<Taps; ++ky)
+          {
+            const float* row = s + yi[ky]*src_stride;
+            float row_sum = 0.0f;
+            for(int kx=0; kx<Taps; ++kx)
+              row_sum += xw[kx]*row[xi[kx]];
+            sum += yw[ky]*row_sum;
+          }
+          d[x] = sum;
+        }
+      }
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+// disparities of a remap: float maps or compact maps (the others are 0)
+struct RemapMaps
+{
+  const iu::ImageCpu_32f_C1* dx_map;
+  const iu::ImageCpu_32f_C1* dy_map;
+  const iu::ImageCpu_16u_C2* coords;
+  const iu::ImageCpu_16u_C1* fractions;
+
+  RemapMaps(const iu::ImageCpu_32f_C1* dx, const iu::ImageCpu_32f_C1* dy) :
+    dx_map(dx), dy_map(dy), coords(0), fractions(0) {}
+  RemapMaps(const iu::ImageCpu_16u_C2* c, const iu::ImageCpu_16u_C1* f) :
+    dx_map(0), dy_map(0), coords(c), fractions(f) {}
+};
+
+template<int Taps>
+static void remapPlanes(const float* const* src, size_t src_stride, int src_width, int src_height,
+                        const RemapMaps& maps,
+                        float* const* dst, size_t dst_stride, int dst_width, int dst_height,
+                        int num_planes)
+{
+  if(src_width<=0 || src_height<=0 || dst_width<=0 || dst_height<=0)
+    return;
+
+  // weights of all fractions of the compact maps
+  float table[REMAP_FRACTION_STEPS*4];
+  for(int f=0; f<REMAP_FRACTION_STEPS; ++f)
+  {
+    const float fraction = (float)f/REMAP_FRACTION_STEPS;
+    if(Taps == 4)
+      bsplineWeights(fraction, &table[f*4]);
+    else if(Taps == 2)
+    {
+      table[f*2] = 1.0f - fraction;
+      table[f*2+1] = fraction;
+    }
+  }
+
+  RemapRows<Taps> body;
+  body.src = src;
+  body.src_stride = src_stride;
+  body.src_width = src_width;
+  body.src_height = src_height;
+  body.dx_map = maps.dx_map;
+  body.dy_map = maps.dy_map;
+  body.coords = maps.coords;
+  body.fractions = maps.fractions;
+  body.table = table;
+  body.dst = dst;
+  body.dst_stride = dst_stride;
+  body.dst_width = dst_width;
+  body.num_planes = num_planes;
+  const TransformKernels& kernels = transformKernels();
+  body.row = (Taps == 2) ? kernels.remapRow2 : ((Taps == 4) ? kernels.remapRow4 : 0);
+  iu::parallelFor(0, dst_height, body, iu::Executor::rowGrain(dst_width*num_planes*Taps*Taps));
+}
+
+//-----------------------------------------------------------------------------
+static void remapPlanes(const float* const* src, size_t src_stride, int src_width, int src_height,
+                        const RemapMaps& maps,
+                        float* const* dst, size_t dst_stride, int dst_width, int dst_height,
+                        int num_planes, IuInterpolationType interpolation)
+{
+  switch(interpolation)
+  {
+  case IU_INTERPOLATE_NEAREST:
+    remapPlanes<1>(src, src_stride, src_width, src_height, maps,
+                   dst, dst_stride, dst_width, dst_height, num_planes);
+    break;
+  case IU_INTERPOLATE_CUBIC:
+  case IU_INTERPOLATE_CUBIC_SPLINE:
+    remapPlanes<4>(src, src_stride, src_width, src_height, maps,
+                   dst, dst_stride, dst_width, dst_height, num_planes);
+    break;
+  case IU_INTERPOLATE_LINEAR:
+  default:
+    remapPlanes<2>(src, src_stride, src_width, src_height, maps,
+                   dst, dst_stride, dst_width, dst_height, num_planes);
+    break;
+  }
+}
+
+//-----------------------------------------------------------------------------
+template<class PlanarImage>
+static void remapPlanar(const PlanarImage* src, const RemapMaps& maps,
+                        PlanarImage* dst, IuInterpolationType interpolation)
+{
+  const float* src_planes[4];
+  float* dst_planes[4];
+  for(unsigned int c=0; c<src->channels(); ++c)
+  {
+    src_planes[c] = src->plane(c);
+    dst_planes[c] = dst->plane(c);
+  }
+  remapPlanes(src_planes, src->stride(), src->width(), src->height(), maps,
+              dst_planes, dst->stride(), dst->width(), dst->height(),
+              src->channels(), interpolation);
+}
+
+//-----------------------------------------------------------------------------
+static void checkCompactMaps(const iu::ImageCpu_16u_C2* coords, const iu::ImageCpu_16u_C1* fractions,
+                             const IuSize& size)
+{
+  if(coords->size() != size || fractions->size() != size)
+    throw IuException("the compact maps have to be of the size of the destination image",
+                      __FILE__, __FUNCTION__, __LINE__);
+}
+
+static void checkMaps(const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+                      const IuSize& size)
+{
+  if(dx_map->size() != size || dy_map->size() != size)
+    throw IuException("dx_map and dy_map have to be of the size of the destination image",
+                      __FILE__, __FUNCTION__, __LINE__);
+}
+
+//-----------------------------------------------------------------------------
+// host; 32-bit; 1-channel
+void remap(const iu::ImageCpu_32f_C1* src,
+           const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+           iu::ImageCpu_32f_C1* dst, IuInterpolationType interpolation)
+{
+  checkMaps(dx_map, dy_map, dst->size());
+  const float* src_plane = src->data();
+  float* dst_plane = dst->data();
+  remapPlanes(&src_plane, src->stride(), src->width(), src->height(), RemapMaps(dx_map, dy_map),
+              &dst_plane, dst->stride(), dst->width(), dst->height(), 1, interpolation);
+}
+
+// host; 32-bit; planar 3-channel
+void remap(const iu::ImagePlanarCpu_32f_C3* src,
+           const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+           iu::ImagePlanarCpu_32f_C3* dst, IuInterpolationType interpolation)
+{
+  checkMaps(dx_map, dy_map, dst->size());
+  remapPlanar(src, RemapMaps(dx_map, dy_map), dst, interpolation);
+}
+
+// host; 32-bit; planar 4-channel
+void remap(const iu::ImagePlanarCpu_32f_C4* src,
+           const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+           iu::ImagePlanarCpu_32f_C4* dst, IuInterpolationType interpolation)
+{
+  checkMaps(dx_map, dy_map, dst->size());
+  remapPlanar(src, RemapMaps(dx_map, dy_map), dst, interpolation);
+}
+
+//-----------------------------------------------------------------------------
+/* Fixed point texture coordinates (x+0.5+dx-0.5 = x+dx) in units of
+ * 1/REMAP_FRACTION_STEPS, split into the (offset) integer part and the fraction.
+ */
+struct ConvertRemapMapsRows
+{
+  const iu::ImageCpu_32f_C1* dx_map;
+  const iu::ImageCpu_32f_C1* dy_map;
+  iu::ImageCpu_16u_C2* coords;
+  iu::ImageCpu_16u_C1* fractions;
+  int width;
+
+  static inline int fixedPoint(float coord)
+  {
+    // the coordinates are clamped where the taps are clamped to the border anyway
+    const float limit = (float)(REMAP_MAX_COORD - REMAP_COORD_OFFSET);
+    coord = IUMIN(IUMAX(coord, -(float)REMAP_COORD_OFFSET), limit);
+    return (int)floorf(coord*REMAP_FRACTION_STEPS + 0.5f) + REMAP_COORD_OFFSET*REMAP_FRACTION_STEPS;
+  }
+
+  void operator()(int begin, int end) const
+  {
+    for(int y=begin; y<end; ++y)
+    {
+      const float* dx = dx_map->data(0,y);
+      const float* dy = dy_map->data(0,y);
+      ushort2* c = coords->data(0,y);
+      unsigned short* f = fractions->data(0,y);
+      for(int x=0; x<width; ++x)
+      {
+        const int qx = fixedPoint(x + dx[x]);
+        const int qy = fixedPoint(y + dy[x]);
+        c[x].x = (unsigned short)(qx >> REMAP_FRACTION_BITS);
+        c[x].y = (unsigned short)(qy >> REMAP_FRACTION_BITS);
+        f[x] = (unsigned short)(((qy & (REMAP_FRACTION_STEPS-1)) << REMAP_FRACTION_BITS) |
+                                (qx & (REMAP_FRACTION_STEPS-1)));
+      }
+    }
+  }
+};
+
+// host; float disparities -> compact maps
+void convertRemapMaps(const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+                      iu::ImageCpu_16u_C2* coords, iu::ImageCpu_16u_C1* fractions)
+{
+  if(dx_map->size() != dy_map->size())
+    throw IuException("dx_map and dy_map have to be of the same size", __FILE__, __FUNCTION__, __LINE__);
+  checkCompactMaps(coords, fractions, dx_map->size());
+
+  ConvertRemapMapsRows body;
+  body.dx_map = dx_map;
+  body.dy_map = dy_map;
+  body.coords = coords;
+  body.fractions = fractions;
+  body.width = dx_map->width();
+  iu::parallelFor(0, dx_map->height(), body, iu::Executor::rowGrain(body.width));
+}
+
+// host; 32-bit; 1-channel; compact maps
+void remap(const iu::ImageCpu_32f_C1* src,
+           const iu::ImageCpu_16u_C2* coords, const iu::ImageCpu_16u_C1* fractions,
+           iu::ImageCpu_32f_C1* dst, IuInterpolationType interpolation)
+{
+  checkCompactMaps(coords, fractions, dst->size());
+  const float* src_plane = src->data();
+  float* dst_plane = dst->data();
+  remapPlanes(&src_plane, src->stride(), src->width(), src->height(), RemapMaps(coords, fractions),
+              &dst_plane, dst->stride(), dst->width(), dst->height(), 1, interpolation);
+}
+
+// host; 32-bit; planar 3-channel; compact maps
+void remap(const iu::ImagePlanarCpu_32f_C3* src,
+           const iu::ImageCpu_16u_C2* coords, const iu::ImageCpu_16u_C1* fractions,
+           iu::ImagePlanarCpu_32f_C3* dst, IuInterpolationType interpolation)
+{
+  checkCompactMaps(coords, fractions, dst->size());
+  remapPlanar(src, RemapMaps(coords, fractions), dst, interpolation);
+}
+
+// host; 32-bit; planar 4-channel; compact maps
+void remap(const iu::ImagePlanarCpu_32f_C4* src,
+           const iu::ImageCpu_16u_C2* coords, const iu::ImageCpu_16u_C1* fractions,
+           iu::ImagePlanarCpu_32f_C4* dst, IuInterpolationType interpolation)
+{
+  checkCompactMaps(coords, fractions, dst->size());
+  remapPlanar(src, RemapMaps(coords, fractions), dst, interpolation);
+}
+
+} // namespace iuprivate
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Geometric Transformations
+ * Class       : none
+ * Language    : C++
+ * Description : Definition of host resampling (reduce/prolongate) and remapping
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+/* ****************************************************************************
+ *  W A R N I N G
+ *  -------------
+ *
+ *  This file is not part of the IU API.  It exists purely as an
+ *  implementation detail.  This header file may change from version to
+ *  version without notice, or even be removed.
+ *
+ *  We mean it.
+ * ****************************************************************************
+ */
+
+#ifndef IUPRIVATE_TRANSFORM_CPU_H
+#define IUPRIVATE_TRANSFORM_CPU_H
+
+#include <vector>
+#include <iucore/coredefs.h>
+#include <iucore/memorydefs.h>
+
+namespace iuprivate {
+
+/** Precomputed resampling weights for one image axis.
+ * Output sample \a o is the weighted sum of the source samples
+ * offset[o] ... offset[o]+taps-1 with the weights weight[o*taps] ... weight[o*taps+taps-1].
+ * Border clamping (and an optional gaussian pre-smoothing) is already folded into
+ * the weights, so applying them needs no index checks at all.
+ */
+struct ResampleWeights
+{
+  int taps;
+  std::vector<int> offset;
+  std::vector<float> weight;
+};
+
+/** Computes the weight table for resampling \a src_length samples to \a dst_length samples.
+ * The sampling positions match the device kernels, i.e. output sample x is taken from
+ * source position (x+0.5)*src_length/dst_length with clamped texture addressing.
+ * \param gauss_sigma If > 0 a gaussian with the given sigma and \a gauss_kernel_size
+ *        is convolved into the weights (fused pre-smoothing). The result equals
+ *        smoothing with clamped borders first and sampling the smoothed image then.
+ */
+void computeResampleWeights(int src_length, int dst_length,
+                            IuInterpolationType interpolation,
+                            float gauss_sigma, int gauss_kernel_size,
+                            ResampleWeights& weights);
+
+// host; 32-bit; separable resampling of the whole image (src->size() -> dst->size())
+void resample(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+              IuInterpolationType interpolation,
+              float gauss_sigma = 0.0f, int gauss_kernel_size = 0);
+void resample(const iu::ImageCpu_32f_C2* src, iu::ImageCpu_32f_C2* dst,
+              IuInterpolationType interpolation,
+              float gauss_sigma = 0.0f, int gauss_kernel_size = 0);
+void resample(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+              IuInterpolationType interpolation,
+              float gauss_sigma = 0.0f, int gauss_kernel_size = 0);
+
+/** Host remapping (warping) with the dense disparities \a dx_map and \a dy_map.
+ * Same sampling as the device remap: dst(x,y) = src(x+dx(x,y), y+dy(x,y)) with clamped
+ * borders; cubic and cubic spline interpolation both evaluate the cubic bspline.
+ * The sample positions and weights are computed once per pixel and shared by all planes.
+ */
+void remap(const iu::ImageCpu_32f_C1* src,
+           const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+           iu::ImageCpu_32f_C1* dst, IuInterpolationType interpolation);
+void remap(const iu::ImagePlanarCpu_32f_C3* src,
+           const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+           iu::ImagePlanarCpu_32f_C3* dst, IuInterpolationType interpolation);
+void remap(const iu::ImagePlanarCpu_32f_C4* src,
+           const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+           iu::ImagePlanarCpu_32f_C4* dst, IuInterpolationType interpolation);
+
+/** Converts the float disparities of a fixed warp into compact maps (see iu::convertRemapMaps):
+ * per pixel the offset integer texture coordinates (16 bits per axis) and the fractions
+ * (5 bits per axis) that index precomputed weight tables.
+ */
+void convertRemapMaps(const iu::ImageCpu_32f_C1* dx_map, const iu::ImageCpu_32f_C1* dy_map,
+                      iu::ImageCpu_16u_C2* coords, iu::ImageCpu_16u_C1* fractions);
+
+// host; remapping with compact maps (same sampling as with the float disparities)
+void remap(const iu::ImageCpu_32f_C1* src,
+           const iu::ImageCpu_16u_C2* coords, const iu::ImageCpu_16u_C1* fractions,
+           iu::ImageCpu_32f_C1* dst, IuInterpolationType interpolation);
+void remap(const iu::ImagePlanarCpu_32f_C3* src,
+           const iu::ImageCpu_16u_C2* coords, const iu::ImageCpu_16u_C1* fractions,
+           iu::ImagePlanarCpu_32f_C3* dst, IuInterpolationType interpolation);
+void remap(const iu::ImagePlanarCpu_32f_C4* src,
+           const iu::ImageCpu_16u_C2* coords, const iu::ImageCpu_16u_C1* fractions,
+           iu::ImagePlanarCpu_32f_C4* dst, IuInterpolationType interpolation);
+
+} // namespace iuprivate
+
+#endif // IUPRIVATE_TRANSFORM_CPU_H
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Geometric Transformations
+ * Class       : none
+ * Language    : C++
+ * Description : Row kernels of the host remapping, warping and optical flow
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IUPRIVATE_TRANSFORMKERNELS_H
+#define IUPRIVATE_TRANSFORMKERNELS_H
+
+#include <cstddef>
+
+//////////////////////////////////////////////////////////////////////////////
+// DISCLAIMER: the following declarations are internal and may change in any
+// version without notice, or even be removed.
+//////////////////////////////////////////////////////////////////////////////
+
+namespace iuprivate {
+
+/** Row kernels of the geometric transformations for one instruction set level (compiled
+ * like the core kernels, see iucore/cpukernels.h). All loops run over \a n elements.
+ */
+struct TransformKernels
+{
+  /** d[x] = sum_ky wy[ky]*sum_kx wx[kx]*s[iy[ky]*stride + ix[kx]] with 2 taps per pixel and direction */
+  void (*remapRow2)(const float* s, size_t stride, const int* ix, const int* iy,
+                    const float* wx, const float* wy, float* d, int n);
+  /** as remapRow2 with 4 taps */
+  void (*remapRow4)(const float* s, size_t stride, const int* ix, const int* iy,
+                    const float* wx, const float* wy, float* d, int n);
+  /** TV-L1 flow: thresholding and primal step of one row of (u1,u2); p*_up are the
+   * dual rows above (zeros for the first row), p1y/p2y zeros for the last row */
+  void (*tvl1PrimalRow)(const float* ix, const float* iy, const float* rho, const float* ig,
+                        const float* p1x, const float* p1y, const float* p1y_up,
+                        const float* p2x, const float* p2y, const float* p2y_up,
+                        float lt, float theta, float* u1, float* u2, int n);
+  /** TV-L1 flow: dual step of one row of p; u*_down are the flow rows below (u itself for the last row) */
+  void (*tvl1DualRow)(const float* u1, const float* u2, const float* u1_down, const float* u2_down,
+                      float taut, float* p1x, float* p1y, float* p2x, float* p2y, int n);
+  /** source positions of a row of an affine warp: sx = x0 + k*dx, sy = y0 + k*dy */
+  void (*warpAffineCoordsRow)(float x0, float y0, float dx, float dy, float* sx, float* sy, int n);
+  /** as warpAffineCoordsRow for a perspective warp: divided by w = w0 + k*dw */
+  void (*warpPerspectiveCoordsRow)(float x0, float y0, float w0, float dx, float dy, float dw,
+                                   float* sx, float* sy, int n);
+  /** d[k] = s sampled at (sx[k],sy[k]) with 1 (nearest), 2 (linear) or 4 (cubic bspline) taps
+   * per direction; all taps have to be inside the image (no clamping); stride in elements */
+  void (*warpRow_8u_C1)(const unsigned char* s, size_t stride, const float* sx, const float* sy,
+                        int taps, unsigned char* d, int n);
+  void (*warpRow_8u_C4)(const unsigned char* s, size_t stride, const float* sx, const float* sy,
+                        int taps, unsigned char* d, int n);
+  void (*warpRow_32f_C1)(const float* s, size_t stride, const float* sx, const float* sy,
+                         int taps, float* d, int n);
+  void (*warpRow_32f_C4)(const float* s, size_t stride, const float* sx, const float* sy,
+                         int taps, float* d, int n);
+};
+
+/** Returns the transform kernels of the level selected by iu::CpuDispatch. */
+const TransformKernels& transformKernels();
+
+} // namespace iuprivate
+
+#endif // IUPRIVATE_TRANSFORMKERNELS_H
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Geometric Transformations
+ * Class       : none
+ * Language    : C++
+ * Description : Row kernels of the geometric transformations; compiled once per instruction set level
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+// No include guard: this file is included by the transformkernels_<level>.cpp files,
+// each defining IU_CPU_KERNELS_NAMESPACE and compiled with the target flags of
+// the core kernels of that level (iucore/cpukernels_impl.h).
+
+#ifndef IU_CPU_KERNELS_NAMESPACE
+  #error "IU_CPU_KERNELS_NAMESPACE has to be defined"
+#endif
+
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include <iucore/cpukernelsdefs.h>
+#include <iucore/warpweights.h>
+#include "transformkernels.h"
+
+namespace iuprivate {
+namespace IU_CPU_KERNELS_NAMESPACE {
+
+//-----------------------------------------------------------------------------
+template<int Taps>
+static void remapRow(const float* IU_CPU_RESTRICT s, size_t stride,
+                     const int* IU_CPU_RESTRICT ix, const int* IU_CPU_RESTRICT iy,
+                     const float* IU_CPU_RESTRICT wx, const float* IU_CPU_RESTRICT wy,
+                     float* IU_CPU_RESTRICT d, int n)
+{
+  for(int x=0; x<n; ++x)
+  {
+    const int* xi = ix + x*Taps;
+    const int* yi = iy + x*Taps;
+    const float* xw = wx + x*Taps;
+    const float* yw = wy + x*Taps;
+    float sum = 0.0f;
+    for(int ky=0; ky<Taps; ++ky)
+    {
+      const float* row = s + yi[ky]*stride;
+      float row_sum = 0.0f;
+      for(int kx=0; kx<Taps; ++kx)
+        row_sum += xw[kx]*row[xi[kx]];
+      sum += yw[ky]*row_sum;
+    }
+    d[x] = sum;
+  }
+}
+
+static void remapRow2(const float* s, size_t stride, const int* ix, const int* iy,
+                      const float* wx, const float* wy, float* d, int n)
+{
+  remapRow<2>(s, stride, ix, iy, wx, wy, d, n);
+}
+
+static void remapRow4(const float* s, size_t stride, const int* ix, const int* iy,
+                      const float* wx, const float* wy, float* d, int n)
+{
+  remapRow<4>(s, stride, ix, iy, wx, wy, d, n);
+}
+
+//-----------------------------------------------------------------------------
+/* TV-L1 optical flow (Zach et al.): thresholding of the linearized data term
+ * followed by the primal step u = v + theta*div(p). rho is the residual at the
+ * warping flow (rho_c), ig = 1/|grad I|^2 (0 for a vanishing gradient). The
+ * divergence is the negative adjoint of the forward differences of tvl1DualRow,
+ * i.e. p is taken as 0 left of the row and at its last element.
+ */
+static inline void tvl1Primal(float ix, float iy, float rho_c, float ig, float div1, float div2,
+                              float lt, float theta, float& u1, float& u2)
+{
+  const float rho = rho_c + ix*u1 + iy*u2;
+  float step = -rho*ig;
+  step = (step < lt) ? step : lt;
+  step = (step > -lt) ? step : -lt;
+  u1 = u1 + step*ix + theta*div1;
+  u2 = u2 + step*iy + theta*div2;
+}
+
+static void tvl1PrimalRow(const float* IU_CPU_RESTRICT ix, const float* IU_CPU_RESTRICT iy,
+                          const float* IU_CPU_RESTRICT rho, const float* IU_CPU_RESTRICT ig,
+                          const float* IU_CPU_RESTRICT p1x, const float* IU_CPU_RESTRICT p1y,
+                          const float* IU_CPU_RESTRICT p1y_up,
+                          const float* IU_CPU_RESTRICT p2x, const float* IU_CPU_RESTRICT p2y,
+                          const float* IU_CPU_RESTRICT p2y_up,
+                          float lt, float theta, float* IU_CPU_RESTRICT u1, float* IU_CPU_RESTRICT u2, int n)
+{
+  if(n == 1)
+  {
+    tvl1Primal(ix[0], iy[0], rho[0], ig[0], p1y[0]-p1y_up[0], p2y[0]-p2y_up[0], lt, theta, u1[0], u2[0]);
+    return;
+  }
+  tvl1Primal(ix[0], iy[0], rho[0], ig[0], p1x[0] + p1y[0]-p1y_up[0], p2x[0] + p2y[0]-p2y_up[0],
+             lt, theta, u1[0], u2[0]);
+  for(int x=1; x<n-1; ++x)
+  {
+    const float div1 = p1x[x]-p1x[x-1] + p1y[x]-p1y_up[x];
+    const float div2 = p2x[x]-p2x[x-1] + p2y[x]-p2y_up[x];
+    tvl1Primal(ix[x], iy[x], rho[x], ig[x], div1, div2, lt, theta, u1[x], u2[x]);
+  }
+  const int x = n-1;
+  tvl1Primal(ix[x], iy[x], rho[x], ig[x], -p1x[x-1] + p1y[x]-p1y_up[x], -p2x[x-1] + p2y[x]-p2y_up[x],
+             lt, theta, u1[x], u2[x]);
+}
+
+//-----------------------------------------------------------------------------
+/* Dual step of TV-L1: p = (p + taut*grad u)/(1 + taut*|grad u|) for both flow
+ * components, forward differences (0 at the last element and for u_down = u).
+ */
+static inline void tvl1Dual(float u1x, float u1y, float u2x, float u2y, float taut,
+                            float& p1x, float& p1y, float& p2x, float& p2y)
+{
+  const float ng1 = 1.0f/(1.0f + taut*std::sqrt(u1x*u1x + u1y*u1y));
+  const float ng2 = 1.0f/(1.0f + taut*std::sqrt(u2x*u2x + u2y*u2y));
+  p1x = (p1x + taut*u1x)*ng1;
+  p1y = (p1y + taut*u1y)*ng1;
+  p2x = (p2x + taut*u2x)*ng2;
+  p2y = (p2y + taut*u2y)*ng2;
+}
+
+static void tvl1DualRow(const float* IU_CPU_RESTRICT u1, const float* IU_CPU_RESTRICT u2,
+                        const float* IU_CPU_RESTRICT u1_down, const float* IU_CPU_RESTRICT u2_down,
+                        float taut, float* IU_CPU_RESTRICT p1x, float* IU_CPU_RESTRICT p1y,
+                        float* IU_CPU_RESTRICT p2x, float* IU_CPU_RESTRICT p2y, int n)
+{
+  for(int x=0; x<n-1; ++x)
+    tvl1Dual(u1[x+1]-u1[x], u1_down[x]-u1[x], u2[x+1]-u2[x], u2_down[x]-u2[x], taut,
+             p1x[x], p1y[x], p2x[x], p2y[x]);
+  const int x = n-1;
+  tvl1Dual(0.0f, u1_down[x]-u1[x], 0.0f, u2_down[x]-u2[x], taut, p1x[x], p1y[x], p2x[x], p2y[x]);
+}
+
+//-----------------------------------------------------------------------------
+static void warpAffineCoordsRow(float x0, float y0, float dx, float dy,
+                                float* IU_CPU_RESTRICT sx, float* IU_CPU_RESTRICT sy, int n)
+{
+  for(int k=0; k<n; ++k)
+  {
+    sx[k] = x0 + k*dx;
+    sy[k] = y0 + k*dy;
+  }
+}
+
+static void warpPerspectiveCoordsRow(float x0, float y0, float w0, float dx, float dy, float dw,
+                                     float* IU_CPU_RESTRICT sx, float* IU_CPU_RESTRICT sy, int n)
+{
+  for(int k=0; k<n; ++k)
+  {
+    const float w = 1.0f/(w0 + k*dw);
+    sx[k] = (x0 + k*dx)*w;
+    sy[k] = (y0 + k*dy)*w;
+  }
+}
+
+template<typename T, int Channels, int Taps>
+static void warpRowT(const T* IU_CPU_RESTRICT s, size_t stride,
+                     const float* IU_CPU_RESTRICT sx, const float* IU_CPU_RESTRICT sy,
+                     T* IU_CPU_RESTRICT d, int n)
+{
+  for(int k=0; k<n; ++k)
+  {
+    float wx[Taps], wy[Taps];
+    const int x = warpWeights<Taps>(sx[k], wx);
+    const int y = warpWeights<Taps>(sy[k], wy);
+    const T* p = s + y*stride + x*Channels;
+    for(int c=0; c<Channels; ++c)
+    {
+      float sum = 0.0f;
+      for(int ky=0; ky<Taps; ++ky)
+      {
+        const T* row = p + ky*stride + c;
+        float row_sum = 0.0f;
+        for(int kx=0; kx<Taps; ++kx)
+          row_sum += wx[kx]*row[kx*Channels];
+        sum += wy[ky]*row_sum;
+      }
+      warpStore(sum, d + k*Channels + c);
+    }
+  }
+}
+
+template<typename T, int Channels>
+static void warpRow(const T* s, size_t stride, const float* sx, const float* sy, int taps, T* d, int n)
+{
+  if(taps == 1)
+    warpRowT<T, Channels, 1>(s, stride, sx, sy, d, n);
+  else if(taps == 2)
+    warpRowT<T, Channels, 2>(s, stride, sx, sy, d, n);
+  else
+    warpRowT<T, Channels, 4>(s, stride, sx, sy, d, n);
+}
+
+//-----------------------------------------------------------------------------
+void getTransformKernels(TransformKernels& kernels)
+{
+  kernels.remapRow2 = remapRow2;
+  kernels.remapRow4 = remapRow4;
+  kernels.tvl1PrimalRow = tvl1PrimalRow;
+  kernels.tvl1DualRow = tvl1DualRow;
+  kernels.warpAffineCoordsRow = warpAffineCoordsRow;
+  kernels.warpPerspectiveCoordsRow = warpPerspectiveCoordsRow;
+  kernels.warpRow_8u_C1 = warpRow<unsigned char, 1>;
+  kernels.warpRow_8u_C4 = warpRow<unsigned char, 4>;
+  kernels.warpRow_32f_C1 = warpRow<float, 1>;
+  kernels.warpRow_32f_C4 = warpRow<float, 4>;
+}
+
+} // namespace IU_CPU_KERNELS_NAMESPACE
+} // namespace iuprivate
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Geometric Transformations
+ * Class       : none
+ * Language    : C++
+ * Description : Implementation of the host affine and perspective warps
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <string.h>
+#include <math.h>
+#include <vector>
+#include <iucutil.h>
+#include <iucore/executor.h>
+#include <iucore/warpweights.h>
+#include "transformkernels.h"
+#include "warp_cpu.h"
+
+namespace iuprivate {
+
+/* ***************************************************************************
+ *  Affine and perspective warps
+ * ***************************************************************************/
+// The destination is processed in tiles (source accesses of rotated rows stay
+// local). For every tile row the source positions are generated from the start
+// position and the per-pixel step of the transform; the row is then clipped
+// into the pixels outside of the source image (set to 0), the pixels whose taps
+// are all inside (dispatched row kernel without any clamping) and the pixels in
+// between (taps clamped to the border). All three sets are intervals since a
+// row is mapped onto a line (the part with w > 0 for perspective warps).
+
+static const unsigned int WARP_TILE_WIDTH = 128;
+static const unsigned int WARP_TILE_HEIGHT = 32;
+
+//-----------------------------------------------------------------------------
+static inline int clampIndex(int i, int length)
+{
+  return (i < 0) ? 0 : ((i >= length) ? length-1 : i);
+}
+
+//-----------------------------------------------------------------------------
+static inline void warpRow(const TransformKernels& k, const unsigned char* s, size_t stride, const float* sx,
+                           const float* sy, int taps, unsigned char* d, int n, int channels)
+{
+  if(channels == 1)
+    k.warpRow_8u_C1(s, stride, sx, sy, taps, d, n);
+  else
+    k.warpRow_8u_C4(s, stride, sx, sy, taps, d, n);
+}
+static inline void warpRow(const TransformKernels& k, const float* s, size_t stride, const float* sx,
+                           const float* sy, int taps, float* d, int n, int channels)
+{
+  if(channels == 1)
+    k.warpRow_32f_C1(s, stride, sx, sy, taps, d, n);
+  else
+    k.warpRow_32f_C4(s, stride, sx, sy, taps, d, n);
+}
+
+//-----------------------------------------------------------------------------
+template<typename T, int Channels>
+struct WarpTiles
+{
+  const T* src;
+  size_t src_stride;
+  int src_width;
+  int src_height;
+  T* dst;
+  size_t dst_stride;
+  // destination -> source pixel coordinates (row-major 3x3; last row 0 0 1 for affine warps)
+  double m[9];
+  bool perspective;
+  int taps;
+  const TransformKernels* kernels;
+
+  bool inside(float x, float y) const
+  {
+    return x >= -0.5f && x < src_width-0.5f && y >= -0.5f && y < src_height-0.5f;
+  }
+
+  bool interior(float x, float y) const
+  {
+    // index range of the first tap and the taps right of it
+    const float lo = (taps == 1) ? -0.5f : ((taps == 2) ? 0.0f : 1.0f);
+    const float hi = (taps == 1) ? 0.5f : ((taps == 2) ? 1.0f : 2.0f);
+    return x >= lo && x < src_width-hi && y >= lo && y < src_height-hi;
+  }
+
+  template<int Taps>
+  void sampleClamped(float x, float y, T* d) const
+  {
+    float wx[Taps], wy[Taps];
+    const int ix = warpWeights<Taps>(x, wx);
+    const int iy = warpWeights<Taps>(y, wy);
+    int cx[Taps];
+    for(int kx=0; kx<Taps; ++kx)
+      cx[kx] = clampIndex(ix+kx, src_width)*Channels;
+    for(int c=0; c<Channels; ++c)
+    {
+      float sum = 0.0f;
+      for(int ky=0; ky<Taps; ++ky)
+      {
+        const T* row = src + clampIndex(iy+ky, src_height)*src_stride + c;
+        float row_sum = 0.0f;
+        for(int kx=0; kx<Taps; ++kx)
+          row_sum += wx[kx]*row[cx[kx]];
+        sum += wy[ky]*row_sum;
+      }
+      warpStore(sum, d + c);
+    }
+  }
+
+  void sampleClamped(const float* sx, const float* sy, T* d, int n) const
+  {
+    for(int k=0; k<n; ++k)
+    {
+      if(taps == 1)
+        sampleClamped<1>(sx[k], sy[k], d + k*Channels);
+      else if(taps == 2)
+        sampleClamped<2>(sx[k], sy[k], d + k*Channels);
+      else
+        sampleClamped<4>(sx[k], sy[k], d + k*Channels);
+    }
+  }
+
+  // pixels [begin,end) of the row with w > 0
+  void positiveSpan(double w0, double dw, int n, int& begin, int& end) const
+  {
+    begin = 0;
+    end = n;
+    if(dw == 0.0)
+    {
+      if(w0 <= 0.0)
+        end = 0;
+      return;
+    }
+    const double root = -w0/dw;
+    if(dw > 0.0)
+      begin = (int)IUMIN(IUMAX(floor(root) + 1.0, 0.0), (double)n);
+    else
+      end = (int)IUMIN(IUMAX(ceil(root), 0.0), (double)n);
+    while(begin < end && w0 + begin*dw <= 0.0)
+      ++begin;
+    while(end > begin && w0 + (end-1)*dw <= 0.0)
+      --end;
+  }
+
+  void operator()(const IuRect& tile) const
+  {
+    const int n = tile.width;
+    std::vector<float> sx(n), sy(n);
+    for(unsigned int y=tile.y; y<tile.y+tile.height; ++y)
+    {
+      const double x0 = m[0]*tile.x + m[1]*y + m[2];
+      const double y0 = m[3]*tile.x + m[4]*y + m[5];
+      T* d = dst + y*dst_stride + tile.x*Channels;
+
+      int begin = 0;
+      int end = n;
+      if(perspective)
+      {
+        const double w0 = m[6]*tile.x + m[7]*y + m[8];
+        positiveSpan(w0, m[6], n, begin, end);
+        kernels->warpPerspectiveCoordsRow((float)x0, (float)y0, (float)w0, (float)m[0], (float)m[3],
+                                          (float)m[6], &sx[0], &sy[0], n);
+      }
+      else
+        kernels->warpAffineCoordsRow((float)x0, (float)y0, (float)m[0], (float)m[3], &sx[0], &sy[0], n);
+
+      // clip to the source image, then to the pixels without clamping
+      while(begin < end && !inside(sx[begin], sy[begin]))
+        ++begin;
+      while(end > begin && !inside(sx[end-1], sy[end-1]))
+        --end;
+      int first = begin;
+      int last = end;
+      while(first < last && !interior(sx[first], sy[first]))
+        ++first;
+      while(last > first && !interior(sx[last-1], sy[last-1]))
+        --last;
+
+      memset(d, 0, begin*Channels*sizeof(T));
+      sampleClamped(&sx[begin], &sy[begin], d + begin*Channels, first-begin);
+      if(last > first)
+        warpRow(*kernels, src, src_stride, &sx[first], &sy[first], taps, d + first*Channels,
+                last-first, Channels);
+      sampleClamped(&sx[last], &sy[last], d + last*Channels, end-last);
+      memset(d + end*Channels, 0, (n-end)*Channels*sizeof(T));
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+template<typename T, int Channels, class Image>
+static void warp(const Image* src, Image* dst, const float* coeffs, bool perspective,
+                 IuInterpolationType interpolation)
+{
+  if(dst->width() == 0 || dst->height() == 0)
+    return;
+  if(src->width() == 0 || src->height() == 0)
+    throw IuException("the source image is empty", __FILE__, __FUNCTION__, __LINE__);
+
+  WarpTiles<T, Channels> body;
+  body.src = reinterpret_cast<const T*>(src->data());
+  body.src_stride = src->stride()*Channels;
+  body.src_width = src->width();
+  body.src_height = src->height();
+  body.dst = reinterpret_cast<T*>(dst->data());
+  body.dst_stride = dst->stride()*Channels;
+  for(int i=0; i<6; ++i)
+    body.m[i] = coeffs[i];
+  body.m[6] = perspective ? coeffs[6] : 0.0;
+  body.m[7] = perspective ? coeffs[7] : 0.0;
+  body.m[8] = perspective ? coeffs[8] : 1.0;
+  body.perspective = perspective;
+  switch(interpolation)
+  {
+  case IU_INTERPOLATE_NEAREST: body.taps = 1; break;
+  case IU_INTERPOLATE_CUBIC:
+  case IU_INTERPOLATE_CUBIC_SPLINE: body.taps = 4; break;
+  case IU_INTERPOLATE_LINEAR:
+  default: body.taps = 2; break;
+  }
+  body.kernels = &transformKernels();
+  iu::parallelForTiles(IuRect(0, 0, dst->width(), dst->height()), body, WARP_TILE_WIDTH, WARP_TILE_HEIGHT);
+}
+
+/* ***************************************************************************
+ *  FUNCTION IMPLEMENTATIONS
+ * ***************************************************************************/
+
+// host; 8-bit; 1-channel
+void warpAffine(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                const float coeffs[6], IuInterpolationType interpolation)
+{
+  warp<unsigned char, 1>(src, dst, coeffs, false, interpolation);
+}
+
+// host; 8-bit; 4-channel
+void warpAffine(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                const float coeffs[6], IuInterpolationType interpolation)
+{
+  warp<unsigned char, 4>(src, dst, coeffs, false, interpolation);
+}
+
+// host; 32-bit; 1-channel
+void warpAffine(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                const float coeffs[6], IuInterpolationType interpolation)
+{
+  warp<float, 1>(src, dst, coeffs, false, interpolation);
+}
+
+// host; 32-bit; 4-channel
+void warpAffine(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                const float coeffs[6], IuInterpolationType interpolation)
+{
+  warp<float, 4>(src, dst, coeffs, false, interpolation);
+}
+
+// host; 8-bit; 1-channel
+void warpPerspective(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                     const float coeffs[9], IuInterpolationType interpolation)
+{
+  warp<unsigned char, 1>(src, dst, coeffs, true, interpolation);
+}
+
+// host; 8-bit; 4-channel
+void warpPerspective(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                     const float coeffs[9], IuInterpolationType interpolation)
+{
+  warp<unsigned char, 4>(src, dst, coeffs, true, interpolation);
+}
+
+// host; 32-bit; 1-channel
+void warpPerspective(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                     const float coeffs[9], IuInterpolationType interpolation)
+{
+  warp<float, 1>(src, dst, coeffs, true, interpolation);
+}
+
+// host; 32-bit; 4-channel
+void warpPerspective(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                     const float coeffs[9], IuInterpolationType interpolation)
+{
+  warp<float, 4>(src, dst, coeffs, true, interpolation);
+}
+
+} // namespace iuprivate
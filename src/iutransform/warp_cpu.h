@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Geometric Transformations
+ * Class       : none
+ * Language    : C++
+ * Description : Definition of the host affine and perspective warps
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+/* ****************************************************************************
+ *  W A R N I N G
+ *  -------------
+ *
+ *  This file is not part of the IU API.  It exists purely as an
+ *  implementation detail.  This header file may change from version to
+ *  version without notice, or even be removed.
+ *
+ *  We mean it.
+ * ****************************************************************************
+ */
+
+#ifndef IUPRIVATE_WARP_CPU_H
+#define IUPRIVATE_WARP_CPU_H
+
+#include <iucore/coredefs.h>
+#include <iucore/memorydefs.h>
+
+namespace iuprivate {
+
+/** Host affine warps: dst(x,y) = src(c[0]*x + c[1]*y + c[2], c[3]*x + c[4]*y + c[5])
+ * (see iu::warpAffine). The source positions are generated per row; pixels that map
+ * outside of the source image are set to 0.
+ */
+void warpAffine(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                const float coeffs[6], IuInterpolationType interpolation);
+void warpAffine(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                const float coeffs[6], IuInterpolationType interpolation);
+void warpAffine(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                const float coeffs[6], IuInterpolationType interpolation);
+void warpAffine(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                const float coeffs[6], IuInterpolationType interpolation);
+
+/** Host perspective warps with the homography \a coeffs (row-major 3x3) from destination
+ * to source pixel coordinates (see iu::warpPerspective).
+ */
+void warpPerspective(const iu::ImageCpu_8u_C1* src, iu::ImageCpu_8u_C1* dst,
+                     const float coeffs[9], IuInterpolationType interpolation);
+void warpPerspective(const iu::ImageCpu_8u_C4* src, iu::ImageCpu_8u_C4* dst,
+                     const float coeffs[9], IuInterpolationType interpolation);
+void warpPerspective(const iu::ImageCpu_32f_C1* src, iu::ImageCpu_32f_C1* dst,
+                     const float coeffs[9], IuInterpolationType interpolation);
+void warpPerspective(const iu::ImageCpu_32f_C4* src, iu::ImageCpu_32f_C4* dst,
+                     const float coeffs[9], IuInterpolationType interpolation);
+
+} // namespace iuprivate
+
+#endif // IUPRIVATE_WARP_CPU_H
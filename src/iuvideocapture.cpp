@@ -23,6 +23,7 @@
 
 #include <iuio/videocapture.h>
 #include "iuvideocapture.h"
+#include "iucore/trace.h"
 
 namespace iu {
 
@@ -54,12 +55,14 @@ VideoCapture::~VideoCapture()
 //-----------------------------------------------------------------------------
 bool VideoCapture::getImage(iu::ImageCpu_32f_C1* image)
 {
+  IU_TRACE_FUNCTION();
   return video_capture_->getImage(image);
 }
 
 //-----------------------------------------------------------------------------
 bool VideoCapture::getImage(iu::ImageGpu_32f_C1* image)
 {
+  IU_TRACE_FUNCTION();
   return video_capture_->getImage(image);
 }
 
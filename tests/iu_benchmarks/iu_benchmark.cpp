@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Benchmarks
+ * Class       : none
+ * Language    : C++
+ * Description : Benchmark runner: parameter sweep, console table and JSON report
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <iucutil.h>
+#include "iu_benchmark.h"
+
+namespace iubench {
+
+// a run stops after this many timed iterations even if min_time is not reached
+static const int MAX_ITERATIONS = 1000000;
+
+//-----------------------------------------------------------------------------
+struct Benchmark
+{
+  std::string name;
+  BenchmarkFunction function;
+};
+
+// function local static: registrars of other translation units may run first
+static std::vector<Benchmark>& registry()
+{
+  static std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+Registrar::Registrar(const char* name, BenchmarkFunction function)
+{
+  Benchmark benchmark;
+  benchmark.name = name;
+  benchmark.function = function;
+  registry().push_back(benchmark);
+}
+
+//-----------------------------------------------------------------------------
+State::State(const IuSize& size, int threads, double min_time) :
+  size_(size), threads_(threads), min_time_(min_time),
+  iterations_(0), calls_(0), start_(0.0), total_time_(0.0),
+  bytes_(0.0), pixels_(0.0)
+{
+}
+
+bool State::keepRunning()
+{
+  ++calls_;
+  if(calls_ == 1)  // warm-up iteration (page faults, caches)
+    return true;
+
+  const double now = iu::getTime();
+  if(calls_ == 2)
+  {
+    start_ = now;
+    return true;
+  }
+
+  ++iterations_;
+  total_time_ = now - start_;
+  return total_time_ < min_time_ && iterations_ < MAX_ITERATIONS;
+}
+
+/* ***************************************************************************
+ *  RESULTS
+ * ***************************************************************************/
+
+struct Result
+{
+  std::string name;
+  IuSize size;
+  int threads;
+  int iterations;
+  double time;     // [ms] per iteration
+  double gbps;     // [GB/s]
+  double mpixps;   // [Mpix/s]
+  std::string skipped;
+};
+
+static std::string runName(const std::string& name, const IuSize& size, int threads)
+{
+  std::ostringstream out;
+  out << name << "/" << size.width << "x" << size.height << "/threads:" << threads;
+  return out.str();
+}
+
+static void printResult(FILE* out, const Result& r)
+{
+  const std::string name = runName(r.name, r.size, r.threads);
+  if(!r.skipped.empty())
+    fprintf(out, "%-52s  skipped: %s\n", name.c_str(), r.skipped.c_str());
+  else
+    fprintf(out, "%-52s %10d %12.4f ms %10.2f GB/s %10.1f Mpix/s\n",
+            name.c_str(), r.iterations, r.time, r.gbps, r.mpixps);
+  fflush(out);
+}
+
+static std::string jsonEscape(const std::string& text)
+{
+  std::string escaped;
+  for(size_t i=0; i<text.size(); ++i)
+  {
+    if(text[i] == '"' || text[i] == '\\')
+      escaped += '\\';
+    if(text[i] == '\n')
+      escaped += "\\n";
+    else
+      escaped += text[i];
+  }
+  return escaped;
+}
+
+static void writeJson(std::ostream& out, const std::vector<Result>& results)
+{
+  char date[64];
+  time_t now = time(0);
+  strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+  out << "{\n";
+  out << "  \"context\": {\n";
+  out << "    \"date\": \"" << date << "\",\n";
+  out << "    \"library\": \"ImageUtilities\",\n";
+  out << "    \"max_threads\": " << iu::Executor::numThreads() << "\n";
+  out << "  },\n";
+  out << "  \"benchmarks\": [";
+  for(size_t i=0; i<results.size(); ++i)
+  {
+    const Result& r = results[i];
+    out << (i == 0 ? "\n" : ",\n");
+    out << "    {\n";
+    out << "      \"name\": \"" << runName(r.name, r.size, r.threads) << "\",\n";
+    out << "      \"benchmark\": \"" << r.name << "\",\n";
+    out << "      \"width\": " << r.size.width << ",\n";
+    out << "      \"height\": " << r.size.height << ",\n";
+    out << "      \"threads\": " << r.threads << ",\n";
+    if(!r.skipped.empty())
+    {
+      out << "      \"skipped\": \"" << jsonEscape(r.skipped) << "\"\n";
+    }
+    else
+    {
+      out << "      \"iterations\": " << r.iterations << ",\n";
+      out << "      \"real_time\": " << r.time << ",\n";
+      out << "      \"time_unit\": \"ms\",\n";
+      out << "      \"bytes_per_second\": " << r.gbps*1e9 << ",\n";
+      out << "      \"items_per_second\": " << r.mpixps*1e6 << "\n";
+    }
+    out << "    }";
+  }
+  out << "\n  ]\n}\n";
+}
+
+/* ***************************************************************************
+ *  COMMAND LINE
+ * ***************************************************************************/
+
+static void split(const std::string& list, std::vector<std::string>& items)
+{
+  std::stringstream in(list);
+  std::string item;
+  while(std::getline(in, item, ','))
+    if(!item.empty())
+      items.push_back(item);
+}
+
+static bool parseSize(const std::string& name, IuSize& size)
+{
+  if(name == "vga")         size = IuSize(640, 480);
+  else if(name == "hd")     size = IuSize(1280, 720);
+  else if(name == "fullhd") size = IuSize(1920, 1080);
+  else if(name == "4k")     size = IuSize(3840, 2160);
+  else if(name == "8k")     size = IuSize(7680, 4320);
+  else
+  {
+    unsigned int width = 0, height = 0;
+    if(sscanf(name.c_str(), "%ux%u", &width, &height) != 2 || width == 0 || height == 0)
+      return false;
+    size = IuSize(width, height);
+  }
+  return true;
+}
+
+static void usage(const char* program)
+{
+  std::cout << "usage: " << program << " [options]\n"
+            << "  --filter=<text>    only run benchmarks whose name contains <text>\n"
+            << "  --sizes=<list>     image sizes: vga,hd,fullhd,4k,8k or WxH (default: all named sizes)\n"
+            << "  --threads=<list>   host thread counts (default: 1 and the maximum)\n"
+            << "  --min_time=<ms>    minimal measuring time per run (default: 250)\n"
+            << "  --json=<file>      write the results as JSON to <file> ('-': stdout)\n"
+            << "  --list             list the benchmarks and exit\n";
+}
+
+//-----------------------------------------------------------------------------
+int runBenchmarks(int argc, char** argv)
+{
+  std::string filter;
+  std::string json_file;
+  std::string size_list = "vga,hd,fullhd,4k,8k";
+  std::string thread_list;
+  double min_time = 250.0;
+  bool list_only = false;
+
+  for(int i=1; i<argc; ++i)
+  {
+    std::string arg = argv[i];
+    if(arg.compare(0, 9, "--filter=") == 0)        filter = arg.substr(9);
+    else if(arg.compare(0, 8, "--sizes=") == 0)    size_list = arg.substr(8);
+    else if(arg.compare(0, 10, "--threads=") == 0) thread_list = arg.substr(10);
+    else if(arg.compare(0, 11, "--min_time=") == 0) min_time = atof(arg.substr(11).c_str());
+    else if(arg.compare(0, 7, "--json=") == 0)     json_file = arg.substr(7);
+    else if(arg == "--list")                       list_only = true;
+    else
+    {
+      usage(argv[0]);
+      return (arg == "--help" || arg == "-h") ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+
+  std::vector<Benchmark> benchmarks;
+  for(size_t i=0; i<registry().size(); ++i)
+    if(filter.empty() || registry()[i].name.find(filter) != std::string::npos)
+      benchmarks.push_back(registry()[i]);
+
+  if(list_only)
+  {
+    for(size_t i=0; i<benchmarks.size(); ++i)
+      std::cout << benchmarks[i].name << std::endl;
+    return EXIT_SUCCESS;
+  }
+
+  std::vector<std::string> items;
+  std::vector<IuSize> sizes;
+  split(size_list, items);
+  for(size_t i=0; i<items.size(); ++i)
+  {
+    IuSize size;
+    if(!parseSize(items[i], size))
+    {
+      std::cerr << "unknown image size '" << items[i] << "'" << std::endl;
+      return EXIT_FAILURE;
+    }
+    sizes.push_back(size);
+  }
+
+  const int max_threads = iu::Executor::numThreads();
+  std::vector<int> threads;
+  items.clear();
+  split(thread_list, items);
+  for(size_t i=0; i<items.size(); ++i)
+    threads.push_back(atoi(items[i].c_str()));
+  if(threads.empty())
+  {
+    threads.push_back(1);
+    if(max_threads > 1)
+      threads.push_back(max_threads);
+  }
+
+  // the table goes to stderr if stdout carries the JSON report
+  FILE* table = (json_file == "-") ? stderr : stdout;
+
+  std::vector<Result> results;
+  for(size_t b=0; b<benchmarks.size(); ++b)
+  {
+    for(size_t s=0; s<sizes.size(); ++s)
+    {
+      for(size_t t=0; t<threads.size(); ++t)
+      {
+        iu::Executor::setNumThreads(threads[t]);
+        State state(sizes[s], threads[t], min_time);
+        try
+        {
+          benchmarks[b].function(state);
+        }
+        catch(std::bad_alloc&)
+        {
+          state.skip("out of memory");
+        }
+        catch(IuException& e)
+        {
+          state.skip(e.what());
+        }
+
+        Result r;
+        r.name = benchmarks[b].name;
+        r.size = sizes[s];
+        r.threads = threads[t];
+        r.iterations = state.iterations();
+        r.skipped = state.skipped();
+        if(r.skipped.empty() && state.iterations() == 0)
+          r.skipped = "no iterations";
+        r.time = r.skipped.empty() ? state.totalTime()/state.iterations() : 0.0;
+        r.gbps = r.skipped.empty() ? state.bytes()/(r.time*1e6) : 0.0;
+        r.mpixps = r.skipped.empty() ? state.pixels()/(r.time*1e3) : 0.0;
+        results.push_back(r);
+        printResult(table, r);
+      }
+    }
+  }
+  iu::Executor::setNumThreads(0);
+
+  if(json_file == "-")
+    writeJson(std::cout, results);
+  else if(!json_file.empty())
+  {
+    std::ofstream out(json_file.c_str());
+    if(!out)
+    {
+      std::cerr << "could not open '" << json_file << "'" << std::endl;
+      return EXIT_FAILURE;
+    }
+    writeJson(out, results);
+  }
+
+  return EXIT_SUCCESS;
+}
+
+} // namespace iubench
+
+//-----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  return iubench::runBenchmarks(argc, argv);
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Benchmarks
+ * Class       : none
+ * Language    : C++
+ * Description : Minimal benchmark harness (registration, timing loop, reporting)
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#ifndef IU_BENCHMARK_H
+#define IU_BENCHMARK_H
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <iucore.h>
+
+namespace iubench {
+
+/** State of one benchmark run (one image size and one thread count).
+ * The benchmark function allocates its data, then times the operation with
+ * \code
+ * while (state.keepRunning())
+ *   iu::copy(&src, &dst);
+ * state.setBytesProcessed(2*src.bytes());
+ * state.setPixelsProcessed(src.width()*src.height());
+ * \endcode
+ * Bytes and pixels are given per iteration.
+ */
+class State
+{
+public:
+  State(const IuSize& size, int threads, double min_time);
+
+  /** Image size of this run. */
+  const IuSize& size() const { return size_; }
+
+  /** Number of host threads of this run (already set on iu::Executor). */
+  int threads() const { return threads_; }
+
+  /** Returns true as long as another iteration has to be timed. The first
+   * call executes one untimed warm-up iteration.
+   */
+  bool keepRunning();
+
+  /** Bytes read and written by one iteration. */
+  void setBytesProcessed(double bytes) { bytes_ = bytes; }
+
+  /** Pixels processed by one iteration. */
+  void setPixelsProcessed(double pixels) { pixels_ = pixels; }
+
+  /** Marks the run as skipped (e.g. not enough memory). */
+  void skip(const std::string& reason) { skipped_ = reason; }
+
+  int iterations() const { return iterations_; }
+  double totalTime() const { return total_time_; }
+  double bytes() const { return bytes_; }
+  double pixels() const { return pixels_; }
+  const std::string& skipped() const { return skipped_; }
+
+private:
+  IuSize size_;
+  int threads_;
+  double min_time_;    // [ms]
+  int iterations_;     // timed iterations
+  int calls_;
+  double start_;       // [ms]
+  double total_time_;  // [ms]
+  double bytes_;
+  double pixels_;
+  std::string skipped_;
+};
+
+typedef void (*BenchmarkFunction)(State& state);
+
+/** Zeroes the whole buffer of a host image (including the padding), so no
+ * benchmark runs on uninitialized (possibly denormal) data.
+ */
+template<typename PixelType, class Allocator, IuPixelType _pixel_type>
+inline void clear(iu::ImageCpu<PixelType, Allocator, _pixel_type>& image)
+{
+  memset(image.data(), 0, image.bytes());
+}
+
+template<unsigned int _channels, IuPixelType _pixel_type>
+inline void clear(iu::ImagePlanarCpu<_channels, _pixel_type>& image)
+{
+  memset(image.plane(0), 0, image.bytes());
+}
+
+/** Registers a benchmark at static initialization time. */
+class Registrar
+{
+public:
+  Registrar(const char* name, BenchmarkFunction function);
+};
+
+/** Runs all registered benchmarks according to the command line (see --help). */
+int runBenchmarks(int argc, char** argv);
+
+} // namespace iubench
+
+/** Defines and registers the benchmark function \a name. */
+#define IU_BENCHMARK(name) \
+  static void name(iubench::State& state); \
+  static iubench::Registrar name##_registrar(#name, name); \
+  static void name(iubench::State& state)
+
+#endif // IU_BENCHMARK_H
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Benchmarks
+ * Class       : none
+ * Language    : C++
+ * Description : Benchmarks of the host entry points of the core module
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <iucore.h>
+#include "iu_benchmark.h"
+
+/* ***************************************************************************
+ *  COPY / SET VALUE
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+template<typename PixelType, class Image>
+static void benchCopy(iubench::State& state)
+{
+  Image src(state.size());
+  Image dst(state.size());
+  iubench::clear(src);
+  while (state.keepRunning())
+    iu::copy(&src, &dst);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(2.0*pixels*sizeof(PixelType));
+  state.setPixelsProcessed(pixels);
+}
+
+static iubench::Registrar copy_8u_C1("copy_8u_C1", benchCopy<unsigned char, iu::ImageCpu_8u_C1>);
+static iubench::Registrar copy_8u_C2("copy_8u_C2", benchCopy<uchar2, iu::ImageCpu_8u_C2>);
+static iubench::Registrar copy_8u_C3("copy_8u_C3", benchCopy<uchar3, iu::ImageCpu_8u_C3>);
+static iubench::Registrar copy_8u_C4("copy_8u_C4", benchCopy<uchar4, iu::ImageCpu_8u_C4>);
+static iubench::Registrar copy_32f_C1("copy_32f_C1", benchCopy<float, iu::ImageCpu_32f_C1>);
+static iubench::Registrar copy_32f_C2("copy_32f_C2", benchCopy<float2, iu::ImageCpu_32f_C2>);
+static iubench::Registrar copy_32f_C3("copy_32f_C3", benchCopy<float3, iu::ImageCpu_32f_C3>);
+static iubench::Registrar copy_32f_C4("copy_32f_C4", benchCopy<float4, iu::ImageCpu_32f_C4>);
+
+//-----------------------------------------------------------------------------
+template<typename PixelType, class Image>
+static void benchSetValue(iubench::State& state)
+{
+  Image img(state.size());
+  const PixelType value = PixelType();
+  while (state.keepRunning())
+    iu::setValue(value, &img, img.roi());
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(pixels*sizeof(PixelType));
+  state.setPixelsProcessed(pixels);
+}
+
+static iubench::Registrar setValue_8u_C1("setValue_8u_C1", benchSetValue<unsigned char, iu::ImageCpu_8u_C1>);
+static iubench::Registrar setValue_8u_C2("setValue_8u_C2", benchSetValue<uchar2, iu::ImageCpu_8u_C2>);
+static iubench::Registrar setValue_8u_C3("setValue_8u_C3", benchSetValue<uchar3, iu::ImageCpu_8u_C3>);
+static iubench::Registrar setValue_8u_C4("setValue_8u_C4", benchSetValue<uchar4, iu::ImageCpu_8u_C4>);
+static iubench::Registrar setValue_32f_C1("setValue_32f_C1", benchSetValue<float, iu::ImageCpu_32f_C1>);
+static iubench::Registrar setValue_32f_C2("setValue_32f_C2", benchSetValue<float2, iu::ImageCpu_32f_C2>);
+static iubench::Registrar setValue_32f_C3("setValue_32f_C3", benchSetValue<float3, iu::ImageCpu_32f_C3>);
+static iubench::Registrar setValue_32f_C4("setValue_32f_C4", benchSetValue<float4, iu::ImageCpu_32f_C4>);
+
+/* ***************************************************************************
+ *  CONVERSIONS
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+IU_BENCHMARK(convert_32f8u_C1)
+{
+  iu::ImageCpu_32f_C1 src(state.size());
+  iu::ImageCpu_8u_C1 dst(state.size());
+  iu::setValue(0.5f, &src, src.roi());
+  while (state.keepRunning())
+    iu::convert_32f8u_C1(&src, &dst);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(pixels*(sizeof(float)+sizeof(unsigned char)));
+  state.setPixelsProcessed(pixels);
+}
+
+//-----------------------------------------------------------------------------
+IU_BENCHMARK(convert_16u32f_C1)
+{
+  iu::ImageCpu_16u_C1 src(state.size());
+  iu::ImageCpu_32f_C1 dst(state.size());
+  iubench::clear(src);
+  while (state.keepRunning())
+    iu::convert_16u32f_C1(&src, &dst, 1.0f/65535.0f, 0.0f);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(pixels*(sizeof(unsigned short)+sizeof(float)));
+  state.setPixelsProcessed(pixels);
+}
+
+//-----------------------------------------------------------------------------
+template<typename SrcPixel, class Src, typename DstPixel, class Dst>
+static void benchConvertLayout(iubench::State& state)
+{
+  Src src(state.size());
+  Dst dst(state.size());
+  iubench::clear(src);
+  while (state.keepRunning())
+    iu::convert(&src, &dst);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(pixels*(sizeof(SrcPixel)+sizeof(DstPixel)));
+  state.setPixelsProcessed(pixels);
+}
+
+// the planar pixel "types" only serve for the byte count
+struct PlanarPixel_C3 { float c[3]; };
+struct PlanarPixel_C4 { float c[4]; };
+
+static iubench::Registrar convert_32f_C3_planarC3(
+    "convert_32f_C3_planarC3",
+    benchConvertLayout<float3, iu::ImageCpu_32f_C3, PlanarPixel_C3, iu::ImagePlanarCpu_32f_C3>);
+static iubench::Registrar convert_32f_C4_planarC3(
+    "convert_32f_C4_planarC3",
+    benchConvertLayout<float4, iu::ImageCpu_32f_C4, PlanarPixel_C3, iu::ImagePlanarCpu_32f_C3>);
+static iubench::Registrar convert_32f_C4_planarC4(
+    "convert_32f_C4_planarC4",
+    benchConvertLayout<float4, iu::ImageCpu_32f_C4, PlanarPixel_C4, iu::ImagePlanarCpu_32f_C4>);
+static iubench::Registrar convert_planarC3_32f_C3(
+    "convert_planarC3_32f_C3",
+    benchConvertLayout<PlanarPixel_C3, iu::ImagePlanarCpu_32f_C3, float3, iu::ImageCpu_32f_C3>);
+static iubench::Registrar convert_planarC3_32f_C4(
+    "convert_planarC3_32f_C4",
+    benchConvertLayout<PlanarPixel_C3, iu::ImagePlanarCpu_32f_C3, float4, iu::ImageCpu_32f_C4>);
+static iubench::Registrar convert_planarC4_32f_C4(
+    "convert_planarC4_32f_C4",
+    benchConvertLayout<PlanarPixel_C4, iu::ImagePlanarCpu_32f_C4, float4, iu::ImageCpu_32f_C4>);
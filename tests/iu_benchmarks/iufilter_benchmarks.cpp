@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Benchmarks
+ * Class       : none
+ * Language    : C++
+ * Description : Benchmarks of the host entry points of the filter module
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <iucore.h>
+#include <iufilter.h>
+#include "iu_benchmark.h"
+
+/* ***************************************************************************
+ *  GAUSS
+ * ***************************************************************************/
+
+// The byte counts of the filters are the compulsory traffic (read source,
+// write destination), not the traffic caused by the filter taps.
+
+//-----------------------------------------------------------------------------
+template<class Image>
+static void benchFilterGauss(iubench::State& state, unsigned int channels)
+{
+  Image src(state.size());
+  Image dst(state.size());
+  const IuRect roi(0, 0, state.size().width, state.size().height);
+  iubench::clear(src);
+  while (state.keepRunning())
+    iu::filterGauss(&src, &dst, roi, 2.0f);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(2.0*pixels*channels*sizeof(float));
+  state.setPixelsProcessed(pixels);
+}
+
+IU_BENCHMARK(filterGauss_32f_C1)
+{
+  benchFilterGauss<iu::ImageCpu_32f_C1>(state, 1);
+}
+
+IU_BENCHMARK(filterGauss_planarC3)
+{
+  benchFilterGauss<iu::ImagePlanarCpu_32f_C3>(state, 3);
+}
+
+IU_BENCHMARK(filterGauss_planarC4)
+{
+  benchFilterGauss<iu::ImagePlanarCpu_32f_C4>(state, 4);
+}
+
+/* ***************************************************************************
+ *  EDGE
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+template<typename SrcPixel, class Src, typename DstPixel, class Dst>
+static void benchFilterEdge(iubench::State& state)
+{
+  Src src(state.size());
+  Dst dst(state.size());
+  const IuRect roi(0, 0, state.size().width, state.size().height);
+  iubench::clear(src);
+  while (state.keepRunning())
+    iu::filterEdge(&src, &dst, roi, 10.0f, 1.0f, 0.01f);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(pixels*(sizeof(SrcPixel)+sizeof(DstPixel)));
+  state.setPixelsProcessed(pixels);
+}
+
+IU_BENCHMARK(filterEdge_32f_C1_C2_gradient)
+{
+  iu::ImageCpu_32f_C1 src(state.size());
+  iu::ImageCpu_32f_C2 dst(state.size());
+  const IuRect roi(0, 0, state.size().width, state.size().height);
+  iubench::clear(src);
+  while (state.keepRunning())
+    iu::filterEdge(&src, &dst, roi);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(pixels*(sizeof(float)+sizeof(float2)));
+  state.setPixelsProcessed(pixels);
+}
+
+static iubench::Registrar filterEdge_32f_C1_C1(
+    "filterEdge_32f_C1_C1", benchFilterEdge<float, iu::ImageCpu_32f_C1, float, iu::ImageCpu_32f_C1>);
+static iubench::Registrar filterEdge_32f_C1_C2(
+    "filterEdge_32f_C1_C2", benchFilterEdge<float, iu::ImageCpu_32f_C1, float2, iu::ImageCpu_32f_C2>);
+static iubench::Registrar filterEdge_32f_C1_C4(
+    "filterEdge_32f_C1_C4", benchFilterEdge<float, iu::ImageCpu_32f_C1, float4, iu::ImageCpu_32f_C4>);
+static iubench::Registrar filterEdge_32f_C4_C1(
+    "filterEdge_32f_C4_C1", benchFilterEdge<float4, iu::ImageCpu_32f_C4, float, iu::ImageCpu_32f_C1>);
+static iubench::Registrar filterEdge_32f_C4_C2(
+    "filterEdge_32f_C4_C2", benchFilterEdge<float4, iu::ImageCpu_32f_C4, float2, iu::ImageCpu_32f_C2>);
+static iubench::Registrar filterEdge_32f_C4_C4(
+    "filterEdge_32f_C4_C4", benchFilterEdge<float4, iu::ImageCpu_32f_C4, float4, iu::ImageCpu_32f_C4>);
+
+/* ***************************************************************************
+ *  EDGE PRESERVING
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+template<typename PixelType, class Image>
+static void benchFilterGuided(iubench::State& state)
+{
+  Image src(state.size());
+  Image dst(state.size());
+  iubench::clear(src);
+  while (state.keepRunning())
+    iu::filterGuided(&src, 0, &dst, 8, 0.01f);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(2.0*pixels*sizeof(PixelType));
+  state.setPixelsProcessed(pixels);
+}
+
+//-----------------------------------------------------------------------------
+template<typename PixelType, class Image>
+static void benchFilterBilateral(iubench::State& state)
+{
+  Image src(state.size());
+  Image dst(state.size());
+  iubench::clear(src);
+  while (state.keepRunning())
+    iu::filterBilateral(&src, 0, &dst, 8.0f, 0.1f);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(2.0*pixels*sizeof(PixelType));
+  state.setPixelsProcessed(pixels);
+}
+
+static iubench::Registrar filterGuided_32f_C1(
+    "filterGuided_32f_C1", benchFilterGuided<float, iu::ImageCpu_32f_C1>);
+static iubench::Registrar filterGuided_32f_C4(
+    "filterGuided_32f_C4", benchFilterGuided<float4, iu::ImageCpu_32f_C4>);
+static iubench::Registrar filterBilateral_32f_C1(
+    "filterBilateral_32f_C1", benchFilterBilateral<float, iu::ImageCpu_32f_C1>);
+static iubench::Registrar filterBilateral_32f_C4(
+    "filterBilateral_32f_C4", benchFilterBilateral<float4, iu::ImageCpu_32f_C4>);
+
+/* ***************************************************************************
+ *  BSPLINE PREFILTER
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+template<typename PixelType, class Image>
+static void benchCubicBSplinePrefilter(iubench::State& state)
+{
+  Image img(state.size());
+  iubench::clear(img);
+  while (state.keepRunning())
+    iu::cubicBSplinePrefilter(&img);
+
+  // in-place: one read and one write per pass (x and y)
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(4.0*pixels*sizeof(PixelType));
+  state.setPixelsProcessed(pixels);
+}
+
+static iubench::Registrar cubicBSplinePrefilter_32f_C1(
+    "cubicBSplinePrefilter_32f_C1", benchCubicBSplinePrefilter<float, iu::ImageCpu_32f_C1>);
+static iubench::Registrar cubicBSplinePrefilter_32f_C4(
+    "cubicBSplinePrefilter_32f_C4", benchCubicBSplinePrefilter<float4, iu::ImageCpu_32f_C4>);
+
+/* ***************************************************************************
+ *  CONVOLUTION
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+template<typename PixelType, class Image>
+static void benchFilterSeparable(iubench::State& state)
+{
+  Image src(state.size());
+  Image dst(state.size());
+  iubench::clear(src);
+  const float kernel[5] = {0.0625f, 0.25f, 0.375f, 0.25f, 0.0625f};
+  while (state.keepRunning())
+    iu::filterSeparable(&src, &dst, kernel, 5, kernel, 5, IU_BORDER_REFLECT);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(2.0*pixels*sizeof(PixelType));
+  state.setPixelsProcessed(pixels);
+}
+
+static iubench::Registrar filterSeparable_8u_C1(
+    "filterSeparable_8u_C1", benchFilterSeparable<unsigned char, iu::ImageCpu_8u_C1>);
+static iubench::Registrar filterSeparable_32f_C1(
+    "filterSeparable_32f_C1", benchFilterSeparable<float, iu::ImageCpu_32f_C1>);
+static iubench::Registrar filterSeparable_32f_C4(
+    "filterSeparable_32f_C4", benchFilterSeparable<float4, iu::ImageCpu_32f_C4>);
+
+//-----------------------------------------------------------------------------
+template<int TemplateSize, IuConvolutionMethod Method>
+static void benchFilterCorrelate(iubench::State& state)
+{
+  iu::ImageCpu_32f_C1 src(state.size());
+  iu::ImageCpu_32f_C1 templ(TemplateSize, TemplateSize);
+  iu::ImageCpu_32f_C1 dst(state.size().width-TemplateSize+1, state.size().height-TemplateSize+1);
+  iubench::clear(src);
+  iubench::clear(templ);
+  while (state.keepRunning())
+    iu::filterCorrelate(&src, &templ, &dst, Method);
+
+  const double pixels = (double)dst.width()*dst.height();
+  state.setBytesProcessed(2.0*pixels*sizeof(float));
+  state.setPixelsProcessed(pixels);
+}
+
+static iubench::Registrar filterCorrelate_32f_C1_16_direct(
+    "filterCorrelate_32f_C1_16x16_direct", benchFilterCorrelate<16, IU_CONVOLUTION_DIRECT>);
+static iubench::Registrar filterCorrelate_32f_C1_16_fft(
+    "filterCorrelate_32f_C1_16x16_fft", benchFilterCorrelate<16, IU_CONVOLUTION_FFT>);
+static iubench::Registrar filterCorrelate_32f_C1_128(
+    "filterCorrelate_32f_C1_128x128", benchFilterCorrelate<128, IU_CONVOLUTION_AUTO>);
+
+/* ***************************************************************************
+ *  MORPHOLOGY
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+template<typename PixelType, class Image>
+static void benchFilterErode(iubench::State& state)
+{
+  Image src(state.size());
+  Image dst(state.size());
+  iubench::clear(src);
+  while (state.keepRunning())
+    iu::filterErode(&src, &dst, IuSize(31, 31));
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(2.0*pixels*sizeof(PixelType));
+  state.setPixelsProcessed(pixels);
+}
+
+static iubench::Registrar filterErode_8u_C1(
+    "filterErode_8u_C1", benchFilterErode<unsigned char, iu::ImageCpu_8u_C1>);
+static iubench::Registrar filterErode_32f_C1(
+    "filterErode_32f_C1", benchFilterErode<float, iu::ImageCpu_32f_C1>);
+
+/* ***************************************************************************
+ *  DENOISING
+ * ***************************************************************************/
+
+// The byte counts are the traffic of the iterations: every field is read and
+// written once (TV: u, ubar and p plus f; TGV additionally v, vbar and q).
+static const unsigned int DENOISE_ITERATIONS = 10;
+
+//-----------------------------------------------------------------------------
+template<typename PixelType, class Image>
+static void benchDenoiseTV(iubench::State& state)
+{
+  Image src(state.size());
+  Image dst(state.size());
+  iubench::clear(src);
+  while (state.keepRunning())
+    iu::denoiseTV(&src, &dst, 10.0f, DENOISE_ITERATIONS);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(9.0*DENOISE_ITERATIONS*pixels*sizeof(PixelType));
+  state.setPixelsProcessed(pixels);
+}
+
+//-----------------------------------------------------------------------------
+template<typename PixelType, class Image>
+static void benchDenoiseTGV2(iubench::State& state)
+{
+  Image src(state.size());
+  Image dst(state.size());
+  iubench::clear(src);
+  while (state.keepRunning())
+    iu::denoiseTGV2(&src, &dst, 10.0f, 1.0f, 2.0f, DENOISE_ITERATIONS);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(25.0*DENOISE_ITERATIONS*pixels*sizeof(PixelType));
+  state.setPixelsProcessed(pixels);
+}
+
+static iubench::Registrar denoiseTV_32f_C1(
+    "denoiseTV_32f_C1", benchDenoiseTV<float, iu::ImageCpu_32f_C1>);
+static iubench::Registrar denoiseTV_32f_C4(
+    "denoiseTV_32f_C4", benchDenoiseTV<float4, iu::ImageCpu_32f_C4>);
+static iubench::Registrar denoiseTGV2_32f_C1(
+    "denoiseTGV2_32f_C1", benchDenoiseTGV2<float, iu::ImageCpu_32f_C1>);
+static iubench::Registrar denoiseTGV2_32f_C4(
+    "denoiseTGV2_32f_C4", benchDenoiseTGV2<float4, iu::ImageCpu_32f_C4>);
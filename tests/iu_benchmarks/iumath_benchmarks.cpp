@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Benchmarks
+ * Class       : none
+ * Language    : C++
+ * Description : Benchmarks of the host entry points of the math module
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <iucore.h>
+#include <iumath.h>
+#include "iu_benchmark.h"
+
+/* ***************************************************************************
+ *  ARITHMETIC (planar host images)
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+template<class Image>
+static void benchAddWeighted(iubench::State& state)
+{
+  Image src1(state.size());
+  Image src2(state.size());
+  Image dst(state.size());
+  const IuRect roi(0, 0, state.size().width, state.size().height);
+  iubench::clear(src1);
+  iubench::clear(src2);
+  while (state.keepRunning())
+    iu::addWeighted(&src1, 0.3f, &src2, 0.7f, &dst, roi);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(3.0*pixels*src1.channels()*sizeof(float));
+  state.setPixelsProcessed(pixels);
+}
+
+static iubench::Registrar addWeighted_planarC3("addWeighted_planarC3", benchAddWeighted<iu::ImagePlanarCpu_32f_C3>);
+static iubench::Registrar addWeighted_planarC4("addWeighted_planarC4", benchAddWeighted<iu::ImagePlanarCpu_32f_C4>);
+
+//-----------------------------------------------------------------------------
+IU_BENCHMARK(mulC_planarC3)
+{
+  iu::ImagePlanarCpu_32f_C3 src(state.size());
+  iu::ImagePlanarCpu_32f_C3 dst(state.size());
+  const IuRect roi(0, 0, state.size().width, state.size().height);
+  iubench::clear(src);
+  const float3 factor = make_float3(0.5f, 1.0f, 2.0f);
+  while (state.keepRunning())
+    iu::mulC(&src, factor, &dst, roi);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(2.0*pixels*3*sizeof(float));
+  state.setPixelsProcessed(pixels);
+}
+
+IU_BENCHMARK(mulC_planarC4)
+{
+  iu::ImagePlanarCpu_32f_C4 src(state.size());
+  iu::ImagePlanarCpu_32f_C4 dst(state.size());
+  const IuRect roi(0, 0, state.size().width, state.size().height);
+  iubench::clear(src);
+  const float4 factor = make_float4(0.5f, 1.0f, 2.0f, 1.0f);
+  while (state.keepRunning())
+    iu::mulC(&src, factor, &dst, roi);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(2.0*pixels*4*sizeof(float));
+  state.setPixelsProcessed(pixels);
+}
+
+//-----------------------------------------------------------------------------
+IU_BENCHMARK(addC_planarC3)
+{
+  iu::ImagePlanarCpu_32f_C3 src(state.size());
+  iu::ImagePlanarCpu_32f_C3 dst(state.size());
+  const IuRect roi(0, 0, state.size().width, state.size().height);
+  iubench::clear(src);
+  const float3 val = make_float3(0.1f, 0.2f, 0.3f);
+  while (state.keepRunning())
+    iu::addC(&src, val, &dst, roi);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(2.0*pixels*3*sizeof(float));
+  state.setPixelsProcessed(pixels);
+}
+
+IU_BENCHMARK(addC_planarC4)
+{
+  iu::ImagePlanarCpu_32f_C4 src(state.size());
+  iu::ImagePlanarCpu_32f_C4 dst(state.size());
+  const IuRect roi(0, 0, state.size().width, state.size().height);
+  iubench::clear(src);
+  const float4 val = make_float4(0.1f, 0.2f, 0.3f, 0.0f);
+  while (state.keepRunning())
+    iu::addC(&src, val, &dst, roi);
+
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(2.0*pixels*4*sizeof(float));
+  state.setPixelsProcessed(pixels);
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Benchmarks
+ * Class       : none
+ * Language    : C++
+ * Description : Benchmarks of the host entry points of the sparse module
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <iucore.h>
+#include <iusparse.h>
+#include "iu_benchmark.h"
+
+// forward differences of an image of the benchmark size as CSR matrix
+// (2*pixels rows, pixels columns; the rows at the right/bottom border are empty)
+static iu::SparseMatrixCpu<float>* gradientOperator(const IuSize& size)
+{
+  const int width = size.width, height = size.height;
+  const int n_col = width*height;
+  const int n_row = 2*n_col;
+  const int nnz = 2*((width-1)*height + width*(height-1));
+
+  iu::LinearHostMemory<int> ptr(n_row+1);
+  iu::LinearHostMemory<int> ind(nnz);
+  iu::LinearHostMemory<float> val(nnz);
+  int e = 0;
+  for (int r = 0; r < n_row; ++r)
+  {
+    *ptr.data(r) = e;
+    const int p = r % n_col;
+    const int x = p % width;
+    const int y = p / width;
+    const int q = (r < n_col) ? (x < width-1 ? p+1 : p) : (y < height-1 ? p+width : p);
+    if (q == p)
+      continue;
+    *ind.data(e) = p;  *val.data(e) = -1.0f;  ++e;
+    *ind.data(e) = q;  *val.data(e) = 1.0f;  ++e;
+  }
+  *ptr.data(n_row) = e;
+  return new iu::SparseMatrixCpu<float>(&val, &ptr, &ind, n_row, n_col, CSR);
+}
+
+// 5-point Laplacian plus a diagonal shift of an image of the benchmark size as CSR
+// matrix (symmetric positive definite)
+static iu::SparseMatrixCpu<float>* poissonOperator(const IuSize& size)
+{
+  const int width = size.width, height = size.height;
+  const int n = width*height;
+
+  iu::LinearHostMemory<int> ptr(n+1);
+  iu::LinearHostMemory<int> ind(5*n);
+  iu::LinearHostMemory<float> val(5*n);
+  int e = 0;
+  for (int p = 0; p < n; ++p)
+  {
+    *ptr.data(p) = e;
+    const int x = p % width;
+    const int y = p / width;
+    const int cols[5] = {y > 0 ? p-width : -1, x > 0 ? p-1 : -1, p,
+                         x < width-1 ? p+1 : -1, y < height-1 ? p+width : -1};
+    int diag_entry = e;
+    float diag = 0.01f;
+    for (int k = 0; k < 5; ++k)
+    {
+      if (cols[k] < 0)
+        continue;
+      *ind.data(e) = cols[k];
+      if (cols[k] == p)
+        diag_entry = e;
+      else
+      {
+        *val.data(e) = -1.0f;
+        diag += 1.0f;
+      }
+      ++e;
+    }
+    *val.data(diag_entry) = diag;
+  }
+  *ptr.data(n) = e;
+  iu::LinearHostMemory<int> ind_view(ind, 0, e);
+  iu::LinearHostMemory<float> val_view(val, 0, e);
+  return new iu::SparseMatrixCpu<float>(&val_view, &ptr, &ind_view, n, n, CSR);
+}
+
+/* ***************************************************************************
+ *  SPARSE MATRIX-VECTOR MULTIPLICATION
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+static void benchSparseMultiplication(iubench::State& state, IuSparseFormat sformat,
+                                      int slice_height, int sorting_scope)
+{
+  iu::SparseMatrixCpu<float>* A = gradientOperator(state.size());
+  if (sformat == SELL)
+    A->changeSparseFormat(SELL, slice_height, sorting_scope);
+
+  iu::LinearHostMemory_32f_C1 u(A->n_col());
+  iu::LinearHostMemory_32f_C1 gu(A->n_row());
+  iu::setValue(1.0f, &u);
+  while (state.keepRunning())
+    iu::sparseMultiplication(A, &u, &gu);
+
+  // stored values and indices (SELL: including the padding), the pointer array,
+  // the source and the destination
+  const double n_stored = (double)A->value()->length();
+  state.setBytesProcessed(n_stored*(sizeof(float) + sizeof(int)) + (double)A->n_row()*sizeof(int) +
+                          ((double)A->n_col() + A->n_row())*sizeof(float));
+  state.setPixelsProcessed((double)A->n_col());
+  delete A;
+}
+
+IU_BENCHMARK(sparseMultiplication_csr)
+{
+  benchSparseMultiplication(state, CSR, 0, 0);
+}
+
+IU_BENCHMARK(sparseMultiplication_sell_C4_s64)
+{
+  benchSparseMultiplication(state, SELL, 4, 64);
+}
+
+IU_BENCHMARK(sparseMultiplication_sell_C8_s256)
+{
+  benchSparseMultiplication(state, SELL, 8, 256);
+}
+
+IU_BENCHMARK(sparseMultiplication_sell_C16_s1)
+{
+  benchSparseMultiplication(state, SELL, 16, 1);
+}
+
+IU_BENCHMARK(sparseMultiplication_sell_C16_s256)
+{
+  benchSparseMultiplication(state, SELL, 16, 256);
+}
+
+/* ***************************************************************************
+ *  ITERATIVE SOLVERS (a fixed number of iterations on a Poisson problem)
+ * ***************************************************************************/
+
+enum SolverType { SOLVER_CG, SOLVER_PCG, SOLVER_BICGSTAB };
+
+//-----------------------------------------------------------------------------
+static void benchSolver(iubench::State& state, SolverType solver, IuSparseFormat sformat)
+{
+  const int iterations = 20;
+  iu::SparseMatrixCpu<float>* A = poissonOperator(state.size());
+  if (sformat == SELL)
+    A->changeSparseFormat(SELL, 8, 256);
+
+  const int n = A->n_row();
+  iu::LinearHostMemory_32f_C1 b(n);
+  iu::LinearHostMemory_32f_C1 x(n);
+  for (int i = 0; i < n; ++i)
+    *b.data(i) = (float)((i*29) % 61) - 30.0f;
+  while (state.keepRunning())
+  {
+    // a zero tolerance runs all iterations
+    iu::setValue(0.0f, &x);
+    if (solver == SOLVER_BICGSTAB)
+      iu::solveBiCGStab(A, &b, &x, iterations, 0.0f);
+    else
+      iu::solveCG(A, &b, &x, iterations, 0.0f, solver == SOLVER_PCG);
+  }
+
+  // per iteration: the products (matrix, pointer array, source and destination)
+  // and the vector passes of the updates
+  const int products = (solver == SOLVER_BICGSTAB) ? 2 : 1;
+  const int vector_passes = (solver == SOLVER_BICGSTAB) ? 15 : (solver == SOLVER_PCG) ? 11 : 9;
+  const double product_bytes = (double)A->value()->length()*(sizeof(float) + sizeof(int)) +
+      (double)n*(sizeof(int) + 2*sizeof(float));
+  state.setBytesProcessed(iterations*(products*product_bytes + (double)vector_passes*n*sizeof(float)));
+  state.setPixelsProcessed((double)n);
+  delete A;
+}
+
+IU_BENCHMARK(solveCG_csr)
+{
+  benchSolver(state, SOLVER_CG, CSR);
+}
+
+IU_BENCHMARK(solveCG_sell)
+{
+  benchSolver(state, SOLVER_CG, SELL);
+}
+
+IU_BENCHMARK(solveCG_jacobi_csr)
+{
+  benchSolver(state, SOLVER_PCG, CSR);
+}
+
+IU_BENCHMARK(solveBiCGStab_csr)
+{
+  benchSolver(state, SOLVER_BICGSTAB, CSR);
+}
+
+IU_BENCHMARK(solveBiCGStab_sell)
+{
+  benchSolver(state, SOLVER_BICGSTAB, SELL);
+}
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Benchmarks
+ * Class       : none
+ * Language    : C++
+ * Description : Benchmarks of the host entry points of the transform module
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+#include <math.h>
+#include <iucore.h>
+#include <iutransform.h>
+#include "iu_benchmark.h"
+
+/* ***************************************************************************
+ *  PYRAMID (reduce / prolongate by a factor of 2)
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+template<typename PixelType, class Image>
+static void benchReduce(iubench::State& state)
+{
+  const IuSize size = state.size();
+  Image src(size);
+  Image dst(IuSize((size.width+1)/2, (size.height+1)/2));
+  iubench::clear(src);
+  while (state.keepRunning())
+    iu::reduce(&src, &dst, IU_INTERPOLATE_LINEAR, true, false);
+
+  const double pixels = (double)dst.width()*dst.height();
+  state.setBytesProcessed(((double)src.width()*src.height() + pixels)*sizeof(PixelType));
+  state.setPixelsProcessed(pixels);
+}
+
+static iubench::Registrar reduce_32f_C1("reduce_32f_C1", benchReduce<float, iu::ImageCpu_32f_C1>);
+static iubench::Registrar reduce_32f_C2("reduce_32f_C2", benchReduce<float2, iu::ImageCpu_32f_C2>);
+static iubench::Registrar reduce_32f_C4("reduce_32f_C4", benchReduce<float4, iu::ImageCpu_32f_C4>);
+
+//-----------------------------------------------------------------------------
+template<typename PixelType, class Image>
+static void benchProlongate(iubench::State& state)
+{
+  const IuSize size = state.size();
+  Image src(IuSize((size.width+1)/2, (size.height+1)/2));
+  Image dst(size);
+  iubench::clear(src);
+  while (state.keepRunning())
+    iu::prolongate(&src, &dst, IU_INTERPOLATE_LINEAR);
+
+  const double pixels = (double)dst.width()*dst.height();
+  state.setBytesProcessed(((double)src.width()*src.height() + pixels)*sizeof(PixelType));
+  state.setPixelsProcessed(pixels);
+}
+
+static iubench::Registrar prolongate_32f_C1("prolongate_32f_C1", benchProlongate<float, iu::ImageCpu_32f_C1>);
+static iubench::Registrar prolongate_32f_C2("prolongate_32f_C2", benchProlongate<float2, iu::ImageCpu_32f_C2>);
+static iubench::Registrar prolongate_32f_C4("prolongate_32f_C4", benchProlongate<float4, iu::ImageCpu_32f_C4>);
+
+/* ***************************************************************************
+ *  REMAP
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+template<class Image>
+static void benchRemap(iubench::State& state, unsigned int channels,
+                       IuInterpolationType interpolation)
+{
+  Image src(state.size());
+  Image dst(state.size());
+  iu::ImageCpu_32f_C1 dx(state.size());
+  iu::ImageCpu_32f_C1 dy(state.size());
+  iubench::clear(src);
+  iu::setValue(0.25f, &dx, dx.roi());
+  iu::setValue(-0.75f, &dy, dy.roi());
+  while (state.keepRunning())
+    iu::remap(&src, &dx, &dy, &dst, interpolation);
+
+  // source, both maps and destination
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(pixels*(2*channels + 2)*sizeof(float));
+  state.setPixelsProcessed(pixels);
+}
+
+IU_BENCHMARK(remap_32f_C1_nearest)
+{
+  benchRemap<iu::ImageCpu_32f_C1>(state, 1, IU_INTERPOLATE_NEAREST);
+}
+
+IU_BENCHMARK(remap_32f_C1_linear)
+{
+  benchRemap<iu::ImageCpu_32f_C1>(state, 1, IU_INTERPOLATE_LINEAR);
+}
+
+IU_BENCHMARK(remap_32f_C1_cubic)
+{
+  benchRemap<iu::ImageCpu_32f_C1>(state, 1, IU_INTERPOLATE_CUBIC);
+}
+
+IU_BENCHMARK(remap_planarC3_linear)
+{
+  benchRemap<iu::ImagePlanarCpu_32f_C3>(state, 3, IU_INTERPOLATE_LINEAR);
+}
+
+IU_BENCHMARK(remap_planarC4_linear)
+{
+  benchRemap<iu::ImagePlanarCpu_32f_C4>(state, 4, IU_INTERPOLATE_LINEAR);
+}
+
+IU_BENCHMARK(remap_planarC4_cubic)
+{
+  benchRemap<iu::ImagePlanarCpu_32f_C4>(state, 4, IU_INTERPOLATE_CUBIC);
+}
+
+//-----------------------------------------------------------------------------
+// same warps with the compact maps (converted once)
+template<class Image>
+static void benchRemapCompact(iubench::State& state, unsigned int channels,
+                              IuInterpolationType interpolation)
+{
+  Image src(state.size());
+  Image dst(state.size());
+  iu::ImageCpu_32f_C1 dx(state.size());
+  iu::ImageCpu_32f_C1 dy(state.size());
+  iu::ImageCpu_16u_C2 coords(state.size());
+  iu::ImageCpu_16u_C1 fractions(state.size());
+  iubench::clear(src);
+  iu::setValue(0.25f, &dx, dx.roi());
+  iu::setValue(-0.75f, &dy, dy.roi());
+  iu::convertRemapMaps(&dx, &dy, &coords, &fractions);
+  while (state.keepRunning())
+    iu::remap(&src, &coords, &fractions, &dst, interpolation);
+
+  // source, compact maps and destination
+  const double pixels = (double)state.size().width*state.size().height;
+  state.setBytesProcessed(pixels*(2*channels*sizeof(float) + 3*sizeof(unsigned short)));
+  state.setPixelsProcessed(pixels);
+}
+
+IU_BENCHMARK(remapCompact_32f_C1_linear)
+{
+  benchRemapCompact<iu::ImageCpu_32f_C1>(state, 1, IU_INTERPOLATE_LINEAR);
+}
+
+IU_BENCHMARK(remapCompact_32f_C1_cubic)
+{
+  benchRemapCompact<iu::ImageCpu_32f_C1>(state, 1, IU_INTERPOLATE_CUBIC);
+}
+
+IU_BENCHMARK(remapCompact_planarC3_linear)
+{
+  benchRemapCompact<iu::ImagePlanarCpu_32f_C3>(state, 3, IU_INTERPOLATE_LINEAR);
+}
+
+/* ***************************************************************************
+ *  AFFINE / PERSPECTIVE WARPS
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+// rotation by 0.3 rad about the image center / a mild homography
+template<class Image>
+static void benchWarp(iubench::State& state, size_t pixel_size, bool perspective,
+                      IuInterpolationType interpolation)
+{
+  const IuSize size = state.size();
+  Image src(size);
+  Image dst(size);
+  iubench::clear(src);
+  const float cx = 0.5f*size.width;
+  const float cy = 0.5f*size.height;
+  const float c = cosf(0.3f);
+  const float s = sinf(0.3f);
+  const float rotation[6] = {c, -s, cx - c*cx + s*cy, s, c, cy - s*cx - c*cy};
+  const float homography[9] = {0.9f, 0.1f, 20.0f, -0.05f, 1.1f, 5.0f, 0.0001f, 0.0002f, 0.9f};
+  while (state.keepRunning())
+  {
+    if(perspective)
+      iu::warpPerspective(&src, &dst, homography, interpolation);
+    else
+      iu::warpAffine(&src, &dst, rotation, interpolation);
+  }
+
+  // source and destination
+  const double pixels = (double)size.width*size.height;
+  state.setBytesProcessed(pixels*2*pixel_size);
+  state.setPixelsProcessed(pixels);
+}
+
+IU_BENCHMARK(warpAffine_8u_C1_linear)
+{
+  benchWarp<iu::ImageCpu_8u_C1>(state, sizeof(unsigned char), false, IU_INTERPOLATE_LINEAR);
+}
+
+IU_BENCHMARK(warpAffine_32f_C1_linear)
+{
+  benchWarp<iu::ImageCpu_32f_C1>(state, sizeof(float), false, IU_INTERPOLATE_LINEAR);
+}
+
+IU_BENCHMARK(warpAffine_32f_C1_cubic)
+{
+  benchWarp<iu::ImageCpu_32f_C1>(state, sizeof(float), false, IU_INTERPOLATE_CUBIC);
+}
+
+IU_BENCHMARK(warpAffine_8u_C4_linear)
+{
+  benchWarp<iu::ImageCpu_8u_C4>(state, sizeof(uchar4), false, IU_INTERPOLATE_LINEAR);
+}
+
+IU_BENCHMARK(warpPerspective_32f_C1_linear)
+{
+  benchWarp<iu::ImageCpu_32f_C1>(state, sizeof(float), true, IU_INTERPOLATE_LINEAR);
+}
+
+IU_BENCHMARK(warpPerspective_32f_C4_linear)
+{
+  benchWarp<iu::ImageCpu_32f_C4>(state, sizeof(float4), true, IU_INTERPOLATE_LINEAR);
+}
+
+/* ***************************************************************************
+ *  OPTICAL FLOW
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+// smooth pattern translated by (2.5, 1.5) pixels
+static void benchFlowTVL1(iubench::State& state, unsigned int num_warps, unsigned int num_iterations)
+{
+  const IuSize size = state.size();
+  iu::ImageCpu_32f_C1 i0(size);
+  iu::ImageCpu_32f_C1 i1(size);
+  iu::ImageCpu_32f_C2 flow(size);
+  for (unsigned int y = 0; y<size.height; ++y)
+  {
+    for (unsigned int x = 0; x<size.width; ++x)
+    {
+      *i0.data(x,y) = 0.5f + 0.25f*(sinf(0.11f*x) * cosf(0.07f*y));
+      *i1.data(x,y) = 0.5f + 0.25f*(sinf(0.11f*(x-2.5f)) * cosf(0.07f*(y-1.5f)));
+    }
+  }
+  while (state.keepRunning())
+    iu::opticalFlowTVL1(&i0, &i1, &flow, 40.0f, 0.3f, 5, 0.5f, num_warps, num_iterations);
+
+  // both images and the flow field
+  const double pixels = (double)size.width*size.height;
+  state.setBytesProcessed(pixels*4*sizeof(float));
+  state.setPixelsProcessed(pixels);
+}
+
+IU_BENCHMARK(opticalFlowTVL1_default)
+{
+  benchFlowTVL1(state, 5, 30);
+}
+
+IU_BENCHMARK(opticalFlowTVL1_fast)
+{
+  benchFlowTVL1(state, 3, 10);
+}
+
+/* ***************************************************************************
+ *  STEREO MATCHING
+ * ***************************************************************************/
+
+//-----------------------------------------------------------------------------
+// textured pattern shifted by 9 pixels, 64 disparities
+static void benchStereoImages(const IuSize& size, iu::ImageCpu_32f_C1& left, iu::ImageCpu_32f_C1& right)
+{
+  for (unsigned int y = 0; y<size.height; ++y)
+  {
+    for (unsigned int x = 0; x<size.width; ++x)
+    {
+      *left.data(x,y) = 0.5f + 0.25f*(sinf(0.31f*x) * cosf(0.27f*y));
+      *right.data(x,y) = 0.5f + 0.25f*(sinf(0.31f*(x+9.0f)) * cosf(0.27f*y));
+    }
+  }
+}
+
+static void benchStereoCosts(iubench::State& state, IuStereoCost cost, unsigned int radius)
+{
+  const IuSize size = state.size();
+  iu::ImageCpu_32f_C1 left(size);
+  iu::ImageCpu_32f_C1 right(size);
+  iu::VolumeCpu_8u_C1 costs(64, size.width, size.height);
+  benchStereoImages(size, left, right);
+  while (state.keepRunning())
+    iu::stereoCostVolume(&left, &right, &costs, cost, radius);
+
+  // both images and the cost volume
+  const double pixels = (double)size.width*size.height;
+  state.setBytesProcessed(pixels*(2*sizeof(float) + 64));
+  state.setPixelsProcessed(pixels);
+}
+
+IU_BENCHMARK(stereoCostVolume_census)
+{
+  benchStereoCosts(state, IU_STEREO_CENSUS, 3);
+}
+
+IU_BENCHMARK(stereoCostVolume_sad)
+{
+  benchStereoCosts(state, IU_STEREO_SAD, 3);
+}
+
+IU_BENCHMARK(stereoAggregateSGM_8paths)
+{
+  const IuSize size = state.size();
+  iu::ImageCpu_32f_C1 left(size);
+  iu::ImageCpu_32f_C1 right(size);
+  iu::VolumeCpu_8u_C1 costs(64, size.width, size.height);
+  iu::VolumeCpu_16u_C1 aggregated(64, size.width, size.height);
+  benchStereoImages(size, left, right);
+  iu::stereoCostVolume(&left, &right, &costs);
+  while (state.keepRunning())
+    iu::stereoAggregateSGM(&costs, &aggregated);
+
+  // the cost volume and the aggregated costs
+  const double pixels = (double)size.width*size.height;
+  state.setBytesProcessed(pixels*64*(1 + sizeof(unsigned short)));
+  state.setPixelsProcessed(pixels);
+}
@@ -23,6 +23,7 @@
 
 // system includes
 #include <iostream>
+#include <vector>
 #include <cuda_runtime.h>
 //#include <cutil_math.h>
 #include <iucore.h>
@@ -143,6 +144,206 @@ int main(int argc, char** argv)
     }
   }
 
+  // planar layout test
+  {
+    std::cout << "testing interleaved <-> planar conversion on cpu ..." << std::endl;
+
+    iu::ImageCpu_32f_C4 src(sz);
+    for (unsigned int y = 0; y<sz.height; ++y)
+      for (unsigned int x = 0; x<sz.width; ++x)
+        *src.data(x,y) = make_float4(x, y, x+y, x*y);
+
+    iu::ImagePlanarCpu_32f_C4 planar_C4(sz);
+    iu::ImagePlanarCpu_32f_C3 planar_C3(sz);
+    iu::convert(&src, &planar_C4);
+    iu::convert(&src, &planar_C3);
+
+    iu::ImageCpu_32f_C4 back_C4(sz);
+    iu::ImageCpu_32f_C4 back_C3(sz);
+    iu::convert(&planar_C4, &back_C4);
+    iu::convert(&planar_C3, &back_C3);
+
+    for (unsigned int y = 0; y<sz.height; ++y)
+    {
+      for (unsigned int x = 0; x<sz.width; ++x)
+      {
+        if( *planar_C4.plane(2,x,y) != x+y || *planar_C4.plane(3,x,y) != x*y)
+          return EXIT_FAILURE;
+        if( *planar_C3.plane(0,x,y) != x || *planar_C3.plane(1,x,y) != y)
+          return EXIT_FAILURE;
+        if( *back_C4.data(x,y) != *src.data(x,y))
+          return EXIT_FAILURE;
+        float4 expected_C3 = make_float4(x, y, x+y, 1.0f);
+        if( *back_C3.data(x,y) != expected_C3)
+          return EXIT_FAILURE;
+      }
+    }
+
+    // mismatching sizes must not be converted
+    IuSize sz_other(sz.width, sz.height+1);
+    iu::ImagePlanarCpu_32f_C3 planar_other(sz_other);
+    iu::ImageCpu_32f_C4 other(sz_other);
+    int caught = 0;
+    try { iu::convert(&src, &planar_other); }
+    catch (IuException&) { ++caught; }
+    try { iu::convert(&planar_C3, &other); }
+    catch (IuException&) { ++caught; }
+    if(caught != 2)
+      return EXIT_FAILURE;
+  }
+
+  // executor test (roi setValue with different thread counts)
+  {
+    std::cout << "testing threaded setValue on cpu ..." << std::endl;
+
+    IuSize big_sz(1031, 517);
+    IuRect roi(13, 7, 1000, 500);
+    iu::ImageCpu_32f_C1 im(big_sz);
+    for (int threads = 1; threads <= 4; ++threads)
+    {
+      iu::Executor::setNumThreads(threads);
+      iu::setValue(0.0f, &im, im.roi());
+      iu::setValue((float)threads, &im, roi);
+      for (unsigned int y = 0; y<big_sz.height; ++y)
+      {
+        for (unsigned int x = 0; x<big_sz.width; ++x)
+        {
+          bool inside = (int)x >= roi.x && x < roi.x+roi.width &&
+              (int)y >= roi.y && y < roi.y+roi.height;
+          if( *im.data(x,y) != (inside ? threads : 0.0f))
+            return EXIT_FAILURE;
+        }
+      }
+    }
+    iu::Executor::setNumThreads(0);
+  }
+
+  // views, assignment and moves
+  {
+    std::cout << "testing image views on cpu ..." << std::endl;
+
+    iu::ImageCpu_32f_C1 im(sz);
+    iu::setValue(0.0f, &im, im.roi());
+
+    // kernels write through a wrapped tile of the image
+    IuRect tile_rect(5, 3, 20, 10);
+    iu::ImageViewCpu<float> tile = im.view(tile_rect);
+    iu::ImageCpu_32f_C1 tile_image(tile);
+    if (!tile_image.isView() || tile_image.data() != im.data(5,3))
+      return EXIT_FAILURE;
+    iu::setValue(2.0f, &tile_image, tile_image.roi());
+
+    // sub-view of the tile
+    iu::ImageViewCpu<const float> band = static_cast<const iu::ImageCpu_32f_C1&>(im).view(tile_rect).rows(4, 2);
+    if (band.width() != 20 || band.height() != 2 || band.data(0,0) != im.data(5,7))
+      return EXIT_FAILURE;
+
+    for (unsigned int y = 0; y<sz.height; ++y)
+    {
+      for (unsigned int x = 0; x<sz.width; ++x)
+      {
+        bool inside = (int)x >= tile_rect.x && x < tile_rect.x+tile_rect.width &&
+            (int)y >= tile_rect.y && y < tile_rect.y+tile_rect.height;
+        if( *im.data(x,y) != (inside ? 2.0f : 0.0f))
+          return EXIT_FAILURE;
+      }
+    }
+
+    bool caught = false;
+    try { im.view(IuRect(70, 0, 10, 1)); }
+    catch (IuException&) { caught = true; }
+    if (!caught)
+      return EXIT_FAILURE;
+
+    // deep copy assignment (reallocating and into an existing buffer)
+    iu::ImageCpu_32f_C1 assigned(IuSize(3,3));
+    assigned = im;
+    if (assigned.size() != sz || assigned.data() == im.data() || *assigned.data(5,3) != 2.0f)
+      return EXIT_FAILURE;
+    iu::setValue(1.0f, &assigned, assigned.roi());
+    iu::ImageCpu_32f_C1 source_tile(assigned.view(tile_rect));
+    tile_image = source_tile;
+    if (*im.data(5,3) != 1.0f || *im.data(4,3) != 0.0f)
+      return EXIT_FAILURE;
+
+#ifdef IU_HAS_MOVE_SEMANTICS
+    const float* buffer = assigned.data();
+    iu::ImageCpu_32f_C1 moved(std::move(assigned));
+    if (moved.data() != buffer || assigned.data() != 0 || assigned.width() != 0)
+      return EXIT_FAILURE;
+    assigned = std::move(moved);
+    if (assigned.data() != buffer || assigned.size() != sz)
+      return EXIT_FAILURE;
+#endif
+  }
+
+  // runtime cpu dispatch: every supported level gives the generic results
+  {
+    std::cout << "testing cpu dispatch levels (supported: "
+              << iu::CpuDispatch::levelName(iu::CpuDispatch::supportedLevel()) << ") ..." << std::endl;
+
+    iu::ImageCpu_32f_C1 src(sz);
+    for (unsigned int y = 0; y<sz.height; ++y)
+      for (unsigned int x = 0; x<sz.width; ++x)
+        *src.data(x,y) = 0.37f*x + 1.3f*y;
+
+    const IuCpuLevel level = iu::CpuDispatch::level();
+    iu::CpuDispatch::setLevel(IU_CPU_GENERIC);
+    iu::ImageCpu_8u_C1 expected(sz);
+    iu::convert_32f8u_C1(&src, &expected, 0.9f, 3.0f);
+
+    for (int l = IU_CPU_SSE4; l <= (int)iu::CpuDispatch::supportedLevel(); ++l)
+    {
+      if (iu::CpuDispatch::setLevel((IuCpuLevel)l) != (IuCpuLevel)l)
+        return EXIT_FAILURE;
+      iu::ImageCpu_8u_C1 dst(sz);
+      iu::convert_32f8u_C1(&src, &dst, 0.9f, 3.0f);
+      for (unsigned int y = 0; y<sz.height; ++y)
+        for (unsigned int x = 0; x<sz.width; ++x)
+          if (*dst.data(x,y) != *expected.data(x,y))
+            return EXIT_FAILURE;
+    }
+    iu::CpuDispatch::setLevel(level);
+  }
+
+  // column-major (matlab) layout <-> images; sizes that are no multiples of the tiles
+  {
+    std::cout << "testing column-major transposition ..." << std::endl;
+
+    const unsigned int width = 301, height = 517;
+    std::vector<double> column_major(width*height);
+    for (unsigned int x = 0; x<width; ++x)
+      for (unsigned int y = 0; y<height; ++y)
+        column_major[y + x*height] = 0.25*x - 3.0*y;
+
+    iu::ImageCpu_32f_C1 im(IuSize(width+5, height+2));
+    iu::copyFromColumnMajor(&column_major[0], width, height, &im);
+    for (unsigned int y = 0; y<height; ++y)
+      for (unsigned int x = 0; x<width; ++x)
+        if (*im.data(x,y) != (float)(0.25*x - 3.0*y))
+          return EXIT_FAILURE;
+
+    std::vector<double> back(width*height, 0.0);
+    iu::copyToColumnMajor(&im, &back[0], width, height);
+    for (size_t i = 0; i<back.size(); ++i)
+      if (back[i] != column_major[i])
+        return EXIT_FAILURE;
+
+    std::vector<int> ints(width*height);
+    for (size_t i = 0; i<ints.size(); ++i)
+      ints[i] = (int)(i*2654435761u);
+    iu::ImageCpu_32s_C1 im_int(IuSize(width, height));
+    iu::copyFromColumnMajor(&ints[0], width, height, &im_int);
+    if (*im_int.data(7,11) != ints[11 + 7*height] || *im_int.data(width-1,height-1) != ints.back())
+      return EXIT_FAILURE;
+
+    bool caught = false;
+    try { iu::copyFromColumnMajor(&column_major[0], width+6, height, &im); }
+    catch (IuException&) { caught = true; }
+    if (!caught)
+      return EXIT_FAILURE;
+  }
+
   std::cout << std::endl;
   std::cout << "**************************************************************************" << std::endl;
   std::cout << "*  Everything seem to be ok. -- All assertions passed.                   *" << std::endl;
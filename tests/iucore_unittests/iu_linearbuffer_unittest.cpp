@@ -115,6 +115,48 @@ int main(int argc, char** argv)
     assert(check_32f_C1.data()[i] == val_32f);
   }
 
+  ////////////////////////////////////////////////////////////////////////////
+  /* alignment, views, assignment and page-locked buffers
+   */
+  {
+    assert(((size_t)h_32f_C1->data() % iu::LinearHostMemory_32f_C1::ALIGNMENT) == 0);
+
+    // a view writes through to its parent
+    iu::LinearHostMemory_32f_C1 view(*h_32f_C1, 100, 50);
+    assert(view.isView() && view.length() == 50);
+    iu::setValue(3.0f, &view);
+    assert(*h_32f_C1->data(99) == val_32f);
+    assert(*h_32f_C1->data(100) == 3.0f && *h_32f_C1->data(149) == 3.0f);
+    assert(*h_32f_C1->data(150) == val_32f);
+
+    // assignment (reallocating and in-place)
+    iu::LinearHostMemory_32f_C1 assigned;
+    assigned = view;
+    assert(!assigned.isView() && assigned.length() == 50 && *assigned.data(49) == 3.0f);
+    iu::setValue(4.0f, &assigned);
+    view = assigned;
+    assert(*h_32f_C1->data(100) == 4.0f);
+
+    // a view cannot be reallocated: a different length throws and leaves it attached
+    iu::LinearHostMemory_32f_C1 longer(60);
+    bool thrown = false;
+    try { view = longer; }
+    catch (IuException&) { thrown = true; }
+    assert(thrown && view.isView() && view.length() == 50 && view.data() == h_32f_C1->data(100));
+
+    // page-locked staging buffer (locking may be refused by the system limits)
+    iu::LinearHostMemory_32f_C1 staging(1024, true);
+    iu::setValue(5.0f, &staging);
+    assert(*staging.data(1023) == 5.0f);
+    std::cout << "page-locked staging buffer: " << (staging.pageLocked() ? "yes" : "no") << std::endl;
+
+    // reallocating assignment keeps the buffer page-locked
+    const bool locked = staging.pageLocked();
+    staging = assigned;
+    assert(staging.length() == 50 && *staging.data(49) == 4.0f);
+    assert(staging.pageLocked() == locked);
+  }
+
   ////////////////////////////////////////////////////////////////////////////
   /* Further test
    */
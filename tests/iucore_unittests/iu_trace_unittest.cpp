@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Unit Tests
+ * Class       : none
+ * Language    : C++
+ * Description : Unit tests for the instrumentation (zones, counters, Chrome trace export)
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+// system includes
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <iucore.h>
+
+int main(int argc, char** argv)
+{
+  std::cout << "Starting iu_trace_unittest ..." << std::endl;
+
+  iu::Trace::clear();
+
+  // nothing is recorded unless started
+  {
+    iu::TraceZone zone("not recorded");
+  }
+  if (iu::Trace::numEvents() != 0)
+  {
+    std::cerr << "events recorded while not recording" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  iu::Trace::start();
+  iu::Trace::setThreadName("main \"thread\"");
+  {
+    iu::TraceZone outer("outer");
+    {
+      iu::TraceZone inner("inner");
+      iu::Trace::count(1024.0, 256.0);
+    }
+    iu::Trace::counter("level", 3.0);
+  }
+
+  // the zones of the library entry points (only compiled with IU_ENABLE_TRACE)
+  iu::ImageCpu_32f_C1 image(64, 48);
+  iu::setValue(1.0f, &image, image.roi());
+  iu::Trace::stop();
+
+  const size_t expected = 3;
+  if (iu::Trace::numEvents() < expected)
+  {
+    std::cerr << "expected at least " << expected << " events, got "
+              << iu::Trace::numEvents() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::ostringstream out;
+  iu::Trace::writeChromeTrace(out);
+  const std::string json = out.str();
+  const char* expected_parts[] = {
+    "{\"traceEvents\":[",
+    "\"name\":\"inner\"",
+    "\"args\":{\"bytes\":1024,\"pixels\":256}",
+    "\"name\":\"outer\"",
+    "\"ph\":\"C\",\"args\":{\"value\":3}",
+    "\"name\":\"main \\\"thread\\\"\"",
+    "\"displayTimeUnit\":\"ms\"}"
+  };
+  for (size_t i = 0; i < sizeof(expected_parts)/sizeof(expected_parts[0]); ++i)
+  {
+    if (json.find(expected_parts[i]) == std::string::npos)
+    {
+      std::cerr << "missing in trace output: " << expected_parts[i] << std::endl;
+      std::cerr << json << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  iu::Trace::clear();
+  if (iu::Trace::numEvents() != 0)
+  {
+    std::cerr << "events left after clear()" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "iu_trace_unittest passed" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,820 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Unit Tests
+ * Class       : none
+ * Language    : C++
+ * Description : Unit tests for the host filters
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+// system includes
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+#include <iucore.h>
+#include <iufilter.h>
+
+// edge weight as evaluated by the device kernels (filter.cu)
+static double exactEdgeWeight(float val, float alpha, float beta, float minval)
+{
+  return std::max((double)minval, exp(-alpha*pow((double)val, (double)beta)));
+}
+
+// relative error bound of the host edge weights (iufilter.h, iumath/fastmath.h)
+static double edgeWeightTolerance(float val, float alpha, float beta)
+{
+  if(val <= 0.0f)
+    return 3e-7;
+  const double log2_val = fabs(log((double)val)/log(2.0));
+  return 3e-7 + (4e-7 + 1.5e-7*beta*std::max(1.0, log2_val))*alpha*pow((double)val, (double)beta);
+}
+
+static bool checkEdgeWeight(float w, float val, float alpha, float beta, float minval)
+{
+  const double exact = exactEdgeWeight(val, alpha, beta, minval);
+  return fabs(w - exact) <= edgeWeightTolerance(val, alpha, beta)*exact;
+}
+
+// mean of the (2r+1)x(2r+1) window around (x,y) clipped to the image
+static double boxMean(const std::vector<double>& v, int width, int height, int x, int y, int r)
+{
+  double sum = 0.0;
+  int n = 0;
+  for(int j=std::max(y-r, 0); j<=std::min(y+r, height-1); ++j)
+    for(int i=std::max(x-r, 0); i<=std::min(x+r, width-1); ++i, ++n)
+      sum += v[j*width + i];
+  return sum/n;
+}
+
+// guided filter (He et al.) evaluated literally with naive box means
+static std::vector<double> naiveGuidedFilter(const std::vector<double>& p, const std::vector<double>& I,
+                                             int width, int height, int r, double eps)
+{
+  const size_t n = p.size();
+  std::vector<double> II(n), Ip(n), a(n), b(n), q(n);
+  for(size_t i=0; i<n; ++i)
+  {
+    II[i] = I[i]*I[i];
+    Ip[i] = I[i]*p[i];
+  }
+  for(int y=0; y<height; ++y)
+  {
+    for(int x=0; x<width; ++x)
+    {
+      const double mean_I = boxMean(I, width, height, x, y, r);
+      const double mean_p = boxMean(p, width, height, x, y, r);
+      const double var = boxMean(II, width, height, x, y, r) - mean_I*mean_I;
+      const double cov = boxMean(Ip, width, height, x, y, r) - mean_I*mean_p;
+      a[y*width + x] = cov/(std::max(var, 0.0) + eps);
+      b[y*width + x] = mean_p - a[y*width + x]*mean_I;
+    }
+  }
+  for(int y=0; y<height; ++y)
+    for(int x=0; x<width; ++x)
+      q[y*width + x] = boxMean(a, width, height, x, y, r)*I[y*width + x] + boxMean(b, width, height, x, y, r);
+  return q;
+}
+
+// min (erode) or max (dilate) over the kw x kh window anchored at ((kw-1)/2, (kh-1)/2)
+// and clipped to the image
+template<typename T>
+static std::vector<T> naiveMorphology(const std::vector<T>& v, int width, int height,
+                                      int kw, int kh, bool erode)
+{
+  std::vector<T> out(v.size());
+  for(int y=0; y<height; ++y)
+  {
+    for(int x=0; x<width; ++x)
+    {
+      const int x0 = x - (kw-1)/2, y0 = y - (kh-1)/2;
+      T m = v[y*width + x];
+      for(int j=std::max(y0, 0); j<=std::min(y0+kh-1, height-1); ++j)
+        for(int i=std::max(x0, 0); i<=std::min(x0+kw-1, width-1); ++i)
+          m = erode ? std::min(m, v[j*width + i]) : std::max(m, v[j*width + i]);
+      out[y*width + x] = m;
+    }
+  }
+  return out;
+}
+
+// all morphology types for several even and odd element sizes, out-of-place and
+// in-place, against the naive window
+template<typename ImageType, typename T>
+static bool checkMorphology(const ImageType& src)
+{
+  const int width = src.width(), height = src.height();
+  std::vector<T> v(width*height);
+  for(int y=0; y<height; ++y)
+    for(int x=0; x<width; ++x)
+      v[y*width + x] = *src.data(x,y);
+
+  const IuSize sizes[7] = {IuSize(1,1), IuSize(2,3), IuSize(4,4), IuSize(5,2),
+                           IuSize(7,9), IuSize(16,1), IuSize(width+9, height+4)};
+  const IuMorphologyType types[5] = {IU_MORPHOLOGY_ERODE, IU_MORPHOLOGY_DILATE, IU_MORPHOLOGY_OPEN,
+                                     IU_MORPHOLOGY_CLOSE, IU_MORPHOLOGY_GRADIENT};
+  ImageType dst(src.size()), inplace(src.size());
+  for(int s=0; s<7; ++s)
+  {
+    const int kw = sizes[s].width, kh = sizes[s].height;
+    const std::vector<T> eroded = naiveMorphology(v, width, height, kw, kh, true);
+    const std::vector<T> dilated = naiveMorphology(v, width, height, kw, kh, false);
+    for(int t=0; t<5; ++t)
+    {
+      std::vector<T> expected;
+      switch(types[t])
+      {
+      case IU_MORPHOLOGY_ERODE: expected = eroded; break;
+      case IU_MORPHOLOGY_DILATE: expected = dilated; break;
+      case IU_MORPHOLOGY_OPEN: expected = naiveMorphology(eroded, width, height, kw, kh, false); break;
+      case IU_MORPHOLOGY_CLOSE: expected = naiveMorphology(dilated, width, height, kw, kh, true); break;
+      default:
+        expected.resize(v.size());
+        for(size_t i=0; i<v.size(); ++i)
+          expected[i] = (T)(dilated[i] - eroded[i]);
+      }
+
+      iu::copy(&src, &inplace);
+      iu::filterMorphology(&src, &dst, types[t], sizes[s]);
+      iu::filterMorphology(&inplace, &inplace, types[t], sizes[s]);
+      for(int y=0; y<height; ++y)
+      {
+        for(int x=0; x<width; ++x)
+        {
+          if(*dst.data(x,y) != expected[y*width + x] || *inplace.data(x,y) != expected[y*width + x])
+          {
+            std::cerr << "morphology type " << types[t] << " with a " << kw << "x" << kh
+                      << " element differs from the naive window at " << x << "/" << y << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// sample index of position i on a line of n samples, or -1 for the constant border
+static int referenceBorderIndex(int i, int n, IuBorderType border)
+{
+  if(border == IU_BORDER_CONSTANT)
+    return (i < 0 || i >= n) ? -1 : i;
+  if(border == IU_BORDER_REPLICATE)
+    return std::min(std::max(i, 0), n-1);
+  if(border == IU_BORDER_WRAP)
+    return ((i % n) + n) % n;
+  // IU_BORDER_REFLECT: mirror at the outer sample edges until inside
+  while(i < 0 || i >= n)
+    i = (i < 0) ? -1-i : 2*n-1-i;
+  return i;
+}
+
+// correlation with the kernel anchored at ((kw-1)/2, (kh-1)/2) on interleaved channels
+static std::vector<double> naiveCorrelation(const std::vector<double>& v, int width, int height,
+                                            int channels, const std::vector<double>& kernel,
+                                            int kw, int kh, IuBorderType border, double value)
+{
+  std::vector<double> out(v.size(), 0.0);
+  for(int y=0; y<height; ++y)
+  {
+    for(int x=0; x<width; ++x)
+    {
+      for(int j=0; j<kh; ++j)
+      {
+        const int r = referenceBorderIndex(y-(kh-1)/2+j, height, border);
+        for(int i=0; i<kw; ++i)
+        {
+          const int c = referenceBorderIndex(x-(kw-1)/2+i, width, border);
+          for(int ch=0; ch<channels; ++ch)
+          {
+            const double sample = (r < 0 || c < 0) ? value : v[(r*width + c)*channels + ch];
+            out[(y*width + x)*channels + ch] += kernel[j*kw + i]*sample;
+          }
+        }
+      }
+    }
+  }
+  return out;
+}
+
+// filterSeparable and filterConvolve for all border types, out-of-place and in-place,
+// against the naive correlation; kernels may be larger than the image
+template<typename ImageType, typename T, int Channels>
+static bool checkBorders(const ImageType& src, double border_value, double tolerance)
+{
+  const int width = src.width(), height = src.height();
+  const int n = width*height*Channels;
+  std::vector<double> v(n);
+  for(int y=0; y<height; ++y)
+    for(int x=0; x<width; ++x)
+      for(int ch=0; ch<Channels; ++ch)
+        v[(y*width + x)*Channels + ch] = ((const T*)src.data(x,y))[ch];
+
+  const IuSize sizes[4] = {IuSize(3,5), IuSize(4,2), IuSize(1,7),
+                           IuSize(2*width+3, 2*height+2)};
+  const IuBorderType borders[4] = {IU_BORDER_REPLICATE, IU_BORDER_REFLECT,
+                                   IU_BORDER_CONSTANT, IU_BORDER_WRAP};
+  ImageType dst(src.size()), inplace(src.size());
+  for(int s=0; s<4; ++s)
+  {
+    const int kw = sizes[s].width, kh = sizes[s].height;
+    std::vector<float> kx(kw), ky(kh), kernel(kw*kh);
+    std::vector<double> separable(kw*kh), dense(kw*kh);
+    for(int i=0; i<kw; ++i)
+      kx[i] = (1.0f + 0.5f*(i%3))/(1.5f*kw);
+    for(int j=0; j<kh; ++j)
+      ky[j] = (2.0f - 0.25f*(j%5))/(1.5f*kh);
+    for(int j=0; j<kh; ++j)
+    {
+      for(int i=0; i<kw; ++i)
+      {
+        separable[j*kw + i] = (double)kx[i]*ky[j];
+        kernel[j*kw + i] = (float)((1.0 + ((3*i + 7*j) % 5))/(3.0*kw*kh));
+        dense[j*kw + i] = kernel[j*kw + i];
+      }
+    }
+
+    for(int b=0; b<4; ++b)
+    {
+      for(int f=0; f<2; ++f)
+      {
+        const std::vector<double> expected =
+            naiveCorrelation(v, width, height, Channels, (f == 0) ? separable : dense,
+                             kw, kh, borders[b], border_value);
+        iu::copy(&src, &inplace);
+        if(f == 0)
+        {
+          iu::filterSeparable(&src, &dst, &kx[0], kw, &ky[0], kh, borders[b], (float)border_value);
+          iu::filterSeparable(&inplace, &inplace, &kx[0], kw, &ky[0], kh, borders[b], (float)border_value);
+        }
+        else
+        {
+          iu::filterConvolve(&src, &dst, &kernel[0], sizes[s], borders[b], (float)border_value);
+          iu::filterConvolve(&inplace, &inplace, &kernel[0], sizes[s], borders[b], (float)border_value);
+        }
+
+        for(int y=0; y<height; ++y)
+        {
+          for(int x=0; x<width; ++x)
+          {
+            for(int ch=0; ch<Channels; ++ch)
+            {
+              double e = expected[(y*width + x)*Channels + ch];
+              if(sizeof(T) == 1)
+                e = std::min(std::max(e, 0.0), 255.0);
+              const double a = ((const T*)dst.data(x,y))[ch];
+              const double a_inplace = ((const T*)inplace.data(x,y))[ch];
+              if(fabs(a - e) > tolerance || fabs(a_inplace - e) > tolerance)
+              {
+                std::cerr << ((f == 0) ? "filterSeparable" : "filterConvolve") << " with border "
+                          << borders[b] << " and a " << kw << "x" << kh << " kernel differs from "
+                          << "the reference at " << x << "/" << y << " (" << a << "/" << a_inplace
+                          << " vs. " << e << ")" << std::endl;
+                return false;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// sum w*|grad u| + lambda/2*|u - f|^2 with forward differences (zero at the last row/column)
+static double tvEnergy(const iu::ImageCpu_32f_C1& u, const iu::ImageCpu_32f_C1& f,
+                       const iu::ImageCpu_32f_C1* weights, float lambda)
+{
+  const int width = u.width(), height = u.height();
+  double energy = 0.0;
+  for(int y=0; y<height; ++y)
+  {
+    for(int x=0; x<width; ++x)
+    {
+      const double c = *u.data(x,y);
+      const double dx = (x+1 < width) ? *u.data(x+1,y) - c : 0.0;
+      const double dy = (y+1 < height) ? *u.data(x,y+1) - c : 0.0;
+      const double w = weights ? *weights->data(x,y) : 1.0;
+      energy += w*sqrt(dx*dx + dy*dy) + 0.5*lambda*(c - *f.data(x,y))*(c - *f.data(x,y));
+    }
+  }
+  return energy;
+}
+
+// Euclidean distance of two images
+static double imageDistance(const iu::ImageCpu_32f_C1& a, const iu::ImageCpu_32f_C1& b)
+{
+  double d = 0.0;
+  for(unsigned int y=0; y<a.height(); ++y)
+    for(unsigned int x=0; x<a.width(); ++x)
+      d += (*a.data(x,y) - *b.data(x,y))*(*a.data(x,y) - *b.data(x,y));
+  return sqrt(d);
+}
+
+int main(int argc, char** argv)
+{
+  std::cout << "Starting iu_filter_cpu_unittest ..." << std::endl;
+
+  IuSize sz(131,67);
+
+  // smooth image with constant patches (zero gradients) and a step edge
+  iu::ImageCpu_32f_C1 im(sz);
+  iu::ImageCpu_32f_C4 im_C4(sz);
+  for(unsigned int y=0; y<sz.height; ++y)
+  {
+    for(unsigned int x=0; x<sz.width; ++x)
+    {
+      float v = 0.5f + 0.4f*sinf(0.11f*x)*cosf(0.07f*y);
+      if(x%17 < 3)
+        v = 0.25f;
+      if(x > sz.width/2)
+        v += 0.3f;
+      *im.data(x,y) = v;
+      *im_C4.data(x,y) = make_float4(v, 1.0f-v, 0.5f*v*v, 7.0f);
+    }
+  }
+
+  // host edge weights against the exact exp/pow formula of the device kernels
+  {
+    std::cout << "testing filterEdge weights on cpu ..." << std::endl;
+
+    const float alphas[3] = {1.0f, 10.0f, 30.0f};
+    const float betas[3] = {0.55f, 1.0f, 2.0f};
+    const float minval = 1e-4f;
+
+    iu::ImageCpu_32f_C1 w_C1(sz);
+    iu::ImageCpu_32f_C4 w_C4(sz);
+    iu::ImageCpu_32f_C2 w_C2(sz);
+    for(int i=0; i<3; ++i)
+    {
+      const float alpha = alphas[i];
+      const float beta = betas[i];
+      iu::filterEdge(&im, &w_C1, im.roi(), alpha, beta, minval);
+      iu::filterEdge(&im, &w_C4, im.roi(), alpha, beta, minval);
+      iu::filterEdge(&im_C4, &w_C2, im.roi(), alpha, beta, minval);
+
+      for(unsigned int y=0; y<sz.height; ++y)
+      {
+        for(unsigned int x=0; x<sz.width; ++x)
+        {
+          // forward neighbours, clamped at the border
+          const unsigned int xr = std::min(x+1, sz.width-1);
+          const unsigned int yd = std::min(y+1, sz.height-1);
+          const unsigned int yu = (y > 0) ? y-1 : 0;
+          const float c = *im.data(x,y);
+          const float gx = *im.data(xr,y) - c;
+          const float gy = *im.data(x,yd) - c;
+          const float vals[4] = {fabsf(gx), fabsf(gy), fabsf(*im.data(xr,yd) - c), fabsf(*im.data(xr,yu) - c)};
+          const float* w4 = reinterpret_cast<const float*>(w_C4.data(x,y));
+          bool ok = checkEdgeWeight(*w_C1.data(x,y), sqrtf(gx*gx + gy*gy), alpha, beta, minval);
+          for(int k=0; k<4; ++k)
+            ok = ok && checkEdgeWeight(w4[k], vals[k], alpha, beta, minval);
+
+          // mean absolute difference over the RGB channels
+          const float4 c4 = *im_C4.data(x,y);
+          const float4 r4 = *im_C4.data(xr,y);
+          const float4 d4 = *im_C4.data(x,yd);
+          const float val_x = (fabsf(r4.x-c4.x) + fabsf(r4.y-c4.y) + fabsf(r4.z-c4.z)) / 3.0f;
+          const float val_y = (fabsf(d4.x-c4.x) + fabsf(d4.y-c4.y) + fabsf(d4.z-c4.z)) / 3.0f;
+          ok = ok && checkEdgeWeight(w_C2.data(x,y)->x, val_x, alpha, beta, minval);
+          ok = ok && checkEdgeWeight(w_C2.data(x,y)->y, val_y, alpha, beta, minval);
+          if(!ok)
+          {
+            std::cerr << "edge weight wrong at " << x << "/" << y << " (alpha=" << alpha
+                      << ", beta=" << beta << ")" << std::endl;
+            return EXIT_FAILURE;
+          }
+        }
+      }
+    }
+  }
+
+  // guided filter against the literal formula with naive box means
+  {
+    std::cout << "testing filterGuided on cpu ..." << std::endl;
+
+    const int w = sz.width, h = sz.height;
+    iu::ImageCpu_32f_C1 guide(sz);
+    std::vector<double> p(w*h), I(w*h), I_rgb(w*h), p_C4(w*h);
+    for(int y=0; y<h; ++y)
+    {
+      for(int x=0; x<w; ++x)
+      {
+        *guide.data(x,y) = 0.5f + 0.5f*cosf(0.05f*x*y);
+        p[y*w + x] = *im.data(x,y);
+        I[y*w + x] = *guide.data(x,y);
+        const float4 v = *im_C4.data(x,y);
+        I_rgb[y*w + x] = (v.x + v.y + v.z) / 3.0f;
+        p_C4[y*w + x] = v.z;
+      }
+    }
+
+    // radius 0, small, and larger than the image
+    const int radii[3] = {0, 4, 150};
+    const float eps = 0.01f;
+    for(int i=0; i<3; ++i)
+    {
+      const int r = radii[i];
+      iu::ImageCpu_32f_C1 self(sz), guided(sz), in_place(im);
+      iu::ImageCpu_32f_C4 out_C4(sz);
+      iu::filterGuided(&im, 0, &self, r, eps);
+      iu::filterGuided(&im, &guide, &guided, r, eps);
+      iu::filterGuided(&in_place, 0, &in_place, r, eps);
+      iu::filterGuided(&im_C4, 0, &out_C4, r, eps);
+
+      const std::vector<double> q_self = naiveGuidedFilter(p, p, w, h, r, eps);
+      const std::vector<double> q_guided = naiveGuidedFilter(p, I, w, h, r, eps);
+      const std::vector<double> q_C4 = naiveGuidedFilter(p_C4, I_rgb, w, h, r, eps);
+      for(int y=0; y<h; ++y)
+      {
+        for(int x=0; x<w; ++x)
+        {
+          if(fabs(*self.data(x,y) - q_self[y*w + x]) > 1e-4 ||
+             fabs(*guided.data(x,y) - q_guided[y*w + x]) > 1e-4 ||
+             *in_place.data(x,y) != *self.data(x,y) ||
+             fabs(out_C4.data(x,y)->z - q_C4[y*w + x]) > 1e-4 ||
+             fabs(out_C4.data(x,y)->w - 7.0f) > 1e-4)
+          {
+            std::cerr << "guided filter wrong at " << x << "/" << y << " (radius " << r << ")" << std::endl;
+            return EXIT_FAILURE;
+          }
+        }
+      }
+    }
+  }
+
+  // bilateral grid: constant images stay constant, step edges stay sharp
+  {
+    std::cout << "testing filterBilateral on cpu ..." << std::endl;
+
+    iu::ImageCpu_32f_C1 constant(sz), step(sz), out(sz);
+    iu::ImageCpu_32f_C4 constant_C4(sz), out_C4(sz);
+    iu::setValue(0.37f, &constant, constant.roi());
+    iu::setValue(make_float4(0.1f, 0.2f, 0.3f, 1.0f), &constant_C4, constant_C4.roi());
+    for(unsigned int y=0; y<sz.height; ++y)
+      for(unsigned int x=0; x<sz.width; ++x)
+        *step.data(x,y) = (x < 2*y) ? 0.2f : 0.8f;
+
+    const float sigmas[2] = {1.0f, 6.0f};
+    for(int i=0; i<2; ++i)
+    {
+      iu::filterBilateral(&constant, 0, &out, sigmas[i], 0.1f);
+      iu::filterBilateral(&constant_C4, 0, &out_C4, sigmas[i], 0.1f);
+      for(unsigned int y=0; y<sz.height; ++y)
+      {
+        for(unsigned int x=0; x<sz.width; ++x)
+        {
+          const float4 v = *out_C4.data(x,y);
+          if(fabs(*out.data(x,y) - 0.37f) > 1e-5f || fabs(v.x - 0.1f) > 1e-5f ||
+             fabs(v.z - 0.3f) > 1e-5f || fabs(v.w - 1.0f) > 1e-5f)
+          {
+            std::cerr << "bilateral filter changed a constant image at " << x << "/" << y << std::endl;
+            return EXIT_FAILURE;
+          }
+        }
+      }
+
+      // the sides are 6 sigma_range apart: nothing is mixed across the edge
+      iu::filterBilateral(&step, 0, &out, sigmas[i], 0.1f);
+      for(unsigned int y=0; y<sz.height; ++y)
+      {
+        for(unsigned int x=0; x<sz.width; ++x)
+        {
+          if(fabs(*out.data(x,y) - *step.data(x,y)) > 1e-5f)
+          {
+            std::cerr << "bilateral filter blurred the step edge at " << x << "/" << y << std::endl;
+            return EXIT_FAILURE;
+          }
+        }
+      }
+    }
+  }
+
+  // morphology against a naive min/max window, including the image edges
+  {
+    std::cout << "testing filterMorphology on cpu ..." << std::endl;
+
+    IuSize msz(53,37);
+    iu::ImageCpu_8u_C1 im_8u(msz);
+    iu::ImageCpu_32f_C1 im_32f(msz);
+    unsigned int seed = 12345u;
+    for(unsigned int y=0; y<msz.height; ++y)
+    {
+      for(unsigned int x=0; x<msz.width; ++x)
+      {
+        seed = seed*1664525u + 1013904223u;
+        *im_8u.data(x,y) = (unsigned char)(seed >> 24);
+        *im_32f.data(x,y) = (float)(seed >> 8)/16777216.0f - 0.5f;
+      }
+    }
+    if(!checkMorphology<iu::ImageCpu_8u_C1, unsigned char>(im_8u) ||
+       !checkMorphology<iu::ImageCpu_32f_C1, float>(im_32f))
+      return EXIT_FAILURE;
+  }
+
+  // border handling of the convolutions against a scalar border index reference
+  {
+    std::cout << "testing border handling of filterSeparable/filterConvolve on cpu ..." << std::endl;
+
+    IuSize bsz(13,9);
+    iu::ImageCpu_8u_C1 b_8u_C1(bsz);
+    iu::ImageCpu_8u_C4 b_8u_C4(bsz);
+    iu::ImageCpu_32f_C1 b_32f_C1(bsz);
+    iu::ImageCpu_32f_C4 b_32f_C4(bsz);
+    unsigned int seed = 4711u;
+    for(unsigned int y=0; y<bsz.height; ++y)
+    {
+      for(unsigned int x=0; x<bsz.width; ++x)
+      {
+        unsigned char c[4];
+        float f[4];
+        for(int ch=0; ch<4; ++ch)
+        {
+          seed = seed*1664525u + 1013904223u;
+          c[ch] = (unsigned char)(seed >> 24);
+          f[ch] = (float)(seed >> 8)/16777216.0f - 0.5f;
+        }
+        *b_8u_C1.data(x,y) = c[0];
+        *b_8u_C4.data(x,y) = make_uchar4(c[0], c[1], c[2], c[3]);
+        *b_32f_C1.data(x,y) = f[0];
+        *b_32f_C4.data(x,y) = make_float4(f[0], f[1], f[2], f[3]);
+      }
+    }
+
+    // 8-bit results are rounded and saturated: one step off for sums close to .5
+    if(!checkBorders<iu::ImageCpu_8u_C1, unsigned char, 1>(b_8u_C1, 77.0, 1.0) ||
+       !checkBorders<iu::ImageCpu_8u_C4, unsigned char, 4>(b_8u_C4, 77.0, 1.0) ||
+       !checkBorders<iu::ImageCpu_32f_C1, float, 1>(b_32f_C1, 0.25, 1e-5) ||
+       !checkBorders<iu::ImageCpu_32f_C4, float, 4>(b_32f_C4, 0.25, 1e-5))
+      return EXIT_FAILURE;
+  }
+
+  // FFT of overlapping tiles against the direct sums: odd and prime image sizes (the
+  // tiles have fast sizes), kernels larger than the image, the automatic choice of the
+  // method and all instruction set levels
+  {
+    std::cout << "testing filterConvolve/filterCorrelate via FFT on cpu ..." << std::endl;
+
+    const IuSize image_sizes[3] = {IuSize(97,45), IuSize(49,131), IuSize(175,77)};
+    const IuCpuLevel level = iu::CpuDispatch::level();
+    unsigned int seed = 815u;
+    for(int s=0; s<3; ++s)
+    {
+      const IuSize fsz = image_sizes[s];
+      const int width = fsz.width, height = fsz.height;
+      iu::ImageCpu_32f_C1 src(fsz), dst(fsz), inplace(fsz);
+      std::vector<double> v(width*height);
+      for(int y=0; y<height; ++y)
+      {
+        for(int x=0; x<width; ++x)
+        {
+          seed = seed*1664525u + 1013904223u;
+          *src.data(x,y) = (float)(seed >> 8)/16777216.0f - 0.5f;
+          v[y*width + x] = *src.data(x,y);
+        }
+      }
+
+      // small (direct) to large (FFT) kernels and one larger than the image
+      const IuSize kernel_sizes[5] = {IuSize(5,5), IuSize(15,9), IuSize(31,31), IuSize(7,63),
+                                      IuSize(width+6, height+3)};
+      for(int k=0; k<5; ++k)
+      {
+        const int kw = kernel_sizes[k].width, kh = kernel_sizes[k].height;
+        std::vector<float> kernel(kw*kh);
+        std::vector<double> dense(kw*kh);
+        double sum = 0.0;
+        for(int i=0; i<kw*kh; ++i)
+        {
+          seed = seed*1664525u + 1013904223u;
+          dense[i] = (float)(seed >> 8)/16777216.0f - 0.25f;
+          sum += fabs(dense[i]);
+        }
+        for(int i=0; i<kw*kh; ++i)
+        {
+          kernel[i] = (float)(dense[i]/sum);
+          dense[i] = kernel[i];
+        }
+        const IuBorderType border = (k%2 == 0) ? IU_BORDER_REFLECT : IU_BORDER_CONSTANT;
+        const std::vector<double> expected =
+            naiveCorrelation(v, width, height, 1, dense, kw, kh, border, 0.25);
+
+        for(int l=IU_CPU_GENERIC; l<=(int)iu::CpuDispatch::supportedLevel(); ++l)
+        {
+          iu::CpuDispatch::setLevel((IuCpuLevel)l);
+          iu::copy(&src, &inplace);
+          iu::filterConvolve(&src, &dst, &kernel[0], kernel_sizes[k], border, 0.25f);
+          iu::filterConvolve(&inplace, &inplace, &kernel[0], kernel_sizes[k], border, 0.25f);
+          for(int y=0; y<height; ++y)
+          {
+            for(int x=0; x<width; ++x)
+            {
+              const double e = expected[y*width + x];
+              if(fabs(*dst.data(x,y) - e) > 1e-5 || fabs(*inplace.data(x,y) - e) > 1e-5)
+              {
+                std::cerr << "filterConvolve of a " << width << "x" << height << " image with a "
+                          << kw << "x" << kh << " kernel (" << iu::CpuDispatch::levelName((IuCpuLevel)l)
+                          << ") differs from the direct sum at " << x << "/" << y << std::endl;
+                return EXIT_FAILURE;
+              }
+            }
+          }
+        }
+      }
+
+      // templates from a few taps to the whole image (a single output)
+      const IuSize templ_sizes[5] = {IuSize(3,3), IuSize(9,7), IuSize(25,21),
+                                     IuSize(width-2, height/2), IuSize(width, height)};
+      for(int t=0; t<5; ++t)
+      {
+        const int tw = templ_sizes[t].width, th = templ_sizes[t].height;
+        const IuSize dsz(width-tw+1, height-th+1);
+        iu::ImageCpu_32f_C1 templ(templ_sizes[t]), out(dsz);
+        for(int y=0; y<th; ++y)
+        {
+          for(int x=0; x<tw; ++x)
+          {
+            seed = seed*1664525u + 1013904223u;
+            *templ.data(x,y) = ((float)(seed >> 8)/16777216.0f - 0.5f)/(tw*th);
+          }
+        }
+
+        for(int l=IU_CPU_GENERIC; l<=(int)iu::CpuDispatch::supportedLevel(); ++l)
+        {
+          iu::CpuDispatch::setLevel((IuCpuLevel)l);
+          const IuConvolutionMethod methods[3] = {IU_CONVOLUTION_DIRECT, IU_CONVOLUTION_FFT,
+                                                  IU_CONVOLUTION_AUTO};
+          for(int m=0; m<3; ++m)
+          {
+            iu::filterCorrelate(&src, &templ, &out, methods[m]);
+            for(unsigned int y=0; y<dsz.height; ++y)
+            {
+              for(unsigned int x=0; x<dsz.width; ++x)
+              {
+                double e = 0.0;
+                for(int j=0; j<th; ++j)
+                  for(int i=0; i<tw; ++i)
+                    e += (double)*templ.data(i,j)*v[(y+j)*width + x+i];
+                if(fabs(*out.data(x,y) - e) > 1e-5)
+                {
+                  std::cerr << "filterCorrelate (method " << methods[m] << ") of a " << width << "x"
+                            << height << " image with a " << tw << "x" << th << " template ("
+                            << iu::CpuDispatch::levelName((IuCpuLevel)l)
+                            << ") differs from the direct sum at " << x << "/" << y << std::endl;
+                  return EXIT_FAILURE;
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+    iu::CpuDispatch::setLevel(level);
+  }
+
+  // TV and TGV denoising: constant images, channels and energy over the iterations
+  {
+    std::cout << "testing denoiseTV/denoiseTGV2 on cpu ..." << std::endl;
+
+    IuSize dsz(61,43);
+    iu::ImageCpu_32f_C1 constant(dsz), noisy(dsz), weights(dsz), u(dsz), u_ref(dsz);
+    iu::ImageCpu_32f_C4 constant_C4(dsz), noisy_C4(dsz), u_C4(dsz);
+    iu::ImageCpu_32f_C1 channel[4] = {iu::ImageCpu_32f_C1(dsz), iu::ImageCpu_32f_C1(dsz),
+                                      iu::ImageCpu_32f_C1(dsz), iu::ImageCpu_32f_C1(dsz)};
+    iu::setValue(0.37f, &constant, constant.roi());
+    iu::setValue(make_float4(0.1f, 0.2f, 0.3f, 1.0f), &constant_C4, constant_C4.roi());
+    unsigned int seed = 2011u;
+    for(unsigned int y=0; y<dsz.height; ++y)
+    {
+      for(unsigned int x=0; x<dsz.width; ++x)
+      {
+        float n[4];
+        for(int c=0; c<4; ++c)
+        {
+          seed = seed*1664525u + 1013904223u;
+          n[c] = 0.2f*((float)(seed >> 8)/16777216.0f - 0.5f);
+        }
+        const float step = (x < y+10) ? 0.2f : 0.8f;
+        *noisy.data(x,y) = step + n[0];
+        *noisy_C4.data(x,y) = make_float4(step + n[0], 0.01f*x + n[1], 1.0f - step + n[2], n[3]);
+        *weights.data(x,y) = 0.5f + 0.5f*((x+y)%3);
+        for(int c=0; c<4; ++c)
+          *channel[c].data(x,y) = ((const float*)noisy_C4.data(x,y))[c];
+      }
+    }
+
+    // constant images are minimizers for every weight and parameter
+    for(int tgv=0; tgv<2; ++tgv)
+    {
+      if(tgv)
+      {
+        iu::denoiseTGV2(&constant, &u, 4.0f, 1.0f, 2.0f, 50, &weights);
+        iu::denoiseTGV2(&constant_C4, &u_C4, 4.0f, 1.0f, 2.0f, 50);
+      }
+      else
+      {
+        iu::denoiseTV(&constant, &u, 4.0f, 50, &weights);
+        iu::denoiseTV(&constant_C4, &u_C4, 4.0f, 50);
+      }
+      for(unsigned int y=0; y<dsz.height; ++y)
+      {
+        for(unsigned int x=0; x<dsz.width; ++x)
+        {
+          const float4 v = *u_C4.data(x,y);
+          if(fabs(*u.data(x,y) - 0.37f) > 1e-6f || fabs(v.x - 0.1f) > 1e-6f || fabs(v.y - 0.2f) > 1e-6f ||
+             fabs(v.z - 0.3f) > 1e-6f || fabs(v.w - 1.0f) > 1e-6f)
+          {
+            std::cerr << (tgv ? "denoiseTGV2" : "denoiseTV") << " changed a constant image at "
+                      << x << "/" << y << std::endl;
+            return EXIT_FAILURE;
+          }
+        }
+      }
+    }
+
+    // color images are denoised per channel
+    for(int tgv=0; tgv<2; ++tgv)
+    {
+      for(int weighted=0; weighted<2; ++weighted)
+      {
+        const iu::ImageCpu_32f_C1* w = weighted ? &weights : 0;
+        if(tgv)
+          iu::denoiseTGV2(&noisy_C4, &u_C4, 8.0f, 1.0f, 2.0f, 40, w);
+        else
+          iu::denoiseTV(&noisy_C4, &u_C4, 8.0f, 40, w);
+        for(int c=0; c<4; ++c)
+        {
+          if(tgv)
+            iu::denoiseTGV2(&channel[c], &u, 8.0f, 1.0f, 2.0f, 40, w);
+          else
+            iu::denoiseTV(&channel[c], &u, 8.0f, 40, w);
+          for(unsigned int y=0; y<dsz.height; ++y)
+          {
+            for(unsigned int x=0; x<dsz.width; ++x)
+            {
+              if(fabs(((const float*)u_C4.data(x,y))[c] - *u.data(x,y)) > 1e-6f)
+              {
+                std::cerr << (tgv ? "denoiseTGV2" : "denoiseTV") << " of channel " << c
+                          << " of a color image differs from the gray image at " << x << "/" << y << std::endl;
+                return EXIT_FAILURE;
+              }
+            }
+          }
+        }
+      }
+    }
+
+    // the TV energy decreases from the noisy image on; TGV (its energy also depends on
+    // the auxiliary field v) approaches the result of a long run
+    const unsigned int iterations[4] = {5, 20, 80, 320};
+    double last_energy = tvEnergy(noisy, noisy, &weights, 8.0f);
+    for(int i=0; i<4; ++i)
+    {
+      iu::denoiseTV(&noisy, &u, 8.0f, iterations[i], &weights);
+      const double energy = tvEnergy(u, noisy, &weights, 8.0f);
+      if(!(energy < last_energy))
+      {
+        std::cerr << "TV energy after " << iterations[i] << " iterations did not decrease ("
+                  << energy << " >= " << last_energy << ")" << std::endl;
+        return EXIT_FAILURE;
+      }
+      last_energy = energy;
+    }
+    iu::denoiseTGV2(&noisy, &u_ref, 8.0f, 1.0f, 2.0f, 2000, &weights);
+    double last_distance = imageDistance(noisy, u_ref);
+    for(int i=0; i<4; ++i)
+    {
+      iu::denoiseTGV2(&noisy, &u, 8.0f, 1.0f, 2.0f, iterations[i], &weights);
+      const double d = imageDistance(u, u_ref);
+      if(!(d < last_distance))
+      {
+        std::cerr << "TGV result after " << iterations[i] << " iterations did not approach the "
+                  << "converged result (" << d << " >= " << last_distance << ")" << std::endl;
+        return EXIT_FAILURE;
+      }
+      last_distance = d;
+    }
+  }
+
+  std::cout << std::endl;
+  std::cout << "**************************************************************************" << std::endl;
+  std::cout << "*  Everything seem to be ok. -- All assertions passed.                   *" << std::endl;
+  std::cout << "**************************************************************************" << std::endl;
+  std::cout << std::endl;
+
+  return EXIT_SUCCESS;
+}
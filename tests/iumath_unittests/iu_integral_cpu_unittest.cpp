@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Unit Tests
+ * Class       : none
+ * Language    : C++
+ * Description : Unit tests for integral images and box queries
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+// system includes
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <iucore.h>
+#include <iumath.h>
+
+int main(int argc, char** argv)
+{
+  std::cout << "Starting iu_integral_cpu_unittest ..." << std::endl;
+
+  // test image size (wider than one column block of the vertical pass)
+  IuSize sz(613,97);
+
+  iu::ImageCpu_8u_C1 im_8u(sz);
+  iu::ImageCpu_32f_C1 im_32f(sz);
+  for(unsigned int y=0; y<sz.height; ++y)
+  {
+    for(unsigned int x=0; x<sz.width; ++x)
+    {
+      *im_8u.data(x,y) = (unsigned char)((x*7 + y*13) % 256);
+      *im_32f.data(x,y) = 0.25f*(float)(((x*5 + y*3) % 17)) - 1.0f;
+    }
+  }
+
+  IuSize sz_ii(sz.width+1, sz.height+1);
+  iu::ImageCpu_64f_C1 ii_8u(sz_ii), ii_sq_8u(sz_ii), ii_32f(sz_ii), ii_sq_32f(sz_ii);
+  iu::integral(&im_8u, &ii_8u);
+  iu::integralSquared(&im_8u, &ii_sq_8u);
+  iu::integral(&im_32f, &ii_32f);
+  iu::integralSquared(&im_32f, &ii_sq_32f);
+
+  // compare every entry with a brute force sum over the prefix (8-bit is exact)
+  {
+    for(unsigned int y=0; y<=sz.height; y+=3)
+    {
+      for(unsigned int x=0; x<=sz.width; x+=5)
+      {
+        double sum_8u = 0.0, sum_sq_8u = 0.0, sum_32f = 0.0;
+        for(unsigned int j=0; j<y; ++j)
+        {
+          for(unsigned int i=0; i<x; ++i)
+          {
+            const double v = *im_8u.data(i,j);
+            sum_8u += v;
+            sum_sq_8u += v*v;
+            sum_32f += *im_32f.data(i,j);
+          }
+        }
+        if(*ii_8u.data(x,y) != sum_8u || *ii_sq_8u.data(x,y) != sum_sq_8u ||
+           fabs(*ii_32f.data(x,y) - sum_32f) > 1e-6)
+        {
+          std::cerr << "integral image wrong at " << x << "/" << y << std::endl;
+          return EXIT_FAILURE;
+        }
+      }
+    }
+    std::cout << "Testing integral ok ..." << std::endl;
+  }
+
+  // box statistics (incl. boxes partially or completely outside the image)
+  {
+    const int num = 5;
+    IuRect boxes[num] = { IuRect(0,0,sz.width,sz.height), IuRect(10,20,31,17),
+                          IuRect(-5,-3,12,9), IuRect(sz.width-4,sz.height-2,10,10),
+                          IuRect(sz.width+3,0,5,5) };
+    double sums[num], means[num], variances[num];
+    iu::boxStatistics(&ii_32f, &ii_sq_32f, boxes, num, sums, means, variances);
+
+    for(int b=0; b<num; ++b)
+    {
+      double sum = 0.0, sum_sq = 0.0, area = 0.0;
+      for(int y=boxes[b].y; y<boxes[b].y+(int)boxes[b].height; ++y)
+      {
+        for(int x=boxes[b].x; x<boxes[b].x+(int)boxes[b].width; ++x)
+        {
+          if(x<0 || y<0 || x>=(int)sz.width || y>=(int)sz.height)
+            continue;
+          const double v = *im_32f.data(x,y);
+          sum += v;
+          sum_sq += v*v;
+          area += 1.0;
+        }
+      }
+      const double mean = (area > 0.0) ? sum/area : 0.0;
+      const double var = (area > 0.0) ? sum_sq/area - mean*mean : 0.0;
+      if(fabs(sums[b]-sum) > 1e-6 || fabs(means[b]-mean) > 1e-9 || fabs(variances[b]-var) > 1e-9 ||
+         fabs(iu::boxSum(&ii_32f, boxes[b])-sum) > 1e-6)
+      {
+        std::cerr << "box statistics wrong for box " << b << ": " << sums[b] << "/" << sum << " "
+                  << means[b] << "/" << mean << " " << variances[b] << "/" << var << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+    std::cout << "Testing boxStatistics ok ..." << std::endl;
+  }
+
+  std::cout << std::endl;
+  std::cout << "**************************************************************************" << std::endl;
+  std::cout << "*  Everything seem to be ok. -- All assertions passed.                   *" << std::endl;
+  std::cout << "**************************************************************************" << std::endl;
+  std::cout << std::endl;
+
+  return EXIT_SUCCESS;
+}
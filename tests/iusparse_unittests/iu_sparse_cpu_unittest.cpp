@@ -0,0 +1,599 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Unit Tests
+ * Class       : none
+ * Language    : C++
+ * Description : Unit tests for host sparse matrix operations
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+// system includes
+#include <iostream>
+#include <stdio.h>
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+#include <iucore.h>
+#include <iusparse.h>
+
+// forward differences of a width x height image as COO triplets (2 entries per row,
+// rows in reverse order and the diagonal entry duplicated to exercise the sorting)
+static void gradientCoo(int width, int height, std::vector<int>& row,
+                        std::vector<int>& col, std::vector<float>& val)
+{
+  for (int i = 2*width*height-1; i >= 0; --i)
+  {
+    const int p = i % (width*height);
+    const int x = p % width;
+    const int y = p / width;
+    const int q = (i < width*height) ? (x < width-1 ? p+1 : p) : (y < height-1 ? p+width : p);
+    if (q == p)
+      continue;
+    row.push_back(i); col.push_back(q); val.push_back(1.0f);
+    row.push_back(i); col.push_back(p); val.push_back(-0.5f);
+    row.push_back(i); col.push_back(p); val.push_back(-0.5f);
+  }
+}
+
+// 5-point Laplacian of a width x height image plus a small diagonal shift (SPD)
+static void poissonCoo(int width, int height, std::vector<int>& row,
+                       std::vector<int>& col, std::vector<float>& val)
+{
+  for (int y = 0; y < height; ++y)
+    for (int x = 0; x < width; ++x)
+    {
+      const int p = y*width + x;
+      float diag = 0.01f + 0.1f*(float)(p % 7);
+      const int n[4][2] = {{x-1, y}, {x+1, y}, {x, y-1}, {x, y+1}};
+      for (int k = 0; k < 4; ++k)
+      {
+        if (n[k][0] < 0 || n[k][0] >= width || n[k][1] < 0 || n[k][1] >= height)
+          continue;
+        row.push_back(p); col.push_back(n[k][1]*width + n[k][0]); val.push_back(-1.0f);
+        diag += 1.0f;
+      }
+      row.push_back(p); col.push_back(p); val.push_back(diag);
+    }
+}
+
+// relative residual |b - Ax|/|b|
+static double relativeResidual(iu::SparseMatrixCpu<float>* A, iu::LinearHostMemory_32f_C1* b,
+                               iu::LinearHostMemory_32f_C1* x)
+{
+  iu::LinearHostMemory_32f_C1 ax(b->length());
+  iu::sparseMultiplication(A, x, &ax);
+  double rr = 0.0, bb = 0.0;
+  for (unsigned int i = 0; i < b->length(); ++i)
+  {
+    const double r = *b->data(i) - *ax.data(i);
+    rr += r*r;
+    bb += (double)*b->data(i) * *b->data(i);
+  }
+  return sqrt(rr/bb);
+}
+
+// CSR matrix of the nonzero entries of a dense n x n matrix (row-major)
+static iu::SparseMatrixCpu<float>* denseToCsr(const std::vector<float>& dense, int n)
+{
+  std::vector<int> ind;
+  std::vector<float> val;
+  iu::LinearHostMemory<int> ptr(n+1);
+  for (int r = 0; r < n; ++r)
+  {
+    *ptr.data(r) = (int)val.size();
+    for (int c = 0; c < n; ++c)
+      if (dense[r*n + c] != 0.0f)
+      {
+        ind.push_back(c);
+        val.push_back(dense[r*n + c]);
+      }
+  }
+  *ptr.data(n) = (int)val.size();
+  iu::LinearHostMemory<int> ind_mem(&ind[0], ind.size());
+  iu::LinearHostMemory<float> val_mem(&val[0], val.size());
+  return new iu::SparseMatrixCpu<float>(&val_mem, &ptr, &ind_mem, n, n, CSR);
+}
+
+// largest absolute difference of two vectors
+static double maxDifference(iu::LinearHostMemory_32f_C1* a, const std::vector<float>& b)
+{
+  double diff = 0.0;
+  for (unsigned int i = 0; i < a->length(); ++i)
+    diff = std::max(diff, fabs((double)*a->data(i) - b[i]));
+  return diff;
+}
+
+// writes bytes into an existing file
+static void patchFile(const char* name, long offset, const void* data, size_t bytes)
+{
+  FILE* f = fopen(name, "r+b");
+  fseek(f, offset, SEEK_SET);
+  fwrite(data, 1, bytes, f);
+  fclose(f);
+}
+
+// true if reading the file throws
+static bool readFails(const char* name, bool binary, bool map_file)
+{
+  try
+  {
+    delete (binary ? iu::readSparseBinary(name, map_file) : iu::readMatrixMarket(name));
+  }
+  catch (IuException&)
+  {
+    return true;
+  }
+  return false;
+}
+
+struct CountIterations : public iu::SparseSolverCallback
+{
+  int calls;
+  float last;
+  CountIterations() : calls(0), last(0.0f) {}
+  bool operator()(int iteration, float residual)
+  { ++calls; last = residual; return iteration < 5; }
+};
+
+int main(int argc, char** argv)
+{
+  std::cout << "Starting iu_sparse_cpu_unittest ..." << std::endl;
+
+  try
+  {
+    // COO -> CSR/CSC with duplicate summation and CSR <-> CSC transposition
+    {
+      std::cout << "testing sparse format conversions on cpu ..." << std::endl;
+
+      const int width = 181, height = 97;
+      const int n_row = 2*width*height, n_col = width*height;
+      std::vector<int> row, col;
+      std::vector<float> val;
+      gradientCoo(width, height, row, col, val);
+
+      iu::LinearHostMemory<int> coo_row(&row[0], row.size());
+      iu::LinearHostMemory<int> coo_col(&col[0], col.size());
+      iu::LinearHostMemory<float> coo_val(&val[0], val.size());
+
+      iu::LinearHostMemory<int> csr_ptr(n_row+1);
+      iu::LinearHostMemory<int> csr_ind(coo_val.length());
+      iu::LinearHostMemory<float> csr_val(coo_val.length());
+      const unsigned int nnz = iu::convertCooToSparse(&coo_row, &coo_col, &coo_val, n_row, n_col, CSR,
+                                                      &csr_ptr, &csr_ind, &csr_val);
+      if (nnz != 2*coo_val.length()/3)
+        return EXIT_FAILURE;
+
+      for (int r = 0; r < n_row; ++r)
+      {
+        const int p = r % n_col;
+        const int x = p % width;
+        const int y = p / width;
+        const bool border = (r < n_col) ? (x == width-1) : (y == height-1);
+        const int b = *csr_ptr.data(r);
+        if (*csr_ptr.data(r+1) - b != (border ? 0 : 2))
+          return EXIT_FAILURE;
+        if (border)
+          continue;
+        // sorted minor indices, duplicates summed up
+        if (*csr_ind.data(b) != p || *csr_ind.data(b+1) <= p ||
+            *csr_val.data(b) != -1.0f || *csr_val.data(b+1) != 1.0f)
+          return EXIT_FAILURE;
+      }
+
+      // the CSC of the same triplets has to match the transposed CSR arrays
+      iu::LinearHostMemory<int> csc_ptr(n_col+1);
+      iu::LinearHostMemory<int> csc_ind(coo_val.length());
+      iu::LinearHostMemory<float> csc_val(coo_val.length());
+      if (iu::convertCooToSparse(&coo_row, &coo_col, &coo_val, n_row, n_col, CSC,
+                                 &csc_ptr, &csc_ind, &csc_val) != nnz)
+        return EXIT_FAILURE;
+
+      iu::LinearHostMemory<int> ind_view(csr_ind, 0, nnz);
+      iu::LinearHostMemory<float> val_view(csr_val, 0, nnz);
+      iu::SparseMatrixCpu<float> A(&val_view, &csr_ptr, &ind_view, n_row, n_col, CSR);
+      A.changeSparseFormat(CSC);
+      for (int c = 0; c <= n_col; ++c)
+        if (A.col()->data()[c] != *csc_ptr.data(c))
+          return EXIT_FAILURE;
+      for (unsigned int i = 0; i < nnz; ++i)
+        if (A.row()->data()[i] != *csc_ind.data(i) || A.value()->data()[i] != *csc_val.data(i))
+          return EXIT_FAILURE;
+
+      // and back
+      A.changeSparseFormat(CSR);
+      for (int r = 0; r <= n_row; ++r)
+        if (A.row()->data()[r] != *csr_ptr.data(r))
+          return EXIT_FAILURE;
+      for (unsigned int i = 0; i < nnz; ++i)
+        if (A.col()->data()[i] != *csr_ind.data(i) || A.value()->data()[i] != *csr_val.data(i))
+          return EXIT_FAILURE;
+    }
+
+    // SELL-C-sigma products have to match the CSR products
+    {
+      std::cout << "testing sparse matrix-vector multiplication on cpu ..." << std::endl;
+
+      const int width = 67, height = 45;
+      const int n_row = 2*width*height, n_col = width*height;
+      std::vector<int> row, col;
+      std::vector<float> val;
+      gradientCoo(width, height, row, col, val);
+      iu::LinearHostMemory<int> coo_row(&row[0], row.size());
+      iu::LinearHostMemory<int> coo_col(&col[0], col.size());
+      iu::LinearHostMemory<float> coo_val(&val[0], val.size());
+      iu::LinearHostMemory<int> ptr(n_row+1);
+      iu::LinearHostMemory<int> ind(coo_val.length());
+      iu::LinearHostMemory<float> value(coo_val.length());
+      const unsigned int nnz = iu::convertCooToSparse(&coo_row, &coo_col, &coo_val, n_row, n_col, CSR,
+                                                      &ptr, &ind, &value);
+      iu::LinearHostMemory<int> ind_view(ind, 0, nnz);
+      iu::LinearHostMemory<float> value_view(value, 0, nnz);
+
+      iu::LinearHostMemory_32f_C1 u(n_col);
+      iu::LinearHostMemory_32f_C1 p(n_row);
+      for (int i = 0; i < n_col; ++i)
+        *u.data(i) = (float)((i*37) % 101);
+      for (int i = 0; i < n_row; ++i)
+        *p.data(i) = (float)((i*13) % 53);
+
+      iu::SparseMatrixCpu<float> G(&value_view, &ptr, &ind_view, n_row, n_col, CSR);
+      iu::LinearHostMemory_32f_C1 gu(n_row);
+      iu::LinearHostMemory_32f_C1 gtp(n_col);
+      iu::sparseMultiplication(&G, &u, &gu);
+      iu::sparseMultiplication(&G, &p, &gtp, CUSPARSE_OPERATION_TRANSPOSE);
+
+      const int slice_heights[3] = {4, 16, 7};
+      for (int i = 0; i < 3; ++i)
+      {
+        iu::SparseMatrixCpu<float> S(&value_view, &ptr, &ind_view, n_row, n_col, CSR);
+        S.changeSparseFormat(SELL, slice_heights[i], 64);
+        if (S.sparseFormat() != SELL || S.n_elements() != (int)nnz || S.value()->length() < nnz)
+          return EXIT_FAILURE;
+
+        iu::LinearHostMemory_32f_C1 su(n_row);
+        iu::LinearHostMemory_32f_C1 stp(n_col);
+        iu::sparseMultiplication(&S, &u, &su);
+        iu::sparseMultiplication(&S, &p, &stp, CUSPARSE_OPERATION_TRANSPOSE);
+        for (int r = 0; r < n_row; ++r)
+          if (*su.data(r) != *gu.data(r))
+            return EXIT_FAILURE;
+        for (int c = 0; c < n_col; ++c)
+          if (fabs(*stp.data(c) - *gtp.data(c)) > 1e-3f)
+            return EXIT_FAILURE;
+      }
+    }
+
+    // iterative solvers on a Poisson problem
+    {
+      std::cout << "testing sparse solvers on cpu ..." << std::endl;
+
+      const int width = 93, height = 71;
+      const int n = width*height;
+      std::vector<int> row, col;
+      std::vector<float> val;
+      poissonCoo(width, height, row, col, val);
+      iu::LinearHostMemory<int> coo_row(&row[0], row.size());
+      iu::LinearHostMemory<int> coo_col(&col[0], col.size());
+      iu::LinearHostMemory<float> coo_val(&val[0], val.size());
+      iu::LinearHostMemory<int> ptr(n+1);
+      iu::LinearHostMemory<int> ind(coo_val.length());
+      iu::LinearHostMemory<float> value(coo_val.length());
+      const unsigned int nnz = iu::convertCooToSparse(&coo_row, &coo_col, &coo_val, n, n, CSR,
+                                                      &ptr, &ind, &value);
+      iu::LinearHostMemory<int> ind_view(ind, 0, nnz);
+      iu::LinearHostMemory<float> value_view(value, 0, nnz);
+
+      iu::LinearHostMemory_32f_C1 b(n);
+      for (int i = 0; i < n; ++i)
+        *b.data(i) = (float)((i*29) % 61) - 30.0f;
+
+      for (int format = 0; format < 2; ++format)
+      {
+        iu::SparseMatrixCpu<float> A(&value_view, &ptr, &ind_view, n, n, CSR);
+        if (format == 1)
+          A.changeSparseFormat(SELL, 8, 128);
+
+        iu::LinearHostMemory_32f_C1 x(n);
+        iu::copy(&b, &x); // arbitrary initial guess
+        const int cg = iu::solveCG(&A, &b, &x, 2000, 1e-5f);
+        if (cg <= 0 || cg >= 2000 || relativeResidual(&A, &b, &x) > 1e-4)
+          return EXIT_FAILURE;
+
+        iu::LinearHostMemory_32f_C1 xj(n);
+        iu::setValue(0.0f, &xj);
+        const int pcg = iu::solveCG(&A, &b, &xj, 2000, 1e-5f, true);
+        if (pcg <= 0 || pcg > cg || relativeResidual(&A, &b, &xj) > 1e-4)
+          return EXIT_FAILURE;
+
+        iu::LinearHostMemory_32f_C1 xb(n);
+        iu::setValue(0.0f, &xb);
+        const int bicg = iu::solveBiCGStab(&A, &b, &xb, 2000, 1e-5f);
+        if (bicg <= 0 || bicg >= 2000 || relativeResidual(&A, &b, &xb) > 1e-4)
+          return EXIT_FAILURE;
+
+        // the callback can stop the solver
+        CountIterations count;
+        iu::setValue(0.0f, &x);
+        if (iu::solveCG(&A, &b, &x, 2000, 1e-5f, false, &count) != 5 || count.calls != 5 ||
+            !(count.last > 1e-5f))
+          return EXIT_FAILURE;
+      }
+    }
+
+    // solvers on small systems with known solutions
+    {
+      std::cout << "testing sparse solvers on small systems on cpu ..." << std::endl;
+
+      const int n = 24;
+      std::vector<float> x_true(n);
+      for (int i = 0; i < n; ++i)
+        x_true[i] = (float)sin(0.7*i) + 0.05f*(float)i;
+
+      // SPD: 1D Laplacian with a varying diagonal shift and a symmetric long-range coupling
+      std::vector<float> spd(n*n, 0.0f);
+      for (int i = 0; i < n; ++i)
+      {
+        spd[i*n + i] = 2.5f + 0.25f*(float)(i % 3);
+        if (i > 0)
+          spd[i*n + i-1] = spd[(i-1)*n + i] = -1.0f;
+        if (i >= 6)
+          spd[i*n + i-6] = spd[(i-6)*n + i] = 0.2f;
+      }
+      // nonsymmetric: upwinded convection-diffusion with a one-sided long-range coupling
+      std::vector<float> nonsym(n*n, 0.0f);
+      for (int i = 0; i < n; ++i)
+      {
+        nonsym[i*n + i] = 3.0f;
+        if (i > 0)
+          nonsym[i*n + i-1] = -1.5f;
+        if (i < n-1)
+          nonsym[i*n + i+1] = -0.5f;
+        if (i+5 < n)
+          nonsym[i*n + i+5] = 0.4f;
+      }
+
+      iu::LinearHostMemory_32f_C1 xt(n);
+      for (int i = 0; i < n; ++i)
+        *xt.data(i) = x_true[i];
+
+      for (int system = 0; system < 2; ++system)
+      {
+        iu::SparseMatrixCpu<float>* A = denseToCsr(system == 0 ? spd : nonsym, n);
+        iu::LinearHostMemory_32f_C1 b(n);
+        iu::sparseMultiplication(A, &xt, &b);
+        iu::LinearHostMemory_32f_C1 x(n);
+
+        if (system == 0)
+        {
+          iu::setValue(0.0f, &x);
+          const int cg = iu::solveCG(A, &b, &x, 200, 1e-6f);
+          if (cg <= 0 || cg > n || maxDifference(&x, x_true) > 1e-4)
+            return EXIT_FAILURE;
+          iu::setValue(0.0f, &x);
+          const int pcg = iu::solveCG(A, &b, &x, 200, 1e-6f, true);
+          if (pcg <= 0 || pcg > n || maxDifference(&x, x_true) > 1e-4)
+            return EXIT_FAILURE;
+        }
+        iu::setValue(0.0f, &x);
+        const int bicg = iu::solveBiCGStab(A, &b, &x, 200, 1e-6f);
+        if (bicg <= 0 || bicg >= 200 || maxDifference(&x, x_true) > 1e-4)
+          return EXIT_FAILURE;
+
+        // a CSC matrix is solved on a copy and stays as it is
+        A->changeSparseFormat(CSC);
+        std::vector<int> csc_ptr(A->col()->data(), A->col()->data() + n+1);
+        std::vector<int> csc_ind(A->row()->data(), A->row()->data() + A->n_elements());
+        std::vector<float> csc_val(A->value()->data(), A->value()->data() + A->n_elements());
+        iu::setValue(0.0f, &x);
+        if (system == 0)
+          iu::solveCG(A, &b, &x, 200, 1e-6f, true);
+        else
+          iu::solveBiCGStab(A, &b, &x, 200, 1e-6f);
+        if (maxDifference(&x, x_true) > 1e-4 || A->sparseFormat() != CSC ||
+            A->n_elements() != (int)csc_val.size())
+          return EXIT_FAILURE;
+        for (int i = 0; i <= n; ++i)
+          if (A->col()->data()[i] != csc_ptr[i])
+            return EXIT_FAILURE;
+        for (size_t i = 0; i < csc_val.size(); ++i)
+          if (A->row()->data()[i] != csc_ind[i] || A->value()->data()[i] != csc_val[i])
+            return EXIT_FAILURE;
+        delete A;
+      }
+
+      // the Jacobi preconditioner rejects a zero on the diagonal (missing or stored)
+      for (int stored = 0; stored < 2; ++stored)
+      {
+        std::vector<float> dense(n*n, 0.0f);
+        for (int i = 0; i < n; ++i)
+        {
+          dense[i*n + i] = (i == n/2) ? 0.0f : 4.0f;
+          if (i > 0)
+            dense[i*n + i-1] = dense[(i-1)*n + i] = -1.0f;
+        }
+        iu::SparseMatrixCpu<float>* Z = denseToCsr(dense, n);
+        if (stored)
+        {
+          // +1 and -1 on the diagonal sum up to zero
+          iu::LinearHostMemory<int> ptr(*Z->row());
+          std::vector<int> ind;
+          std::vector<float> val;
+          for (int r = 0; r < n; ++r)
+          {
+            *ptr.data(r) = (int)val.size();
+            for (int k = Z->row()->data()[r]; k < Z->row()->data()[r+1]; ++k)
+            {
+              ind.push_back(Z->col()->data()[k]);
+              val.push_back(Z->value()->data()[k]);
+            }
+            if (r == n/2)
+            {
+              ind.push_back(r); val.push_back(1.0f);
+              ind.push_back(r); val.push_back(-1.0f);
+            }
+          }
+          *ptr.data(n) = (int)val.size();
+          iu::LinearHostMemory<int> ind_mem(&ind[0], ind.size());
+          iu::LinearHostMemory<float> val_mem(&val[0], val.size());
+          delete Z;
+          Z = new iu::SparseMatrixCpu<float>(&val_mem, &ptr, &ind_mem, n, n, CSR);
+        }
+        iu::LinearHostMemory_32f_C1 b(n);
+        iu::LinearHostMemory_32f_C1 x(n);
+        iu::setValue(1.0f, &b);
+        iu::setValue(0.0f, &x);
+        bool thrown = false;
+        try
+        {
+          iu::solveCG(Z, &b, &x, 200, 1e-6f, true);
+        }
+        catch (IuException&)
+        {
+          thrown = true;
+        }
+        delete Z;
+        if (!thrown)
+          return EXIT_FAILURE;
+      }
+    }
+
+    // Matrix Market and binary files
+    {
+      std::cout << "testing sparse matrix files on cpu ..." << std::endl;
+
+      // symmetric file with comments; the mirrored entries have to be added
+      const char* mtx_name = "iu_sparse_cpu_unittest.mtx";
+      FILE* f = fopen(mtx_name, "w");
+      fprintf(f, "%%%%MatrixMarket matrix coordinate real symmetric\n%% comment\n%%\n"
+                 "3 3 4\n1 1 2.5\n2 1 -1\n3 2 1e-1\n\n3 3 4.\n");
+      fclose(f);
+      iu::SparseMatrixCpu<float>* S = iu::readMatrixMarket(mtx_name);
+      const int s_ptr[4] = {0, 2, 4, 6};
+      const int s_ind[6] = {0, 1, 0, 2, 1, 2};
+      const float s_val[6] = {2.5f, -1.0f, -1.0f, 0.1f, 0.1f, 4.0f};
+      if (S->n_row() != 3 || S->n_col() != 3 || S->n_elements() != 6)
+        return EXIT_FAILURE;
+      for (int i = 0; i < 4; ++i)
+        if (S->row()->data()[i] != s_ptr[i])
+          return EXIT_FAILURE;
+      for (int i = 0; i < 6; ++i)
+        if (S->col()->data()[i] != s_ind[i] || S->value()->data()[i] != s_val[i])
+          return EXIT_FAILURE;
+      delete S;
+
+      // round trips of an operator through both formats
+      const int width = 59, height = 41;
+      const int n_row = 2*width*height, n_col = width*height;
+      std::vector<int> row, col;
+      std::vector<float> val;
+      gradientCoo(width, height, row, col, val);
+      for (size_t i = 0; i < val.size(); ++i)
+        val[i] *= 1.0f + 0.001f*(float)(i % 97);
+      iu::LinearHostMemory<int> coo_row(&row[0], row.size());
+      iu::LinearHostMemory<int> coo_col(&col[0], col.size());
+      iu::LinearHostMemory<float> coo_val(&val[0], val.size());
+      iu::LinearHostMemory<int> ptr(n_row+1);
+      iu::LinearHostMemory<int> ind(coo_val.length());
+      iu::LinearHostMemory<float> value(coo_val.length());
+      const unsigned int nnz = iu::convertCooToSparse(&coo_row, &coo_col, &coo_val, n_row, n_col, CSR,
+                                                      &ptr, &ind, &value);
+      iu::LinearHostMemory<int> ind_view(ind, 0, nnz);
+      iu::LinearHostMemory<float> value_view(value, 0, nnz);
+      iu::SparseMatrixCpu<float> G(&value_view, &ptr, &ind_view, n_row, n_col, CSR);
+
+      const char* bin_name = "iu_sparse_cpu_unittest.bin";
+      if (!iu::writeMatrixMarket(&G, mtx_name) || !iu::writeSparseBinary(&G, bin_name))
+        return EXIT_FAILURE;
+      iu::SparseMatrixCpu<float>* loaded[3] = {iu::readMatrixMarket(mtx_name),
+                                               iu::readSparseBinary(bin_name),
+                                               iu::readSparseBinary(bin_name, false)};
+      for (int m = 0; m < 3; ++m)
+      {
+        iu::SparseMatrixCpu<float>* L = loaded[m];
+        if (L->sparseFormat() != CSR || L->n_row() != n_row || L->n_col() != n_col ||
+            L->n_elements() != (int)nnz)
+          return EXIT_FAILURE;
+        for (int r = 0; r <= n_row; ++r)
+          if (L->row()->data()[r] != *ptr.data(r))
+            return EXIT_FAILURE;
+        for (unsigned int i = 0; i < nnz; ++i)
+          if (L->col()->data()[i] != *ind.data(i) || L->value()->data()[i] != *value.data(i))
+            return EXIT_FAILURE;
+        // the file buffers are replaced by conversions
+        L->changeSparseFormat(SELL);
+        delete L;
+      }
+
+      // lines with trailing fields are rejected, trailing blanks are not
+      const char* mtx_files[5] = {
+          "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 1 2.0 7\n",
+          "%%MatrixMarket matrix coordinate real general\n2 2 1 3\n1 1 2.0\n",
+          "%%MatrixMarket matrix coordinate pattern general\n2 2 1\n1 1 2\n",
+          "%%MatrixMarket matrix coordinate integer general\n2 2 1\n1 1 2 x\n",
+          "%%MatrixMarket matrix coordinate real general\n2 2 1 \t\r\n2 1 2.0  \r\n"};
+      for (int i = 0; i < 5; ++i)
+      {
+        f = fopen(mtx_name, "w");
+        fputs(mtx_files[i], f);
+        fclose(f);
+        if (readFails(mtx_name, false, false) != (i < 4))
+          return EXIT_FAILURE;
+      }
+
+      // corrupt binary files: offsets that overflow, a decreasing pointer array and
+      // indices outside the matrix
+      const long header_ind_offset = 56;
+      const long ptr_offset = 128;
+      const long ind_offset = (ptr_offset + 4*(n_row+1) + 63) / 64 * 64;
+      const uint64_t huge_offset = ~(uint64_t)63;
+      const int decreasing = *ptr.data(6) + 1;
+      const int outside[2] = {n_col, -1};
+      for (int corruption = 0; corruption < 4; ++corruption)
+      {
+        if (!iu::writeSparseBinary(&G, bin_name))
+          return EXIT_FAILURE;
+        if (readFails(bin_name, true, true))
+          return EXIT_FAILURE;
+        if (corruption == 0)
+          patchFile(bin_name, header_ind_offset, &huge_offset, sizeof(huge_offset));
+        else if (corruption == 1)
+          patchFile(bin_name, ptr_offset + 4*5, &decreasing, sizeof(int));
+        else
+          patchFile(bin_name, ind_offset + 4*(10 + 7*corruption), &outside[corruption-2], sizeof(int));
+        if (!readFails(bin_name, true, true) || !readFails(bin_name, true, false))
+          return EXIT_FAILURE;
+      }
+
+      remove(mtx_name);
+      remove(bin_name);
+    }
+  }
+  catch (IuException& e)
+  {
+    std::cout << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << std::endl;
+  std::cout << "**************************************************************************" << std::endl;
+  std::cout << "*  Everything seem to be ok. -- All assertions passed.                   *" << std::endl;
+  std::cout << "**************************************************************************" << std::endl;
+  std::cout << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) ICG. All rights reserved.
+ *
+ * Institute for Computer Graphics and Vision
+ * Graz University of Technology / Austria
+ *
+ *
+ * This software is distributed WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the above copyright notices for more information.
+ *
+ *
+ * Project     : ImageUtilities
+ * Module      : Unit Tests
+ * Class       : none
+ * Language    : C++
+ * Description : Unit tests for host geometric transformations
+ *
+ * Author     : Manuel Werlberger
+ * EMail      : werlberger@icg.tugraz.at
+ *
+ */
+
+// system includes
+#include <iostream>
+#include <math.h>
+#include <cuda_runtime.h>
+#include <iu/iucore.h>
+#include <iu/iucutil.h>
+#include <iu/iutransform.h>
+#include <iu/iufilter.h>
+
+int main(int argc, char** argv)
+{
+  std::cout << "Starting iu_transform_cpu_unittest ..." << std::endl;
+
+  IuSize sz(79,63);
+  IuSize sz_reduced(40,32);
+  IuSize sz_prolongated(158,126);
+
+  IuInterpolationType interpolations[4] = {IU_INTERPOLATE_NEAREST, IU_INTERPOLATE_LINEAR,
+                                           IU_INTERPOLATE_CUBIC, IU_INTERPOLATE_CUBIC_SPLINE};
+
+  // constant images have to stay constant for every interpolation type
+  {
+    std::cout << "testing reduce/prolongate of constant images on cpu ..." << std::endl;
+
+    iu::ImageCpu_32f_C1 im_32f_C1(sz);
+    iu::ImageCpu_32f_C4 im_32f_C4(sz);
+    float set_value_32f_C1 = 1.1f;
+    float4 set_value_32f_C4 = make_float4(1.1f, 2.2f, 3.3f, 4.4f);
+    iu::setValue(set_value_32f_C1, &im_32f_C1, im_32f_C1.roi());
+    iu::setValue(set_value_32f_C4, &im_32f_C4, im_32f_C4.roi());
+
+    for(int i=0; i<4; ++i)
+    {
+      iu::ImageCpu_32f_C1 reduced_32f_C1(sz_reduced);
+      iu::ImageCpu_32f_C4 reduced_32f_C4(sz_reduced);
+      iu::reduce(&im_32f_C1, &reduced_32f_C1, interpolations[i], true);
+      iu::reduce(&im_32f_C4, &reduced_32f_C4, interpolations[i], true);
+
+      for (unsigned int y = 0; y<sz_reduced.height; ++y)
+      {
+        for (unsigned int x = 0; x<sz_reduced.width; ++x)
+        {
+          if(fabs(*reduced_32f_C1.data(x,y) - set_value_32f_C1) > 1e-5f)
+            return EXIT_FAILURE;
+          if(fabs(reduced_32f_C4.data(x,y)->w - set_value_32f_C4.w) > 1e-5f)
+            return EXIT_FAILURE;
+        }
+      }
+
+      iu::ImageCpu_32f_C1 prolongated_32f_C1(sz_prolongated);
+      iu::prolongate(&im_32f_C1, &prolongated_32f_C1, interpolations[i]);
+      for (unsigned int y = 0; y<sz_prolongated.height; ++y)
+        for (unsigned int x = 0; x<sz_prolongated.width; ++x)
+          if(fabs(*prolongated_32f_C1.data(x,y) - set_value_32f_C1) > 1e-5f)
+            return EXIT_FAILURE;
+    }
+  }
+
+  // linear interpolation reproduces a horizontal ramp away from the border
+  {
+    std::cout << "testing linear reduction of a ramp on cpu ..." << std::endl;
+
+    iu::ImageCpu_32f_C1 ramp(sz);
+    for (unsigned int y = 0; y<sz.height; ++y)
+      for (unsigned int x = 0; x<sz.width; ++x)
+        *ramp.data(x,y) = x + 0.5f;
+
+    iu::ImageCpu_32f_C1 reduced(sz_reduced);
+    iu::reduce(&ramp, &reduced, IU_INTERPOLATE_LINEAR, false);
+    float x_factor = (float)sz.width/(float)sz_reduced.width;
+    for (unsigned int y = 0; y<sz_reduced.height; ++y)
+    {
+      for (unsigned int x = 1; x<sz_reduced.width-1; ++x)
+      {
+        if(fabs(*reduced.data(x,y) - (x+0.5f)*x_factor) > 1e-4f)
+          return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // the fused gaussian pre-smoothing has to match filtering first and sampling then
+  // (as on the device), in particular for the border pixels; a mild reduction keeps
+  // the smoothing wide enough to tell the border handling apart
+  {
+    std::cout << "testing gauss pre-filtered reduction at the image border on cpu ..." << std::endl;
+
+    IuSize sz_mild(71,57);
+    iu::ImageCpu_32f_C1 im(sz);
+    for (unsigned int y = 0; y<sz.height; ++y)
+      for (unsigned int x = 0; x<sz.width; ++x)
+        *im.data(x,y) = sinf(0.5f*x) + 0.1f*x + cosf(0.3f*y);
+
+    float x_factor = (float)sz_mild.width/(float)sz.width;
+    float y_factor = (float)sz_mild.height/(float)sz.height;
+    float sigma = 0.3f * sqrtf(0.5f*(x_factor+y_factor));
+    iu::ImageCpu_32f_C1 filtered(sz);
+    iu::filterGauss(&im, &filtered, im.roi(), sigma, 5);
+
+    for(int i=0; i<4; ++i)
+    {
+      iu::ImageCpu_32f_C1 reduced(sz_mild);
+      iu::ImageCpu_32f_C1 reference(sz_mild);
+      iu::reduce(&im, &reduced, interpolations[i], true, false);
+      iu::reduce(&filtered, &reference, interpolations[i], false, false);
+
+      for (unsigned int y = 0; y<sz_mild.height; ++y)
+        for (unsigned int x = 0; x<sz_mild.width; ++x)
+          if(fabs(*reduced.data(x,y) - *reference.data(x,y)) > 1e-5f)
+            return EXIT_FAILURE;
+    }
+  }
+
+  // bspline coefficients have to reproduce the samples with cubic spline interpolation
+  {
+    std::cout << "testing cubicBSplinePrefilter on cpu ..." << std::endl;
+
+    iu::ImageCpu_32f_C1 im(sz);
+    iu::ImageCpu_32f_C4 im_C4(sz);
+    for (unsigned int y = 0; y<sz.height; ++y)
+    {
+      for (unsigned int x = 0; x<sz.width; ++x)
+      {
+        *im.data(x,y) = sinf(0.3f*x) + cosf(0.2f*y);
+        *im_C4.data(x,y) = make_float4(*im.data(x,y), -*im.data(x,y), 0.5f, 1.0f);
+      }
+    }
+
+    iu::ImageCpu_32f_C1 coeffs(im);
+    iu::ImageCpu_32f_C4 coeffs_C4(im_C4);
+    iu::cubicBSplinePrefilter(&coeffs);
+    iu::cubicBSplinePrefilter(&coeffs_C4);
+
+    iu::ImageCpu_32f_C1 reconstructed(sz);
+    iu::ImageCpu_32f_C4 reconstructed_C4(sz);
+    iu::prolongate(&coeffs, &reconstructed, IU_INTERPOLATE_CUBIC_SPLINE);
+    iu::prolongate(&coeffs_C4, &reconstructed_C4, IU_INTERPOLATE_CUBIC_SPLINE);
+
+    for (unsigned int y = 1; y<sz.height-1; ++y)
+    {
+      for (unsigned int x = 1; x<sz.width-1; ++x)
+      {
+        if(fabs(*reconstructed.data(x,y) - *im.data(x,y)) > 1e-4f)
+          return EXIT_FAILURE;
+        if(fabs(reconstructed_C4.data(x,y)->y - im_C4.data(x,y)->y) > 1e-4f)
+          return EXIT_FAILURE;
+        if(fabs(reconstructed_C4.data(x,y)->w - 1.0f) > 1e-4f)
+          return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // remapping with the compact maps has to match the float maps up to the 1/32 pixel quantization
+  {
+    std::cout << "testing remap with compact maps on cpu ..." << std::endl;
+
+    IuSize sz_remap(97,61);
+    iu::ImageCpu_32f_C1 im(sz_remap);
+    iu::ImageCpu_32f_C1 dx(sz_remap);
+    iu::ImageCpu_32f_C1 dy(sz_remap);
+    for (unsigned int y = 0; y<sz_remap.height; ++y)
+    {
+      for (unsigned int x = 0; x<sz_remap.width; ++x)
+      {
+        *im.data(x,y) = 0.5f + 0.4f*sinf(0.13f*x)*cosf(0.17f*y);
+        *dx.data(x,y) = 2.3f*sinf(0.05f*y) - 1.1f;
+        *dy.data(x,y) = 1.7f*cosf(0.04f*x) + 0.6f;
+      }
+    }
+
+    iu::ImageCpu_16u_C2 coords(sz_remap);
+    iu::ImageCpu_16u_C1 fractions(sz_remap);
+    iu::convertRemapMaps(&dx, &dy, &coords, &fractions);
+    iu::ImageCpu_32f_C1 warped(sz_remap);
+    iu::ImageCpu_32f_C1 warped_compact(sz_remap);
+    for (int i = 0; i<2; ++i)
+    {
+      IuInterpolationType interpolation = (i == 0) ? IU_INTERPOLATE_LINEAR : IU_INTERPOLATE_CUBIC;
+      iu::remap(&im, &dx, &dy, &warped, interpolation);
+      iu::remap(&im, &coords, &fractions, &warped_compact, interpolation);
+      for (unsigned int y = 0; y<sz_remap.height; ++y)
+      {
+        for (unsigned int x = 0; x<sz_remap.width; ++x)
+        {
+          if(fabs(*warped.data(x,y) - *warped_compact.data(x,y)) > 5e-3f)
+            return EXIT_FAILURE;
+        }
+      }
+    }
+
+    // maps of another size than the destination are rejected
+    iu::ImageCpu_32f_C1 dx_small(IuSize(sz_remap.width-1, sz_remap.height));
+    bool thrown = false;
+    try { iu::remap(&im, &dx_small, &dy, &warped, IU_INTERPOLATE_LINEAR); }
+    catch (IuException&) { thrown = true; }
+    if(!thrown)
+      return EXIT_FAILURE;
+  }
+
+  // warps with integer translations have to shift the image exactly
+  {
+    std::cout << "testing warpAffine/warpPerspective on cpu ..." << std::endl;
+
+    IuSize sz_warp(67,45);
+    iu::ImageCpu_32f_C1 im(sz_warp);
+    for (unsigned int y = 0; y<sz_warp.height; ++y)
+      for (unsigned int x = 0; x<sz_warp.width; ++x)
+        *im.data(x,y) = 0.5f + 0.4f*sinf(0.13f*x)*cosf(0.17f*y);
+
+    const float affine[6] = {1.0f, 0.0f, 3.0f, 0.0f, 1.0f, -2.0f};
+    const float perspective[9] = {2.0f, 0.0f, 6.0f, 0.0f, 2.0f, -4.0f, 0.0f, 0.0f, 2.0f};
+    iu::ImageCpu_32f_C1 warped(sz_warp);
+    iu::ImageCpu_32f_C1 warped_perspective(sz_warp);
+    for (int i = 0; i<3; ++i)
+    {
+      IuInterpolationType interpolation = (i == 0) ? IU_INTERPOLATE_NEAREST :
+                                          ((i == 1) ? IU_INTERPOLATE_LINEAR : IU_INTERPOLATE_CUBIC);
+      iu::warpAffine(&im, &warped, affine, interpolation);
+      iu::warpPerspective(&im, &warped_perspective, perspective, interpolation);
+      for (unsigned int y = 0; y<sz_warp.height; ++y)
+      {
+        for (unsigned int x = 0; x<sz_warp.width; ++x)
+        {
+          // pixels mapped outside of the source are 0; the cubic bspline smooths inside
+          const bool inside = (x+3 < sz_warp.width) && (y >= 2);
+          if((!inside || i < 2) &&
+             fabs(*warped.data(x,y) - (inside ? *im.data(x+3,y-2) : 0.0f)) > 1e-5f)
+            return EXIT_FAILURE;
+          if(fabs(*warped_perspective.data(x,y) - *warped.data(x,y)) > 1e-5f)
+            return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+
+  // a translated smooth pattern has to give the (constant) translation as flow
+  {
+    std::cout << "testing opticalFlowTVL1 on cpu ..." << std::endl;
+
+    IuSize sz_flow(160,120);
+    const float u = 4.6f;
+    const float v = -2.3f;
+    iu::ImageCpu_32f_C1 i0(sz_flow);
+    iu::ImageCpu_32f_C1 i1(sz_flow);
+    for (unsigned int y = 0; y<sz_flow.height; ++y)
+    {
+      for (unsigned int x = 0; x<sz_flow.width; ++x)
+      {
+        *i0.data(x,y) = 0.5f + 0.12f*(sinf(0.11f*x) + sinf(0.07f*y) + sinf(0.23f*x-0.17f*y));
+        *i1.data(x,y) = 0.5f + 0.12f*(sinf(0.11f*(x-u)) + sinf(0.07f*(y-v)) + sinf(0.23f*(x-u)-0.17f*(y-v)));
+      }
+    }
+
+    iu::ImageCpu_32f_C2 flow(sz_flow);
+    iu::opticalFlowTVL1(&i0, &i1, &flow);
+    for (unsigned int y = 16; y<sz_flow.height-16; ++y)
+    {
+      for (unsigned int x = 16; x<sz_flow.width-16; ++x)
+      {
+        if(fabs(flow.data(x,y)->x - u) > 0.1f || fabs(flow.data(x,y)->y - v) > 0.1f)
+          return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // images at or below the coarsest pyramid size are solved on one level
+  {
+    std::cout << "testing opticalFlowTVL1 on small images on cpu ..." << std::endl;
+
+    const IuSize sizes[5] = {IuSize(8,8), IuSize(12,12), IuSize(16,16), IuSize(1,1), IuSize(3,17)};
+    const float scales[5] = {0.5f, 0.8f, 0.5f, 0.5f, 0.8f};
+    for (int i = 0; i < 5; ++i)
+    {
+      iu::ImageCpu_32f_C1 i0(sizes[i]);
+      iu::ImageCpu_32f_C1 i1(sizes[i]);
+      for (unsigned int y = 0; y<sizes[i].height; ++y)
+      {
+        for (unsigned int x = 0; x<sizes[i].width; ++x)
+        {
+          *i0.data(x,y) = 0.5f + 0.2f*sinf(0.7f*x + 0.3f*y);
+          *i1.data(x,y) = 0.5f + 0.2f*sinf(0.7f*(x-0.5f) + 0.3f*y);
+        }
+      }
+
+      // identical images give zero flow, shifted ones a finite flow
+      iu::ImageCpu_32f_C2 flow(sizes[i]);
+      iu::opticalFlowTVL1(&i0, &i0, &flow, 40.0f, 0.3f, 5, scales[i], 2, 20);
+      for (unsigned int y = 0; y<sizes[i].height; ++y)
+        for (unsigned int x = 0; x<sizes[i].width; ++x)
+          if(fabs(flow.data(x,y)->x) > 1e-5f || fabs(flow.data(x,y)->y) > 1e-5f)
+            return EXIT_FAILURE;
+      iu::opticalFlowTVL1(&i0, &i1, &flow, 40.0f, 0.3f, 5, scales[i], 2, 20);
+      for (unsigned int y = 0; y<sizes[i].height; ++y)
+        for (unsigned int x = 0; x<sizes[i].width; ++x)
+          if(!(fabs(flow.data(x,y)->x) < 10.0f) || !(fabs(flow.data(x,y)->y) < 10.0f))
+            return EXIT_FAILURE;
+    }
+  }
+
+  // a translated textured pattern has to give the translation as disparity
+  {
+    std::cout << "testing stereo matching on cpu ..." << std::endl;
+
+    IuSize sz_stereo(120,80);
+    const unsigned int disparity = 7;
+    iu::ImageCpu_32f_C1 left(sz_stereo);
+    iu::ImageCpu_32f_C1 right(sz_stereo);
+    for (unsigned int y = 0; y<sz_stereo.height; ++y)
+    {
+      for (unsigned int x = 0; x<sz_stereo.width; ++x)
+      {
+        *left.data(x,y) = 0.5f + 0.12f*(sinf(0.31f*x) + sinf(0.27f*y) + sinf(0.43f*x-0.37f*y));
+        *right.data(x,y) = 0.5f + 0.12f*(sinf(0.31f*(x+disparity)) + sinf(0.27f*y) +
+                                         sinf(0.43f*(x+disparity)-0.37f*y));
+      }
+    }
+
+    iu::VolumeCpu_8u_C1 costs(32, sz_stereo.width, sz_stereo.height);
+    iu::VolumeCpu_16u_C1 aggregated(32, sz_stereo.width, sz_stereo.height);
+    iu::ImageCpu_32f_C1 disparities(sz_stereo);
+    for (int cost = 0; cost<2; ++cost)
+    {
+      iu::stereoCostVolume(&left, &right, &costs, cost == 0 ? IU_STEREO_CENSUS : IU_STEREO_SAD);
+      iu::stereoAggregateSGM(&costs, &aggregated);
+      iu::stereoDisparityWTA(&aggregated, &disparities);
+      for (unsigned int y = 3; y<sz_stereo.height-3; ++y)
+      {
+        for (unsigned int x = 32; x<sz_stereo.width-3; ++x)
+        {
+          if(fabs(*disparities.data(x,y) - disparity) > 0.5f)
+            return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+
+  std::cout << std::endl;
+  std::cout << "**************************************************************************" << std::endl;
+  std::cout << "*  Everything seem to be ok. -- All assertions passed.                   *" << std::endl;
+  std::cout << "**************************************************************************" << std::endl;
+  std::cout << std::endl;
+
+  return EXIT_SUCCESS;
+}